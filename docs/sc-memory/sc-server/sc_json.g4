@@ -288,6 +288,7 @@ sc_json_command_template_payload
         '{'
             (SC_ALIAS ':' (SC_ADDR_HASH | SC_ALIAS) ',')*
         '}' ','
+        ('"profile"' ':' BOOL ',')?
     '}' ','
   ;
 
@@ -308,9 +309,30 @@ sc_json_command_answer_search_template
         '{'
             (SC_ALIAS ':' NUMBER ',')*
         '}' ','
+        ('"profile"' ':' sc_json_template_search_profile ',')?
     '}' ','
   ;
 
+sc_json_template_search_profile
+  : '{'
+        '"algorithm"' ':' ('"dependence"' | '"join"') ','
+        '"order"' ':' '[' (NUMBER ',')* ']' ','
+        '"time"' ':' NUMBER ','
+        '"triples"' ':'
+        '['
+            ('{'
+                '"index"' ':' NUMBER ','
+                '"iterators"' ':' NUMBER ','
+                '"visited"' ':' NUMBER ','
+                '"rejectedByBinding"' ':' NUMBER ','
+                '"rejectedByUsedConnector"' ':' NUMBER ','
+                '"rejectedByStructure"' ':' NUMBER ','
+                '"time"' ':' NUMBER ','
+            '}' ',')*
+        ']' ','
+    '}'
+  ;
+
 sc_json_command_generate_template
   : '"type"' ':' '"generate_template"' ','
     sc_json_command_template_payload
@@ -8,6 +8,7 @@
 #define _sc_condition_h_
 
 #include "sc-core/sc_defines.h"
+#include "sc-core/sc_types.h"
 
 typedef struct _sc_condition sc_condition;
 typedef struct _sc_mutex sc_mutex;
@@ -16,6 +17,11 @@ _SC_EXTERN void sc_cond_init(sc_condition * condition);
 
 _SC_EXTERN void sc_cond_wait(sc_condition * condition, sc_mutex * mutex);
 
+/*! Waits for condition until monotonic time (in microseconds) reaches \p end_time.
+ * @returns SC_FALSE if \p end_time passed, otherwise SC_TRUE.
+ */
+_SC_EXTERN sc_bool sc_cond_wait_until(sc_condition * condition, sc_mutex * mutex, sc_int64 end_time);
+
 _SC_EXTERN void sc_cond_signal(sc_condition * condition);
 
 _SC_EXTERN void sc_cond_broadcast(sc_condition * condition);
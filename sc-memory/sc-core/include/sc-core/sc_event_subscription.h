@@ -27,6 +27,18 @@ typedef sc_result (*sc_event_callback_with_user)(
     sc_type connector_type,
     sc_addr other_addr);
 
+/*! Callback function type of global sc-event subscription.
+ * It takes the same parameters as `sc_event_callback_with_user` and
+ * @param subscription_addr A sc-address of sc-element for which sc-event was emitted.
+ */
+typedef sc_result (*sc_event_global_callback)(
+    sc_event_subscription const * event_subscription,
+    sc_addr user_addr,
+    sc_addr subscription_addr,
+    sc_addr connector_addr,
+    sc_type connector_type,
+    sc_addr other_addr);
+
 /// Backward compatibility
 typedef sc_result (*sc_event_callback_ext)(
     sc_event_subscription const * event_subscription,
@@ -87,6 +99,30 @@ _SC_EXTERN sc_event_subscription * sc_event_subscription_with_user_new(
     sc_event_callback_with_user callback,
     sc_event_subscription_delete_function delete_callback);
 
+/*! Subscribe for events of the specified type from all sc-elements.
+ * @param ctx A sc-memory context used to create sc-event subscription.
+ * @param event_type_addr Type of listening sc-events.
+ * @param event_element_type Type of connector to be involved in event.
+ * @param set_addr A sc-address of set which sc-elements of emitted sc-events should belong to (via constant permanent
+ * positive sc-arcs). If it is empty, then sc-events of all sc-elements are listened.
+ * @param data Pointer to user data.
+ * @param callback Pointer to callback function. It would be calls, when event emitted.
+ * @param delete_callback Pointer to callback function, that calls on sc-event subscription destruction.
+ * @return Returns pointer to generated sc-event subscription.
+ * @remarks Global sc-event subscriptions are found by type of emitted sc-event, so their cost doesn't depend on count
+ * of listened sc-elements. Belonging to set is checked in worker thread before callback is called, because sc-elements
+ * of emitted sc-event are locked during emission.
+ * @remarks Callback functions can be called from any thread, so they need to be a thread safe.
+ */
+_SC_EXTERN sc_event_subscription * sc_event_global_subscription_new(
+    sc_memory_context const * ctx,
+    sc_event_type event_type_addr,
+    sc_type event_element_type,
+    sc_addr set_addr,
+    sc_pointer data,
+    sc_event_global_callback callback,
+    sc_event_subscription_delete_function delete_callback);
+
 /*! Destroys the specified sc-event subscription.
  * @param event_subscription Pointer to the sc-event subscription to be destroyed.
  * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_NO otherwise.
@@ -99,6 +135,51 @@ _SC_EXTERN sc_result sc_event_subscription_destroy(sc_event_subscription * event
  */
 _SC_EXTERN sc_bool sc_event_subscription_is_deletable(sc_event_subscription const * event_subscription);
 
+/*! Sets priority of processing sc-events of the specified sc-event subscription.
+ * @param event_subscription Pointer to the sc-event subscription.
+ * @param priority Priority of processing sc-events. Sc-events with high priority are processed before queued sc-events
+ * with normal priority. By default, priority is SC_EVENT_PRIORITY_NORMAL.
+ * @note It affects only sc-events emitted after this call.
+ */
+_SC_EXTERN void sc_event_subscription_set_priority(
+    sc_event_subscription * event_subscription,
+    sc_event_priority priority);
+
+/*! Gets priority of processing sc-events of the specified sc-event subscription.
+ * @param event_subscription Pointer to the sc-event subscription.
+ * @return Returns priority of processing sc-events.
+ */
+_SC_EXTERN sc_event_priority sc_event_subscription_get_priority(sc_event_subscription const * event_subscription);
+
+/*! Gets latencies of sc-events processed by the specified sc-event subscription.
+ * @param event_subscription Pointer to the sc-event subscription.
+ * @param stat Pointer to the statistics to be filled. Latencies are measured in microseconds.
+ * @note Only sc-events that were processed by callbacks of the sc-event subscription are counted.
+ */
+_SC_EXTERN void sc_event_subscription_get_latency_stat(
+    sc_event_subscription const * event_subscription,
+    sc_events_latency_stat * stat);
+
+/*! Gets index of bucket of histogram of latencies that counts the specified value.
+ * @param value A value of latency.
+ * @return Returns index of bucket in range [0, SC_LATENCY_HISTOGRAM_BUCKETS_COUNT).
+ */
+_SC_EXTERN sc_uint32 sc_latency_histogram_get_bucket_index(sc_uint64 value);
+
+/*! Adds values of one histogram of latencies to another.
+ * @param histogram Pointer to the histogram to be updated.
+ * @param other Pointer to the histogram to be added.
+ */
+_SC_EXTERN void sc_latency_histogram_merge(sc_latency_histogram * histogram, sc_latency_histogram const * other);
+
+/*! Gets estimation of percentile of latencies from histogram.
+ * @param histogram Pointer to the histogram of latencies.
+ * @param percentile Percentile in range [0, 100].
+ * @return Returns upper bound of bucket that contains the percentile, but not greater than max latency. If histogram is
+ * empty, then returns 0.
+ */
+_SC_EXTERN sc_uint64 sc_latency_histogram_get_percentile(sc_latency_histogram const * histogram, sc_float percentile);
+
 /*! Gets the user-defined data associated with the specified sc-event subscription.
  * @param event_subscription Pointer to the sc-event subscription.
  * @return Returns a pointer to the user-defined data.
@@ -113,7 +194,7 @@ _SC_EXTERN sc_addr sc_event_subscription_get_event_type(sc_event_subscription co
 
 /*! Gets the sc-address of the subscription sc-element for the specified sc-event subscription.
  * @param event_subscription Pointer to the sc-event subscription.
- * @return Returns the sc-address of the subscription sc-element.
+ * @return Returns the sc-address of the subscription sc-element. It is empty for global sc-event subscription.
  */
 _SC_EXTERN sc_addr sc_event_subscription_get_element(sc_event_subscription const * event_subscription);
 
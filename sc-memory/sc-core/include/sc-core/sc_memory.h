@@ -137,6 +137,20 @@ _SC_EXTERN sc_addr sc_memory_context_get_user_addr(sc_memory_context * ctx);
  */
 _SC_EXTERN void sc_memory_context_pending_begin(sc_memory_context * ctx);
 
+/*!
+ * @brief Starts events pending mode for a context, optionally coalescing redundant events.
+ *
+ * In this mode, all new emitted events will be pending until `sc_memory_context_pending_end` is called. If
+ * \p is_coalescing is SC_TRUE, then events of sc-connectors that were generated and erased in this mode aren't emitted
+ * at all, these sc-connectors are just erased when the mode ends.
+ *
+ * @param ctx Pointer to the sc-memory context.
+ * @param is_coalescing Flag indicating whether redundant events are dropped.
+ *
+ * @see sc_memory_context_pending_end
+ */
+_SC_EXTERN void sc_memory_context_pending_begin_ext(sc_memory_context * ctx, sc_bool is_coalescing);
+
 /*!
  * @brief Ends events pending mode for a context.
  *
@@ -174,6 +188,20 @@ _SC_EXTERN void sc_memory_context_blocking_begin(sc_memory_context * ctx);
  */
 _SC_EXTERN void sc_memory_context_blocking_end(sc_memory_context * ctx);
 
+/*!
+ * @brief Checks if a context is in events pending mode.
+ * @param ctx Pointer to the sc-memory context.
+ * @return Returns SC_TRUE if sc-events emitted by the context are pending; otherwise, returns SC_FALSE.
+ */
+_SC_EXTERN sc_bool sc_memory_context_are_events_pending(sc_memory_context const * ctx);
+
+/*!
+ * @brief Checks if a context is in events blocking mode.
+ * @param ctx Pointer to the sc-memory context.
+ * @return Returns SC_TRUE if sc-events emitted by the context are blocked; otherwise, returns SC_FALSE.
+ */
+_SC_EXTERN sc_bool sc_memory_context_are_events_blocking(sc_memory_context const * ctx);
+
 /*!
  * @brief Checks if sc-memory is initialized.
  *
@@ -891,6 +919,97 @@ _SC_EXTERN sc_result sc_memory_find_links_contents_by_content_substring_ext(
  */
 _SC_EXTERN sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * stat);
 
+/*!
+ * @brief Retrieves statistics of queues of emitted sc-events.
+ *
+ * Statistics include numbers of queued and spilled sc-events of each priority, number of sc-events dropped and number
+ * of emissions blocked because queue was full.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_events_queue_stat` structure where the statistics will be stored.
+ *             It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_events_queue_stat(sc_memory_context const * ctx, sc_events_queue_stat * stat);
+
+/*!
+ * @brief Retrieves histograms of latencies of processed sc-events.
+ *
+ * Statistics include histogram of times from emission of sc-events to start of their processing and histogram of times
+ * of processing of sc-events by callbacks of sc-event subscriptions. Latencies are measured in microseconds. Use
+ * `sc_latency_histogram_get_percentile` to get percentiles of latencies.
+ *
+ * @param ctx A pointer to the sc-memory context that manages the operation.
+ * @param stat Pointer to the `sc_events_latency_stat` structure where the statistics will be stored.
+ *             It should be pre-allocated by the caller.
+ *
+ * @return Returns the result of the operation. If successful, it returns SC_RESULT_OK.
+ * @note This function is thread-safe.
+ *
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHORIZED The specified sc-memory context is not authorized.
+ * @retval SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS The specified sc-memory context does not have read
+ * permissions.
+ */
+_SC_EXTERN sc_result sc_memory_events_latency_stat(sc_memory_context const * ctx, sc_events_latency_stat * stat);
+
+/*!
+ * @brief Marks that current thread starts waiting in wait point, for example, for finish of action.
+ *
+ * If current thread is worker thread processing sc-events and pool of worker threads is adaptive, then another worker
+ * thread may be started, so sc-events aren't starved while this thread is blocked.
+ *
+ * @note Calls may be nested, each call must be paired with the call of `sc_memory_wait_point_end`.
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN void sc_memory_wait_point_begin();
+
+/*!
+ * @brief Marks that current thread stops waiting in wait point.
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN void sc_memory_wait_point_end();
+
+/*!
+ * @brief Callback of task posted to pool of worker threads processing sc-events.
+ * @param data An argument passed when task was posted.
+ * @param is_cancelled SC_TRUE if sc-memory is being shut down. Task should release \p data and not access sc-memory.
+ */
+typedef void (*sc_memory_task_callback)(sc_pointer data, sc_bool is_cancelled);
+
+/*!
+ * @brief Posts task to pool of worker threads processing sc-events.
+ *
+ * Task is queued with sc-events of normal priority and called by one of worker threads. Tasks are never dropped by
+ * overflow policy of queue of sc-events, and tasks posted before sc-memory shutdown are called before it finishes.
+ *
+ * @param callback A callback of task.
+ * @param data An argument of callback.
+ *
+ * @return Returns SC_RESULT_OK if task is queued. If sc-memory isn't initialized or is being shut down, then it returns
+ * SC_RESULT_ERROR and callback isn't called, so caller should call it or release \p data itself.
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN sc_result sc_memory_post_task(sc_memory_task_callback callback, sc_pointer data);
+
+//! Callback called after sc-memory statistics are dumped by period.
+typedef void (*sc_memory_statistics_dump_callback)();
+
+/*!
+ * @brief Sets callback that dumps additional statistics after sc-memory statistics are dumped by period.
+ *
+ * Callback is called in thread of timer of statistics dumps, if `dump_memory_statistics` is turned on.
+ *
+ * @param callback A callback to be called, or null_ptr to unset callback.
+ * @note This function is thread-safe.
+ */
+_SC_EXTERN void sc_memory_set_statistics_dump_callback(sc_memory_statistics_dump_callback callback);
+
 /*!
  * @brief Saves the current state of the sc-storage to persistent storage.
  *
@@ -14,6 +14,9 @@
 #define DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES SC_TRUE
 #define DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS 32
 #define DEFAULT_MIN_EVENTS_AND_AGENTS_THREADS 1
+#define DEFAULT_ADAPTIVE_EVENTS_AND_AGENTS_THREADS SC_FALSE
+#define DEFAULT_MAX_EVENTS_QUEUE_SIZE 0
+#define DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY "Spill"
 #define DEFAULT_DUMP_MEMORY SC_TRUE
 #define DEFAULT_DUMP_MEMORY_PERIOD 32000
 #define DEFAULT_DUMP_MEMORY_STATISTICS SC_TRUE
@@ -46,6 +49,14 @@ typedef struct
   ///< Boolean indicating whether sc-memory limit `max_events_and_agents_threads` by maximum physical core number.
   sc_bool limit_max_threads_by_max_physical_cores;
   sc_uint32 max_events_and_agents_threads;  ///< Maximum number of threads for events and agents processing.
+  sc_uint32 min_events_and_agents_threads;  ///< Minimum number of threads for events and agents processing.
+  ///< Boolean indicating whether number of threads for events and agents processing changes between
+  ///< `min_events_and_agents_threads` and `max_events_and_agents_threads` depending on load. By default, it is SC_FALSE.
+  sc_bool adaptive_events_and_agents_threads;
+  ///< Maximum number of queued sc-events of each priority. If it is 0, then it equals to capacity of lock-free lanes.
+  sc_uint32 max_events_queue_size;
+  ///< Policy applied to emitted sc-event when queue is full ("Spill", "Block" or "DropOldest").
+  sc_char const * events_queue_overflow_policy;
 
   ///< Boolean indicating whether automatic saving of sc-memory state. By default, it is SC_TRUE.
   sc_bool dump_memory;
@@ -233,6 +233,7 @@ typedef sc_uint16 sc_states;
 #  define SC_STATE_REQUEST_ERASURE 0x1
 #  define SC_STATE_IS_ERASABLE 0x200
 #  define SC_STATE_ELEMENT_EXIST 0x2
+#  define SC_STATE_HAS_SUBSCRIPTIONS 0x400
 
 // results
 enum _sc_result
@@ -276,6 +277,48 @@ struct _sc_stat
   sc_uint64 link_count;       // amount of all sc-links stored in memory
 };
 
+// priorities of processing emitted sc-events
+enum _sc_event_priority
+{
+  SC_EVENT_PRIORITY_NORMAL = 0,  // sc-events are processed after all queued sc-events with high priority
+  SC_EVENT_PRIORITY_HIGH,        // sc-events are processed before queued sc-events with normal priority
+
+  SC_EVENT_PRIORITY_COUNT,  // number of priorities
+};
+
+// structure to store statistics of queue of emitted sc-events
+struct _sc_events_queue_stat
+{
+  sc_uint32 queued_events_count[SC_EVENT_PRIORITY_COUNT];   // amount of sc-events waiting for processing
+  sc_uint32 spilled_events_count[SC_EVENT_PRIORITY_COUNT];  // amount of queued sc-events that didn't fit in lanes
+  sc_uint64 dropped_events_count;  // amount of sc-events dropped because queue was full
+  sc_uint64 blocked_pushes_count;  // amount of pushes that waited for free place in queue
+
+  sc_uint32 workers_count;           // amount of worker threads processing sc-events
+  sc_uint32 sleeping_workers_count;  // amount of worker threads waiting for sc-events
+  sc_uint32 blocked_workers_count;   // amount of worker threads blocked in wait points
+  sc_uint64 grown_workers_count;     // amount of worker threads started by adaptive pool
+  sc_uint64 shrunk_workers_count;    // amount of worker threads stopped by adaptive pool
+};
+
+#define SC_LATENCY_HISTOGRAM_BUCKETS_COUNT 128
+
+// histogram of latencies in microseconds, values less than 8 have own buckets, each next power of two is split into
+// 4 buckets, so relative error of percentiles is not greater than 25%
+struct _sc_latency_histogram
+{
+  sc_uint32 buckets[SC_LATENCY_HISTOGRAM_BUCKETS_COUNT];  // amounts of values in buckets
+  sc_uint64 count;                                        // amount of values
+  sc_uint64 max;                                          // max value
+};
+
+// structure to store latencies of processing of emitted sc-events
+struct _sc_events_latency_stat
+{
+  struct _sc_latency_histogram queue_latency;       // time from emission of sc-events to start of their processing
+  struct _sc_latency_histogram execution_duration;  // time of processing of sc-events by callbacks
+};
+
 #endif
 
 typedef struct _sc_arc sc_arc;
@@ -294,3 +337,7 @@ typedef struct _sc_iterator5 sc_iterator5;
 typedef struct _sc_event_subscription sc_event_subscription;
 typedef enum _sc_result sc_result;
 typedef struct _sc_stat sc_stat;
+typedef enum _sc_event_priority sc_event_priority;
+typedef struct _sc_events_queue_stat sc_events_queue_stat;
+typedef struct _sc_latency_histogram sc_latency_histogram;
+typedef struct _sc_events_latency_stat sc_events_latency_stat;
@@ -18,6 +18,11 @@ void sc_cond_wait(sc_condition * condition, sc_mutex * mutex)
   g_cond_wait(&condition->instance, &mutex->instance);
 }
 
+sc_bool sc_cond_wait_until(sc_condition * condition, sc_mutex * mutex, sc_int64 end_time)
+{
+  return g_cond_wait_until(&condition->instance, &mutex->instance, end_time);
+}
+
 void sc_cond_signal(sc_condition * condition)
 {
   g_cond_signal(&condition->instance);
@@ -0,0 +1,103 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_event_latency.h"
+
+#include <glib.h>
+
+#include "sc-core/sc_event_subscription.h"
+
+#define SC_LATENCY_EXACT_BUCKETS_COUNT 8  // values less than it have own buckets
+#define SC_LATENCY_SUB_BUCKETS_BITS 2     // each power of two is split into 4 buckets
+#define SC_LATENCY_SUB_BUCKETS_COUNT (1 << SC_LATENCY_SUB_BUCKETS_BITS)
+#define SC_LATENCY_EXACT_BUCKETS_BITS 3
+
+sc_uint32 sc_latency_histogram_get_bucket_index(sc_uint64 value)
+{
+  if (value < SC_LATENCY_EXACT_BUCKETS_COUNT)
+    return (sc_uint32)value;
+
+  sc_uint32 const exponent = g_bit_storage(value) - 1;
+  sc_uint32 const sub_bucket = (value >> (exponent - SC_LATENCY_SUB_BUCKETS_BITS)) & (SC_LATENCY_SUB_BUCKETS_COUNT - 1);
+  sc_uint32 const index = SC_LATENCY_EXACT_BUCKETS_COUNT
+                          + (exponent - SC_LATENCY_EXACT_BUCKETS_BITS) * SC_LATENCY_SUB_BUCKETS_COUNT + sub_bucket;
+  return sc_min(index, SC_LATENCY_HISTOGRAM_BUCKETS_COUNT - 1);
+}
+
+//! Gets the greatest value counted in bucket with specified index.
+sc_uint64 _sc_latency_histogram_get_bucket_upper_bound(sc_uint32 index)
+{
+  if (index < SC_LATENCY_EXACT_BUCKETS_COUNT)
+    return index;
+
+  sc_uint32 const exponent =
+      (index - SC_LATENCY_EXACT_BUCKETS_COUNT) / SC_LATENCY_SUB_BUCKETS_COUNT + SC_LATENCY_EXACT_BUCKETS_BITS;
+  sc_uint64 const sub_bucket = (index - SC_LATENCY_EXACT_BUCKETS_COUNT) % SC_LATENCY_SUB_BUCKETS_COUNT;
+  return ((SC_LATENCY_SUB_BUCKETS_COUNT + sub_bucket + 1) << (exponent - SC_LATENCY_SUB_BUCKETS_BITS)) - 1;
+}
+
+void _sc_latency_atomic_histogram_record(sc_latency_atomic_histogram * histogram, sc_uint64 value)
+{
+  g_atomic_int_inc(&histogram->buckets[sc_latency_histogram_get_bucket_index(value)]);
+  g_atomic_int_inc(&histogram->count);
+
+  sc_int32 const limited_value = (sc_int32)sc_min(value, (sc_uint64)SC_MAXINT32);
+  sc_int32 max = g_atomic_int_get(&histogram->max);
+  while (limited_value > max && !g_atomic_int_compare_and_exchange(&histogram->max, max, limited_value))
+    max = g_atomic_int_get(&histogram->max);
+}
+
+void _sc_latency_atomic_histogram_collect(
+    sc_latency_atomic_histogram const * histogram,
+    sc_latency_histogram * snapshot)
+{
+  for (sc_uint32 i = 0; i < SC_LATENCY_HISTOGRAM_BUCKETS_COUNT; ++i)
+    snapshot->buckets[i] = (sc_uint32)g_atomic_int_get(&histogram->buckets[i]);
+  snapshot->count = (sc_uint32)g_atomic_int_get(&histogram->count);
+  snapshot->max = (sc_uint32)g_atomic_int_get(&histogram->max);
+}
+
+void sc_events_latency_record(sc_events_latency * latency, sc_uint64 queue_latency, sc_uint64 execution_duration)
+{
+  _sc_latency_atomic_histogram_record(&latency->queue_latency, queue_latency);
+  _sc_latency_atomic_histogram_record(&latency->execution_duration, execution_duration);
+}
+
+void sc_events_latency_collect(sc_events_latency const * latency, sc_events_latency_stat * stat)
+{
+  *stat = (sc_events_latency_stat){0};
+  if (latency == null_ptr)
+    return;
+
+  _sc_latency_atomic_histogram_collect(&latency->queue_latency, &stat->queue_latency);
+  _sc_latency_atomic_histogram_collect(&latency->execution_duration, &stat->execution_duration);
+}
+
+void sc_latency_histogram_merge(sc_latency_histogram * histogram, sc_latency_histogram const * other)
+{
+  for (sc_uint32 i = 0; i < SC_LATENCY_HISTOGRAM_BUCKETS_COUNT; ++i)
+    histogram->buckets[i] += other->buckets[i];
+  histogram->count += other->count;
+  histogram->max = sc_max(histogram->max, other->max);
+}
+
+sc_uint64 sc_latency_histogram_get_percentile(sc_latency_histogram const * histogram, sc_float percentile)
+{
+  if (histogram->count == 0)
+    return 0;
+
+  // the number of values not greater than the percentile, rounded up
+  sc_uint64 const rank = sc_max(1, (sc_uint64)(percentile / 100 * histogram->count + 0.999));
+  sc_uint64 count = 0;
+  for (sc_uint32 i = 0; i < SC_LATENCY_HISTOGRAM_BUCKETS_COUNT; ++i)
+  {
+    count += histogram->buckets[i];
+    if (count >= rank)
+      return sc_min(_sc_latency_histogram_get_bucket_upper_bound(i), histogram->max);
+  }
+
+  return histogram->max;
+}
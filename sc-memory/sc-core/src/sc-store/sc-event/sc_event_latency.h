@@ -0,0 +1,43 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_event_latency_h_
+#define _sc_event_latency_h_
+
+#include "sc-core/sc_types.h"
+
+/*! Structure representing histogram of latencies in microseconds.
+ * @note Histogram is updated by atomic operations, so concurrent worker threads record latencies without locks.
+ */
+typedef struct
+{
+  sc_int32 buckets[SC_LATENCY_HISTOGRAM_BUCKETS_COUNT];  ///< Amounts of values in buckets.
+  sc_int32 count;                                        ///< Amount of values.
+  sc_int32 max;                                          ///< Max value, it is limited by SC_MAXINT32.
+} sc_latency_atomic_histogram;
+
+//! Structure representing latencies of processing of sc-events.
+typedef struct
+{
+  sc_latency_atomic_histogram queue_latency;       ///< Time from emission of sc-events to start of their processing.
+  sc_latency_atomic_histogram execution_duration;  ///< Time of processing of sc-events by callbacks.
+} sc_events_latency;
+
+/*! Records latencies of processed sc-event.
+ * @param latency Pointer to the latencies of sc-events.
+ * @param queue_latency Time (in microseconds) from emission of sc-event to start of its processing.
+ * @param execution_duration Time (in microseconds) of processing of sc-event by callback.
+ */
+void sc_events_latency_record(sc_events_latency * latency, sc_uint64 queue_latency, sc_uint64 execution_duration);
+
+/*! Collects snapshot of latencies of sc-events.
+ * @param latency Pointer to the latencies of sc-events. If it is null_ptr, then \p stat is filled by zeros.
+ * @param stat Pointer to the statistics to be filled.
+ * @note Values are read without locks, so amounts in snapshot may be slightly inconsistent.
+ */
+void sc_events_latency_collect(sc_events_latency const * latency, sc_events_latency_stat * stat);
+
+#endif
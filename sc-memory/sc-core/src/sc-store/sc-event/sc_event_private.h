@@ -17,8 +17,10 @@
 //! Structure that contains information about event
 struct _sc_event_subscription
 {
-  //! sc-addr of listened sc-element
+  //! sc-addr of listened sc-element, it is empty for global sc-event subscription
   sc_addr subscription_addr;
+  //! sc-addr of set which sc-elements of sc-events of global sc-event subscription should belong to
+  sc_addr set_addr;
   //! Event type
   sc_event_type event_type_addr;
   //! Connector type required to trigger the event
@@ -29,12 +31,18 @@ struct _sc_event_subscription
   sc_event_callback callback;
   //! Pointer to callback function, that calls on event emit
   sc_event_callback_with_user callback_with_user;
+  //! Pointer to callback function, that calls on event emit (for global sc-event subscription)
+  sc_event_global_callback callback_global;
   //! Pointer to callback function, that calls, when subscribed sc-element deleted
   sc_event_subscription_delete_function delete_callback;
   //! Monitor used to synchronize state of fields of sc-event subscription
   sc_monitor monitor;
   //! Count of references (users) of this sc-event subscription
   sc_uint32 ref_count;
+  //! Priority of processing sc-events of this sc-event subscription, it is read without lock
+  sc_int32 priority;
+  //! Latencies of processed sc-events of this sc-event subscription, they are allocated on first processed sc-event
+  sc_events_latency * latency;
 };
 
 /*! Notify about sc-element deletion.
@@ -6,6 +6,8 @@
 
 #include "sc_event_queue.h"
 
+#include <time.h>
+
 #include "sc-core/sc_event_subscription.h"
 #include "sc_event_private.h"
 
@@ -13,8 +15,10 @@
 #include "sc-store/sc_storage_private.h"
 #include "sc_memory_private.h"
 #include "sc-core/sc_memory.h"
+#include "sc-core/sc_helper.h"
 
 #include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc-container/sc_string.h"
 
 /*! Structure representing elementary sc-event.
  * @note This structure holds information required for processing events in a worker thread.
@@ -23,56 +27,393 @@ typedef struct
 {
   sc_event_subscription * event_subscription;  ///< A pointer to the sc-event subscription associated with the event.
   sc_addr user_addr;                           ///< A sc-address representing user that initiated this sc-event
+  sc_addr subscription_addr;                   ///< A sc-address of sc-element for which the event was emitted.
   sc_addr connector_addr;               ///< A sc-address representing the sc-connector associated with the event.
   sc_type connector_type;               ///< A sc-type of the sc-connector associated with the event.
   sc_addr other_addr;                   ///< A sc-address representing the other element associated with the event.
   sc_event_do_after_callback callback;  ///< A pointer to function that is executed after the execution of a function
                                         ///< that was called on the initiated event.
   sc_addr event_addr;                   ///< An argument of callback.
+  sc_memory_task_callback task;         ///< A callback of posted task, sc-event of task has no subscription.
+  sc_pointer task_data;                 ///< An argument of callback of posted task.
+  sc_int64 emission_time;               ///< Monotonic time (in microseconds) of emission of sc-event.
 } sc_event;
 
-sc_event * _sc_event_new(
-    sc_event_subscription * event_subscription,
-    sc_addr user_addr,
-    sc_addr connector_addr,
-    sc_type connector_type,
-    sc_addr other_addr,
-    sc_event_do_after_callback callback,
-    sc_addr event_addr)
+#define SC_EVENT_EMISSION_LANE_CAPACITY 1024  // must be a power of two
+#define SC_EVENT_EMISSION_LANE_MASK (SC_EVENT_EMISSION_LANE_CAPACITY - 1)
+#define SC_CACHE_LINE_SIZE 64
+#define SC_EVENT_EMISSION_BLOCK_TIMEOUT 1000000  // microseconds
+
+#define SC_EVENT_EMISSION_POOL_CONTROL_PERIOD 50000  // microseconds
+//! Number of control periods with queued sc-events and without idle workers after which adaptive pool grows.
+#define SC_EVENT_EMISSION_POOL_GROW_PERIODS 2
+//! Number of control periods with idle workers after which adaptive pool shrinks.
+#define SC_EVENT_EMISSION_POOL_SHRINK_PERIODS 200
+//! CPU utilisation of process above which adaptive pool doesn't grow if there are no blocked workers.
+#define SC_EVENT_EMISSION_POOL_MAX_CPU_UTILISATION 0.9
+
+//! Cell of lane that stores sc-event record and its sequence number.
+typedef struct
+{
+  sc_int32 sequence;  ///< Position of push that may fill this cell or position of pop + 1 that may read it.
+  sc_event event;     ///< Record of sc-event.
+} sc_event_emission_cell;
+
+/*! Structure representing bounded lock-free multi-producer multi-consumer queue of sc-events.
+ * @note Positions of push and pop are placed in different cache lines, so producers and workers don't invalidate
+ * cache lines of each other.
+ */
+struct _sc_event_emission_lane
+{
+  sc_int32 push_position;
+  sc_char push_position_padding[SC_CACHE_LINE_SIZE - sizeof(sc_int32)];
+  sc_int32 pop_position;
+  sc_char pop_position_padding[SC_CACHE_LINE_SIZE - sizeof(sc_int32)];
+  sc_event_emission_cell cells[SC_EVENT_EMISSION_LANE_CAPACITY];
+};
+
+//! Structure representing arguments of worker thread.
+typedef struct
+{
+  sc_event_emission_manager * manager;
+  sc_uint32 lane_index;
+} sc_event_emission_worker;
+
+//! Index of the next thread that pushes sc-events for the first time. It is used to choose lanes of producers.
+static sc_int32 producers_counter = 0;
+//! Index of current producer thread + 1, it is 0 if thread hasn't pushed sc-events yet.
+static GPrivate producer_index = G_PRIVATE_INIT(null_ptr);
+//! Not null in worker threads. Worker threads never wait for free place in queue, because they free it.
+static GPrivate is_worker_thread = G_PRIVATE_INIT(null_ptr);
+//! Depth of nested wait points of current thread.
+static GPrivate wait_depth = G_PRIVATE_INIT(null_ptr);
+
+void _sc_event_emission_lane_init(sc_event_emission_lane * lane)
+{
+  for (sc_uint32 i = 0; i < SC_EVENT_EMISSION_LANE_CAPACITY; ++i)
+    g_atomic_int_set(&lane->cells[i].sequence, (sc_int32)i);
+  g_atomic_int_set(&lane->push_position, 0);
+  g_atomic_int_set(&lane->pop_position, 0);
+}
+
+sc_bool _sc_event_emission_lane_push(sc_event_emission_lane * lane, sc_event const * event)
+{
+  sc_event_emission_cell * cell;
+  sc_uint32 position = (sc_uint32)g_atomic_int_get(&lane->push_position);
+  while (SC_TRUE)
+  {
+    cell = &lane->cells[position & SC_EVENT_EMISSION_LANE_MASK];
+    sc_int32 const difference = (sc_int32)((sc_uint32)g_atomic_int_get(&cell->sequence) - position);
+    if (difference == 0)
+    {
+      if (g_atomic_int_compare_and_exchange(&lane->push_position, (sc_int32)position, (sc_int32)(position + 1)))
+        break;
+    }
+    else if (difference < 0)
+      return SC_FALSE;  // lane is full
+
+    position = (sc_uint32)g_atomic_int_get(&lane->push_position);
+  }
+
+  cell->event = *event;
+  g_atomic_int_set(&cell->sequence, (sc_int32)(position + 1));
+  return SC_TRUE;
+}
+
+sc_bool _sc_event_emission_lane_pop(sc_event_emission_lane * lane, sc_event * event)
+{
+  sc_event_emission_cell * cell;
+  sc_uint32 position = (sc_uint32)g_atomic_int_get(&lane->pop_position);
+  while (SC_TRUE)
+  {
+    cell = &lane->cells[position & SC_EVENT_EMISSION_LANE_MASK];
+    sc_int32 const difference = (sc_int32)((sc_uint32)g_atomic_int_get(&cell->sequence) - (position + 1));
+    if (difference == 0)
+    {
+      if (g_atomic_int_compare_and_exchange(&lane->pop_position, (sc_int32)position, (sc_int32)(position + 1)))
+        break;
+    }
+    else if (difference < 0)
+      return SC_FALSE;  // lane is empty
+
+    position = (sc_uint32)g_atomic_int_get(&lane->pop_position);
+  }
+
+  *event = cell->event;
+  g_atomic_int_set(&cell->sequence, (sc_int32)(position + SC_EVENT_EMISSION_LANE_CAPACITY));
+  return SC_TRUE;
+}
+
+void _sc_event_emission_manager_notify_producers(sc_event_emission_manager * manager)
+{
+  if (g_atomic_int_get(&manager->blocked_producers_count) == 0)
+    return;
+
+  sc_mutex_lock(&manager->space_mutex);
+  sc_cond_broadcast(&manager->space_condition);
+  sc_mutex_unlock(&manager->space_mutex);
+}
+
+/*! Pops sc-event with specified priority from lane with specified index, steals it from other lanes if this lane is
+ * empty, and pops it from queue of spilled sc-events if all lanes are empty.
+ */
+sc_bool _sc_event_emission_manager_pop_priority(
+    sc_event_emission_manager * manager,
+    sc_event_priority priority,
+    sc_uint32 lane_index,
+    sc_event * event)
+{
+  sc_event_emission_lane * lanes = &manager->lanes[priority * manager->lanes_count];
+  for (sc_uint32 i = 0; i < manager->lanes_count; ++i)
+  {
+    if (_sc_event_emission_lane_pop(&lanes[(lane_index + i) % manager->lanes_count], event))
+      goto popped;
+  }
+
+  if (g_atomic_int_get(&manager->spilled_events_count[priority]) == 0)
+    return SC_FALSE;
+
+  sc_event * spilled_event = null_ptr;
+  sc_mutex_lock(&manager->spilled_events_mutex);
+  if (!sc_queue_empty(&manager->spilled_events[priority]))
+  {
+    spilled_event = sc_queue_pop(&manager->spilled_events[priority]);
+    g_atomic_int_add(&manager->spilled_events_count[priority], -1);
+  }
+  sc_mutex_unlock(&manager->spilled_events_mutex);
+
+  if (spilled_event == null_ptr)
+    return SC_FALSE;
+
+  *event = *spilled_event;
+  sc_mem_free(spilled_event);
+
+popped:
+  g_atomic_int_add(&manager->queued_events_count[priority], -1);
+  _sc_event_emission_manager_notify_producers(manager);
+  return SC_TRUE;
+}
+
+//! Pops sc-event for worker with specified lane index. Sc-events with high priority are popped first.
+sc_bool _sc_event_emission_manager_pop(sc_event_emission_manager * manager, sc_uint32 lane_index, sc_event * event)
+{
+  for (sc_int32 priority = SC_EVENT_PRIORITY_COUNT - 1; priority >= 0; --priority)
+  {
+    if (_sc_event_emission_manager_pop_priority(manager, (sc_event_priority)priority, lane_index, event))
+      return SC_TRUE;
+  }
+
+  return SC_FALSE;
+}
+
+sc_bool _sc_event_emission_manager_is_worker_retiring(sc_event_emission_manager * manager, sc_uint32 lane_index)
 {
-  sc_event * event = sc_mem_new(sc_event, 1);
-  event->event_subscription = event_subscription;
-  event->user_addr = user_addr;
-  event->connector_addr = connector_addr;
-  event->connector_type = connector_type;
-  event->other_addr = other_addr;
-  event->callback = callback;
-  event->event_addr = event_addr;
+  return g_atomic_int_get(&manager->workers_states[lane_index]) == SC_EVENT_EMISSION_WORKER_RETIRING;
+}
+
+/*! Waits for sc-event and pops it.
+ * @returns SC_FALSE if manager is stopping or worker is retiring and there are no sc-events to process.
+ */
+sc_bool _sc_event_emission_manager_wait(sc_event_emission_manager * manager, sc_uint32 lane_index, sc_event * event)
+{
+  sc_bool is_popped;
+
+  sc_mutex_lock(&manager->sleep_mutex);
+  // producers check count of sleeping workers after push, so sc-event pushed after this increment is popped below
+  // or its producer signals the condition
+  g_atomic_int_inc(&manager->sleeping_workers_count);
+  while (!(is_popped = _sc_event_emission_manager_pop(manager, lane_index, event)) && !manager->is_stopping
+         && !_sc_event_emission_manager_is_worker_retiring(manager, lane_index))
+    sc_cond_wait(&manager->sleep_condition, &manager->sleep_mutex);
+  g_atomic_int_add(&manager->sleeping_workers_count, -1);
+  sc_mutex_unlock(&manager->sleep_mutex);
+
+  return is_popped;
+}
+
+void _sc_event_emission_manager_notify(sc_event_emission_manager * manager)
+{
+  if (g_atomic_int_get(&manager->sleeping_workers_count) == 0)
+    return;
 
-  return event;
+  sc_mutex_lock(&manager->sleep_mutex);
+  sc_cond_signal(&manager->sleep_condition);
+  sc_mutex_unlock(&manager->sleep_mutex);
 }
 
-void _sc_event_emission_pool_worker_data_destroy(sc_event * data)
+sc_uint32 _sc_event_emission_manager_get_producer_lane_index(sc_event_emission_manager * manager)
+{
+  sc_uint32 index = GPOINTER_TO_UINT(g_private_get(&producer_index));
+  if (index == 0)
+  {
+    index = (sc_uint32)g_atomic_int_add(&producers_counter, 1) + 1;
+    g_private_set(&producer_index, GUINT_TO_POINTER(index));
+  }
+
+  return (index - 1) % manager->lanes_count;
+}
+
+void _sc_event_emission_manager_spill(
+    sc_event_emission_manager * manager,
+    sc_event_priority priority,
+    sc_event const * event)
 {
-  sc_mem_free(data);
+  sc_event * spilled_event = sc_mem_new(sc_event, 1);
+  *spilled_event = *event;
+  sc_mutex_lock(&manager->spilled_events_mutex);
+  sc_queue_push(&manager->spilled_events[priority], spilled_event);
+  g_atomic_int_inc(&manager->spilled_events_count[priority]);
+  sc_mutex_unlock(&manager->spilled_events_mutex);
 }
 
-/*! Function that represents the work performed by a worker in the sc-event emission pool.
- * @param data Pointer to the sc_event containing information about the work.
- * @param user_data Pointer to the sc_event_emission_manager managing the sc-event emission.
+sc_bool _sc_event_emission_manager_is_full(sc_event_emission_manager * manager, sc_event_priority priority)
+{
+  return (sc_uint32)g_atomic_int_get(&manager->queued_events_count[priority]) >= manager->max_queued_events_count;
+}
+
+/*! Waits until queue of sc-events with specified priority has free place.
+ * @note Producer may hold monitors of sc-elements that workers need to process popped sc-events, so it waits no longer
+ * than SC_EVENT_EMISSION_BLOCK_TIMEOUT and then pushes sc-event anyway.
  */
-void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
+void _sc_event_emission_manager_wait_for_space(sc_event_emission_manager * manager, sc_event_priority priority)
+{
+  if (g_private_get(&is_worker_thread) != null_ptr)
+    return;
+
+  g_atomic_int_inc(&manager->blocked_pushes_count);
+  sc_int64 const end_time = g_get_monotonic_time() + SC_EVENT_EMISSION_BLOCK_TIMEOUT;
+
+  sc_mutex_lock(&manager->space_mutex);
+  // workers check count of blocked producers after pop, so sc-event popped after this increment is seen below
+  // or its worker signals the condition
+  g_atomic_int_inc(&manager->blocked_producers_count);
+  while (_sc_event_emission_manager_is_full(manager, priority))
+  {
+    if (!sc_cond_wait_until(&manager->space_condition, &manager->space_mutex, end_time))
+      break;
+  }
+  g_atomic_int_add(&manager->blocked_producers_count, -1);
+  sc_mutex_unlock(&manager->space_mutex);
+}
+
+//! Drops the oldest queued sc-event with specified priority to free place for new one.
+void _sc_event_emission_manager_drop_oldest(
+    sc_event_emission_manager * manager,
+    sc_event_priority priority,
+    sc_uint32 lane_index)
 {
-  sc_event * event = (sc_event *)data;
-  sc_event_emission_manager * queue = user_data;
+  sc_event event;
+  if (!_sc_event_emission_manager_pop_priority(manager, priority, lane_index, &event))
+    return;
+
+  // callback completes erasure of sc-element and task releases its data, so such sc-event is put back to the end of
+  // queue
+  if (event.callback != null_ptr || event.task != null_ptr)
+  {
+    g_atomic_int_inc(&manager->queued_events_count[priority]);
+    _sc_event_emission_manager_spill(manager, priority, &event);
+    return;
+  }
+
+  g_atomic_int_inc(&manager->dropped_events_count);
+}
+
+void _sc_event_emission_manager_push(
+    sc_event_emission_manager * manager,
+    sc_event_priority priority,
+    sc_event const * event)
+{
+  sc_uint32 const lane_index = _sc_event_emission_manager_get_producer_lane_index(manager);
+
+  if (manager->overflow_policy != SC_EVENTS_QUEUE_OVERFLOW_SPILL
+      && _sc_event_emission_manager_is_full(manager, priority))
+  {
+    if (manager->overflow_policy == SC_EVENTS_QUEUE_OVERFLOW_BLOCK)
+      _sc_event_emission_manager_wait_for_space(manager, priority);
+    else
+      _sc_event_emission_manager_drop_oldest(manager, priority, lane_index);
+  }
+
+  g_atomic_int_inc(&manager->queued_events_count[priority]);
+
+  sc_event_emission_lane * lanes = &manager->lanes[priority * manager->lanes_count];
+  for (sc_uint32 i = 0; i < manager->lanes_count; ++i)
+  {
+    if (_sc_event_emission_lane_push(&lanes[(lane_index + i) % manager->lanes_count], event))
+    {
+      _sc_event_emission_manager_notify(manager);
+      return;
+    }
+  }
+
+  // all lanes are full, so sc-event is spilled to unbounded queue
+  _sc_event_emission_manager_spill(manager, priority, event);
+  _sc_event_emission_manager_notify(manager);
+}
+
+sc_bool _sc_event_emission_manager_is_stopping(sc_event_emission_manager * manager)
+{
+  sc_mutex_lock(&manager->sleep_mutex);
+  sc_bool const is_stopping = manager->is_stopping;
+  sc_mutex_unlock(&manager->sleep_mutex);
+  return is_stopping;
+}
+
+/*! Function that records latencies of processed sc-event for manager and sc-event subscription.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event_subscription Pointer to the sc-event subscription that processed sc-event.
+ * @param event Pointer to the processed sc_event.
+ * @param start_time Monotonic time (in microseconds) when callback of sc-event subscription was called.
+ */
+void _sc_event_emission_manager_record_latency(
+    sc_event_emission_manager * manager,
+    sc_event_subscription * event_subscription,
+    sc_event const * event,
+    sc_int64 start_time)
+{
+  sc_uint64 const queue_latency = (sc_uint64)sc_max(0, start_time - event->emission_time);
+  sc_uint64 const execution_duration = (sc_uint64)sc_max(0, g_get_monotonic_time() - start_time);
+
+  sc_events_latency * latency = g_atomic_pointer_get(&event_subscription->latency);
+  if (latency == null_ptr)
+  {
+    // latencies are allocated lazily, because most of sc-event subscriptions are never triggered
+    sc_events_latency * new_latency = sc_mem_new(sc_events_latency, 1);
+    if (g_atomic_pointer_compare_and_exchange(&event_subscription->latency, null_ptr, new_latency))
+      latency = new_latency;
+    else
+    {
+      sc_mem_free(new_latency);
+      latency = g_atomic_pointer_get(&event_subscription->latency);
+    }
+  }
+
+  sc_events_latency_record(latency, queue_latency, execution_duration);
+  sc_events_latency_record(&manager->latency, queue_latency, execution_duration);
+}
+
+/*! Function that processes sc-event in worker thread.
+ * @param manager Pointer to the sc_event_emission_manager managing the sc-event emission.
+ * @param event Pointer to the sc_event containing information about the work.
+ */
+void _sc_event_emission_manager_process(sc_event_emission_manager * manager, sc_event const * event)
+{
+  if (event->task != null_ptr)
+  {
+    sc_monitor_acquire_read(&manager->destroy_monitor);
+    sc_bool const is_cancelled = manager->running == SC_FALSE;
+    event->task(event->task_data, is_cancelled);
+    sc_monitor_release_read(&manager->destroy_monitor);
+    return;
+  }
 
   sc_event_subscription * event_subscription = event->event_subscription;
   if (event_subscription == null_ptr)
     goto destroy;
 
-  sc_monitor_acquire_read(&queue->destroy_monitor);
+  sc_monitor_acquire_read(&manager->destroy_monitor);
 
-  if (queue->running == SC_FALSE)
+  if (manager->running == SC_FALSE)
     goto end;
 
   sc_monitor_acquire_read(&event_subscription->monitor);
@@ -84,32 +425,264 @@ void _sc_event_emission_pool_worker(sc_pointer data, sc_pointer user_data)
 
   sc_event_callback callback = event_subscription->callback;
   sc_event_callback_with_user callback_ext2 = event_subscription->callback_with_user;
+  sc_event_global_callback callback_global = event_subscription->callback_global;
 
   sc_storage_start_new_process();
 
+  // belonging to set isn't checked during emission, because sc-elements of sc-event are locked there
+  if (callback_global != null_ptr && !SC_ADDR_IS_EMPTY(event_subscription->set_addr)
+      && !sc_helper_check_arc(
+          s_memory_default_ctx, event_subscription->set_addr, event->subscription_addr, sc_type_const_perm_pos_arc))
+    callback_global = null_ptr;
+
+  sc_int64 const start_time = g_get_monotonic_time();
   if (callback != null_ptr)
     callback(event_subscription, event->connector_addr);
   else if (callback_ext2 != null_ptr)
     callback_ext2(
         event_subscription, event->user_addr, event->connector_addr, event->connector_type, event->other_addr);
+  else if (callback_global != null_ptr)
+    callback_global(
+        event_subscription,
+        event->user_addr,
+        event->subscription_addr,
+        event->connector_addr,
+        event->connector_type,
+        event->other_addr);
 
   sc_storage_end_new_process();
 
+  if (callback != null_ptr || callback_ext2 != null_ptr || callback_global != null_ptr)
+    _sc_event_emission_manager_record_latency(manager, event_subscription, event, start_time);
+
   sc_monitor_release_read(&event_subscription->monitor);
 
 end:
-  sc_monitor_release_read(&queue->destroy_monitor);
+  sc_monitor_release_read(&manager->destroy_monitor);
 destroy:
-{
   if (event->callback != null_ptr)
   {
     sc_memory_context * ctx = sc_memory_context_new_ext(event->user_addr);
     event->callback(ctx, event->event_addr);
     sc_memory_context_free(ctx);
   }
+}
 
-  _sc_event_emission_pool_worker_data_destroy(event);
+/*! Function that represents the work performed by a worker thread of the sc-event emission manager.
+ * @param data Pointer to the sc_event_emission_worker with arguments of worker thread.
+ */
+sc_pointer _sc_event_emission_manager_worker(sc_pointer data)
+{
+  sc_event_emission_worker * worker = data;
+  sc_event_emission_manager * manager = worker->manager;
+  sc_uint32 const lane_index = worker->lane_index;
+  sc_mem_free(worker);
+  g_private_set(&is_worker_thread, manager);
+
+  sc_event event;
+  while (SC_TRUE)
+  {
+    // retiring worker exits after current sc-event, unless controller has revived it
+    if (g_atomic_int_compare_and_exchange(
+            &manager->workers_states[lane_index], SC_EVENT_EMISSION_WORKER_RETIRING, SC_EVENT_EMISSION_WORKER_EXITED))
+      return null_ptr;
+
+    if (_sc_event_emission_manager_pop(manager, lane_index, &event)
+        || _sc_event_emission_manager_wait(manager, lane_index, &event))
+    {
+      _sc_event_emission_manager_process(manager, &event);
+      continue;
+    }
+
+    if (_sc_event_emission_manager_is_stopping(manager))
+      break;
+  }
+
+  g_atomic_int_set(&manager->workers_states[lane_index], SC_EVENT_EMISSION_WORKER_EXITED);
+  return null_ptr;
+}
+
+void _sc_event_emission_manager_start_worker(sc_event_emission_manager * manager, sc_uint32 slot)
+{
+  sc_event_emission_worker * worker = sc_mem_new(sc_event_emission_worker, 1);
+  worker->manager = manager;
+  worker->lane_index = slot;
+  g_atomic_int_set(&manager->workers_states[slot], SC_EVENT_EMISSION_WORKER_RUNNING);
+  manager->workers[slot] = g_thread_new("sc-event-worker", _sc_event_emission_manager_worker, worker);
 }
+
+//! Joins worker threads that have exited after retirement. It is called by controller thread only.
+void _sc_event_emission_manager_join_exited_workers(sc_event_emission_manager * manager)
+{
+  for (sc_uint32 slot = g_atomic_int_get(&manager->workers_count); slot < manager->lanes_count; ++slot)
+  {
+    if (g_atomic_int_get(&manager->workers_states[slot]) != SC_EVENT_EMISSION_WORKER_EXITED)
+      continue;
+
+    g_thread_join(manager->workers[slot]);
+    manager->workers[slot] = null_ptr;
+    g_atomic_int_set(&manager->workers_states[slot], SC_EVENT_EMISSION_WORKER_EMPTY);
+  }
+}
+
+/*! Adds worker thread to the first free slot. Worker of this slot is revived if it hasn't exited yet.
+ * @note It is called by controller thread only.
+ */
+sc_bool _sc_event_emission_manager_grow(sc_event_emission_manager * manager)
+{
+  sc_uint32 const slot = g_atomic_int_get(&manager->workers_count);
+  if (!g_atomic_int_compare_and_exchange(
+          &manager->workers_states[slot], SC_EVENT_EMISSION_WORKER_RETIRING, SC_EVENT_EMISSION_WORKER_RUNNING))
+  {
+    if (g_atomic_int_get(&manager->workers_states[slot]) == SC_EVENT_EMISSION_WORKER_EXITED)
+    {
+      g_thread_join(manager->workers[slot]);
+      manager->workers[slot] = null_ptr;
+    }
+    else if (g_atomic_int_get(&manager->workers_states[slot]) != SC_EVENT_EMISSION_WORKER_EMPTY)
+      return SC_FALSE;
+
+    _sc_event_emission_manager_start_worker(manager, slot);
+  }
+
+  g_atomic_int_set(&manager->workers_count, slot + 1);
+  g_atomic_int_inc(&manager->grown_workers_count);
+  return SC_TRUE;
+}
+
+/*! Retires worker thread of the last occupied slot. It exits after processing current sc-event.
+ * @note It is called by controller thread only.
+ */
+void _sc_event_emission_manager_shrink(sc_event_emission_manager * manager)
+{
+  sc_uint32 const slot = g_atomic_int_get(&manager->workers_count) - 1;
+  g_atomic_int_set(&manager->workers_count, slot);
+  g_atomic_int_set(&manager->workers_states[slot], SC_EVENT_EMISSION_WORKER_RETIRING);
+  g_atomic_int_inc(&manager->shrunk_workers_count);
+
+  sc_mutex_lock(&manager->sleep_mutex);
+  sc_cond_broadcast(&manager->sleep_condition);
+  sc_mutex_unlock(&manager->sleep_mutex);
+}
+
+/*! Grows adaptive pool when sc-events wait for workers and shrinks it when workers are idle.
+ * @param manager Pointer to the sc_event_emission_manager.
+ * @param cpu_utilisation CPU utilisation of process during the last control period.
+ * @param congested_periods Number of consecutive control periods with queued sc-events and without idle workers.
+ * @param idle_periods Number of consecutive control periods with idle workers.
+ */
+void _sc_event_emission_manager_control(
+    sc_event_emission_manager * manager,
+    double cpu_utilisation,
+    sc_uint32 * congested_periods,
+    sc_uint32 * idle_periods)
+{
+  sc_uint32 queued_events_count = 0;
+  for (sc_uint32 priority = 0; priority < SC_EVENT_PRIORITY_COUNT; ++priority)
+    queued_events_count += sc_max(0, g_atomic_int_get(&manager->queued_events_count[priority]));
+  sc_int32 const workers_count = g_atomic_int_get(&manager->workers_count);
+  sc_int32 const sleeping_workers_count = g_atomic_int_get(&manager->sleeping_workers_count);
+  sc_int32 const blocked_workers_count = g_atomic_int_get(&manager->blocked_workers_count);
+
+  *congested_periods = queued_events_count > 0 && sleeping_workers_count == 0 ? *congested_periods + 1 : 0;
+  *idle_periods = sleeping_workers_count > 0 ? *idle_periods + 1 : 0;
+
+  // workers blocked in wait points don't use CPU, so other workers are started regardless of CPU utilisation
+  sc_bool const is_starved = *congested_periods > 0 && blocked_workers_count > 0;
+  sc_bool const is_congested = *congested_periods >= SC_EVENT_EMISSION_POOL_GROW_PERIODS
+                               && cpu_utilisation < SC_EVENT_EMISSION_POOL_MAX_CPU_UTILISATION;
+  if ((is_starved || is_congested) && (sc_uint32)workers_count < manager->lanes_count
+      && (sc_uint32)(workers_count - blocked_workers_count) < manager->max_runnable_workers_count)
+  {
+    if (_sc_event_emission_manager_grow(manager))
+    {
+      sc_memory_info(
+          "Events and agents threads pool is grown to %d threads: %u sc-events are queued, %d threads are blocked, "
+          "CPU utilisation is %.0f%%",
+          workers_count + 1,
+          queued_events_count,
+          blocked_workers_count,
+          cpu_utilisation * 100);
+      *congested_periods = 0;
+    }
+    return;
+  }
+
+  if (*idle_periods >= SC_EVENT_EMISSION_POOL_SHRINK_PERIODS && (sc_uint32)workers_count > manager->min_workers_count)
+  {
+    _sc_event_emission_manager_shrink(manager);
+    sc_memory_info(
+        "Events and agents threads pool is shrunk to %d threads: %d threads are idle",
+        workers_count - 1,
+        sleeping_workers_count);
+    *idle_periods = 0;
+  }
+}
+
+/*! Function that represents the work performed by controller thread of adaptive pool.
+ * @param data Pointer to the sc_event_emission_manager.
+ */
+sc_pointer _sc_event_emission_manager_controller(sc_pointer data)
+{
+  sc_event_emission_manager * manager = data;
+  sc_uint32 const processors_count = g_get_num_processors();
+  sc_uint32 congested_periods = 0;
+  sc_uint32 idle_periods = 0;
+  clock_t cpu_time = clock();
+  sc_int64 time = g_get_monotonic_time();
+
+  sc_mutex_lock(&manager->controller_mutex);
+  while (!manager->is_controller_stopping)
+  {
+    sc_int64 const end_time = time + SC_EVENT_EMISSION_POOL_CONTROL_PERIOD;
+    while (!manager->is_controller_stopping
+           && sc_cond_wait_until(&manager->controller_condition, &manager->controller_mutex, end_time))
+      ;
+    if (manager->is_controller_stopping)
+      break;
+    sc_mutex_unlock(&manager->controller_mutex);
+
+    clock_t const current_cpu_time = clock();
+    sc_int64 const current_time = g_get_monotonic_time();
+    double const cpu_utilisation = ((double)(current_cpu_time - cpu_time) / CLOCKS_PER_SEC)
+                                   / ((double)(current_time - time) / 1000000 * processors_count);
+    cpu_time = current_cpu_time;
+    time = current_time;
+
+    _sc_event_emission_manager_join_exited_workers(manager);
+    _sc_event_emission_manager_control(manager, cpu_utilisation, &congested_periods, &idle_periods);
+
+    sc_mutex_lock(&manager->controller_mutex);
+  }
+  sc_mutex_unlock(&manager->controller_mutex);
+
+  return null_ptr;
+}
+
+sc_events_queue_overflow_policy _sc_event_emission_manager_parse_overflow_policy(sc_char const * policy)
+{
+  if (policy == null_ptr || sc_str_cmp(policy, "Spill"))
+    return SC_EVENTS_QUEUE_OVERFLOW_SPILL;
+  if (sc_str_cmp(policy, "Block"))
+    return SC_EVENTS_QUEUE_OVERFLOW_BLOCK;
+  if (sc_str_cmp(policy, "DropOldest"))
+    return SC_EVENTS_QUEUE_OVERFLOW_DROP_OLDEST;
+
+  sc_memory_warning("Unknown events queue overflow policy `%s`, policy `Spill` is used", policy);
+  return SC_EVENTS_QUEUE_OVERFLOW_SPILL;
+}
+
+sc_char const * _sc_event_emission_manager_overflow_policy_to_string(sc_events_queue_overflow_policy policy)
+{
+  switch (policy)
+  {
+  case SC_EVENTS_QUEUE_OVERFLOW_BLOCK:
+    return "Block";
+  case SC_EVENTS_QUEUE_OVERFLOW_DROP_OLDEST:
+    return "DropOldest";
+  default:
+    return "Spill";
+  }
 }
 
 void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params)
@@ -118,28 +691,80 @@ void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager,
   sc_queue_init(&(*manager)->deletable_events_subscriptions);
 
   (*manager)->limit_max_threads_by_max_physical_cores = params->limit_max_threads_by_max_physical_cores;
-  (*manager)->max_events_and_agents_threads =
+  (*manager)->max_runnable_workers_count =
       (*manager)->limit_max_threads_by_max_physical_cores
           ? sc_boundary(params->max_events_and_agents_threads, 1, g_get_num_processors())
           : sc_max(1, params->max_events_and_agents_threads);
+  (*manager)->is_adaptive = params->adaptive_events_and_agents_threads;
+  // workers blocked in wait points don't use CPU, so adaptive pool may exceed number of physical cores to replace them
+  (*manager)->max_events_and_agents_threads = (*manager)->is_adaptive ? sc_max(1, params->max_events_and_agents_threads)
+                                                                      : (*manager)->max_runnable_workers_count;
+  (*manager)->min_workers_count =
+      (*manager)->is_adaptive
+          ? sc_boundary(params->min_events_and_agents_threads, 1, (*manager)->max_runnable_workers_count)
+          : (*manager)->max_events_and_agents_threads;
+  sc_uint32 const lanes_capacity = (*manager)->max_events_and_agents_threads * SC_EVENT_EMISSION_LANE_CAPACITY;
+  (*manager)->max_queued_events_count =
+      params->max_events_queue_size == 0 ? lanes_capacity : params->max_events_queue_size;
+  (*manager)->overflow_policy = _sc_event_emission_manager_parse_overflow_policy(params->events_queue_overflow_policy);
   {
     sc_memory_info("Sc-event managers configuration:");
     sc_message(
         "\tLimit max threads by max physical cores: %s",
         (*manager)->limit_max_threads_by_max_physical_cores ? "On" : "Off");
     sc_message("\tMax events and agents threads: %d", (*manager)->max_events_and_agents_threads);
+    sc_message("\tAdaptive events and agents threads: %s", (*manager)->is_adaptive ? "On" : "Off");
+    if ((*manager)->is_adaptive)
+      sc_message("\tMin events and agents threads: %d", (*manager)->min_workers_count);
+    sc_message("\tMax events queue size: %u", (*manager)->max_queued_events_count);
+    sc_message(
+        "\tEvents queue overflow policy: %s",
+        _sc_event_emission_manager_overflow_policy_to_string((*manager)->overflow_policy));
   }
 
   (*manager)->running = SC_TRUE;
   sc_monitor_init(&(*manager)->destroy_monitor);
-
   sc_monitor_init(&(*manager)->pool_monitor);
-  (*manager)->thread_pool = g_thread_pool_new(
-      _sc_event_emission_pool_worker,
-      *manager,
-      (sc_int32)(*manager)->max_events_and_agents_threads,
-      SC_FALSE,
-      null_ptr);
+
+  (*manager)->lanes_count = (*manager)->max_events_and_agents_threads;
+  (*manager)->lanes = sc_mem_new(sc_event_emission_lane, (*manager)->lanes_count * SC_EVENT_PRIORITY_COUNT);
+  for (sc_uint32 i = 0; i < (*manager)->lanes_count * SC_EVENT_PRIORITY_COUNT; ++i)
+    _sc_event_emission_lane_init(&(*manager)->lanes[i]);
+  for (sc_uint32 priority = 0; priority < SC_EVENT_PRIORITY_COUNT; ++priority)
+  {
+    sc_queue_init(&(*manager)->spilled_events[priority]);
+    g_atomic_int_set(&(*manager)->spilled_events_count[priority], 0);
+    g_atomic_int_set(&(*manager)->queued_events_count[priority], 0);
+  }
+  sc_mutex_init(&(*manager)->spilled_events_mutex);
+
+  sc_mutex_init(&(*manager)->space_mutex);
+  sc_cond_init(&(*manager)->space_condition);
+  g_atomic_int_set(&(*manager)->blocked_producers_count, 0);
+  g_atomic_int_set(&(*manager)->dropped_events_count, 0);
+  g_atomic_int_set(&(*manager)->blocked_pushes_count, 0);
+
+  sc_mutex_init(&(*manager)->sleep_mutex);
+  sc_cond_init(&(*manager)->sleep_condition);
+  (*manager)->is_stopping = SC_FALSE;
+  g_atomic_int_set(&(*manager)->is_accepting, SC_TRUE);
+
+  g_atomic_int_set(&(*manager)->blocked_workers_count, 0);
+  g_atomic_int_set(&(*manager)->grown_workers_count, 0);
+  g_atomic_int_set(&(*manager)->shrunk_workers_count, 0);
+  (*manager)->workers = sc_mem_new(sc_thread *, (*manager)->lanes_count);
+  (*manager)->workers_states = sc_mem_new(sc_int32, (*manager)->lanes_count);
+  for (sc_uint32 slot = 0; slot < (*manager)->min_workers_count; ++slot)
+    _sc_event_emission_manager_start_worker(*manager, slot);
+  g_atomic_int_set(&(*manager)->workers_count, (*manager)->min_workers_count);
+
+  if ((*manager)->is_adaptive)
+  {
+    sc_mutex_init(&(*manager)->controller_mutex);
+    sc_cond_init(&(*manager)->controller_condition);
+    (*manager)->is_controller_stopping = SC_FALSE;
+    (*manager)->controller = g_thread_new("sc-event-pool", _sc_event_emission_manager_controller, *manager);
+  }
 }
 
 void sc_event_emission_manager_stop(sc_event_emission_manager * manager)
@@ -166,21 +791,59 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
   if (manager == null_ptr)
     return;
 
-  sc_monitor_acquire_write(&manager->pool_monitor);
-  if (manager->thread_pool)
+  // producers check this flag after they are counted, so there are no producers after this loop
+  g_atomic_int_set(&manager->is_accepting, SC_FALSE);
+  while (g_atomic_int_get(&manager->producers_count) != 0)
+    g_thread_yield();
+
+  if (manager->is_adaptive)
   {
-    g_thread_pool_free(manager->thread_pool, SC_FALSE, SC_TRUE);
-    manager->thread_pool = null_ptr;
+    sc_mutex_lock(&manager->controller_mutex);
+    manager->is_controller_stopping = SC_TRUE;
+    sc_cond_signal(&manager->controller_condition);
+    sc_mutex_unlock(&manager->controller_mutex);
+
+    g_thread_join(manager->controller);
+    manager->controller = null_ptr;
+    sc_mutex_destroy(&manager->controller_mutex);
+    sc_cond_destroy(&manager->controller_condition);
   }
 
+  sc_mutex_lock(&manager->sleep_mutex);
+  manager->is_stopping = SC_TRUE;
+  sc_cond_broadcast(&manager->sleep_condition);
+  sc_mutex_unlock(&manager->sleep_mutex);
+
+  // retiring workers may still process sc-events, so all occupied slots are joined
+  for (sc_uint32 slot = 0; slot < manager->lanes_count; ++slot)
+  {
+    if (manager->workers[slot] != null_ptr)
+      g_thread_join(manager->workers[slot]);
+  }
+  sc_mem_free(manager->workers);
+  manager->workers = null_ptr;
+  sc_mem_free(manager->workers_states);
+  manager->workers_states = null_ptr;
+
+  sc_mem_free(manager->lanes);
+  manager->lanes = null_ptr;
+  for (sc_uint32 priority = 0; priority < SC_EVENT_PRIORITY_COUNT; ++priority)
+    sc_queue_destroy(&manager->spilled_events[priority]);
+  sc_mutex_destroy(&manager->spilled_events_mutex);
+  sc_mutex_destroy(&manager->space_mutex);
+  sc_cond_destroy(&manager->space_condition);
+  sc_mutex_destroy(&manager->sleep_mutex);
+  sc_cond_destroy(&manager->sleep_condition);
+
+  sc_monitor_acquire_write(&manager->pool_monitor);
   while (!sc_queue_empty(&manager->deletable_events_subscriptions))
   {
     sc_event_subscription * event_subscription = sc_queue_pop(&manager->deletable_events_subscriptions);
     sc_monitor_destroy(&event_subscription->monitor);
+    sc_mem_free(event_subscription->latency);
     sc_mem_free(event_subscription);
   }
   sc_queue_destroy(&manager->deletable_events_subscriptions);
-
   sc_monitor_release_write(&manager->pool_monitor);
 
   sc_monitor_destroy(&manager->pool_monitor);
@@ -188,10 +851,89 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager)
   sc_mem_free(manager);
 }
 
+void sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_queue_stat * stat)
+{
+  *stat = (sc_events_queue_stat){0};
+  if (manager == null_ptr)
+    return;
+
+  for (sc_uint32 priority = 0; priority < SC_EVENT_PRIORITY_COUNT; ++priority)
+  {
+    stat->queued_events_count[priority] = sc_max(0, g_atomic_int_get(&manager->queued_events_count[priority]));
+    stat->spilled_events_count[priority] = g_atomic_int_get(&manager->spilled_events_count[priority]);
+  }
+  stat->dropped_events_count = (sc_uint32)g_atomic_int_get(&manager->dropped_events_count);
+  stat->blocked_pushes_count = (sc_uint32)g_atomic_int_get(&manager->blocked_pushes_count);
+
+  stat->workers_count = g_atomic_int_get(&manager->workers_count);
+  stat->sleeping_workers_count = g_atomic_int_get(&manager->sleeping_workers_count);
+  stat->blocked_workers_count = g_atomic_int_get(&manager->blocked_workers_count);
+  stat->grown_workers_count = (sc_uint32)g_atomic_int_get(&manager->grown_workers_count);
+  stat->shrunk_workers_count = (sc_uint32)g_atomic_int_get(&manager->shrunk_workers_count);
+}
+
+void sc_event_emission_manager_get_latency_stat(sc_event_emission_manager * manager, sc_events_latency_stat * stat)
+{
+  sc_events_latency_collect(manager == null_ptr ? null_ptr : &manager->latency, stat);
+}
+
+void sc_event_emission_manager_wait_begin()
+{
+  sc_event_emission_manager * manager = g_private_get(&is_worker_thread);
+  if (manager == null_ptr)
+    return;
+
+  sc_uint32 const depth = GPOINTER_TO_UINT(g_private_get(&wait_depth));
+  g_private_set(&wait_depth, GUINT_TO_POINTER(depth + 1));
+  if (depth == 0)
+    g_atomic_int_inc(&manager->blocked_workers_count);
+}
+
+void sc_event_emission_manager_wait_end()
+{
+  sc_event_emission_manager * manager = g_private_get(&is_worker_thread);
+  if (manager == null_ptr)
+    return;
+
+  sc_uint32 const depth = GPOINTER_TO_UINT(g_private_get(&wait_depth));
+  if (depth == 0)
+    return;
+
+  g_private_set(&wait_depth, GUINT_TO_POINTER(depth - 1));
+  if (depth == 1)
+    g_atomic_int_add(&manager->blocked_workers_count, -1);
+}
+
+sc_result sc_event_emission_manager_post_task(
+    sc_event_emission_manager * manager,
+    sc_memory_task_callback callback,
+    sc_pointer data)
+{
+  if (manager == null_ptr || callback == null_ptr)
+    return SC_RESULT_ERROR;
+
+  sc_event const event = {
+      .task = callback,
+      .task_data = data,
+      .emission_time = g_get_monotonic_time(),
+  };
+
+  sc_result result = SC_RESULT_ERROR;
+  g_atomic_int_inc(&manager->producers_count);
+  if (g_atomic_int_get(&manager->is_accepting) == SC_TRUE)
+  {
+    _sc_event_emission_manager_push(manager, SC_EVENT_PRIORITY_NORMAL, &event);
+    result = SC_RESULT_OK;
+  }
+  g_atomic_int_add(&manager->producers_count, -1);
+  return result;
+}
+
 void _sc_event_emission_manager_add(
     sc_event_emission_manager * manager,
     sc_event_subscription * event_subscription,
     sc_addr user_addr,
+    sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
     sc_addr other_addr,
@@ -201,10 +943,24 @@ void _sc_event_emission_manager_add(
   if (manager == null_ptr)
     return;
 
-  sc_event * event =
-      _sc_event_new(event_subscription, user_addr, connector_addr, connector_type, other_addr, callback, event_addr);
-
-  sc_monitor_acquire_write(&manager->pool_monitor);
-  g_thread_pool_push(manager->thread_pool, event, null_ptr);
-  sc_monitor_release_write(&manager->pool_monitor);
+  sc_event const event = {
+      .event_subscription = event_subscription,
+      .user_addr = user_addr,
+      .subscription_addr = subscription_addr,
+      .connector_addr = connector_addr,
+      .connector_type = connector_type,
+      .other_addr = other_addr,
+      .callback = callback,
+      .event_addr = event_addr,
+      .emission_time = g_get_monotonic_time(),
+  };
+
+  sc_event_priority const priority = event_subscription == null_ptr
+                                         ? SC_EVENT_PRIORITY_NORMAL
+                                         : sc_event_subscription_get_priority(event_subscription);
+
+  g_atomic_int_inc(&manager->producers_count);
+  if (g_atomic_int_get(&manager->is_accepting) == SC_TRUE)
+    _sc_event_emission_manager_push(manager, priority, &event);
+  g_atomic_int_add(&manager->producers_count, -1);
 }
@@ -7,6 +7,7 @@
 #ifndef _sc_event_queue_h_
 #define _sc_event_queue_h_
 
+#include "sc-core/sc_memory.h"
 #include "sc-core/sc_memory_params.h"
 
 #include "sc-core/sc_types.h"
@@ -15,11 +16,38 @@
 
 #include "sc-store/sc-container/sc_hash_table.h"
 #include "sc-store/sc-base/sc_monitor_private.h"
+#include "sc-store/sc-base/sc_mutex_private.h"
+#include "sc-store/sc-base/sc_condition_private.h"
+#include "sc-store/sc-base/sc_thread.h"
+#include "sc-store/sc-event/sc_event_latency.h"
 
 typedef sc_result (*sc_event_do_after_callback)(sc_memory_context const * ctx, sc_addr addr);
 
+typedef struct _sc_event_emission_lane sc_event_emission_lane;
+
+//! Policies applied to emitted sc-event when queue of sc-events with its priority is full.
+typedef enum
+{
+  SC_EVENTS_QUEUE_OVERFLOW_SPILL,        ///< Sc-event is put to unbounded queue of spilled sc-events.
+  SC_EVENTS_QUEUE_OVERFLOW_BLOCK,        ///< Producer waits until workers take some sc-event from queue.
+  SC_EVENTS_QUEUE_OVERFLOW_DROP_OLDEST,  ///< The oldest queued sc-event is dropped.
+} sc_events_queue_overflow_policy;
+
+//! States of slots of worker threads.
+typedef enum
+{
+  SC_EVENT_EMISSION_WORKER_EMPTY,     ///< Slot has no worker thread.
+  SC_EVENT_EMISSION_WORKER_RUNNING,   ///< Worker thread processes sc-events.
+  SC_EVENT_EMISSION_WORKER_RETIRING,  ///< Worker thread should exit after processing current sc-event.
+  SC_EVENT_EMISSION_WORKER_EXITED,    ///< Worker thread has exited and should be joined.
+} sc_event_emission_worker_state;
+
 /*! Structure representing an sc-event emission manager.
- * @note This structure manages the asynchronous processing of sc-events using a thread pool.
+ * @note This structure manages the asynchronous processing of sc-events using worker threads. Emitted sc-events are
+ * pushed to lock-free lanes of their priorities: each producer thread pushes to its own lane, each worker pops from
+ * its own lane and steals sc-events from other lanes when its lane is empty. Workers take sc-events with high priority
+ * before sc-events with normal priority. Records of sc-events are stored in cells of lanes, so emission doesn't
+ * allocate memory until all lanes of priority are full.
  */
 typedef struct
 {
@@ -30,14 +58,53 @@ typedef struct
                                             ///< sc-memory shutdown.
   sc_bool running;                          ///< Flag indicating whether the event emission manager is running.
   sc_monitor destroy_monitor;               ///< Monitor for synchronizing access to the destruction process.
-  GThreadPool * thread_pool;                ///< Thread pool used for worker threads processing events.
-  sc_monitor pool_monitor;                  ///< Monitor for synchronizing access to the thread pool.
+  sc_monitor pool_monitor;  ///< Monitor for synchronizing access to the queue of deletable sc-event subscriptions.
+
+  sc_event_emission_lane * lanes;  ///< Lock-free lanes of emitted sc-events, `lanes_count` lanes per priority.
+  sc_uint32 lanes_count;           ///< Number of lanes of each priority.
+  sc_queue spilled_events[SC_EVENT_PRIORITY_COUNT];  ///< Queues of sc-events that didn't fit in full lanes.
+  sc_mutex spilled_events_mutex;  ///< Mutex for synchronizing access to the queues of spilled sc-events.
+  sc_int32 spilled_events_count[SC_EVENT_PRIORITY_COUNT];  ///< Numbers of spilled sc-events, read without lock.
+
+  sc_int32 queued_events_count[SC_EVENT_PRIORITY_COUNT];  ///< Numbers of sc-events waiting for processing.
+  sc_uint32 max_queued_events_count;  ///< Number of queued sc-events of one priority at which queue is full.
+  sc_events_queue_overflow_policy overflow_policy;  ///< Policy applied to emitted sc-event when queue is full.
+  sc_int32 blocked_producers_count;  ///< Number of producers waiting for free place in queue.
+  sc_mutex space_mutex;              ///< Mutex used by waiting producers.
+  sc_condition space_condition;      ///< Condition used to wake up waiting producers.
+  sc_int32 dropped_events_count;     ///< Number of sc-events dropped because queue was full.
+  sc_int32 blocked_pushes_count;     ///< Number of pushes that waited for free place in queue.
+
+  sc_thread ** workers;             ///< Slots of worker threads processing sc-events, worker of slot pops from lane
+                                    ///< with the same index.
+  sc_int32 * workers_states;        ///< States of slots of worker threads.
+  sc_int32 workers_count;           ///< Number of running worker threads, they occupy the first slots.
+  sc_int32 sleeping_workers_count;  ///< Number of worker threads waiting for sc-events.
+  sc_int32 blocked_workers_count;   ///< Number of worker threads blocked in wait points.
+
+  sc_bool is_adaptive;                   ///< Flag indicating whether number of worker threads depends on load.
+  sc_uint32 min_workers_count;           ///< Minimum number of worker threads of adaptive pool.
+  sc_uint32 max_runnable_workers_count;  ///< Maximum number of worker threads that aren't blocked in wait points.
+  sc_thread * controller;                ///< Thread that grows and shrinks adaptive pool.
+  sc_bool is_controller_stopping;        ///< Flag indicating whether controller thread should exit.
+  sc_mutex controller_mutex;             ///< Mutex used by controller thread to wait for the next period.
+  sc_condition controller_condition;     ///< Condition used to wake up controller thread on shutdown.
+  sc_int32 grown_workers_count;          ///< Number of worker threads started by controller thread.
+  sc_int32 shrunk_workers_count;         ///< Number of worker threads stopped by controller thread.
+
+  sc_mutex sleep_mutex;             ///< Mutex used by waiting worker threads.
+  sc_condition sleep_condition;     ///< Condition used to wake up waiting worker threads.
+  sc_bool is_stopping;              ///< Flag indicating whether worker threads should exit when lanes are empty.
+  sc_int32 is_accepting;            ///< Flag indicating whether new sc-events are accepted.
+  sc_int32 producers_count;         ///< Number of threads pushing sc-events at the moment.
+
+  sc_events_latency latency;  ///< Latencies of all processed sc-events.
 } sc_event_emission_manager;
 
 /*! Function that initializes an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be initialized.
  * @param params Pointer to the sc-memory params.
- * @note This function initializes the event emission manager, creating a thread pool and necessary monitors.
+ * @note This function initializes the event emission manager, creating lanes, worker threads and necessary monitors.
  */
 void sc_event_emission_manager_initialize(sc_event_emission_manager ** manager, sc_memory_params const * params);
 
@@ -49,13 +116,52 @@ void sc_event_emission_manager_stop(sc_event_emission_manager * manager);
 
 /*! Function that shuts down and frees resources associated with an sc-event emission manager.
  * @param manager Pointer to the sc_event_emission_manager to be shut down.
- * @note This function shuts down and frees resources associated with the event emission manager.
+ * @note This function shuts down and frees resources associated with the event emission manager. Sc-events pushed
+ * before shutdown are processed before worker threads exit, sc-events pushed after shutdown began are dropped.
  */
 void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
 
+/*! Function that marks that current thread starts waiting in wait point, for example, for finish of action.
+ * @note If current thread is worker thread, adaptive pool may start another worker thread, so sc-events aren't starved
+ * while this worker is blocked. Calls may be nested, each call must be paired with the call of
+ * `sc_event_emission_manager_wait_end`.
+ */
+void sc_event_emission_manager_wait_begin();
+
+//! Function that marks that current thread stops waiting in wait point.
+void sc_event_emission_manager_wait_end();
+
+/*! Function that collects statistics of queue of sc-events.
+ * @param manager Pointer to the sc_event_emission_manager.
+ * @param stat Pointer to the statistics to be filled.
+ * @note Counts are read without locks, so they may be slightly outdated.
+ */
+void sc_event_emission_manager_get_stat(sc_event_emission_manager * manager, sc_events_queue_stat * stat);
+
+/*! Function that collects latencies of sc-events processed by worker threads.
+ * @param manager Pointer to the sc_event_emission_manager.
+ * @param stat Pointer to the statistics to be filled.
+ * @note Sc-events of destroyed sc-event subscriptions aren't counted.
+ */
+void sc_event_emission_manager_get_latency_stat(sc_event_emission_manager * manager, sc_events_latency_stat * stat);
+
+/*! Function that posts task to worker threads of an sc-event emission manager.
+ * @param manager Pointer to the sc_event_emission_manager.
+ * @param callback A callback of task.
+ * @param data An argument of callback.
+ * @returns SC_RESULT_OK if task is queued, SC_RESULT_ERROR if manager doesn't accept sc-events anymore.
+ * @note Task is queued as sc-event of normal priority without sc-event subscription. It is never dropped by overflow
+ * policy and it is called with `is_cancelled` set to SC_TRUE if manager is stopped before task is processed.
+ */
+sc_result sc_event_emission_manager_post_task(
+    sc_event_emission_manager * manager,
+    sc_memory_task_callback callback,
+    sc_pointer data);
+
 /*! Function that adds an sc-event to the event emission manager for processing.
  * @param manager Pointer to the sc_event_emission_manager managing event emission.
  * @param event_subscription A pointer to sc-event subscription.
+ * @param subscription_addr A sc-address of sc-element for which sc-event was emitted.
  * @param connector_addr A sc-address of added/removed sc-connector (just for specified events).
  * @param connector_type A sc-type of added/removed sc-connector (just for specified events).
  * @param other_addr A sc-address of the second sc-element of sc-connector. If \p subscription_addr is a source, then \p
@@ -63,12 +169,18 @@ void sc_event_emission_manager_shutdown(sc_event_emission_manager * manager);
  * @param callback A pointer function that is executed after the execution of a function that was called on the
  * initiated event (it is used for events of erasing sc-connectors and sc-elements and event of changing link content).
  * @param event_addr An argument of callback.
- * @note This function adds an sc-event to the event emission manager for asynchronous processing.
+ * @note This function adds an sc-event to the event emission manager for asynchronous processing. It doesn't take
+ * locks unless all lanes are full, queue is full or some worker thread waits for sc-events. If queue of sc-events
+ * with priority of \p event_subscription is full, then overflow policy of manager is applied: sc-event is spilled,
+ * producer waits for free place (worker threads and producers waiting longer than timeout spill sc-event), or the
+ * oldest queued sc-event is dropped. Sc-events with callbacks are never dropped, because their callbacks complete
+ * erasure of sc-elements.
  */
 void _sc_event_emission_manager_add(
     sc_event_emission_manager * manager,
     sc_event_subscription * event_subscription,
     sc_addr user_addr,
+    sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
     sc_addr other_addr,
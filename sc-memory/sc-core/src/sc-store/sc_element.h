@@ -8,6 +8,7 @@
 #define _sc_element_h_
 
 #include "sc-core/sc_types.h"
+#include "sc-core/sc_platform.h"
 
 struct _sc_arc_info
 {
@@ -67,4 +68,21 @@ struct _sc_element
   sc_uint32 outgoing_arcs_count;
 };
 
+/* Atomic access to states of sc-element. States are changed under monitor of sc-element, but flags changed by these
+ * macros can be read without it.
+ */
+#if SC_COMPILER == SC_COMPILER_MSVC
+#  define sc_element_states_get(_element) (*(sc_states volatile *)&(_element)->flags.states)
+#  define sc_element_states_set(_element, _states) \
+    (*(sc_states volatile *)&(_element)->flags.states |= (sc_states)(_states))
+#  define sc_element_states_reset(_element, _states) \
+    (*(sc_states volatile *)&(_element)->flags.states &= (sc_states) ~(_states))
+#else
+#  define sc_element_states_get(_element) __atomic_load_n(&(_element)->flags.states, __ATOMIC_ACQUIRE)
+#  define sc_element_states_set(_element, _states) \
+    __atomic_fetch_or(&(_element)->flags.states, (sc_states)(_states), __ATOMIC_RELEASE)
+#  define sc_element_states_reset(_element, _states) \
+    __atomic_fetch_and(&(_element)->flags.states, (sc_states) ~(_states), __ATOMIC_RELEASE)
+#endif
+
 #endif
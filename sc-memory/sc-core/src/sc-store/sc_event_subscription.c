@@ -19,18 +19,53 @@
 #include "sc_memory_context_manager.h"
 #include "sc_memory_context_private.h"
 
+#define SC_EVENT_SUBSCRIPTION_MANAGER_SHARDS_COUNT 64
+
+//! Structure representing sc-event subscription with its fields used to choose subscriptions for emitted sc-events.
+typedef struct
+{
+  sc_event_subscription * event_subscription;  ///< A pointer to sc-event subscription.
+  sc_event_type event_type_addr;               ///< Type of listened sc-events.
+  sc_type event_element_type;                  ///< Connector type required to trigger sc-events.
+} sc_event_subscriptions_array_item;
+
+/*! Structure representing array of sc-event subscriptions of sc-element.
+ * @note Array isn't changed after it is put to the table of shard. Subscribing and unsubscribing replace it by changed
+ * copy, so emitters iterate over array without lock, holding a reference to it.
+ */
+typedef struct
+{
+  sc_int32 ref_count;                         ///< Count of references to array: one of table and ones of emitters.
+  sc_uint32 size;                             ///< Count of sc-event subscriptions in array.
+  sc_event_subscriptions_array_item items[];  ///< Sc-event subscriptions.
+} sc_event_subscriptions_array;
+
+/*! Structure representing a shard of sc-event subscription registration manager.
+ * @note Sc-elements are distributed between shards by their sc-addresses, so subscribing and emission for different
+ * sc-elements rarely compete for the same monitor.
+ */
+typedef struct
+{
+  sc_hash_table * subscriptions_table;  ///< Hash table containing arrays of sc-event subscriptions of sc-elements.
+  sc_monitor monitor;                   ///< Monitor for synchronizing access to the table.
+} sc_event_subscription_manager_shard;
+
 /*! Structure representing an sc-event_subscription registration manager.
  * @note This structure manages the registration and removal of sc-events associated with sc-elements.
  */
 struct _sc_event_subscription_manager
 {
-  sc_hash_table * events_table;     ///< Hash table containing registered events.
-  sc_monitor events_table_monitor;  ///< Monitor for synchronizing access to the events table.
+  sc_event_subscription_manager_shard shards[SC_EVENT_SUBSCRIPTION_MANAGER_SHARDS_COUNT];  ///< Shards of table.
+
+  sc_event_subscription_manager_shard global_subscriptions;  ///< Dispatch table containing arrays of global sc-event
+                                                             ///< subscriptions by types of sc-events.
+  sc_int32 global_subscriptions_count;  ///< Count of global sc-event subscriptions, it is read without lock.
 };
 
 #define TABLE_KEY(__Addr) GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(__Addr))
 
-// Pointer to hash table that contains events
+#define SHARD(__Manager, __Addr) \
+  (&(__Manager)->shards[SC_ADDR_LOCAL_TO_INT(__Addr) % SC_EVENT_SUBSCRIPTION_MANAGER_SHARDS_COUNT])
 
 guint events_table_hash_func(gconstpointer pointer)
 {
@@ -42,6 +77,145 @@ gboolean events_table_equal_func(gconstpointer a, gconstpointer b)
   return (a == b);
 }
 
+sc_event_subscriptions_array * _sc_event_subscriptions_array_new(sc_uint32 size)
+{
+  sc_event_subscriptions_array * array = (sc_event_subscriptions_array *)sc_mem_new(
+      sc_char, sizeof(sc_event_subscriptions_array) + size * sizeof(sc_event_subscriptions_array_item));
+  array->ref_count = 1;
+  array->size = size;
+  return array;
+}
+
+void _sc_event_subscriptions_array_ref(sc_event_subscriptions_array * array)
+{
+  g_atomic_int_inc(&array->ref_count);
+}
+
+void _sc_event_subscriptions_array_unref(sc_event_subscriptions_array * array)
+{
+  if (array != null_ptr && g_atomic_int_dec_and_test(&array->ref_count))
+    sc_mem_free(array);
+}
+
+void _sc_event_subscriptions_array_destroy(sc_pointer array)
+{
+  _sc_event_subscriptions_array_unref(array);
+}
+
+/*! Replaces array of sc-event subscriptions by the specified key in table by its copy with added sc-event subscription.
+ * @note It is called under lock of table.
+ */
+void _sc_event_subscriptions_table_add(
+    sc_hash_table * table,
+    sc_pointer key,
+    sc_event_subscription * event_subscription)
+{
+  sc_event_subscriptions_array * array = sc_hash_table_get(table, key);
+  sc_uint32 const size = array == null_ptr ? 0 : array->size;
+  sc_event_subscriptions_array * new_array = _sc_event_subscriptions_array_new(size + 1);
+  if (size != 0)
+    sc_mem_cpy(new_array->items, array->items, size * sizeof(sc_event_subscriptions_array_item));
+  new_array->items[size] = (sc_event_subscriptions_array_item){
+      .event_subscription = event_subscription,
+      .event_type_addr = event_subscription->event_type_addr,
+      .event_element_type = event_subscription->event_element_type,
+  };
+  // previous array is unreferenced by table
+  sc_hash_table_insert(table, key, new_array);
+}
+
+/*! Replaces array of sc-event subscriptions by the specified key in table by its copy without removed sc-event
+ * subscription.
+ * @param is_empty Flag that is set if there are no more sc-event subscriptions by the key.
+ * @returns SC_FALSE if there is no such sc-event subscription by the key.
+ * @note It is called under lock of table.
+ */
+sc_bool _sc_event_subscriptions_table_remove(
+    sc_hash_table * table,
+    sc_pointer key,
+    sc_event_subscription * event_subscription,
+    sc_bool * is_empty)
+{
+  sc_event_subscriptions_array * array = sc_hash_table_get(table, key);
+  if (array == null_ptr)
+    return SC_FALSE;
+
+  sc_event_subscriptions_array * new_array = _sc_event_subscriptions_array_new(array->size);
+  new_array->size = 0;
+  for (sc_uint32 i = 0; i < array->size; ++i)
+  {
+    if (array->items[i].event_subscription != event_subscription)
+      new_array->items[new_array->size++] = array->items[i];
+  }
+
+  if (new_array->size == array->size)
+  {
+    _sc_event_subscriptions_array_unref(new_array);
+    return SC_FALSE;
+  }
+
+  *is_empty = new_array->size == 0;
+  if (*is_empty)
+  {
+    _sc_event_subscriptions_array_unref(new_array);
+    sc_hash_table_remove(table, key);
+  }
+  else
+    sc_hash_table_insert(table, key, new_array);
+
+  return SC_TRUE;
+}
+
+/*! Gets array of sc-event subscriptions by the specified key in table of shard and references it.
+ * @returns A pointer to array that should be unreferenced after usage, or null_ptr if there are no subscriptions.
+ */
+sc_event_subscriptions_array * _sc_event_subscription_manager_shard_get(
+    sc_event_subscription_manager_shard * shard,
+    sc_pointer key)
+{
+  sc_monitor_acquire_read(&shard->monitor);
+  sc_event_subscriptions_array * array = null_ptr;
+  if (shard->subscriptions_table != null_ptr)
+    array = sc_hash_table_get(shard->subscriptions_table, key);
+  if (array != null_ptr)
+    _sc_event_subscriptions_array_ref(array);
+  sc_monitor_release_read(&shard->monitor);
+
+  return array;
+}
+
+/*! Updates flag of sc-element indicating whether it has sc-event subscriptions by the table of its shard.
+ * @returns SC_FALSE if sc-element doesn't exist.
+ * @note It is called without lock of shard. Monitor of sc-element is acquired before monitor of shard, as emitters of
+ * sc-events do, and flag is computed from the table under both monitors, so concurrent subscribing and unsubscribing
+ * can't leave it stale.
+ */
+sc_bool _sc_event_subscription_manager_update_element_flag(
+    sc_event_subscription_manager_shard * shard,
+    sc_addr subscription_addr)
+{
+  sc_monitor * monitor =
+      sc_monitor_table_get_monitor_for_addr(&sc_storage_get()->addr_monitors_table, subscription_addr);
+  sc_monitor_acquire_write(monitor);
+  sc_element * element;
+  sc_result const result = sc_storage_get_element_by_addr(subscription_addr, &element);
+  if (result == SC_RESULT_OK)
+  {
+    sc_monitor_acquire_read(&shard->monitor);
+    sc_bool const has_subscriptions =
+        shard->subscriptions_table != null_ptr
+        && sc_hash_table_get(shard->subscriptions_table, TABLE_KEY(subscription_addr)) != null_ptr;
+    sc_monitor_release_read(&shard->monitor);
+
+    if (has_subscriptions)
+      sc_element_states_set(element, SC_STATE_HAS_SUBSCRIPTIONS);
+    else
+      sc_element_states_reset(element, SC_STATE_HAS_SUBSCRIPTIONS);
+  }
+  sc_monitor_release_write(monitor);
+  return result == SC_RESULT_OK;
+}
+
 /*! Adds the specified sc-event_subscription to the registration manager's events table.
  * @param manager Pointer to the sc-event_subscription registration manager.
  * @param event_subscription Pointer to the sc-event_subscription to be added.
@@ -51,28 +225,35 @@ sc_result _sc_event_subscription_manager_add(
     sc_event_subscription_manager * manager,
     sc_event_subscription * event_subscription)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-
   // the first, if table doesn't exist, then return error
   if (manager == null_ptr)
     return SC_RESULT_NO;
 
-  sc_monitor_acquire_write(&manager->events_table_monitor);
+  sc_addr const subscription_addr = event_subscription->subscription_addr;
+  sc_event_subscription_manager_shard * shard = SHARD(manager, subscription_addr);
+  sc_monitor_acquire_write(&shard->monitor);
 
-  if (manager->events_table == null_ptr)
+  if (shard->subscriptions_table == null_ptr)
   {
-    sc_monitor_release_write(&manager->events_table_monitor);
+    sc_monitor_release_write(&shard->monitor);
     return SC_RESULT_NO;
   }
 
-  // if there are no events for specified sc-element, then generate new events list
-  element_events_list =
-      (sc_hash_table_list *)sc_hash_table_get(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
-  element_events_list = sc_hash_table_list_append(element_events_list, (sc_pointer)event_subscription);
-  sc_hash_table_insert(
-      manager->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
+  _sc_event_subscriptions_table_add(shard->subscriptions_table, TABLE_KEY(subscription_addr), event_subscription);
 
-  sc_monitor_release_write(&manager->events_table_monitor);
+  sc_monitor_release_write(&shard->monitor);
+
+  // flag is set after release of shard monitor, because emitters acquire it under monitor of sc-element
+  if (!_sc_event_subscription_manager_update_element_flag(shard, subscription_addr))
+  {
+    sc_bool is_empty;
+    sc_monitor_acquire_write(&shard->monitor);
+    if (shard->subscriptions_table != null_ptr)
+      _sc_event_subscriptions_table_remove(
+          shard->subscriptions_table, TABLE_KEY(subscription_addr), event_subscription, &is_empty);
+    sc_monitor_release_write(&shard->monitor);
+    return SC_RESULT_NO;
+  }
 
   return SC_RESULT_OK;
 }
@@ -86,47 +267,127 @@ sc_result _sc_event_subscription_manager_remove(
     sc_event_subscription_manager * manager,
     sc_event_subscription * event_subscription)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-
   // the first, if table doesn't exist, then return error
   if (manager == null_ptr)
     return SC_RESULT_NO;
 
-  sc_monitor_acquire_write(&manager->events_table_monitor);
-  element_events_list =
-      (sc_hash_table_list *)sc_hash_table_get(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
-  if (element_events_list == null_ptr)
+  sc_addr const subscription_addr = event_subscription->subscription_addr;
+  sc_event_subscription_manager_shard * shard = SHARD(manager, subscription_addr);
+  sc_monitor_acquire_write(&shard->monitor);
+
+  if (shard->subscriptions_table == null_ptr)
     goto error;
 
-  if (manager->events_table == null_ptr)
+  sc_bool is_empty;
+  if (!_sc_event_subscriptions_table_remove(
+          shard->subscriptions_table, TABLE_KEY(subscription_addr), event_subscription, &is_empty))
     goto error;
 
-  // remove event_subscription from list of events for specified sc-element
-  element_events_list = sc_hash_table_list_remove(element_events_list, (sc_const_pointer)event_subscription);
-  if (element_events_list == null_ptr)
-    sc_hash_table_remove(manager->events_table, TABLE_KEY(event_subscription->subscription_addr));
-  else
-    sc_hash_table_insert(
-        manager->events_table, TABLE_KEY(event_subscription->subscription_addr), (sc_pointer)element_events_list);
+  sc_monitor_release_write(&shard->monitor);
+
+  // flag is reset after release of shard monitor, because emitters acquire it under monitor of sc-element
+  if (is_empty)
+    _sc_event_subscription_manager_update_element_flag(shard, subscription_addr);
 
-  sc_monitor_release_write(&manager->events_table_monitor);
   return SC_RESULT_OK;
 error:
-  sc_monitor_release_write(&manager->events_table_monitor);
+  sc_monitor_release_write(&shard->monitor);
   return SC_RESULT_ERROR_INVALID_PARAMS;
 }
 
+/*! Gets array of sc-event subscriptions of sc-element and references it.
+ * @returns A pointer to array that should be unreferenced after usage, or null_ptr if sc-element has no
+ * subscriptions.
+ */
+sc_event_subscriptions_array * _sc_event_subscription_manager_get(
+    sc_event_subscription_manager * manager,
+    sc_addr subscription_addr)
+{
+  return _sc_event_subscription_manager_shard_get(SHARD(manager, subscription_addr), TABLE_KEY(subscription_addr));
+}
+
+/*! Adds the specified global sc-event subscription to the dispatch table of the registration manager.
+ * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_NO otherwise.
+ */
+sc_result _sc_event_subscription_manager_add_global(
+    sc_event_subscription_manager * manager,
+    sc_event_subscription * event_subscription)
+{
+  if (manager == null_ptr)
+    return SC_RESULT_NO;
+
+  sc_event_subscription_manager_shard * shard = &manager->global_subscriptions;
+  sc_monitor_acquire_write(&shard->monitor);
+
+  if (shard->subscriptions_table == null_ptr)
+  {
+    sc_monitor_release_write(&shard->monitor);
+    return SC_RESULT_NO;
+  }
+
+  _sc_event_subscriptions_table_add(
+      shard->subscriptions_table, TABLE_KEY(event_subscription->event_type_addr), event_subscription);
+  g_atomic_int_inc(&manager->global_subscriptions_count);
+
+  sc_monitor_release_write(&shard->monitor);
+
+  return SC_RESULT_OK;
+}
+
+/*! Removes the specified global sc-event subscription from the dispatch table of the registration manager.
+ * @return Returns SC_RESULT_OK if the operation is successful, SC_RESULT_ERROR_INVALID_PARAMS otherwise.
+ */
+sc_result _sc_event_subscription_manager_remove_global(
+    sc_event_subscription_manager * manager,
+    sc_event_subscription * event_subscription)
+{
+  if (manager == null_ptr)
+    return SC_RESULT_NO;
+
+  sc_event_subscription_manager_shard * shard = &manager->global_subscriptions;
+  sc_monitor_acquire_write(&shard->monitor);
+
+  sc_bool is_empty;
+  if (shard->subscriptions_table == null_ptr
+      || !_sc_event_subscriptions_table_remove(
+          shard->subscriptions_table, TABLE_KEY(event_subscription->event_type_addr), event_subscription, &is_empty))
+  {
+    sc_monitor_release_write(&shard->monitor);
+    return SC_RESULT_ERROR_INVALID_PARAMS;
+  }
+
+  g_atomic_int_add(&manager->global_subscriptions_count, -1);
+
+  sc_monitor_release_write(&shard->monitor);
+  return SC_RESULT_OK;
+}
+
 void sc_event_subscription_manager_initialize(sc_event_subscription_manager ** manager)
 {
   (*manager) = sc_mem_new(sc_event_subscription_manager, 1);
-  (*manager)->events_table = sc_hash_table_init(events_table_hash_func, events_table_equal_func, null_ptr, null_ptr);
-  sc_monitor_init(&(*manager)->events_table_monitor);
+  for (sc_uint32 i = 0; i < SC_EVENT_SUBSCRIPTION_MANAGER_SHARDS_COUNT; ++i)
+  {
+    sc_event_subscription_manager_shard * shard = &(*manager)->shards[i];
+    shard->subscriptions_table = sc_hash_table_init(
+        events_table_hash_func, events_table_equal_func, null_ptr, _sc_event_subscriptions_array_destroy);
+    sc_monitor_init(&shard->monitor);
+  }
+
+  (*manager)->global_subscriptions.subscriptions_table = sc_hash_table_init(
+      events_table_hash_func, events_table_equal_func, null_ptr, _sc_event_subscriptions_array_destroy);
+  sc_monitor_init(&(*manager)->global_subscriptions.monitor);
 }
 
 void sc_event_subscription_manager_shutdown(sc_event_subscription_manager * manager)
 {
-  sc_monitor_destroy(&manager->events_table_monitor);
-  sc_hash_table_destroy(manager->events_table);
+  for (sc_uint32 i = 0; i < SC_EVENT_SUBSCRIPTION_MANAGER_SHARDS_COUNT; ++i)
+  {
+    sc_event_subscription_manager_shard * shard = &manager->shards[i];
+    sc_monitor_destroy(&shard->monitor);
+    sc_hash_table_destroy(shard->subscriptions_table);
+  }
+  sc_monitor_destroy(&manager->global_subscriptions.monitor);
+  sc_hash_table_destroy(manager->global_subscriptions.subscriptions_table);
   sc_mem_free(manager);
 }
 
@@ -152,14 +413,21 @@ sc_event_subscription * sc_event_subscription_new(
   event_subscription->event_element_type = 0;
   event_subscription->callback = callback;
   event_subscription->callback_with_user = null_ptr;
+  event_subscription->callback_global = null_ptr;
   event_subscription->delete_callback = delete_callback;
   event_subscription->data = data;
   event_subscription->ref_count = 1;
+  event_subscription->priority = SC_EVENT_PRIORITY_NORMAL;
   sc_monitor_init(&event_subscription->monitor);
 
   // register generated event_subscription
   sc_event_subscription_manager * manager = sc_storage_get_event_subscription_manager();
-  _sc_event_subscription_manager_add(manager, event_subscription);
+  if (_sc_event_subscription_manager_add(manager, event_subscription) != SC_RESULT_OK)
+  {
+    sc_monitor_destroy(&event_subscription->monitor);
+    sc_mem_free(event_subscription);
+    return null_ptr;
+  }
 
   return event_subscription;
 }
@@ -187,14 +455,61 @@ sc_event_subscription * sc_event_subscription_with_user_new(
   event_subscription->event_element_type = event_element_type;
   event_subscription->callback = null_ptr;
   event_subscription->callback_with_user = callback;
+  event_subscription->callback_global = null_ptr;
   event_subscription->delete_callback = delete_callback;
   event_subscription->data = data;
   event_subscription->ref_count = 1;
+  event_subscription->priority = SC_EVENT_PRIORITY_NORMAL;
   sc_monitor_init(&event_subscription->monitor);
 
   // register generated event_subscription
   sc_event_subscription_manager * manager = sc_storage_get_event_subscription_manager();
-  _sc_event_subscription_manager_add(manager, event_subscription);
+  if (_sc_event_subscription_manager_add(manager, event_subscription) != SC_RESULT_OK)
+  {
+    sc_monitor_destroy(&event_subscription->monitor);
+    sc_mem_free(event_subscription);
+    return null_ptr;
+  }
+
+  return event_subscription;
+}
+
+sc_event_subscription * sc_event_global_subscription_new(
+    sc_memory_context const * ctx,
+    sc_event_type event_type_addr,
+    sc_type event_element_type,
+    sc_addr set_addr,
+    sc_pointer data,
+    sc_event_global_callback callback,
+    sc_event_subscription_delete_function delete_callback)
+{
+  if (!sc_storage_is_element(ctx, event_type_addr))
+    return null_ptr;
+
+  if (!SC_ADDR_IS_EMPTY(set_addr) && !sc_storage_is_element(ctx, set_addr))
+    return null_ptr;
+
+  sc_event_subscription * event_subscription = sc_mem_new(sc_event_subscription, 1);
+  event_subscription->subscription_addr = SC_ADDR_EMPTY;
+  event_subscription->set_addr = set_addr;
+  event_subscription->event_type_addr = event_type_addr;
+  event_subscription->event_element_type = event_element_type;
+  event_subscription->callback = null_ptr;
+  event_subscription->callback_with_user = null_ptr;
+  event_subscription->callback_global = callback;
+  event_subscription->delete_callback = delete_callback;
+  event_subscription->data = data;
+  event_subscription->ref_count = 1;
+  event_subscription->priority = SC_EVENT_PRIORITY_NORMAL;
+  sc_monitor_init(&event_subscription->monitor);
+
+  sc_event_subscription_manager * manager = sc_storage_get_event_subscription_manager();
+  if (_sc_event_subscription_manager_add_global(manager, event_subscription) != SC_RESULT_OK)
+  {
+    sc_monitor_destroy(&event_subscription->monitor);
+    sc_mem_free(event_subscription);
+    return null_ptr;
+  }
 
   return event_subscription;
 }
@@ -208,7 +523,10 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
   sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
 
   sc_monitor_acquire_write(&event_subscription->monitor);
-  if (_sc_event_subscription_manager_remove(subscription_manager, event_subscription) != SC_RESULT_OK)
+  sc_result const result = SC_ADDR_IS_EMPTY(event_subscription->subscription_addr)
+                               ? _sc_event_subscription_manager_remove_global(subscription_manager, event_subscription)
+                               : _sc_event_subscription_manager_remove(subscription_manager, event_subscription);
+  if (result != SC_RESULT_OK)
   {
     sc_monitor_release_write(&event_subscription->monitor);
     return SC_RESULT_ERROR;
@@ -219,10 +537,12 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
 
   event_subscription->ref_count = SC_EVENT_REQUEST_DESTROY;
   event_subscription->subscription_addr = SC_ADDR_EMPTY;
+  event_subscription->set_addr = SC_ADDR_EMPTY;
   event_subscription->event_type_addr = SC_ADDR_EMPTY;
   event_subscription->event_element_type = 0;
   event_subscription->callback = null_ptr;
   event_subscription->callback_with_user = null_ptr;
+  event_subscription->callback_global = null_ptr;
   event_subscription->delete_callback = null_ptr;
   event_subscription->data = null_ptr;
 
@@ -240,32 +560,34 @@ sc_result sc_event_subscription_destroy(sc_event_subscription * event_subscripti
 
 sc_result sc_event_notify_element_deleted(sc_addr element)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-  sc_event_subscription * event_subscription = null_ptr;
-
   sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
   sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
 
   // do nothing, if there are no registered events
-  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
+  if (subscription_manager == null_ptr)
     goto result;
 
   // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
   // lookup for all registered to specified sc-element events
-  sc_monitor_acquire_write(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
+  sc_event_subscription_manager_shard * shard = SHARD(subscription_manager, element);
+  sc_monitor_acquire_write(&shard->monitor);
+  sc_event_subscriptions_array * array = null_ptr;
+  if (shard->subscriptions_table != null_ptr)
   {
-    element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(element));
-    if (element_events_list != null_ptr)
-      sc_hash_table_remove(subscription_manager->events_table, TABLE_KEY(element));
+    array = sc_hash_table_get(shard->subscriptions_table, TABLE_KEY(element));
+    if (array != null_ptr)
+    {
+      // array is unreferenced by table after removal
+      _sc_event_subscriptions_array_ref(array);
+      sc_hash_table_remove(shard->subscriptions_table, TABLE_KEY(element));
+    }
   }
 
-  if (element_events_list != null_ptr)
+  if (array != null_ptr)
   {
-    while (element_events_list != null_ptr)
+    for (sc_uint32 i = 0; i < array->size; ++i)
     {
-      event_subscription = (sc_event_subscription *)element_events_list->data;
+      sc_event_subscription * event_subscription = array->items[i].event_subscription;
 
       // mark event_subscription for deletion
       sc_monitor_acquire_write(&event_subscription->monitor);
@@ -275,12 +597,10 @@ sc_result sc_event_notify_element_deleted(sc_addr element)
       sc_monitor_release_write(&emission_manager->pool_monitor);
 
       sc_monitor_release_write(&event_subscription->monitor);
-
-      element_events_list = sc_hash_table_list_remove_sublist(element_events_list, element_events_list);
     }
-    sc_hash_table_list_destroy(element_events_list);
+    _sc_event_subscriptions_array_unref(array);
   }
-  sc_monitor_release_write(&subscription_manager->events_table_monitor);
+  sc_monitor_release_write(&shard->monitor);
 
 result:
   return SC_RESULT_OK;
@@ -302,17 +622,20 @@ sc_result sc_event_emit(
   if (_sc_memory_context_are_events_blocking(ctx))
     return SC_RESULT_NO;
 
-  if (_sc_memory_context_are_events_pending(ctx))
-  {
-    _sc_memory_context_pend_event(ctx, event_type_addr, subscription_addr, connector_addr, connector_type, other_addr);
+  if (_sc_memory_context_pend_event(
+          ctx, event_type_addr, subscription_addr, connector_addr, connector_type, other_addr, callback, event_addr))
     return SC_RESULT_OK;
-  }
 
   return sc_event_emit_impl(
       ctx, subscription_addr, event_type_addr, connector_addr, connector_type, other_addr, callback, event_addr);
 }
 
-sc_result sc_event_emit_impl(
+/*! Adds sc-events for sc-event subscriptions of array that match the emitted sc-event to the emission manager.
+ * @returns SC_TRUE if some sc-event subscription matches the emitted sc-event.
+ */
+sc_bool _sc_event_subscriptions_array_emit(
+    sc_event_subscriptions_array const * array,
+    sc_event_emission_manager * emission_manager,
     sc_memory_context const * ctx,
     sc_addr subscription_addr,
     sc_event_type event_type_addr,
@@ -322,47 +645,100 @@ sc_result sc_event_emit_impl(
     sc_event_do_after_callback callback,
     sc_addr event_addr)
 {
-  sc_hash_table_list * element_events_list = null_ptr;
-  sc_event_subscription * event_subscription = null_ptr;
-
-  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
-  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
-
-  // if table is empty, then do nothing
-  sc_result result = SC_RESULT_NO;
-  if (subscription_manager == null_ptr || subscription_manager->events_table == null_ptr)
-    goto result;
-
-  // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
-  // lookup for all registered to specified sc-element events
-  sc_monitor_acquire_read(&subscription_manager->events_table_monitor);
-  if (subscription_manager != null_ptr)
-    element_events_list =
-        (sc_hash_table_list *)sc_hash_table_get(subscription_manager->events_table, TABLE_KEY(subscription_addr));
-
-  while (element_events_list != null_ptr)
+  sc_bool is_matched = SC_FALSE;
+  for (sc_uint32 i = 0; i < array->size; ++i)
   {
-    event_subscription = (sc_event_subscription *)element_events_list->data;
+    sc_event_subscriptions_array_item const * item = &array->items[i];
 
-    if (SC_ADDR_IS_EQUAL(event_subscription->event_type_addr, event_type_addr)
-        && ((event_subscription->event_element_type & connector_type) == event_subscription->event_element_type))
+    if (SC_ADDR_IS_EQUAL(item->event_type_addr, event_type_addr)
+        && ((item->event_element_type & connector_type) == item->event_element_type))
     {
       _sc_event_emission_manager_add(
           emission_manager,
-          event_subscription,
+          item->event_subscription,
           ctx->user_addr,
+          subscription_addr,
           connector_addr,
           connector_type,
           other_addr,
           callback,
           event_addr);
 
-      result = SC_RESULT_OK;
+      is_matched = SC_TRUE;
     }
+  }
+
+  return is_matched;
+}
+
+sc_result sc_event_emit_impl(
+    sc_memory_context const * ctx,
+    sc_addr subscription_addr,
+    sc_event_type event_type_addr,
+    sc_addr connector_addr,
+    sc_type connector_type,
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr)
+{
+  sc_event_subscription_manager * subscription_manager = sc_storage_get_event_subscription_manager();
+  sc_event_emission_manager * emission_manager = sc_storage_get_event_emission_manager();
 
-    element_events_list = element_events_list->next;
+  // if table is empty, then do nothing
+  sc_result result = SC_RESULT_NO;
+  if (subscription_manager == null_ptr)
+    goto result;
+
+  sc_event_subscriptions_array * array;
+
+  // sc-elements without sc-event subscriptions aren't looked up in table
+  sc_element * element;
+  if (sc_storage_get_element_by_addr(subscription_addr, &element) == SC_RESULT_OK
+      && (sc_element_states_get(element) & SC_STATE_HAS_SUBSCRIPTIONS) == SC_STATE_HAS_SUBSCRIPTIONS)
+  {
+    // TODO(NikitaZotov): Implement monitor for `subscription_manager` to synchronize its freeing.
+    // lookup for all registered to specified sc-element events
+    array = _sc_event_subscription_manager_get(subscription_manager, subscription_addr);
+    if (array != null_ptr)
+    {
+      if (_sc_event_subscriptions_array_emit(
+              array,
+              emission_manager,
+              ctx,
+              subscription_addr,
+              event_type_addr,
+              connector_addr,
+              connector_type,
+              other_addr,
+              callback,
+              event_addr))
+        result = SC_RESULT_OK;
+      _sc_event_subscriptions_array_unref(array);
+    }
+  }
+
+  // dispatch table isn't looked up while there are no global sc-event subscriptions
+  if (g_atomic_int_get(&subscription_manager->global_subscriptions_count) == 0)
+    goto result;
+
+  array = _sc_event_subscription_manager_shard_get(
+      &subscription_manager->global_subscriptions, TABLE_KEY(event_type_addr));
+  if (array != null_ptr)
+  {
+    if (_sc_event_subscriptions_array_emit(
+            array,
+            emission_manager,
+            ctx,
+            subscription_addr,
+            event_type_addr,
+            connector_addr,
+            connector_type,
+            other_addr,
+            callback,
+            event_addr))
+      result = SC_RESULT_OK;
+    _sc_event_subscriptions_array_unref(array);
   }
-  sc_monitor_release_read(&subscription_manager->events_table_monitor);
 
 result:
   return result;
@@ -373,6 +749,26 @@ sc_bool sc_event_subscription_is_deletable(sc_event_subscription const * event_s
   return event_subscription->ref_count == SC_EVENT_REQUEST_DESTROY;
 }
 
+void sc_event_subscription_set_priority(sc_event_subscription * event_subscription, sc_event_priority priority)
+{
+  if (priority >= SC_EVENT_PRIORITY_COUNT)
+    return;
+
+  g_atomic_int_set(&event_subscription->priority, priority);
+}
+
+sc_event_priority sc_event_subscription_get_priority(sc_event_subscription const * event_subscription)
+{
+  return (sc_event_priority)g_atomic_int_get(&event_subscription->priority);
+}
+
+void sc_event_subscription_get_latency_stat(
+    sc_event_subscription const * event_subscription,
+    sc_events_latency_stat * stat)
+{
+  sc_events_latency_collect(g_atomic_pointer_get(&event_subscription->latency), stat);
+}
+
 sc_pointer sc_event_subscription_get_data(sc_event_subscription const * event_subscription)
 {
   return event_subscription->data;
@@ -660,11 +660,15 @@ sc_result _sc_storage_element_erase(sc_addr addr)
   }
 
   sc_monitor_acquire_write(monitor);
+  // flag is read under monitor, so sc-event subscriptions can't be added after it is read
+  sc_bool const has_subscriptions =
+      (sc_element_states_get(element) & SC_STATE_HAS_SUBSCRIPTIONS) == SC_STATE_HAS_SUBSCRIPTIONS;
   sc_storage_free_element(addr);
   sc_monitor_release_write(monitor);
 
   // erase registered events before deletion
-  sc_event_notify_element_deleted(addr);
+  if (has_subscriptions)
+    sc_event_notify_element_deleted(addr);
 
   return result;
 }
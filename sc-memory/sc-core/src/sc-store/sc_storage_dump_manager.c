@@ -7,10 +7,13 @@
 #include "sc_storage_dump_manager.h"
 
 #include <unistd.h>
+#include <glib.h>
 
 #include "sc-core/sc-base/sc_allocator.h"
+#include "sc-core/sc_event_subscription.h"
 
 #include "sc_storage.h"
+#include "sc_storage_private.h"
 #include "sc_memory_private.h"
 
 typedef void (*sc_timed_callback)();
@@ -30,6 +33,8 @@ struct _sc_storage_dump_manager
   sc_dump_info dump_memory_statistics_info;
 };
 
+static sc_memory_statistics_dump_callback statistics_dump_callback = null_ptr;
+
 void * _sc_timer_check_periodic(void * arg)
 {
   sc_dump_info * dump_info = arg;
@@ -66,6 +71,17 @@ void _sc_storage_dump_timer()
   sc_storage_save(null_ptr);
 }
 
+void _sc_storage_dump_latency_histogram(sc_char const * name, sc_latency_histogram const * histogram)
+{
+  sc_message(
+      "%s: p50 %" PRIu64 " us, p90 %" PRIu64 " us, p99 %" PRIu64 " us, max %" PRIu64 " us",
+      name,
+      sc_latency_histogram_get_percentile(histogram, 50),
+      sc_latency_histogram_get_percentile(histogram, 90),
+      sc_latency_histogram_get_percentile(histogram, 99),
+      histogram->max);
+}
+
 void _sc_storage_dump_statistics_timer()
 {
   sc_memory_info("Dump sc-memory statistics by period");
@@ -82,6 +98,16 @@ void _sc_storage_dump_statistics_timer()
       statistics.connector_count,
       (sc_float)statistics.connector_count / (sc_float)allElements * 100);
   sc_message("Total: %" PRIu64, allElements);
+
+  sc_events_latency_stat latency_statistics;
+  sc_event_emission_manager_get_latency_stat(sc_storage_get_event_emission_manager(), &latency_statistics);
+  sc_message("Processed sc-events: %" PRIu64, latency_statistics.queue_latency.count);
+  _sc_storage_dump_latency_histogram("Sc-events queue latency", &latency_statistics.queue_latency);
+  _sc_storage_dump_latency_histogram("Sc-events execution duration", &latency_statistics.execution_duration);
+
+  sc_memory_statistics_dump_callback const callback = g_atomic_pointer_get(&statistics_dump_callback);
+  if (callback != null_ptr)
+    callback();
 }
 
 void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_memory_params const * params)
@@ -134,3 +160,8 @@ void sc_storage_dump_manager_shutdown(sc_storage_dump_manager * manager)
   }
   sc_mem_free(manager);
 }
+
+void sc_storage_dump_manager_set_statistics_dump_callback(sc_memory_statistics_dump_callback callback)
+{
+  g_atomic_pointer_set(&statistics_dump_callback, callback);
+}
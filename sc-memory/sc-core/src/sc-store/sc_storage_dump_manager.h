@@ -8,6 +8,7 @@
 #define _sc_storage_dumper_
 
 #include "sc-core/sc_memory_params.h"
+#include "sc-core/sc_memory.h"
 
 typedef struct _sc_storage_dump_manager sc_storage_dump_manager;
 
@@ -15,4 +16,6 @@ void sc_storage_dump_manager_initialize(sc_storage_dump_manager ** manager, sc_m
 
 void sc_storage_dump_manager_shutdown(sc_storage_dump_manager * manager);
 
+void sc_storage_dump_manager_set_statistics_dump_callback(sc_memory_statistics_dump_callback callback);
+
 #endif  // _sc_storage_dumper_
@@ -9,6 +9,8 @@
 
 #include "sc-store/sc_storage.h"
 #include "sc-store/sc_storage_private.h"
+#include "sc-store/sc_storage_dump_manager.h"
+#include "sc-store/sc-event/sc_event_queue.h"
 #include "sc_memory_private.h"
 #include "sc-core/sc_helper.h"
 #include "sc_helper_private.h"
@@ -176,7 +178,12 @@ sc_addr sc_memory_context_get_user_addr(sc_memory_context * ctx)
 
 void sc_memory_context_pending_begin(sc_memory_context * ctx)
 {
-  _sc_memory_context_pending_begin(ctx);
+  _sc_memory_context_pending_begin(ctx, SC_FALSE);
+}
+
+void sc_memory_context_pending_begin_ext(sc_memory_context * ctx, sc_bool is_coalescing)
+{
+  _sc_memory_context_pending_begin(ctx, is_coalescing);
 }
 
 void sc_memory_context_pending_end(sc_memory_context * ctx)
@@ -194,6 +201,16 @@ void sc_memory_context_blocking_end(sc_memory_context * ctx)
   _sc_memory_context_blocking_end(ctx);
 }
 
+sc_bool sc_memory_context_are_events_pending(sc_memory_context const * ctx)
+{
+  return _sc_memory_context_are_events_pending(ctx);
+}
+
+sc_bool sc_memory_context_are_events_blocking(sc_memory_context const * ctx)
+{
+  return _sc_memory_context_are_events_blocking(ctx);
+}
+
 sc_bool sc_memory_is_initialized()
 {
   return sc_storage_is_initialized();
@@ -636,6 +653,52 @@ sc_result sc_memory_stat(sc_memory_context const * ctx, sc_stat * statistics)
   return sc_storage_get_elements_stat(statistics);
 }
 
+sc_result sc_memory_events_queue_stat(sc_memory_context const * ctx, sc_events_queue_stat * stat)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_event_emission_manager_get_stat(sc_storage_get_event_emission_manager(), stat);
+  return SC_RESULT_OK;
+}
+
+sc_result sc_memory_events_latency_stat(sc_memory_context const * ctx, sc_events_latency_stat * stat)
+{
+  if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED;
+
+  if (_sc_memory_context_check_global_permissions(memory->context_manager, ctx, SC_CONTEXT_PERMISSIONS_READ)
+      == SC_FALSE)
+    return SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS;
+
+  sc_event_emission_manager_get_latency_stat(sc_storage_get_event_emission_manager(), stat);
+  return SC_RESULT_OK;
+}
+
+void sc_memory_wait_point_begin()
+{
+  sc_event_emission_manager_wait_begin();
+}
+
+void sc_memory_wait_point_end()
+{
+  sc_event_emission_manager_wait_end();
+}
+
+sc_result sc_memory_post_task(sc_memory_task_callback callback, sc_pointer data)
+{
+  return sc_event_emission_manager_post_task(sc_storage_get_event_emission_manager(), callback, data);
+}
+
+void sc_memory_set_statistics_dump_callback(sc_memory_statistics_dump_callback callback)
+{
+  sc_storage_dump_manager_set_statistics_dump_callback(callback);
+}
+
 sc_result sc_memory_save(sc_memory_context const * ctx)
 {
   if (_sc_memory_context_is_authenticated(memory->context_manager, ctx) == SC_FALSE)
@@ -22,18 +22,32 @@
  */
 struct _sc_event_emit_params
 {
-  sc_addr subscription_addr;      ///< sc-address representing the subscription associated with the event.
-  sc_event_type event_type_addr;  ///< Type of the event to be emitted.
-  sc_addr connector_addr;         ///< sc-address representing the connector associated with the event.
-  sc_type connector_type;         ///< sc-type of the connector associated with the event.
-  sc_addr other_addr;             ///< sc-address representing the other element associated with the event.
+  sc_addr subscription_addr;            ///< sc-address representing the subscription associated with the event.
+  sc_event_type event_type_addr;        ///< Type of the event to be emitted.
+  sc_addr connector_addr;               ///< sc-address representing the connector associated with the event.
+  sc_type connector_type;               ///< sc-type of the connector associated with the event.
+  sc_addr other_addr;                   ///< sc-address representing the other element associated with the event.
+  sc_event_do_after_callback callback;  ///< Function that completes erasure of sc-element after the event.
+  sc_addr event_addr;                   ///< An argument of callback.
 };
 
 #define SC_CONTEXT_FLAG_PENDING_EVENTS 0x1
 #define SC_CONTEXT_FLAG_BLOCKING_EVENTS 0x2
+#define SC_CONTEXT_FLAG_COALESCING_EVENTS 0x4
+
+#define SC_CONTEXT_PEND_EVENTS_INITIAL_CAPACITY 64
+
+#define SC_CONTEXT_IDLE_CONTEXTS_MAX_COUNT 256
 
 #define SC_CONTEXT_PERMISSIONS_FULL 0xff
 
+void _sc_memory_context_destroy(sc_memory_context * ctx)
+{
+  sc_monitor_destroy(&ctx->monitor);
+  sc_mem_free(ctx->pend_events);
+  sc_mem_free(ctx);
+}
+
 void _sc_memory_context_manager_initialize(sc_memory_context_manager ** manager, sc_bool user_mode)
 {
   sc_memory_info("Initialize context manager");
@@ -42,12 +56,16 @@ void _sc_memory_context_manager_initialize(sc_memory_context_manager ** manager,
   (*manager)->context_hash_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
   (*manager)->context_count = 0;
   sc_monitor_init(&(*manager)->context_monitor);
+  (*manager)->idle_contexts = sc_mem_new(sc_memory_context *, SC_CONTEXT_IDLE_CONTEXTS_MAX_COUNT);
+  (*manager)->idle_contexts_count = 0;
   (*manager)->user_mode = user_mode;
-  (*manager)->user_global_permissions = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+  (*manager)->is_permissions_batch = SC_FALSE;
+  (*manager)->user_global_permissions_draft = null_ptr;
+  (*manager)->user_local_permissions_draft = null_ptr;
+  (*manager)->user_global_permissions = null_ptr;
   sc_monitor_init(&(*manager)->user_global_permissions_monitor);
   (*manager)->basic_action_classes = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
-  (*manager)->user_local_permissions =
-      sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, (GDestroyNotify)g_hash_table_destroy);
+  (*manager)->user_local_permissions = null_ptr;
   sc_monitor_init(&(*manager)->user_local_permissions_monitor);
 
   (*manager)->on_new_users_in_sets_events =
@@ -94,15 +112,26 @@ void _sc_memory_context_manager_shutdown(sc_memory_context_manager * manager)
   sc_monitor_acquire_write(&manager->context_monitor);
   sc_hash_table_destroy(manager->context_hash_table);
   manager->context_hash_table = null_ptr;
+
+  while (manager->idle_contexts_count > 0)
+    _sc_memory_context_destroy(manager->idle_contexts[--manager->idle_contexts_count]);
+  sc_mem_free(manager->idle_contexts);
+  manager->idle_contexts = null_ptr;
   sc_monitor_release_write(&manager->context_monitor);
 
   sc_monitor_destroy(&manager->context_monitor);
 
   sc_monitor_destroy(&manager->user_global_permissions_monitor);
-  sc_hash_table_destroy(manager->user_global_permissions);
+  _sc_permissions_table_free(manager->user_global_permissions);
 
   sc_monitor_destroy(&manager->user_local_permissions_monitor);
-  sc_hash_table_destroy(manager->user_local_permissions);
+  sc_uint32 index = 0;
+  sc_addr_hash user_key;
+  sc_pointer structures_permissions_table;
+  while (_sc_permissions_table_next(manager->user_local_permissions, &index, &user_key, &structures_permissions_table))
+    _sc_permissions_table_free(structures_permissions_table);
+  _sc_permissions_table_free(manager->user_local_permissions);
+  _sc_permissions_table_readers_destroy(&manager->user_permissions_readers);
 
   sc_hash_table_destroy(manager->basic_action_classes);
 
@@ -120,28 +149,45 @@ sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * mana
   if (manager == null_ptr)
     return null_ptr;
 
-  sc_memory_context * ctx = sc_mem_new(sc_memory_context, 1);
+  sc_memory_context * ctx = null_ptr;
 
   sc_monitor_acquire_write(&manager->context_monitor);
 
   if (manager->context_hash_table == null_ptr)
-    goto error;
+    goto result;
+
+  if (SC_ADDR_IS_EMPTY(user_addr))
+    user_addr = _sc_memory_context_manager_generate_guest_user(manager);
+  sc_pointer const key = GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr));
+
+  // context may be generated by another thread after it wasn't found without lock
+  ctx = sc_hash_table_get(manager->context_hash_table, key);
+  if (ctx != null_ptr)
+    goto reference;
 
-  sc_monitor_init(&ctx->monitor);
-  ctx->user_addr = SC_ADDR_IS_EMPTY(user_addr) ? _sc_memory_context_manager_generate_guest_user(manager) : user_addr;
+  // released context of any user is reused, because all its fields depending on user are reset below
+  if (manager->idle_contexts_count > 0)
+    ctx = manager->idle_contexts[--manager->idle_contexts_count];
+  else
+  {
+    ctx = sc_mem_new(sc_memory_context, 1);
+    sc_monitor_init(&ctx->monitor);
+  }
+
+  // permissions of user are resolved at the first check of them, because most contexts never check them
+  ctx->user_addr = user_addr;
   ctx->ref_count = 0;
-  ctx->global_permissions = _sc_context_get_user_global_permissions(ctx->user_addr);
-  ctx->local_permissions = _sc_context_get_user_local_permissions(ctx->user_addr);
-  ctx->pend_events = null_ptr;
+  ctx->global_permissions = SC_CONTEXT_PERMISSIONS_UNRESOLVED;
+  ctx->flags = 0;
+  ctx->pend_events_count = 0;
 
-  sc_hash_table_insert(
-      manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
+  sc_hash_table_insert(manager->context_hash_table, key, (sc_pointer)ctx);
   ++manager->context_count;
-  goto result;
 
-error:
-  sc_mem_free(ctx);
-  ctx = null_ptr;
+reference:
+  sc_monitor_acquire_write(&ctx->monitor);
+  ++ctx->ref_count;
+  sc_monitor_release_write(&ctx->monitor);
 
 result:
   sc_monitor_release_write(&manager->context_monitor);
@@ -169,21 +215,33 @@ error:
   return ctx;
 }
 
-sc_memory_context * _sc_memory_context_resolve_impl(sc_memory_context_manager * manager, sc_addr user_addr)
+sc_memory_context * _sc_memory_context_acquire_impl(sc_memory_context_manager * manager, sc_addr user_addr)
 {
   if (manager == null_ptr)
     return null_ptr;
 
-  sc_memory_context * ctx = _sc_memory_context_get_impl(manager, user_addr);
-  if (ctx == null_ptr)
-    ctx = _sc_memory_context_new_impl(manager, user_addr);
+  sc_memory_context * ctx = null_ptr;
 
-  if (ctx == null_ptr)
-    return ctx;
+  // reference is added under lock of manager, so context can't be released by another thread before it
+  sc_monitor_acquire_read(&manager->context_monitor);
+  if (manager->context_hash_table != null_ptr && SC_ADDR_IS_NOT_EMPTY(user_addr))
+    ctx = sc_hash_table_get(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(user_addr)));
+  if (ctx != null_ptr)
+  {
+    sc_monitor_acquire_write(&ctx->monitor);
+    ++ctx->ref_count;
+    sc_monitor_release_write(&ctx->monitor);
+  }
+  sc_monitor_release_read(&manager->context_monitor);
 
-  sc_monitor_acquire_write(&ctx->monitor);
-  ++ctx->ref_count;
-  sc_monitor_release_write(&ctx->monitor);
+  return ctx;
+}
+
+sc_memory_context * _sc_memory_context_resolve_impl(sc_memory_context_manager * manager, sc_addr user_addr)
+{
+  sc_memory_context * ctx = _sc_memory_context_acquire_impl(manager, user_addr);
+  if (ctx == null_ptr)
+    ctx = _sc_memory_context_new_impl(manager, user_addr);
 
   return ctx;
 }
@@ -205,11 +263,15 @@ void _sc_memory_context_free_impl(sc_memory_context_manager * manager, sc_memory
   if (ref_count > 0)
     goto error;
 
-  sc_monitor_destroy(&ctx->monitor);
-  sc_hash_table_remove(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
+  sc_pointer const key = GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr));
+  sc_hash_table_remove(manager->context_hash_table, key);
   --manager->context_count;
 
-  sc_mem_free(ctx);
+  // released context is kept for the next context of any user, if there is room for it
+  if (manager->idle_contexts_count < SC_CONTEXT_IDLE_CONTEXTS_MAX_COUNT)
+    manager->idle_contexts[manager->idle_contexts_count++] = ctx;
+  else
+    _sc_memory_context_destroy(ctx);
 error:
   sc_monitor_release_write(&manager->context_monitor);
 }
@@ -230,65 +292,247 @@ sc_bool _sc_memory_context_are_events_pending(sc_memory_context const * ctx)
   return result;
 }
 
-void _sc_memory_context_pend_event(
+sc_bool _sc_memory_context_pend_event(
     sc_memory_context const * ctx,
     sc_event_type event_type_addr,
     sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr)
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr)
+{
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
+  // most events are emitted outside of pending events blocks, so concurrent writers of context aren't serialized by it
+  if (!_sc_memory_context_are_events_pending(ctx))
+    return SC_FALSE;
+
+  // flag is checked again under the same lock as buffer is detached, so events aren't pended after the end of block
+  sc_monitor_acquire_write(&context->monitor);
+  if ((context->flags & SC_CONTEXT_FLAG_PENDING_EVENTS) == 0)
+  {
+    sc_monitor_release_write(&context->monitor);
+    return SC_FALSE;
+  }
+
+  if (context->pend_events_count == context->pend_events_capacity)
+  {
+    // buffer grows twice, so appending of pending events is amortized O(1)
+    sc_uint32 const capacity = context->pend_events_capacity == 0 ? SC_CONTEXT_PEND_EVENTS_INITIAL_CAPACITY
+                                                                  : context->pend_events_capacity * 2;
+    sc_event_emit_params * pend_events = sc_mem_new(sc_event_emit_params, capacity);
+    if (context->pend_events_count != 0)
+      sc_mem_cpy(pend_events, context->pend_events, sizeof(sc_event_emit_params) * context->pend_events_count);
+    sc_mem_free(context->pend_events);
+    context->pend_events = pend_events;
+    context->pend_events_capacity = capacity;
+  }
+
+  context->pend_events[context->pend_events_count++] = (sc_event_emit_params){
+      .subscription_addr = subscription_addr,
+      .event_type_addr = event_type_addr,
+      .connector_addr = connector_addr,
+      .connector_type = connector_type,
+      .other_addr = other_addr,
+      .callback = callback,
+      .event_addr = event_addr,
+  };
+  sc_monitor_release_write(&context->monitor);
+  return SC_TRUE;
+}
+
+sc_bool _sc_memory_context_is_generation_event(sc_event_type event_type_addr)
 {
-  sc_event_emit_params * params = sc_mem_new(sc_event_emit_params, 1);
-  params->event_type_addr = event_type_addr;
-  params->subscription_addr = subscription_addr;
-  params->connector_addr = connector_addr;
-  params->connector_type = connector_type;
-  params->other_addr = other_addr;
-
-  sc_monitor_acquire_write((sc_monitor *)&ctx->monitor);
-  ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_append(ctx->pend_events, params);
-  sc_monitor_release_write((sc_monitor *)&ctx->monitor);
+  return SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_connector_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_outgoing_arc_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_incoming_arc_addr)
+         || SC_ADDR_IS_EQUAL(event_type_addr, sc_event_after_generate_edge_addr);
 }
 
-void _sc_memory_context_emit_events(sc_memory_context const * ctx)
+/*! Collects sc-connectors that were generated and erased in the same pending events block.
+ * @returns Returns a table of collected sc-connectors or null_ptr if there are no such sc-connectors.
+ */
+sc_hash_table * _sc_memory_context_collect_coalesced_connectors(
+    sc_event_emit_params const * pend_events,
+    sc_uint32 pend_events_count)
 {
-  GSList * item = null_ptr;
-  sc_event_emit_params * event_params = null_ptr;
+  sc_hash_table * generated_connectors = null_ptr;
+  sc_hash_table * coalesced_connectors = null_ptr;
 
-  // Emit all saved events
-  while (ctx->pend_events)
+  for (sc_uint32 i = 0; i < pend_events_count; ++i)
   {
-    item = ctx->pend_events;
-    event_params = (sc_event_emit_params *)item->data;
-
-    sc_event_emit_impl(
-        ctx,
-        event_params->subscription_addr,
-        event_params->event_type_addr,
-        event_params->connector_addr,
-        event_params->connector_type,
-        event_params->other_addr,
-        null_ptr,
-        SC_ADDR_EMPTY);
-    sc_mem_free(event_params);
-
-    ((sc_memory_context *)ctx)->pend_events = sc_hash_table_list_remove_sublist(ctx->pend_events, ctx->pend_events);
+    sc_event_emit_params const * params = &pend_events[i];
+    if (_sc_memory_context_is_generation_event(params->event_type_addr))
+    {
+      if (generated_connectors == null_ptr)
+        generated_connectors = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+      sc_pointer const key = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(params->connector_addr));
+      sc_hash_table_insert(generated_connectors, key, key);
+    }
+    else if (
+        generated_connectors != null_ptr
+        && SC_ADDR_IS_EQUAL(params->event_type_addr, sc_event_before_erase_element_addr))
+    {
+      sc_pointer const key = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(params->subscription_addr));
+      if (sc_hash_table_get(generated_connectors, key) == null_ptr)
+        continue;
+
+      if (coalesced_connectors == null_ptr)
+        coalesced_connectors = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+      sc_hash_table_insert(coalesced_connectors, key, key);
+    }
   }
+
+  if (generated_connectors != null_ptr)
+    sc_hash_table_destroy(generated_connectors);
+  return coalesced_connectors;
 }
 
-void _sc_memory_context_pending_begin(sc_memory_context * ctx)
+sc_bool _sc_memory_context_is_event_coalesced(
+    sc_hash_table * coalesced_connectors,
+    sc_event_emit_params const * params)
+{
+  if (coalesced_connectors == null_ptr)
+    return SC_FALSE;
+
+  return sc_hash_table_get(coalesced_connectors, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(params->connector_addr)))
+             != null_ptr
+         || sc_hash_table_get(coalesced_connectors, GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(params->subscription_addr)))
+                != null_ptr;
+}
+
+/*! Counts pending events of erasing each sc-element.
+ * @returns Returns a table of counts by sc-elements or null_ptr if there are no such events.
+ */
+sc_hash_table * _sc_memory_context_count_erasure_events(
+    sc_event_emit_params const * pend_events,
+    sc_uint32 pend_events_count)
+{
+  sc_hash_table * erasure_events_counts = null_ptr;
+
+  for (sc_uint32 i = 0; i < pend_events_count; ++i)
+  {
+    sc_event_emit_params const * params = &pend_events[i];
+    if (params->callback == null_ptr)
+      continue;
+
+    if (erasure_events_counts == null_ptr)
+      erasure_events_counts = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+    sc_pointer const key = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(params->event_addr));
+    sc_uint32 const erasure_events_count = GPOINTER_TO_UINT(sc_hash_table_get(erasure_events_counts, key)) + 1;
+    sc_hash_table_insert(erasure_events_counts, key, GUINT_TO_POINTER(erasure_events_count));
+  }
+
+  return erasure_events_counts;
+}
+
+/*! Emits pending events detached from sc-memory context. Pending events of erasing sc-elements that have no
+ * subscriptions and coalesced events of erasing sc-connectors complete erasure directly.
+ * @note It is called without lock of sc-memory context, because erasure of sc-elements emits new events by this
+ * sc-memory context.
+ */
+void _sc_memory_context_emit_pend_events(
+    sc_memory_context const * ctx,
+    sc_event_emit_params const * pend_events,
+    sc_uint32 pend_events_count,
+    sc_bool is_coalescing)
+{
+  sc_hash_table * coalesced_connectors =
+      is_coalescing ? _sc_memory_context_collect_coalesced_connectors(pend_events, pend_events_count) : null_ptr;
+
+  sc_hash_table * erasure_events_counts = _sc_memory_context_count_erasure_events(pend_events, pend_events_count);
+  sc_hash_table * emitted_erasures = null_ptr;
+  for (sc_uint32 i = 0; i < pend_events_count; ++i)
+  {
+    sc_event_emit_params const * params = &pend_events[i];
+
+    sc_result result = SC_RESULT_NO;
+    if (!_sc_memory_context_is_event_coalesced(coalesced_connectors, params))
+      result = sc_event_emit_impl(
+          ctx,
+          params->subscription_addr,
+          params->event_type_addr,
+          params->connector_addr,
+          params->connector_type,
+          params->other_addr,
+          params->callback,
+          params->event_addr);
+
+    if (params->callback == null_ptr)
+      continue;
+
+    // events of erasing one sc-element may be interleaved with other events, so erasure is completed directly after
+    // the last of its events if none of them was emitted
+    sc_pointer const key = GUINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(params->event_addr));
+    if (result == SC_RESULT_OK)
+    {
+      if (emitted_erasures == null_ptr)
+        emitted_erasures = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr);
+      sc_hash_table_insert(emitted_erasures, key, key);
+    }
+
+    sc_uint32 const erasure_events_count = GPOINTER_TO_UINT(sc_hash_table_get(erasure_events_counts, key)) - 1;
+    sc_hash_table_insert(erasure_events_counts, key, GUINT_TO_POINTER(erasure_events_count));
+    if (erasure_events_count > 0)
+      continue;
+
+    if (emitted_erasures == null_ptr || sc_hash_table_get(emitted_erasures, key) == null_ptr)
+      params->callback(ctx, params->event_addr);
+  }
+
+  if (erasure_events_counts != null_ptr)
+    sc_hash_table_destroy(erasure_events_counts);
+  if (emitted_erasures != null_ptr)
+    sc_hash_table_destroy(emitted_erasures);
+  if (coalesced_connectors != null_ptr)
+    sc_hash_table_destroy(coalesced_connectors);
+}
+
+/*! Detaches pending events buffer from sc-memory context and emits its events.
+ * @note It is called under lock of sc-memory context and releases it, so events pended after the lock are emitted by
+ * the next call.
+ */
+void _sc_memory_context_detach_and_emit_events(sc_memory_context * ctx)
+{
+  sc_event_emit_params * pend_events = ctx->pend_events;
+  sc_uint32 const pend_events_count = ctx->pend_events_count;
+  sc_bool const is_coalescing = (ctx->flags & SC_CONTEXT_FLAG_COALESCING_EVENTS) != 0;
+  ctx->pend_events = null_ptr;
+  ctx->pend_events_count = 0;
+  ctx->pend_events_capacity = 0;
+  sc_monitor_release_write(&ctx->monitor);
+
+  _sc_memory_context_emit_pend_events(ctx, pend_events, pend_events_count, is_coalescing);
+  sc_mem_free(pend_events);
+}
+
+void _sc_memory_context_emit_events(sc_memory_context const * ctx)
+{
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
+  sc_monitor_acquire_write(&context->monitor);
+  _sc_memory_context_detach_and_emit_events(context);
+}
+
+void _sc_memory_context_pending_begin(sc_memory_context * ctx, sc_bool is_coalescing)
 {
   sc_monitor_acquire_write(&ctx->monitor);
   ctx->flags |= SC_CONTEXT_FLAG_PENDING_EVENTS;
+  if (is_coalescing)
+    ctx->flags |= SC_CONTEXT_FLAG_COALESCING_EVENTS;
+  else
+    ctx->flags &= ~SC_CONTEXT_FLAG_COALESCING_EVENTS;
   sc_monitor_release_write(&ctx->monitor);
 }
 
 void _sc_memory_context_pending_end(sc_memory_context * ctx)
 {
+  // buffer is detached under the same lock, so events pended by other threads after the end of block aren't
+  // appended to it
   sc_monitor_acquire_write(&ctx->monitor);
   ctx->flags &= ~SC_CONTEXT_FLAG_PENDING_EVENTS;
-  _sc_memory_context_emit_events(ctx);
-  sc_monitor_release_write(&ctx->monitor);
+  _sc_memory_context_detach_and_emit_events(ctx);
 }
 
 sc_bool _sc_memory_context_are_events_blocking(sc_memory_context const * ctx)
@@ -13,6 +13,7 @@
 #include "sc-core/sc-base/sc_monitor.h"
 
 #include "sc-store/sc-base/sc_message.h"
+#include "sc-store/sc-event/sc_event_queue.h"
 
 typedef struct _sc_memory_context_manager sc_memory_context_manager;
 typedef struct _sc_event_emit_params sc_event_emit_params;
@@ -49,11 +50,12 @@ void _sc_memory_context_assign_context_for_system(sc_memory_context_manager * ma
  */
 void _sc_memory_context_manager_shutdown(sc_memory_context_manager * manager);
 
-/*! Function that generates an existing sc-memory context for a specified user.
+/*! Function that generates a sc-memory context for a specified user and adds reference to it.
  * @param manager Pointer to the sc-memory context manager responsible for context creation.
  * @param user_addr sc-address representing the user for whom the context is generated.
- * @returns Returns a pointer to the existing sc-memory context for the specified user.
- * @note This function generates sc-memory context for the specified user.
+ * @returns Returns a pointer to the sc-memory context for the specified user.
+ * @note This function reuses a released sc-memory context of the specified user if it is kept by the manager. Reused
+ * context is reset, and its permissions are resolved at the first check of them.
  */
 sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * manager, sc_addr user_addr);
 
@@ -67,6 +69,16 @@ sc_memory_context * _sc_memory_context_new_impl(sc_memory_context_manager * mana
  */
 sc_memory_context * _sc_memory_context_get_impl(sc_memory_context_manager * manager, sc_addr user_addr);
 
+/*! Function that retrieves an existing sc-memory context for a specified user and adds a reference to it.
+ * @param manager Pointer to the sc-memory context manager responsible for context retrieval.
+ * @param user_addr sc-address representing the user for whom the context is retrieved.
+ * @returns Returns a pointer to the existing sc-memory context for the specified user. If the context does not exist,
+ * returns null_ptr.
+ * @note The reference is added under lock of the manager, so the context can't be released and reused for another user
+ * until it is freed by _sc_memory_context_free_impl.
+ */
+sc_memory_context * _sc_memory_context_acquire_impl(sc_memory_context_manager * manager, sc_addr user_addr);
+
 /*! Function that resolves a sc-memory context for a specified user, creating a new one if it does not exist.
  * @param manager Pointer to the sc-memory context manager responsible for context resolution.
  * @param user_addr sc_addr representing the user for whom the context is resolved.
@@ -79,8 +91,9 @@ sc_memory_context * _sc_memory_context_resolve_impl(sc_memory_context_manager *
 /*! Function that frees a sc-memory context, removing it from the context manager.
  * @param manager Pointer to the sc-memory context manager responsible for context removal.
  * @param ctx Pointer to the sc-memory context to be freed.
- * @note This function frees a sc-memory context, removing it from the manager's context hash table and releasing
- * associated resources.
+ * @note This function frees a sc-memory context, removing it from the manager's context hash table. If the manager
+ * keeps less than max number of released contexts, then the context is kept for the next context of any user,
+ * otherwise associated resources are released.
  */
 void _sc_memory_context_free_impl(sc_memory_context_manager * manager, sc_memory_context * ctx);
 
@@ -92,9 +105,10 @@ sc_bool _sc_memory_context_are_events_pending(sc_memory_context const * ctx);
 
 /*! Function that marks the beginning of a pending events block in a sc-memory context.
  * @param ctx Pointer to the sc-memory context for which the pending events block begins.
+ * @param is_coalescing Flag indicating whether events of sc-connectors generated and erased in this block are dropped.
  * @note This function marks the beginning of a pending events block in the sc-memory context.
  */
-void _sc_memory_context_pending_begin(sc_memory_context * ctx);
+void _sc_memory_context_pending_begin(sc_memory_context * ctx, sc_bool is_coalescing);
 
 /*! Function that marks the end of a pending events block in a sc-memory context, emitting pending events.
  * @param ctx Pointer to the sc-memory context for which the pending events block ends.
@@ -102,26 +116,36 @@ void _sc_memory_context_pending_begin(sc_memory_context * ctx);
  */
 void _sc_memory_context_pending_end(sc_memory_context * ctx);
 
-/*! Function that adds an event to the pending events list in a sc-memory context.
+/*! Function that adds an event to the pending events buffer in a sc-memory context.
  * @param ctx Pointer to the sc-memory context to which the event is added.
  * @param type Type of the event to be added.
  * @param subscription_addr sc_addr representing the sc-element associated with the event.
  * @param connector_addr sc-address representing the sc-connector associated with the event.
  * @param connector_type sc-type representing the sc-connector associated with the event.
  * @param other_addr sc-address representing the other sc-element associated with the event.
- * @note This function adds an event to the pending events list in the sc-memory context, to be emitted later.
+ * @param callback A pointer function that completes erasure of sc-element after the event (it is used for events of
+ * erasing sc-connectors and sc-elements).
+ * @param event_addr An argument of callback.
+ * @returns Returns SC_TRUE if the event is pended, or SC_FALSE if the sc-memory context isn't in a pending events
+ * block.
+ * @note This function adds an event to the pending events buffer in the sc-memory context, to be emitted later.
+ * Appending is amortized O(1).
  */
-void _sc_memory_context_pend_event(
+sc_bool _sc_memory_context_pend_event(
     sc_memory_context const * ctx,
     sc_event_type event_type_addr,
     sc_addr subscription_addr,
     sc_addr connector_addr,
     sc_type connector_type,
-    sc_addr other_addr);
+    sc_addr other_addr,
+    sc_event_do_after_callback callback,
+    sc_addr event_addr);
 
 /*! Function that emits pending events in a sc-memory context.
  * @param ctx Pointer to the sc-memory context for which pending events are emitted.
- * @note This function emits all pending events in the sc-memory context, clearing the pending events list afterward.
+ * @note This function detaches the pending events buffer from the sc-memory context and emits all its events in
+ * order. If the pending events block is coalescing, then events of sc-connectors generated and erased in this block
+ * are dropped and these sc-connectors are erased directly.
  */
 void _sc_memory_context_emit_events(sc_memory_context const * ctx);
 
@@ -18,18 +18,32 @@ typedef void (*sc_users_updater)(sc_memory_context_manager *, sc_addr, sc_addr,
 typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_addr, sc_addr, sc_users_updater);
 
 /**
- * @brief Adds global permissions (within the knowledge base) to a given sc-memory context.
+ * @brief Changes global permissions (within the knowledge base) of a given sc-memory context.
  * @param _context Pointer to the sc-memory context.
- * @param _adding_permissions Permissions to be added.
+ * @param _operation Assignment operation applied to permissions.
+ * @param _operand Permissions used in operation.
  * @return None.
  */
-#define _sc_context_add_context_global_permissions(_context, _adding_permissions) \
+#define _sc_context_change_context_global_permissions(_context, _operation, _operand) \
   ({ \
     sc_monitor_acquire_write(&(_context)->monitor); \
-    (_context)->global_permissions |= (_adding_permissions); \
+    sc_int32 _context_permissions = g_atomic_int_get(&(_context)->global_permissions); \
+    if (_context_permissions == SC_CONTEXT_PERMISSIONS_UNRESOLVED) \
+      _context_permissions = _sc_context_get_user_global_permissions((_context)->user_addr); \
+    _context_permissions _operation(_operand); \
+    g_atomic_int_set(&(_context)->global_permissions, _context_permissions); \
     sc_monitor_release_write(&(_context)->monitor); \
   })
 
+/**
+ * @brief Adds global permissions (within the knowledge base) to a given sc-memory context.
+ * @param _context Pointer to the sc-memory context.
+ * @param _adding_permissions Permissions to be added.
+ * @return None.
+ */
+#define _sc_context_add_context_global_permissions(_context, _adding_permissions) \
+  _sc_context_change_context_global_permissions(_context, |=, _adding_permissions)
+
 /**
  * @brief Removes global permissions (within the knowledge base) from a given sc-memory context.
  * @param _context Pointer to the sc-memory context.
@@ -37,11 +51,7 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
  * @return None.
  */
 #define _sc_context_remove_context_global_permissions(_context, _removing_permissions) \
-  ({ \
-    sc_monitor_acquire_write(&(_context)->monitor); \
-    (_context)->global_permissions &= ~(_removing_permissions); \
-    sc_monitor_release_write(&(_context)->monitor); \
-  })
+  _sc_context_change_context_global_permissions(_context, &=, ~(_removing_permissions))
 
 /**
  * @brief Checks if a given subset of permissions is present in the permission.
@@ -54,12 +64,249 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
 
 //! Gets sc-memory context global permissions.
 #define _sc_context_get_context_global_permissions(_context) \
-  ({ \
-    sc_monitor_acquire_read((sc_monitor *)&(_context)->monitor); \
-    sc_permissions const _context_permissions = (_context)->global_permissions; \
-    sc_monitor_release_read((sc_monitor *)&(_context)->monitor); \
-    _context_permissions; \
-  })
+  _sc_memory_context_get_global_permissions(manager, _context)
+
+//! Gets table storing global permissions that is changed by writers. It is called under the monitor of writers.
+#define _sc_context_get_writable_user_global_permissions() \
+  (manager->is_permissions_batch ? manager->user_global_permissions_draft \
+                                 : g_atomic_pointer_get(&manager->user_global_permissions))
+
+//! Gets table storing local permissions that is changed by writers. It is called under the monitor of writers.
+#define _sc_context_get_writable_user_local_permissions() \
+  (manager->is_permissions_batch ? manager->user_local_permissions_draft \
+                                 : g_atomic_pointer_get(&manager->user_local_permissions))
+
+/*! Replaces the table storing global permissions by its copy with specified permissions of user.
+ * @note It is called under the monitor of writers of the table. Previous table is freed when nobody reads it. While
+ * permissions are changed in batch, draft of the table is changed instead.
+ */
+void _sc_context_set_user_global_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr,
+    sc_permissions permissions)
+{
+  if (manager->is_permissions_batch)
+  {
+    manager->user_global_permissions_draft = _sc_permissions_table_set_unpublished(
+        manager->user_global_permissions_draft, SC_ADDR_LOCAL_TO_INT(user_addr), GUINT_TO_POINTER(permissions));
+    return;
+  }
+
+  sc_permissions_table * table = g_atomic_pointer_get(&manager->user_global_permissions);
+  g_atomic_pointer_set(
+      &manager->user_global_permissions,
+      _sc_permissions_table_copy_with(table, SC_ADDR_LOCAL_TO_INT(user_addr), GUINT_TO_POINTER(permissions)));
+  _sc_permissions_table_wait_readers(&manager->user_permissions_readers);
+  _sc_permissions_table_free(table);
+}
+
+/*! Replaces the table storing local permissions by its copy with specified permissions of user within sc-structure.
+ * @note It is called under the monitor of writers of the table. Previous tables are freed when nobody reads them.
+ * While permissions are changed in batch, draft of the table and its tables are changed instead.
+ */
+void _sc_context_set_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr,
+    sc_addr structure_addr,
+    sc_permissions permissions)
+{
+  if (manager->is_permissions_batch)
+  {
+    sc_permissions_table * structures_permissions_table =
+        _sc_permissions_table_get(manager->user_local_permissions_draft, SC_ADDR_LOCAL_TO_INT(user_addr));
+    sc_permissions_table * new_structures_permissions_table = _sc_permissions_table_set_unpublished(
+        structures_permissions_table, SC_ADDR_LOCAL_TO_INT(structure_addr), GUINT_TO_POINTER(permissions));
+    if (new_structures_permissions_table != structures_permissions_table)
+      manager->user_local_permissions_draft = _sc_permissions_table_set_unpublished(
+          manager->user_local_permissions_draft, SC_ADDR_LOCAL_TO_INT(user_addr), new_structures_permissions_table);
+    return;
+  }
+
+  sc_permissions_table * table = g_atomic_pointer_get(&manager->user_local_permissions);
+  sc_permissions_table * structures_permissions_table =
+      _sc_permissions_table_get(table, SC_ADDR_LOCAL_TO_INT(user_addr));
+  sc_permissions_table * new_structures_permissions_table = _sc_permissions_table_copy_with(
+      structures_permissions_table, SC_ADDR_LOCAL_TO_INT(structure_addr), GUINT_TO_POINTER(permissions));
+  g_atomic_pointer_set(
+      &manager->user_local_permissions,
+      _sc_permissions_table_copy_with(table, SC_ADDR_LOCAL_TO_INT(user_addr), new_structures_permissions_table));
+  _sc_permissions_table_wait_readers(&manager->user_permissions_readers);
+  _sc_permissions_table_free(structures_permissions_table);
+  _sc_permissions_table_free(table);
+}
+
+//! Frees table storing local permissions and its tables.
+void _sc_context_free_user_local_permissions(sc_permissions_table * table)
+{
+  sc_uint32 index = 0;
+  sc_addr_hash user_key;
+  sc_pointer structures_permissions_table;
+  while (_sc_permissions_table_next(table, &index, &user_key, &structures_permissions_table))
+    _sc_permissions_table_free(structures_permissions_table);
+  _sc_permissions_table_free(table);
+}
+
+void _sc_memory_context_manager_begin_permissions_batch(sc_memory_context_manager * manager)
+{
+  sc_monitor_acquire_write(&manager->user_global_permissions_monitor);
+  sc_monitor_acquire_write(&manager->user_local_permissions_monitor);
+
+  manager->user_global_permissions_draft =
+      _sc_permissions_table_copy_with(g_atomic_pointer_get(&manager->user_global_permissions), 0, null_ptr);
+
+  // tables of draft are changed in place, so they are copied too
+  sc_permissions_table * table = g_atomic_pointer_get(&manager->user_local_permissions);
+  manager->user_local_permissions_draft = _sc_permissions_table_copy_with(table, 0, null_ptr);
+  sc_uint32 index = 0;
+  sc_addr_hash user_key;
+  sc_pointer structures_permissions_table;
+  while (_sc_permissions_table_next(table, &index, &user_key, &structures_permissions_table))
+    manager->user_local_permissions_draft = _sc_permissions_table_set_unpublished(
+        manager->user_local_permissions_draft,
+        user_key,
+        _sc_permissions_table_copy_with(structures_permissions_table, 0, null_ptr));
+
+  g_atomic_int_set(&manager->is_permissions_batch, SC_TRUE);
+
+  sc_monitor_release_write(&manager->user_local_permissions_monitor);
+  sc_monitor_release_write(&manager->user_global_permissions_monitor);
+}
+
+void _sc_memory_context_manager_end_permissions_batch(sc_memory_context_manager * manager)
+{
+  sc_monitor_acquire_write(&manager->user_global_permissions_monitor);
+  sc_monitor_acquire_write(&manager->user_local_permissions_monitor);
+
+  sc_permissions_table * global_table = g_atomic_pointer_get(&manager->user_global_permissions);
+  g_atomic_pointer_set(&manager->user_global_permissions, manager->user_global_permissions_draft);
+  manager->user_global_permissions_draft = null_ptr;
+
+  sc_permissions_table * local_table = g_atomic_pointer_get(&manager->user_local_permissions);
+  g_atomic_pointer_set(&manager->user_local_permissions, manager->user_local_permissions_draft);
+  manager->user_local_permissions_draft = null_ptr;
+
+  g_atomic_int_set(&manager->is_permissions_batch, SC_FALSE);
+
+  sc_monitor_release_write(&manager->user_local_permissions_monitor);
+  sc_monitor_release_write(&manager->user_global_permissions_monitor);
+
+  // previous tables are replaced by writers of batch only, so they are freed after one grace period
+  _sc_permissions_table_wait_readers(&manager->user_permissions_readers);
+  _sc_permissions_table_free(global_table);
+  _sc_context_free_user_local_permissions(local_table);
+}
+
+sc_permissions _sc_memory_context_manager_get_user_global_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr)
+{
+  // the latest permissions are in draft while they are changed in batch
+  if (g_atomic_int_get(&manager->is_permissions_batch))
+  {
+    sc_monitor_acquire_read(&manager->user_global_permissions_monitor);
+    sc_bool const is_permissions_batch = manager->is_permissions_batch;
+    sc_permissions const permissions =
+        is_permissions_batch
+            ? (sc_uint64)_sc_permissions_table_get(
+                  manager->user_global_permissions_draft, SC_ADDR_LOCAL_TO_INT(user_addr))
+            : 0;
+    sc_monitor_release_read(&manager->user_global_permissions_monitor);
+    if (is_permissions_batch)
+      return permissions;
+  }
+
+  sc_uint32 const reader_index = _sc_permissions_table_read_begin(&manager->user_permissions_readers);
+  sc_permissions const permissions = (sc_uint64)_sc_permissions_table_get(
+      g_atomic_pointer_get(&manager->user_global_permissions), SC_ADDR_LOCAL_TO_INT(user_addr));
+  _sc_permissions_table_read_end(&manager->user_permissions_readers, reader_index);
+  return permissions;
+}
+
+/*! Gets local permissions of a specific user within a specific sc-structure, or copy of all its local permissions if
+ * structure is empty.
+ */
+sc_pointer _sc_memory_context_manager_read_user_local_permissions(
+    sc_permissions_table const * table,
+    sc_addr user_addr,
+    sc_addr structure_addr)
+{
+  sc_permissions_table const * structures_permissions_table =
+      _sc_permissions_table_get(table, SC_ADDR_LOCAL_TO_INT(user_addr));
+  if (!SC_ADDR_IS_EMPTY(structure_addr))
+    return _sc_permissions_table_get(structures_permissions_table, SC_ADDR_LOCAL_TO_INT(structure_addr));
+
+  return structures_permissions_table == null_ptr
+             ? null_ptr
+             : _sc_permissions_table_copy_with(structures_permissions_table, 0, null_ptr);
+}
+
+/*! Reads local permissions of a specific user, see `_sc_memory_context_manager_read_user_local_permissions`.
+ * @note Permissions are read from published table without locks. While permissions are changed in batch, they are read
+ * from draft of the table under the monitor of its writers.
+ */
+sc_pointer _sc_memory_context_manager_read_user_local_permissions_safely(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr,
+    sc_addr structure_addr)
+{
+  if (g_atomic_int_get(&manager->is_permissions_batch))
+  {
+    sc_monitor_acquire_read(&manager->user_local_permissions_monitor);
+    sc_bool const is_permissions_batch = manager->is_permissions_batch;
+    sc_pointer const result = is_permissions_batch
+                                  ? _sc_memory_context_manager_read_user_local_permissions(
+                                        manager->user_local_permissions_draft, user_addr, structure_addr)
+                                  : null_ptr;
+    sc_monitor_release_read(&manager->user_local_permissions_monitor);
+    if (is_permissions_batch)
+      return result;
+  }
+
+  sc_uint32 const reader_index = _sc_permissions_table_read_begin(&manager->user_permissions_readers);
+  sc_pointer const result = _sc_memory_context_manager_read_user_local_permissions(
+      g_atomic_pointer_get(&manager->user_local_permissions), user_addr, structure_addr);
+  _sc_permissions_table_read_end(&manager->user_permissions_readers, reader_index);
+  return result;
+}
+
+sc_bool _sc_memory_context_manager_has_user_local_permissions(sc_memory_context_manager * manager, sc_addr user_addr)
+{
+  if (g_atomic_int_get(&manager->is_permissions_batch))
+  {
+    sc_monitor_acquire_read(&manager->user_local_permissions_monitor);
+    sc_bool const is_permissions_batch = manager->is_permissions_batch;
+    sc_bool const has_permissions =
+        is_permissions_batch
+        && _sc_permissions_table_get(manager->user_local_permissions_draft, SC_ADDR_LOCAL_TO_INT(user_addr))
+               != null_ptr;
+    sc_monitor_release_read(&manager->user_local_permissions_monitor);
+    if (is_permissions_batch)
+      return has_permissions;
+  }
+
+  sc_uint32 const reader_index = _sc_permissions_table_read_begin(&manager->user_permissions_readers);
+  sc_bool const has_permissions = _sc_permissions_table_get(
+                                      g_atomic_pointer_get(&manager->user_local_permissions),
+                                      SC_ADDR_LOCAL_TO_INT(user_addr))
+                                  != null_ptr;
+  _sc_permissions_table_read_end(&manager->user_permissions_readers, reader_index);
+  return has_permissions;
+}
+
+sc_permissions _sc_memory_context_manager_get_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr,
+    sc_addr structure_addr)
+{
+  return (sc_uint64)_sc_memory_context_manager_read_user_local_permissions_safely(manager, user_addr, structure_addr);
+}
+
+sc_permissions_table * _sc_memory_context_manager_copy_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr)
+{
+  return _sc_memory_context_manager_read_user_local_permissions_safely(manager, user_addr, SC_ADDR_EMPTY);
+}
 
 /**
  * @brief Adds global permissions (within the knowledge base) for a specific user in the context manager.
@@ -70,13 +317,10 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
 #define _sc_context_add_user_global_permissions(_user_addr, _adding_permissions) \
   ({ \
     sc_monitor_acquire_write(&manager->user_global_permissions_monitor); \
-    sc_permissions _user_permissions = (sc_uint64)sc_hash_table_get( \
-        manager->user_global_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
+    sc_permissions _user_permissions = (sc_uint64)_sc_permissions_table_get( \
+        _sc_context_get_writable_user_global_permissions(), SC_ADDR_LOCAL_TO_INT(_user_addr)); \
     _user_permissions |= (_adding_permissions); \
-    sc_hash_table_insert( \
-        manager->user_global_permissions, \
-        GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr)), \
-        GINT_TO_POINTER(_user_permissions)); \
+    _sc_context_set_user_global_permissions(manager, _user_addr, _user_permissions); \
     sc_monitor_release_write(&manager->user_global_permissions_monitor); \
   })
 
@@ -89,32 +333,35 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
 #define _sc_context_remove_user_global_permissions(_user_addr, _removing_permissions) \
   ({ \
     sc_monitor_acquire_write(&manager->user_global_permissions_monitor); \
-    sc_permissions _user_permissions = (sc_uint64)sc_hash_table_get( \
-        manager->user_global_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
+    sc_permissions _user_permissions = (sc_uint64)_sc_permissions_table_get( \
+        _sc_context_get_writable_user_global_permissions(), SC_ADDR_LOCAL_TO_INT(_user_addr)); \
     _user_permissions &= ~(_removing_permissions); \
-    sc_hash_table_insert( \
-        manager->user_global_permissions, \
-        GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr)), \
-        GINT_TO_POINTER(_user_permissions)); \
+    _sc_context_set_user_global_permissions(manager, _user_addr, _user_permissions); \
     sc_monitor_release_write(&manager->user_global_permissions_monitor); \
   })
 
 #define _sc_context_add_global_permissions(_user_addr, _adding_permissions) \
   ({ \
-    sc_memory_context * ctx = _sc_memory_context_get_impl(manager, _user_addr); \
+    sc_memory_context * ctx = _sc_memory_context_acquire_impl(manager, _user_addr); \
     if (ctx == null_ptr) \
       _sc_context_add_user_global_permissions(user_addr, _adding_permissions); \
     else \
+    { \
       _sc_context_add_context_global_permissions(ctx, _adding_permissions); \
+      _sc_memory_context_free_impl(manager, ctx); \
+    } \
   })
 
 #define _sc_context_remove_global_permissions(_user_addr, _removing_permissions) \
   ({ \
-    sc_memory_context * ctx = _sc_memory_context_get_impl(manager, _user_addr); \
+    sc_memory_context * ctx = _sc_memory_context_acquire_impl(manager, _user_addr); \
     if (ctx == null_ptr) \
       _sc_context_remove_user_global_permissions(user_addr, _removing_permissions); \
     else \
+    { \
       _sc_context_remove_context_global_permissions(ctx, _removing_permissions); \
+      _sc_memory_context_free_impl(manager, ctx); \
+    } \
   })
 
 /**
@@ -126,25 +373,12 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
 #define _sc_context_add_user_local_permissions(_user_addr, _adding_permissions, _structure_addr) \
   ({ \
     sc_monitor_acquire_write(&manager->user_local_permissions_monitor); \
-    sc_hash_table * structures_permissions_table = \
-        sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
-    sc_permissions _user_permissions = 0; \
-    if (structures_permissions_table == null_ptr) \
-    { \
-      structures_permissions_table = sc_hash_table_init(g_direct_hash, g_direct_equal, null_ptr, null_ptr); \
-      sc_hash_table_insert( \
-          manager->user_local_permissions, \
-          GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr)), \
-          structures_permissions_table); \
-    } \
-    else \
-      _user_permissions = (sc_uint64)sc_hash_table_get( \
-          structures_permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr))); \
+    sc_permissions_table * structures_permissions_table = _sc_permissions_table_get( \
+        _sc_context_get_writable_user_local_permissions(), SC_ADDR_LOCAL_TO_INT(_user_addr)); \
+    sc_permissions _user_permissions = (sc_uint64)_sc_permissions_table_get( \
+        structures_permissions_table, SC_ADDR_LOCAL_TO_INT(_structure_addr)); \
     _user_permissions |= (_adding_permissions); \
-    sc_hash_table_insert( \
-        structures_permissions_table, \
-        GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr)), \
-        GINT_TO_POINTER(_user_permissions)); \
+    _sc_context_set_user_local_permissions(manager, _user_addr, _structure_addr, _user_permissions); \
     sc_monitor_release_write(&manager->user_local_permissions_monitor); \
   })
 
@@ -157,66 +391,46 @@ typedef void (*sc_users_action_class_handler)(sc_memory_context_manager *, sc_ad
 #define _sc_context_remove_user_local_permissions(_user_addr, _removing_permissions, _structure_addr) \
   ({ \
     sc_monitor_acquire_write(&manager->user_local_permissions_monitor); \
-    sc_hash_table * structures_permissions_table = \
-        sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
-    sc_permissions _user_permissions = 0; \
+    sc_permissions_table * structures_permissions_table = _sc_permissions_table_get( \
+        _sc_context_get_writable_user_local_permissions(), SC_ADDR_LOCAL_TO_INT(_user_addr)); \
     if (structures_permissions_table != null_ptr) \
     { \
-      _user_permissions = (sc_uint64)sc_hash_table_get( \
-          structures_permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr))); \
+      sc_permissions _user_permissions = (sc_uint64)_sc_permissions_table_get( \
+          structures_permissions_table, SC_ADDR_LOCAL_TO_INT(_structure_addr)); \
       _user_permissions &= ~(_removing_permissions); \
-      sc_hash_table_insert( \
-          structures_permissions_table, \
-          GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_structure_addr)), \
-          GINT_TO_POINTER(_user_permissions)); \
+      _sc_context_set_user_local_permissions(manager, _user_addr, _structure_addr, _user_permissions); \
     } \
     sc_monitor_release_write(&manager->user_local_permissions_monitor); \
   })
 
-/**
- * @brief Adds local permissions (within sc-structure) to a given sc-memory context.
- * @param _context Pointer to the sc-memory context.
- * @param _adding_permissions Permissions to be added.
- * @return None.
- */
-#define _sc_context_add_context_local_permissions(_context, _adding_permissions, _structure_addr) \
-  ({ \
-    _sc_context_add_user_local_permissions((_context)->user_addr, _adding_permissions, _structure_addr); \
-    if ((_context)->local_permissions == null_ptr) \
-    { \
-      sc_monitor_acquire_write(&manager->user_local_permissions_monitor); \
-      (_context)->local_permissions = sc_hash_table_get( \
-          manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT((_context)->user_addr))); \
-      sc_monitor_release_write(&manager->user_local_permissions_monitor); \
-    } \
-  })
-
-/**
- * @brief Removes local permissions (within sc-structure) from a given sc-memory context.
- * @param _context Pointer to the sc-memory context.
- * @param _removing_permissions Permissions to be removed.
- * @return None.
- */
-#define _sc_context_remove_context_local_permissions(_context, _removing_permissions, _structure_addr) \
-  _sc_context_remove_user_local_permissions((_context)->user_addr, _removing_permissions, _structure_addr)
-
+// sc-memory contexts read local permissions of their users from the table, so they are changed for users only
 #define _sc_context_add_local_permissions(_user_addr, _adding_permissions, _structure_addr) \
-  ({ \
-    sc_memory_context * ctx = _sc_memory_context_get_impl(manager, _user_addr); \
-    if (ctx == null_ptr) \
-      _sc_context_add_user_local_permissions(user_addr, _adding_permissions, _structure_addr); \
-    else \
-      _sc_context_add_context_local_permissions(ctx, _adding_permissions, _structure_addr); \
-  })
+  _sc_context_add_user_local_permissions(_user_addr, _adding_permissions, _structure_addr)
 
 #define _sc_context_remove_local_permissions(_user_addr, _removing_permissions, _structure_addr) \
-  ({ \
-    sc_memory_context * ctx = _sc_memory_context_get_impl(manager, _user_addr); \
-    if (ctx == null_ptr) \
-      _sc_context_remove_user_local_permissions(user_addr, _removing_permissions, _structure_addr); \
-    else \
-      _sc_context_remove_context_local_permissions(ctx, _removing_permissions, _structure_addr); \
-  })
+  _sc_context_remove_user_local_permissions(_user_addr, _removing_permissions, _structure_addr)
+
+sc_permissions _sc_memory_context_get_global_permissions(
+    sc_memory_context_manager * manager,
+    sc_memory_context const * ctx)
+{
+  sc_memory_context * context = (sc_memory_context *)ctx;
+
+  sc_int32 permissions = g_atomic_int_get(&context->global_permissions);
+  if (permissions != SC_CONTEXT_PERMISSIONS_UNRESOLVED)
+    return (sc_permissions)permissions;
+
+  sc_monitor_acquire_write(&context->monitor);
+  permissions = g_atomic_int_get(&context->global_permissions);
+  if (permissions == SC_CONTEXT_PERMISSIONS_UNRESOLVED)
+  {
+    permissions = _sc_context_get_user_global_permissions(context->user_addr);
+    g_atomic_int_set(&context->global_permissions, permissions);
+  }
+  sc_monitor_release_write(&context->monitor);
+
+  return (sc_permissions)permissions;
+}
 
 sc_addr _sc_memory_context_manager_generate_guest_user(sc_memory_context_manager * manager)
 {
@@ -255,8 +469,7 @@ sc_result _sc_memory_context_manager_on_identified_user(
   sc_hash_table_remove(manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)));
 
   ctx->user_addr = identified_user_addr;
-  ctx->global_permissions = _sc_context_get_user_global_permissions(ctx->user_addr);
-  ctx->local_permissions = _sc_context_get_user_local_permissions(ctx->user_addr);
+  g_atomic_int_set(&ctx->global_permissions, SC_CONTEXT_PERMISSIONS_UNRESOLVED);
 
   sc_hash_table_insert(
       manager->context_hash_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(ctx->user_addr)), (sc_pointer)ctx);
@@ -408,21 +621,23 @@ sc_result _sc_memory_context_manager_on_new_user_in_users_set(
   sc_permissions const global_permissions = _sc_context_get_user_global_permissions(users_set_addr);
   _sc_context_add_global_permissions(user_addr, global_permissions);
 
-  sc_hash_table * local_permissions = _sc_context_get_user_local_permissions(users_set_addr);
+  // permissions of users set are copied, because tables of permissions can't be changed while they are read
+  sc_permissions_table * local_permissions = _sc_context_copy_user_local_permissions(users_set_addr);
   if (local_permissions == null_ptr)
     goto end;
 
-  sc_hash_table_iterator local_permissions_iterator;
-  sc_hash_table_iterator_init(&local_permissions_iterator, local_permissions);
-  sc_pointer key, value;
-  while (sc_hash_table_iterator_next(&local_permissions_iterator, &key, &value))
+  sc_uint32 index = 0;
+  sc_addr_hash key;
+  sc_pointer value;
+  while (_sc_permissions_table_next(local_permissions, &index, &key, &value))
   {
     sc_addr structure_addr;
-    SC_ADDR_LOCAL_FROM_INT((sc_pointer_to_sc_addr_hash)key, structure_addr);
+    SC_ADDR_LOCAL_FROM_INT(key, structure_addr);
     sc_permissions const permissions = (sc_uint64)value;
 
     _sc_context_add_local_permissions(user_addr, permissions, structure_addr);
   }
+  _sc_permissions_table_free(local_permissions);
 
 end:
 {
@@ -457,21 +672,23 @@ sc_result _sc_memory_context_manager_on_remove_user_from_users_set(
   sc_permissions const global_permissions = _sc_context_get_user_global_permissions(users_set_addr);
   _sc_context_remove_global_permissions(user_addr, global_permissions);
 
-  sc_hash_table * local_permissions = _sc_context_get_user_local_permissions(users_set_addr);
+  // permissions of users set are copied, because tables of permissions can't be changed while they are read
+  sc_permissions_table * local_permissions = _sc_context_copy_user_local_permissions(users_set_addr);
   if (local_permissions == null_ptr)
     goto end;
 
-  sc_hash_table_iterator local_permissions_iterator;
-  sc_hash_table_iterator_init(&local_permissions_iterator, local_permissions);
-  sc_pointer key, value;
-  while (sc_hash_table_iterator_next(&local_permissions_iterator, &key, &value))
+  sc_uint32 index = 0;
+  sc_addr_hash key;
+  sc_pointer value;
+  while (_sc_permissions_table_next(local_permissions, &index, &key, &value))
   {
     sc_addr structure_addr;
-    SC_ADDR_LOCAL_FROM_INT((sc_pointer_to_sc_addr_hash)key, structure_addr);
+    SC_ADDR_LOCAL_FROM_INT(key, structure_addr);
     sc_permissions const permissions = (sc_uint64)value;
 
     _sc_context_remove_local_permissions(user_addr, permissions, structure_addr);
   }
+  _sc_permissions_table_free(local_permissions);
 
 end:
   sc_memory_arc_new(s_memory_default_ctx, sc_type_const_temp_neg_arc, users_set_addr, user_addr);
@@ -1045,6 +1262,9 @@ void _sc_memory_context_handle_all_user_permissions(sc_memory_context_manager *
   if (manager->user_mode == SC_FALSE)
     return;
 
+  // permissions of all users are changed in batch, so tables of permissions aren't copied for each sc-arc
+  _sc_memory_context_manager_begin_permissions_batch(manager);
+
   _sc_memory_context_manager_iterate_by_all_outgoing_arcs_from_permitted_relation(
       manager,
       manager->nrel_user_action_class_addr,
@@ -1086,6 +1306,8 @@ void _sc_memory_context_handle_all_user_permissions(sc_memory_context_manager *
       sc_type_const_neg_arc,
       _sc_memory_context_manager_handle_users_set_action_class,
       _sc_memory_context_manager_remove_user_action_class_within_structure);
+
+  _sc_memory_context_manager_end_permissions_batch(manager);
 }
 
 #define sc_context_manager_register_user_event(...) \
@@ -1280,23 +1502,9 @@ sc_bool _sc_memory_context_check_if_has_permitted_structure(
   if (_sc_memory_context_check_system(manager, ctx))
     return SC_TRUE;
 
-  sc_bool result = SC_FALSE;
-
-  sc_monitor_acquire_read((sc_monitor *)&ctx->monitor);
-  sc_hash_table * permissions_table = ctx->local_permissions;
-
   // If element is permitted structure
-  if (permissions_table == null_ptr)
-    goto result;
-
-  sc_permissions permissions =
-      (sc_uint64)sc_hash_table_get(permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(element_addr)));
-  result = sc_context_has_permissions_subset(permissions, action_class_permissions);
-
-result:
-  sc_monitor_release_read((sc_monitor *)&ctx->monitor);
-
-  return result;
+  sc_permissions const permissions = _sc_context_get_user_local_permissions(ctx->user_addr, element_addr);
+  return sc_context_has_permissions_subset(permissions, action_class_permissions);
 }
 
 #define _sc_memory_check_if_is_permitted_structure(_structure_addr) \
@@ -1317,11 +1525,9 @@ sc_result _sc_memory_context_check_local_permissions(
 
   sc_result result = SC_RESULT_UNKNOWN;
 
-  sc_monitor_acquire_read((sc_monitor *)&ctx->monitor);
-  sc_hash_table * permissions_table = ctx->local_permissions;
-
-  if (permissions_table == null_ptr)
-    goto result;
+  sc_addr const user_addr = ctx->user_addr;
+  if (_sc_context_has_user_local_permissions(user_addr) == SC_FALSE)
+    return result;
 
   sc_iterator3 * it3 = sc_iterator3_a_a_f_new(
       s_memory_default_ctx, sc_type_node | sc_type_const | sc_type_node_structure, sc_type_const_pos_arc, element_addr);
@@ -1331,15 +1537,12 @@ sc_result _sc_memory_context_check_local_permissions(
     if (_sc_memory_check_if_is_permitted_structure(structure_addr) == SC_FALSE)
       continue;
 
-    sc_permissions const permissions =
-        (sc_uint64)sc_hash_table_get(permissions_table, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(structure_addr)));
+    // tables of permissions are read for each sc-structure, so reading isn't held during iteration
+    sc_permissions const permissions = _sc_context_get_user_local_permissions(user_addr, structure_addr);
     result = sc_context_has_permissions_subset(permissions, action_class_permissions) ? SC_RESULT_OK : SC_RESULT_NO;
   }
   sc_iterator3_free(it3);
 
-result:
-  sc_monitor_release_read((sc_monitor *)&ctx->monitor);
-
   return result;
 }
 
@@ -1397,6 +1600,7 @@ sc_bool _sc_memory_context_check_global_permissions_to_read_permissions(
 }
 
 sc_bool _sc_memory_context_check_global_permissions_to_handle_permissions(
+    sc_memory_context_manager * manager,
     sc_memory_context const * ctx,
     sc_addr permitted_element_addr,
     sc_permissions required_permissions)
@@ -1426,7 +1630,7 @@ sc_bool _sc_memory_context_check_global_permissions_to_write_permissions(
     return SC_TRUE;
 
   return _sc_memory_context_check_global_permissions_to_handle_permissions(
-      ctx, permitted_element_addr, required_permissions);
+      manager, ctx, permitted_element_addr, required_permissions);
 }
 
 sc_bool _sc_memory_context_check_global_permissions_to_erase_permissions(
@@ -1439,5 +1643,5 @@ sc_bool _sc_memory_context_check_global_permissions_to_erase_permissions(
     return SC_TRUE;
 
   return _sc_memory_context_check_global_permissions_to_handle_permissions(
-      ctx, permitted_element_addr, required_permissions);
+      manager, ctx, permitted_element_addr, required_permissions);
 }
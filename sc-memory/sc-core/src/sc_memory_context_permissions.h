@@ -14,9 +14,12 @@
 #include "sc-store/sc-base/sc_monitor_table.h"
 
 #include "sc_memory_context_manager.h"
+#include "sc_memory_context_permissions_table.h"
 
 #define SC_CONTEXT_FLAG_SYSTEM 0x10
 
+#define SC_CONTEXT_PERMISSIONS_UNRESOLVED -1
+
 /**
  * @brief Sets permissions for a specific sc-memory element.
  * @param _element_addr Address of the sc-memory element.
@@ -48,26 +51,70 @@
     _element_permissions; \
   })
 
+//! Gets global permissions of a specific user without locks.
 #define _sc_context_get_user_global_permissions(_user_addr) \
-  ({ \
-    sc_monitor_acquire_read(&manager->user_global_permissions_monitor); \
-    sc_permissions const permissions = (sc_uint64)sc_hash_table_get( \
-        manager->user_global_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
-    sc_monitor_release_read(&manager->user_global_permissions_monitor); \
-    permissions; \
-  })
+  _sc_memory_context_manager_get_user_global_permissions(manager, _user_addr)
 
-#define _sc_context_get_user_local_permissions(_user_addr) \
-  ({ \
-    sc_monitor_acquire_read(&manager->user_local_permissions_monitor); \
-    sc_hash_table * permissions = \
-        sc_hash_table_get(manager->user_local_permissions, GINT_TO_POINTER(SC_ADDR_LOCAL_TO_INT(_user_addr))); \
-    sc_monitor_release_read(&manager->user_local_permissions_monitor); \
-    permissions; \
-  })
+//! Checks without locks if a specific user has local permissions within any sc-structure.
+#define _sc_context_has_user_local_permissions(_user_addr) \
+  _sc_memory_context_manager_has_user_local_permissions(manager, _user_addr)
+
+//! Gets local permissions of a specific user within a specific sc-structure without locks.
+#define _sc_context_get_user_local_permissions(_user_addr, _structure_addr) \
+  _sc_memory_context_manager_get_user_local_permissions(manager, _user_addr, _structure_addr)
+
+/*! Copies table of local permissions of a specific user within sc-structures.
+ * @returns Returns copy of table that should be freed by `_sc_permissions_table_free`, or null_ptr if user hasn't local
+ * permissions.
+ */
+#define _sc_context_copy_user_local_permissions(_user_addr) \
+  _sc_memory_context_manager_copy_user_local_permissions(manager, _user_addr)
+
+/*! Function that gets global permissions of a specific user.
+ * @note Permissions are read from published table without locks. While permissions are changed in batch, they are read
+ * from draft of table under the monitor of its writers.
+ */
+sc_permissions _sc_memory_context_manager_get_user_global_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr);
+
+//! Function that checks if a specific user has local permissions within any sc-structure.
+sc_bool _sc_memory_context_manager_has_user_local_permissions(sc_memory_context_manager * manager, sc_addr user_addr);
+
+//! Function that gets local permissions of a specific user within a specific sc-structure.
+sc_permissions _sc_memory_context_manager_get_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr,
+    sc_addr structure_addr);
+
+//! Function that copies table of local permissions of a specific user within sc-structures.
+sc_permissions_table * _sc_memory_context_manager_copy_user_local_permissions(
+    sc_memory_context_manager * manager,
+    sc_addr user_addr);
+
+/*! Function that begins batch of changes of permissions of users.
+ * @param manager Pointer to the sc-memory context manager.
+ * @note Changes of permissions in batch are applied in place to drafts of tables of permissions, and drafts are
+ * published at the end of batch, so readers wait for only one grace period and tables aren't copied for each change.
+ */
+void _sc_memory_context_manager_begin_permissions_batch(sc_memory_context_manager * manager);
+
+//! Function that publishes tables of permissions changed in batch.
+void _sc_memory_context_manager_end_permissions_batch(sc_memory_context_manager * manager);
 
 sc_addr _sc_memory_context_manager_generate_guest_user(sc_memory_context_manager * manager);
 
+/*! Function that gets global permissions of a sc-memory context, resolving them from cached permissions of its user.
+ * @param manager Pointer to the sc-memory context manager.
+ * @param ctx Pointer to the sc-memory context which permissions are got.
+ * @returns Returns global permissions of the sc-memory context.
+ * @note Permissions are resolved once, at the first access to them, so sc-memory contexts that never check
+ * permissions don't look them up. Resolved permissions are read without locks.
+ */
+sc_permissions _sc_memory_context_get_global_permissions(
+    sc_memory_context_manager * manager,
+    sc_memory_context const * ctx);
+
 /*! Function that handles all user permissions by iterating through relevant relations and invoking corresponding
  * handlers.
  * @param manager Pointer to the sc-memory context manager.
@@ -0,0 +1,253 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_memory_context_permissions_table.h"
+
+#include <glib.h>
+
+#include "sc-core/sc-base/sc_allocator.h"
+
+#define SC_PERMISSIONS_TABLE_INITIAL_CAPACITY 8
+
+//! Structure representing item of table of permissions. Item with empty key is free.
+typedef struct
+{
+  sc_addr_hash key;
+  sc_pointer value;
+} sc_permissions_table_item;
+
+struct _sc_permissions_table
+{
+  sc_uint32 capacity;  ///< Number of items, it is a power of two.
+  sc_uint32 size;      ///< Number of occupied items.
+  sc_permissions_table_item items[];
+};
+
+//! Number of indices of records of reader threads that have been assigned.
+static sc_uint32 readers_indices_count = 0;
+//! Indices + 1 of records of exited reader threads. They are reused by new reader threads.
+static GSList * free_readers_indices = null_ptr;
+//! Mutex for synchronizing access to indices of records of reader threads. Static GMutex doesn't need initialization.
+static GMutex readers_indices_mutex;
+
+//! Returns index of record of exited reader thread to free indices.
+static void _sc_permissions_table_release_reader_index(sc_pointer index)
+{
+  g_mutex_lock(&readers_indices_mutex);
+  free_readers_indices = g_slist_prepend(free_readers_indices, index);
+  g_mutex_unlock(&readers_indices_mutex);
+}
+
+//! Index of record of current reader thread + 1, it is 0 if thread hasn't read tables of permissions yet.
+static GPrivate reader_index = G_PRIVATE_INIT(_sc_permissions_table_release_reader_index);
+
+sc_uint32 _sc_permissions_table_get_item_index(sc_permissions_table const * table, sc_addr_hash key)
+{
+  sc_uint32 const mask = table->capacity - 1;
+  sc_uint32 index = (key * 2654435761u) & mask;
+  while (table->items[index].key != 0 && table->items[index].key != key)
+    index = (index + 1) & mask;
+  return index;
+}
+
+sc_pointer _sc_permissions_table_get(sc_permissions_table const * table, sc_addr_hash key)
+{
+  if (table == null_ptr || key == 0)
+    return null_ptr;
+
+  return table->items[_sc_permissions_table_get_item_index(table, key)].value;
+}
+
+void _sc_permissions_table_set(sc_permissions_table * table, sc_addr_hash key, sc_pointer value)
+{
+  sc_permissions_table_item * item = &table->items[_sc_permissions_table_get_item_index(table, key)];
+  if (item->key == 0)
+  {
+    item->key = key;
+    ++table->size;
+  }
+  item->value = value;
+}
+
+sc_permissions_table * _sc_permissions_table_copy_with(
+    sc_permissions_table const * table,
+    sc_addr_hash key,
+    sc_pointer value)
+{
+  sc_uint32 const size = table == null_ptr ? 1 : table->size + 1;
+  sc_uint32 capacity = table == null_ptr ? SC_PERMISSIONS_TABLE_INITIAL_CAPACITY : table->capacity;
+  while (size * 2 > capacity)
+    capacity *= 2;
+
+  sc_permissions_table * copy =
+      (sc_permissions_table *)_sc_mem_new(sizeof(sc_permissions_table) + sizeof(sc_permissions_table_item) * capacity);
+  copy->capacity = capacity;
+  copy->size = 0;
+
+  sc_uint32 index = 0;
+  sc_addr_hash item_key;
+  sc_pointer item_value;
+  while (_sc_permissions_table_next(table, &index, &item_key, &item_value))
+    _sc_permissions_table_set(copy, item_key, item_value);
+
+  if (key != 0)
+    _sc_permissions_table_set(copy, key, value);
+
+  return copy;
+}
+
+sc_bool _sc_permissions_table_next(
+    sc_permissions_table const * table,
+    sc_uint32 * index,
+    sc_addr_hash * key,
+    sc_pointer * value)
+{
+  if (table == null_ptr)
+    return SC_FALSE;
+
+  for (; *index < table->capacity; ++*index)
+  {
+    sc_permissions_table_item const * item = &table->items[*index];
+    if (item->key == 0)
+      continue;
+
+    *key = item->key;
+    *value = item->value;
+    ++*index;
+    return SC_TRUE;
+  }
+
+  return SC_FALSE;
+}
+
+sc_permissions_table * _sc_permissions_table_set_unpublished(
+    sc_permissions_table * table,
+    sc_addr_hash key,
+    sc_pointer value)
+{
+  if (table == null_ptr || (table->size + 1) * 2 > table->capacity)
+  {
+    sc_permissions_table * copy = _sc_permissions_table_copy_with(table, key, value);
+    _sc_permissions_table_free(table);
+    return copy;
+  }
+
+  _sc_permissions_table_set(table, key, value);
+  return table;
+}
+
+void _sc_permissions_table_free(sc_permissions_table * table)
+{
+  sc_mem_free(table);
+}
+
+void _sc_permissions_table_readers_destroy(sc_permissions_table_readers * readers)
+{
+  for (sc_uint32 i = 0; i < SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT; ++i)
+  {
+    sc_mem_free(readers->chunks[i]);
+    readers->chunks[i] = null_ptr;
+  }
+}
+
+//! Gets index of record of current reader thread, assigning it at the first reading by thread.
+sc_uint32 _sc_permissions_table_get_reader_index()
+{
+  sc_uint32 index = GPOINTER_TO_UINT(g_private_get(&reader_index));
+  if (index != 0)
+    return index - 1;
+
+  g_mutex_lock(&readers_indices_mutex);
+  if (free_readers_indices != null_ptr)
+  {
+    index = GPOINTER_TO_UINT(free_readers_indices->data);
+    free_readers_indices = g_slist_delete_link(free_readers_indices, free_readers_indices);
+  }
+  else if (readers_indices_count < SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT * SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE)
+    index = ++readers_indices_count;
+  g_mutex_unlock(&readers_indices_mutex);
+
+  // there are no free records, so thread is counted by counter of overflowed readers
+  if (index == 0)
+    return SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT * SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE;
+
+  g_private_set(&reader_index, GUINT_TO_POINTER(index));
+  return index - 1;
+}
+
+//! Gets record of reader with specified index, allocating its chunk at the first reading.
+sc_permissions_table_reader * _sc_permissions_table_get_reader(sc_permissions_table_readers * readers, sc_uint32 index)
+{
+  sc_permissions_table_reader ** chunk_ptr = &readers->chunks[index / SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE];
+  sc_permissions_table_reader * chunk = g_atomic_pointer_get(chunk_ptr);
+  if (chunk == null_ptr)
+  {
+    sc_permissions_table_reader * new_chunk =
+        sc_mem_new(sc_permissions_table_reader, SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE);
+    if (g_atomic_pointer_compare_and_exchange(chunk_ptr, null_ptr, new_chunk))
+      chunk = new_chunk;
+    else
+    {
+      sc_mem_free(new_chunk);
+      chunk = g_atomic_pointer_get(chunk_ptr);
+    }
+  }
+
+  return &chunk[index % SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE];
+}
+
+sc_uint32 _sc_permissions_table_read_begin(sc_permissions_table_readers * readers)
+{
+  sc_uint32 const index = _sc_permissions_table_get_reader_index();
+  if (index == SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT * SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE)
+  {
+    g_atomic_int_inc(&readers->overflowed_readers_count);
+    return index;
+  }
+
+  sc_permissions_table_reader * reader = _sc_permissions_table_get_reader(readers, index);
+  // exchange is a full barrier, so tables are loaded after generation is stored
+  g_atomic_int_compare_and_exchange(&reader->generation, 0, g_atomic_int_get(&readers->generation) + 1);
+  return index;
+}
+
+void _sc_permissions_table_read_end(sc_permissions_table_readers * readers, sc_uint32 reader_index)
+{
+  if (reader_index == SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT * SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE)
+  {
+    g_atomic_int_dec_and_test(&readers->overflowed_readers_count);
+    return;
+  }
+
+  g_atomic_int_set(&_sc_permissions_table_get_reader(readers, reader_index)->generation, 0);
+}
+
+void _sc_permissions_table_wait_readers(sc_permissions_table_readers * readers)
+{
+  // increment is a full barrier, so readers that load new generation load new tables, and only readers that began
+  // reading at previous generations are waited
+  sc_int32 const generation = g_atomic_int_add(&readers->generation, 1) + 1;
+  for (sc_uint32 i = 0; i < SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT; ++i)
+  {
+    sc_permissions_table_reader * chunk = g_atomic_pointer_get(&readers->chunks[i]);
+    if (chunk == null_ptr)
+      continue;
+
+    for (sc_uint32 j = 0; j < SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE; ++j)
+    {
+      while (SC_TRUE)
+      {
+        sc_int32 const reader_generation = g_atomic_int_get(&chunk[j].generation);
+        if (reader_generation == 0 || reader_generation > generation)
+          break;
+        g_thread_yield();
+      }
+    }
+  }
+
+  while (g_atomic_int_get(&readers->overflowed_readers_count) != 0)
+    g_thread_yield();
+}
@@ -0,0 +1,117 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#ifndef _sc_memory_context_permissions_table_h_
+#define _sc_memory_context_permissions_table_h_
+
+#include "sc-core/sc_types.h"
+
+#define SC_PERMISSIONS_TABLE_READERS_CHUNK_SIZE 64
+#define SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT 1024
+#define SC_PERMISSIONS_TABLE_CACHE_LINE_SIZE 64
+
+/*! Structure representing immutable open-addressing table of permissions.
+ * @note Table is never changed after its publication. Writers publish changed copy of table instead of it, and readers
+ * look up keys in table without locks. Keys are hashes of sc-addresses, empty sc-address can't be a key.
+ */
+typedef struct _sc_permissions_table sc_permissions_table;
+
+//! Structure representing reader thread of tables of permissions placed in its own cache line.
+typedef struct
+{
+  sc_int32 generation;  ///< Generation of tables + 1 at which thread began reading, 0 if thread doesn't read.
+  sc_char generation_padding[SC_PERMISSIONS_TABLE_CACHE_LINE_SIZE - sizeof(sc_int32)];
+} sc_permissions_table_reader;
+
+/*! Structure representing readers of tables of permissions.
+ * @note Each reader thread has its own record, in which it stores generation of tables when it begins reading. Writers
+ * increment generation after publishing of new tables and wait only for readers that began reading at previous
+ * generations (grace period), so readers that begin reading later can't starve writers. Records are allocated in
+ * chunks at the first reading by thread, indices of records of exited threads are reused by new threads. Reading
+ * threads are counted by shared counter only if all records are occupied.
+ */
+typedef struct
+{
+  sc_int32 generation;  ///< Generation of tables, it is incremented by writers.
+  sc_permissions_table_reader * chunks[SC_PERMISSIONS_TABLE_READERS_CHUNKS_COUNT];  ///< Chunks of records of readers.
+  ///< Number of reading threads that got no records, because all records are occupied by other threads.
+  sc_int32 overflowed_readers_count;
+} sc_permissions_table_readers;
+
+/*! Function that gets value by key from table of permissions.
+ * @param table Pointer to table of permissions. It may be null_ptr.
+ * @param key Hash of sc-address used as a key.
+ * @returns Returns value of key or null_ptr if table has no such key.
+ */
+sc_pointer _sc_permissions_table_get(sc_permissions_table const * table, sc_addr_hash key);
+
+/*! Function that generates copy of table of permissions with specified value of key.
+ * @param table Pointer to copied table of permissions. It may be null_ptr.
+ * @param key Hash of sc-address used as a key.
+ * @param value Value of key in the copy.
+ * @returns Returns pointer to the copy that should be freed by `_sc_permissions_table_free`.
+ * @note Copy grows twice if it is filled more than by half.
+ */
+sc_permissions_table * _sc_permissions_table_copy_with(
+    sc_permissions_table const * table,
+    sc_addr_hash key,
+    sc_pointer value);
+
+/*! Function that gets the next item of table of permissions.
+ * @param table Pointer to table of permissions. It may be null_ptr.
+ * @param index Pointer to index of the next item. It should be 0 before the first call.
+ * @param key Pointer to key of item.
+ * @param value Pointer to value of item.
+ * @returns Returns SC_TRUE if item is got, otherwise SC_FALSE.
+ */
+sc_bool _sc_permissions_table_next(
+    sc_permissions_table const * table,
+    sc_uint32 * index,
+    sc_addr_hash * key,
+    sc_pointer * value);
+
+/*! Function that sets value of key in table of permissions that isn't published yet.
+ * @param table Pointer to changed table of permissions. It may be null_ptr.
+ * @param key Hash of sc-address used as a key.
+ * @param value Value of key.
+ * @returns Returns pointer to table with specified value of key. If \p table has to grow, then it is its grown copy and
+ * \p table is freed.
+ * @note It is used to collect many changes in one table, which is published once, instead of copying of table for
+ * each change.
+ */
+sc_permissions_table * _sc_permissions_table_set_unpublished(
+    sc_permissions_table * table,
+    sc_addr_hash key,
+    sc_pointer value);
+
+//! Frees table of permissions. Table may be null_ptr.
+void _sc_permissions_table_free(sc_permissions_table * table);
+
+//! Frees records of readers of tables of permissions. Nobody should read tables at this moment.
+void _sc_permissions_table_readers_destroy(sc_permissions_table_readers * readers);
+
+/*! Function that marks the beginning of reading of tables of permissions by current thread.
+ * @param readers Pointer to readers of tables of permissions.
+ * @returns Returns index of record of current thread that should be passed to `_sc_permissions_table_read_end`.
+ * @note Tables loaded after this call are valid until the end of reading. Readers can't change tables of permissions
+ * and wait for anything during reading.
+ */
+sc_uint32 _sc_permissions_table_read_begin(sc_permissions_table_readers * readers);
+
+/*! Function that marks the end of reading of tables of permissions by current thread.
+ * @param readers Pointer to readers of tables of permissions.
+ * @param reader_index Index of record returned by `_sc_permissions_table_read_begin`.
+ */
+void _sc_permissions_table_read_end(sc_permissions_table_readers * readers, sc_uint32 reader_index);
+
+/*! Function that waits until readers that could load previous tables of permissions end reading.
+ * @param readers Pointer to readers of tables of permissions.
+ * @note It is called by writers after publishing of new tables and before freeing of previous ones. Readers that begin
+ * reading after this call began aren't waited.
+ */
+void _sc_permissions_table_wait_readers(sc_permissions_table_readers * readers);
+
+#endif
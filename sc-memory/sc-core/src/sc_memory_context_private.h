@@ -13,6 +13,8 @@
 #include "sc-store/sc-container/sc_hash_table.h"
 #include "sc-store/sc-base/sc_monitor_private.h"
 
+#include "sc_memory_context_permissions_table.h"
+
 /*! Structure representing a memory context manager.
  * @note This structure manages memory contexts and user authentications in the sc-memory.
  */
@@ -21,6 +23,10 @@ struct _sc_memory_context_manager
   sc_hash_table * context_hash_table;  ///< Hash table storing memory contexts based on user addresses.
   sc_uint32 context_count;             ///< Number of currently active memory contexts.
   sc_monitor context_monitor;          ///< Monitor for synchronizing access to the hash table storing memory contexts.
+  ///< Stack of released memory contexts. They are reused by new memory contexts of any users, so their number is
+  ///< bounded by the stack capacity. It is synchronized by the monitor of the hash table storing memory contexts.
+  sc_memory_context ** idle_contexts;
+  sc_uint32 idle_contexts_count;  ///< Number of released memory contexts in the stack.
 
   sc_event_subscription * on_new_identified_user_subscription;  /// < Subscription for identified user events.
 
@@ -29,9 +35,21 @@ struct _sc_memory_context_manager
   sc_event_subscription *
       on_remove_authenticated_user_subscription;  ///< Subscription for user unauthentication events.
 
-  ///< Hash table storing global permissions (within the knowledge base) for users.
-  sc_hash_table * user_global_permissions;
-  ///< Monitor for synchronizing access to the hash table storing global permissions within the knowledge base.
+  ///< Readers of tables storing permissions for users. They read tables without monitors.
+  sc_permissions_table_readers user_permissions_readers;
+  ///< Flag indicating whether changes of permissions for users are collected in drafts of tables. It is changed under
+  ///< monitors of writers of both tables.
+  sc_int32 is_permissions_batch;
+  ///< Draft of table storing global permissions for users. It is changed in place while permissions are changed in
+  ///< batch.
+  sc_permissions_table * user_global_permissions_draft;
+  ///< Draft of table storing local permissions for users. Draft and its tables are changed in place while permissions
+  ///< are changed in batch.
+  sc_permissions_table * user_local_permissions_draft;
+
+  ///< Table storing global permissions (within the knowledge base) for users. It is replaced by its changed copy.
+  sc_permissions_table * user_global_permissions;
+  ///< Monitor for synchronizing writers of the table storing global permissions within the knowledge base.
   sc_monitor user_global_permissions_monitor;
   sc_hash_table * basic_action_classes;  ///< Hash table storing permissions for action classes in sc-memory.
   sc_event_subscription *
@@ -41,9 +59,9 @@ struct _sc_memory_context_manager
       on_remove_user_action_class;  ///< Event subscription for removing new permitted action classes for users.
   sc_event_subscription * on_remove_users_set_action_class;
 
-  ///< Hash table storing local permissions (within sc-structures) for users.
-  sc_hash_table * user_local_permissions;
-  ///< Monitor for synchronizing access to the hash table storing local permissions within sc-structures.
+  ///< Table storing tables of local permissions (within sc-structures) for users. It is replaced by its changed copy.
+  sc_permissions_table * user_local_permissions;
+  ///< Monitor for synchronizing writers of the table storing local permissions within sc-structures.
   sc_monitor user_local_permissions_monitor;
   sc_event_subscription * on_new_user_action_class_within_sc_structure;
   sc_event_subscription * on_new_users_set_action_class_within_sc_structure;
@@ -80,11 +98,16 @@ struct _sc_memory_context
 {
   sc_addr user_addr;                  ///< sc-address representing the user associated with the sc-memory context.
   sc_uint32 ref_count;                ///< Reference count to manage the number of references to the sc-memory context.
-  sc_permissions global_permissions;  ///< Global permissions within the knowledge base.
-  sc_hash_table * local_permissions;  ///< Local permissions within sc-structures.
-  sc_uint8 flags;                     ///< Flags indicating the state of the sc-memory context.
-  sc_hash_table_list * pend_events;   ///< List of pending events to be emitted in the sc-memory context.
-  sc_monitor monitor;                 ///< Monitor for synchronizing access to the sc-memory context.
+  ///< Global permissions within the knowledge base, or SC_CONTEXT_PERMISSIONS_UNRESOLVED if they aren't resolved yet.
+  ///< They are read atomically and changed under the monitor of the sc-memory context.
+  sc_int32 global_permissions;
+  sc_uint8 flags;  ///< Flags indicating the state of the sc-memory context.
+
+  struct _sc_event_emit_params * pend_events;  ///< Buffer of pending events to be emitted in the sc-memory context.
+  sc_uint32 pend_events_count;                 ///< Number of pending events in the buffer.
+  sc_uint32 pend_events_capacity;              ///< Number of events that fit in the buffer without its growth.
+
+  sc_monitor monitor;  ///< Monitor for synchronizing access to the sc-memory context.
 };
 
 /*!
@@ -6,6 +6,11 @@
 
 #include <sc-memory/test/sc_test.hpp>
 
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
 extern "C"
 {
 #include <sc-core/sc_memory.h>
@@ -101,3 +106,104 @@ TEST_F(ScMemoryTest, sc_event_subscription_invalid)
       sc_event_subscription_with_user_new(context, SC_ADDR_EMPTY, subscription_addr, 0, nullptr, nullptr, nullptr),
       nullptr);
 }
+
+TEST_F(ScMemoryTest, sc_memory_context_reuse_released_context_of_user)
+{
+  sc_memory_context * context = **m_ctx;
+  sc_addr const user_addr = sc_memory_node_new(context, sc_type_const_node);
+
+  sc_memory_context * user_context = sc_memory_context_new_ext(user_addr);
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_memory_context_get_user_addr(user_context), user_addr));
+  EXPECT_EQ(sc_memory_context_new_ext(user_addr), user_context);
+  sc_memory_context_free(user_context);
+  sc_memory_context_free(user_context);
+
+  sc_memory_context * reused_user_context = sc_memory_context_new_ext(user_addr);
+  EXPECT_EQ(reused_user_context, user_context);
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_memory_context_get_user_addr(reused_user_context), user_addr));
+
+  sc_memory_context * other_user_context = sc_memory_context_new_ext(SC_ADDR_EMPTY);
+  EXPECT_NE(other_user_context, reused_user_context);
+  EXPECT_FALSE(SC_ADDR_IS_EQUAL(sc_memory_context_get_user_addr(other_user_context), user_addr));
+
+  sc_memory_context_free(other_user_context);
+  sc_memory_context_free(reused_user_context);
+}
+
+TEST_F(ScMemoryTest, sc_memory_context_reuse_released_context_of_user_concurrently)
+{
+  sc_memory_context * context = **m_ctx;
+  sc_addr const user_addr = sc_memory_node_new(context, sc_type_const_node);
+
+  std::atomic_bool is_valid = true;
+  std::vector<std::thread> threads;
+  for (sc_uint32 i = 0; i < 8; ++i)
+    threads.emplace_back(
+        [&user_addr, &is_valid]()
+        {
+          for (sc_uint32 j = 0; j < 1000; ++j)
+          {
+            sc_memory_context * user_context = sc_memory_context_new_ext(user_addr);
+            if (user_context == nullptr || !SC_ADDR_IS_EQUAL(sc_memory_context_get_user_addr(user_context), user_addr))
+              is_valid = false;
+            sc_memory_context_free(user_context);
+          }
+        });
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_TRUE(is_valid.load());
+}
+
+TEST_F(ScMemoryTest, sc_memory_post_task)
+{
+  std::atomic<sc_uint32> calls_count = 0;
+  std::atomic<sc_uint32> cancelled_calls_count = 0;
+  struct TaskData
+  {
+    std::atomic<sc_uint32> * calls_count;
+    std::atomic<sc_uint32> * cancelled_calls_count;
+  } data{&calls_count, &cancelled_calls_count};
+
+  sc_uint32 const tasks_count = 100;
+  for (sc_uint32 i = 0; i < tasks_count; ++i)
+    EXPECT_EQ(
+        sc_memory_post_task(
+            [](sc_pointer data, sc_bool is_cancelled)
+            {
+              auto * task_data = static_cast<TaskData *>(data);
+              if (is_cancelled)
+                ++*task_data->cancelled_calls_count;
+              ++*task_data->calls_count;
+            },
+            &data),
+        SC_RESULT_OK);
+
+  for (sc_uint32 i = 0; i < 1000 && calls_count.load() != tasks_count; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(5));
+
+  EXPECT_EQ(calls_count.load(), tasks_count);
+  EXPECT_EQ(cancelled_calls_count.load(), 0u);
+  EXPECT_EQ(sc_memory_post_task(nullptr, &data), SC_RESULT_ERROR);
+}
+
+TEST_F(ScMemoryTest, sc_memory_context_reuse_released_context_of_other_user)
+{
+  sc_memory_context * context = **m_ctx;
+  sc_addr const user_addr = sc_memory_node_new(context, sc_type_const_node);
+  sc_addr const other_user_addr = sc_memory_node_new(context, sc_type_const_node);
+
+  sc_memory_context * user_context = sc_memory_context_new_ext(user_addr);
+  sc_memory_context_free(user_context);
+
+  sc_memory_context * other_user_context = sc_memory_context_new_ext(other_user_addr);
+  EXPECT_EQ(other_user_context, user_context);
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_memory_context_get_user_addr(other_user_context), other_user_addr));
+
+  sc_memory_context * new_user_context = sc_memory_context_new_ext(user_addr);
+  EXPECT_NE(new_user_context, other_user_context);
+  EXPECT_TRUE(SC_ADDR_IS_EQUAL(sc_memory_context_get_user_addr(new_user_context), user_addr));
+
+  sc_memory_context_free(new_user_context);
+  sc_memory_context_free(other_user_context);
+}
@@ -0,0 +1,132 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/test/sc_test.hpp>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+extern "C"
+{
+#include <sc_memory_context_permissions_table.h>
+}
+
+TEST(ScPermissionsTableTest, sc_permissions_table_copy_with)
+{
+  EXPECT_EQ(_sc_permissions_table_get(nullptr, 1), nullptr);
+
+  sc_permissions_table * table = _sc_permissions_table_copy_with(nullptr, 1, (sc_pointer)0x4);
+  EXPECT_EQ(_sc_permissions_table_get(table, 1), (sc_pointer)0x4);
+  EXPECT_EQ(_sc_permissions_table_get(table, 2), nullptr);
+
+  sc_permissions_table * copy = _sc_permissions_table_copy_with(table, 2, (sc_pointer)0x8);
+  EXPECT_EQ(_sc_permissions_table_get(copy, 1), (sc_pointer)0x4);
+  EXPECT_EQ(_sc_permissions_table_get(copy, 2), (sc_pointer)0x8);
+  EXPECT_EQ(_sc_permissions_table_get(table, 2), nullptr);
+
+  sc_permissions_table * changed_copy = _sc_permissions_table_copy_with(copy, 1, (sc_pointer)0x10);
+  EXPECT_EQ(_sc_permissions_table_get(changed_copy, 1), (sc_pointer)0x10);
+  EXPECT_EQ(_sc_permissions_table_get(copy, 1), (sc_pointer)0x4);
+
+  _sc_permissions_table_free(changed_copy);
+  _sc_permissions_table_free(copy);
+  _sc_permissions_table_free(table);
+}
+
+TEST(ScPermissionsTableTest, sc_permissions_table_grow_and_iterate)
+{
+  sc_uint32 const items_count = 1000;
+
+  sc_permissions_table * table = nullptr;
+  for (sc_uint32 i = 1; i <= items_count; ++i)
+  {
+    sc_permissions_table * copy = _sc_permissions_table_copy_with(table, i << 16, (sc_pointer)(sc_uint64)i);
+    _sc_permissions_table_free(table);
+    table = copy;
+  }
+
+  for (sc_uint32 i = 1; i <= items_count; ++i)
+    EXPECT_EQ(_sc_permissions_table_get(table, i << 16), (sc_pointer)(sc_uint64)i);
+
+  sc_uint32 index = 0;
+  sc_uint32 iterated_items_count = 0;
+  sc_addr_hash key;
+  sc_pointer value;
+  while (_sc_permissions_table_next(table, &index, &key, &value))
+  {
+    EXPECT_EQ(key, (sc_uint64)value << 16);
+    ++iterated_items_count;
+  }
+  EXPECT_EQ(iterated_items_count, items_count);
+
+  _sc_permissions_table_free(table);
+}
+
+TEST(ScPermissionsTableTest, sc_permissions_table_set_unpublished)
+{
+  sc_permissions_table * table = nullptr;
+  for (sc_uint32 i = 1; i <= 100; ++i)
+    table = _sc_permissions_table_set_unpublished(table, i << 16, (sc_pointer)(sc_uint64)i);
+
+  sc_permissions_table * const changed_table = _sc_permissions_table_set_unpublished(table, 1 << 16, (sc_pointer)0x4);
+  EXPECT_EQ(changed_table, table);
+
+  EXPECT_EQ(_sc_permissions_table_get(table, 1 << 16), (sc_pointer)0x4);
+  for (sc_uint32 i = 2; i <= 100; ++i)
+    EXPECT_EQ(_sc_permissions_table_get(table, i << 16), (sc_pointer)(sc_uint64)i);
+
+  _sc_permissions_table_free(table);
+}
+
+void TestReadPermissionsTableWhileReplaced(sc_uint32 readersCount)
+{
+  sc_permissions_table_readers readers{};
+  std::atomic<sc_permissions_table *> table = _sc_permissions_table_copy_with(nullptr, 1, (sc_pointer)0x1);
+
+  std::atomic_bool is_stopped = false;
+  std::atomic_bool is_valid = true;
+  std::vector<std::thread> threads;
+  for (sc_uint32 i = 0; i < readersCount; ++i)
+    threads.emplace_back(
+        [&]()
+        {
+          while (!is_stopped.load())
+          {
+            sc_uint32 const reader_index = _sc_permissions_table_read_begin(&readers);
+            if (_sc_permissions_table_get(table.load(), 1) == nullptr)
+              is_valid = false;
+            _sc_permissions_table_read_end(&readers, reader_index);
+          }
+        });
+
+  for (sc_uint64 i = 2; i < 1000; ++i)
+  {
+    sc_permissions_table * previous_table = table.load();
+    table = _sc_permissions_table_copy_with(previous_table, 1, (sc_pointer)i);
+    _sc_permissions_table_wait_readers(&readers);
+    _sc_permissions_table_free(previous_table);
+  }
+
+  is_stopped = true;
+  for (auto & thread : threads)
+    thread.join();
+
+  EXPECT_TRUE(is_valid.load());
+  _sc_permissions_table_free(table.load());
+  _sc_permissions_table_readers_destroy(&readers);
+}
+
+TEST(ScPermissionsTableTest, sc_permissions_table_read_while_replaced)
+{
+  TestReadPermissionsTableWhileReplaced(4);
+}
+
+TEST(ScPermissionsTableTest, sc_permissions_table_read_by_many_threads_while_replaced)
+{
+  // readers that begin reading after replacement aren't waited, so writer isn't starved by many readers
+  TestReadPermissionsTableWhileReplaced(128);
+}
@@ -182,6 +182,12 @@ ScTemplate ScAgent<TScEvent, TScContext>::GetResultConditionTemplate(TScEvent co
   return ScTemplate();
 }
 
+template <class TScEvent, class TScContext>
+ScEventPriority ScAgent<TScEvent, TScContext>::GetEventPriority() const
+{
+  return ScEventPriority::Normal;
+}
+
 template <class TScEvent, class TScContext>
 void ScAgent<TScEvent, TScContext>::SetInitiator(ScAddr const & userAddr) noexcept
 {
@@ -389,7 +395,7 @@ ScTemplate ScAgent<TScEvent, TScContext>::BuildInitiationConditionTemplate(
   }
 
   ScTemplate initiationConditionTemplate;
-  this->m_context.BuildTemplate(initiationConditionTemplate, initiationConditionTemplateAddr, templateParams);
+  this->m_context.BuildCachedTemplate(initiationConditionTemplate, initiationConditionTemplateAddr, templateParams);
   return initiationConditionTemplate;
 }
 
@@ -399,7 +405,7 @@ ScTemplate ScAgent<TScEvent, TScContext>::BuildResultConditionTemplate(
     ScAddr const & resultConditionTemplateAddr) noexcept
 {
   ScTemplate resultConditionTemplate;
-  this->m_context.BuildTemplate(resultConditionTemplate, resultConditionTemplateAddr);
+  this->m_context.BuildCachedTemplate(resultConditionTemplate, resultConditionTemplateAddr);
   return resultConditionTemplate;
 }
 
@@ -487,3 +493,18 @@ bool ScAgent<TScEvent, TScContext>::GenerateCheckTemplateParams(
 
   return true;
 }
+
+template <class TScEvent, class TScContext>
+ScBatchAgent<TScEvent, TScContext>::ScBatchAgent() noexcept = default;
+
+template <class TScEvent, class TScContext>
+size_t ScBatchAgent<TScEvent, TScContext>::GetMaxBatchSize() const
+{
+  return 100;
+}
+
+template <class TScEvent, class TScContext>
+std::chrono::milliseconds ScBatchAgent<TScEvent, TScContext>::GetMaxBatchDelay() const
+{
+  return std::chrono::milliseconds(100);
+}
@@ -30,6 +30,12 @@ ScAddr ScAgentBuilder<TScAgent>::GetAgentImplementation() const noexcept
   return m_agentImplementationAddr;
 }
 
+template <class TScAgent>
+std::shared_ptr<ScAgentExecutor> ScAgentBuilder<TScAgent>::GetExecutor() const noexcept
+{
+  return m_executor;
+}
+
 template <class TScAgent>
 ScAgentBuilder<TScAgent> * ScAgentBuilder<TScAgent>::SetAbstractAgent(ScAddr const & abstractAgentAddr) noexcept
 {
@@ -604,6 +610,14 @@ void ScAgentBuilder<TScAgent>::ResolveInitiationConditionAndResultCondition(
   SC_LOG_DEBUG("Initiation condition and result for agent class `" << agentClassName << "` was found.");
 }
 
+template <class TScAgent>
+ScAgentBuilder<TScAgent> * ScAgentBuilder<TScAgent>::SetExecutor(
+    std::shared_ptr<ScAgentExecutor> const & executor) noexcept
+{
+  m_executor = executor;
+  return this;
+}
+
 template <class TScAgent>
 ScModule * ScAgentBuilder<TScAgent>::FinishBuild() noexcept
 {
@@ -23,6 +23,45 @@ std::shared_ptr<ScElementaryEventSubscription<TScEvent>> ScAgentContext::CreateE
       new ScElementaryEventSubscription<TScEvent>(*this, subscriptionElementAddr, eventCallback));
 }
 
+template <class TScEvent>
+std::shared_ptr<ScGlobalEventSubscription<TScEvent>> ScAgentContext::CreateGlobalEventSubscription(
+    ScAddr const & setAddr,
+    std::function<void(TScEvent const &)> const & eventCallback)
+{
+  if (!IsElement(setAddr))
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Not able to create global sc-event subscription because set is not valid.");
+
+  return std::shared_ptr<ScGlobalEventSubscription<TScEvent>>(
+      new ScGlobalEventSubscription<TScEvent>(*this, setAddr, eventCallback));
+}
+
+template <class TScEvent>
+std::shared_ptr<ScGlobalEventSubscription<TScEvent>> ScAgentContext::CreateGlobalEventSubscription(
+    std::function<void(TScEvent const &)> const & eventCallback)
+{
+  return std::shared_ptr<ScGlobalEventSubscription<TScEvent>>(
+      new ScGlobalEventSubscription<TScEvent>(*this, ScAddr::Empty, eventCallback));
+}
+
+template <class TScEvent>
+std::shared_ptr<ScEventSubscriptionBatch<TScEvent>> ScAgentContext::CreateEventSubscriptionBatch(
+    ScAddr const & subscriptionElementAddr,
+    size_t maxBatchSize,
+    std::chrono::milliseconds const & maxBatchDelay,
+    std::function<void(std::vector<TScEvent> const &)> const & eventsCallback)
+{
+  ValidateEventElements<TScEvent>(subscriptionElementAddr, "sc-event subscription batch");
+
+  if (maxBatchSize == 0)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Not able to create sc-event subscription batch because max batch size is 0.");
+
+  return std::shared_ptr<ScEventSubscriptionBatch<TScEvent>>(new ScEventSubscriptionBatch<TScEvent>(
+      *this, subscriptionElementAddr, maxBatchSize, maxBatchDelay, eventsCallback));
+}
+
 template <class TScEvent>
 std::shared_ptr<ScWaiter> ScAgentContext::CreateEventWaiter(
     ScAddr const & subscriptionElementAddr,
@@ -70,7 +109,7 @@ void ScAgentContext::SubscribeAgent(TScAddr const &... subscriptionAddrs)
         "Not able to provide subscription sc-elements for TScAgent, because it inherits ScActionInitiatedAgent class "
         "for which `action_initiated` is used by default.");
 
-  ScAgentManager<TScAgent>::Subscribe(this, ScAddr::Empty, subscriptionAddrs...);
+  ScAgentManager<TScAgent>::Subscribe(this, nullptr, ScAddr::Empty, subscriptionAddrs...);
 }
 
 template <class TScAgent, class... TScAddr>
@@ -110,7 +149,7 @@ void ScAgentContext::SubscribeSpecifiedAgent(ScAddr const & agentImplementationA
   ScAgentBuilder<TScAgent> builder{agentImplementationAddr};
   builder.ResolveSpecification(this);
 
-  ScAgentManager<TScAgent>::Subscribe(this, agentImplementationAddr);
+  ScAgentManager<TScAgent>::Subscribe(this, nullptr, agentImplementationAddr);
 }
 
 template <class TScAgent>
@@ -135,6 +174,26 @@ void ScAgentContext::UnsubscribeSpecifiedAgent(ScAddr const & agentImplementatio
   ScAgentManager<TScAgent>::Unsubscribe(this, agentImplementationAddr);
 }
 
+template <class TScAgent>
+ScMemoryContext::ScEventsLatencyStatistics ScAgentContext::GetAgentEventsLatencyStatistics() const
+{
+  CheckEventsLatencyStatisticsAccess();
+
+  sc_events_latency_stat stat{};
+  ScAgentManager<TScAgent>::CollectLatencyStatistics(stat);
+  return ConvertEventsLatencyStatistics(stat);
+}
+
+template <class TScAgent>
+std::vector<ScAgentExecutionStatistics> ScAgentContext::GetAgentExecutionStatistics() const
+{
+  CheckEventsLatencyStatisticsAccess();
+
+  std::vector<ScAgentExecutionStatistics> statistics;
+  ScAgentManager<TScAgent>::CollectExecutionStatistics(statistics);
+  return statistics;
+}
+
 template <class TScEvent>
 void ScAgentContext::ValidateEventElements(ScAddr const & subscriptionElementAddr, std::string const & validatorName)
 {
@@ -8,16 +8,23 @@
 
 #include "sc-memory/sc_agent_manager.hpp"
 
+#include <chrono>
+
 #include "sc-memory/sc_action.hpp"
 #include "sc-memory/sc_structure.hpp"
 #include "sc-memory/sc_result.hpp"
 #include "sc-memory/sc_event_subscription.hpp"
+#include "sc-memory/sc_action_dispatcher.hpp"
 #include "sc-memory/sc_keynodes.hpp"
+#include "sc-memory/sc_agent_metrics.hpp"
+#include "sc-memory/sc_agent_executor.hpp"
+#include "sc-memory/sc_agent_results_cache.hpp"
 
 template <class TScAgent>
 template <class... TScAddr>
 void ScAgentManager<TScAgent>::Subscribe(
     ScMemoryContext * context,
+    std::shared_ptr<ScAgentExecutor> const & executor,
     ScAddr const & agentImplementationAddr,
     TScAddr const &... subscriptionAddrs) noexcept(false)
 {
@@ -84,13 +91,17 @@ void ScAgentManager<TScAgent>::Subscribe(
         postEraseEventCallback =
             GetPostEraseEventCallback(agentClassName, eventClassName, agentImplementationAddr, subscriptionElementAddr);
 
-      subscriptions->get().insert(
-          {subscriptionElementAddr,
-           new ScElementaryEventSubscription(
-               *context,
-               eventClassAddr,
-               subscriptionElementAddr,
-               ScAgentManager<TScAgent>::GetCallback(agentImplementationAddr, postEraseEventCallback))});
+      ScEventSubscription * subscription = GenerateSubscription(
+          context,
+          agent,
+          eventClassAddr,
+          subscriptionElementAddr,
+          agentImplementationAddr,
+          executor,
+          postEraseEventCallback);
+      subscriptions->get().insert({subscriptionElementAddr, subscription});
+      if (executor != nullptr && !postEraseEventCallback)
+        m_subscriptionsExecutors.insert({subscription, executor});
       ScAgentManager<TScAgent>::m_agentEventClasses.insert({agentClassName, {eventClassAddr, subscriptionElementAddr}});
     }
     else
@@ -99,12 +110,17 @@ void ScAgentManager<TScAgent>::Subscribe(
         postEraseEventCallback =
             GetPostEraseEventCallback(agentClassName, eventClassName, agentImplementationAddr, subscriptionElementAddr);
 
-      subscriptions->get().insert(
-          {subscriptionElementAddr,
-           new ScElementaryEventSubscription<TScEvent>(
-               *context,
-               subscriptionElementAddr,
-               ScAgentManager<TScAgent>::GetCallback(agentImplementationAddr, postEraseEventCallback))});
+      ScEventSubscription * subscription = GenerateSubscription(
+          context,
+          agent,
+          TScEvent::eventClassAddr,
+          subscriptionElementAddr,
+          agentImplementationAddr,
+          executor,
+          postEraseEventCallback);
+      subscriptions->get().insert({subscriptionElementAddr, subscription});
+      if (executor != nullptr && !postEraseEventCallback)
+        m_subscriptionsExecutors.insert({subscription, executor});
       ScAgentManager<TScAgent>::m_agentEventClasses.insert(
           {agentClassName, {TScEvent::eventClassAddr, subscriptionElementAddr}});
     }
@@ -159,6 +175,7 @@ void ScAgentManager<TScAgent>::Unsubscribe(
     subscriptionVector.emplace_back(agent.GetEventSubscriptionElement());
 
   std::string const & eventClassName = GetEventClassName(context, agent);
+  std::vector<std::shared_ptr<ScAgentExecutor>> executors;
   for (ScAddr const & subscriptionElementAddr : subscriptionVector)
   {
     std::string const & subscriptionElementName = GetSubscriptionElementName(context, subscriptionElementAddr);
@@ -181,12 +198,23 @@ void ScAgentManager<TScAgent>::Unsubscribe(
         "Unsubscribe " << agentImplementationInfo << " from event `" << eventClassName
                        << "` with subscription sc-element `" << subscriptionElementName << "`.");
 
+    auto const & executorIt = m_subscriptionsExecutors.find(subscription);
+    if (executorIt != m_subscriptionsExecutors.cend())
+    {
+      executors.push_back(executorIt->second);
+      m_subscriptionsExecutors.erase(executorIt);
+    }
+
     delete subscription;
     EraseSubscription(subscriptionElementAddr, *subscriptions);
   }
 
   ClearEmptyAgentImplementationSubscriptions(
       agentClassName, agentImplementationAddr, agentImplementationsToSubscriptions, subscriptions);
+
+  // calls queued by executors before subscriptions were erased must be finished before module is shut down
+  for (auto const & executor : executors)
+    executor->Wait();
 }
 
 template <class TScAgent>
@@ -275,6 +303,31 @@ bool ScAgentManager<TScAgent>::WasAgentSubscribedToEventOfErasedElementErasing(
          && !context->IsElement(eventClassIt->second.second);
 }
 
+template <class TScAgent>
+void ScAgentManager<TScAgent>::CollectLatencyStatistics(sc_events_latency_stat & stat) noexcept
+{
+  for (auto const & [agentClassName, agentImplementationsToSubscriptions] :
+       ScAgentManager<TScAgent>::m_agentClassesToAgentImplementationSubscriptions)
+  {
+    for (auto const & [agentImplementationAddr, subscriptions] : agentImplementationsToSubscriptions)
+    {
+      for (auto const & [subscriptionElementAddr, subscription] : subscriptions)
+        subscription->CollectLatencyStatistics(stat);
+    }
+  }
+}
+
+template <class TScAgent>
+void ScAgentManager<TScAgent>::CollectExecutionStatistics(std::vector<ScAgentExecutionStatistics> & statistics) noexcept
+{
+  for (auto const & [agentClassName, agentImplementationsToSubscriptions] :
+       ScAgentManager<TScAgent>::m_agentClassesToAgentImplementationSubscriptions)
+  {
+    for (auto const & [agentImplementationAddr, _] : agentImplementationsToSubscriptions)
+      ScAgentMetrics::CollectByAgentClass(agentClassName, agentImplementationAddr, statistics);
+  }
+}
+
 template <class TScAgent>
 typename ScAgentManager<TScAgent>::ScAgentImplementationsToSubscriptionsRef ScAgentManager<
     TScAgent>::ResolveAgentClassAgentImplementationSubscriptions(std::string const & agentClassName)
@@ -390,8 +443,177 @@ std::function<void(void)> ScAgentManager<TScAgent>::GetPostEraseEventCallback(
   };
 }
 
+template <class TScAgent>
+typename ScAgentManager<TScAgent>::ScAgentMetadataPtr ScAgentManager<TScAgent>::GenerateAgentMetadata(
+    ScMemoryContext * context,
+    TScAgent & agent) noexcept(false)
+{
+  auto const & agentMetadata = std::make_shared<ScAgentMetadata>();
+  agentMetadata->m_agentClassName = GetAgentClassName(context, agent);
+  agentMetadata->m_loggerPrefix = agent.GetName() + ": ";
+
+  try
+  {
+    agentMetadata->m_actionClassAddr = agent.GetActionClass();
+  }
+  catch (utils::ScException const &)
+  {
+    // Agent without action class gets it on each call, as if it has no metadata.
+  }
+
+  return agentMetadata;
+}
+
+template <class TScAgent>
+void ScAgentManager<TScAgent>::AcquireAgentContext(
+    ScAgentMetadata & agentMetadata,
+    TScAgent & agent,
+    ScAddr const & userAddr) noexcept
+{
+  if constexpr (std::is_same<ScAgentContext, TScContext>::value)
+  {
+    std::lock_guard<std::mutex> lock(agentMetadata.m_contextsMutex);
+    auto const & it = agentMetadata.m_userContexts.find(userAddr);
+    if (it != agentMetadata.m_userContexts.cend())
+    {
+      agent.m_context = std::move(it->second.back());
+      it->second.pop_back();
+      if (it->second.empty())
+        agentMetadata.m_userContexts.erase(it);
+      --agentMetadata.m_contextsCount;
+      return;
+    }
+  }
+
+  agent.SetInitiator(userAddr);
+}
+
+template <class TScAgent>
+void ScAgentManager<TScAgent>::ReleaseAgentContext(
+    ScAgentMetadata & agentMetadata,
+    TScAgent & agent,
+    ScAddr const & userAddr) noexcept
+{
+  if constexpr (std::is_same<ScAgentContext, TScContext>::value)
+  {
+    if (*agent.m_context == nullptr)
+      return;
+
+    // Pending and blocking modes are shared by all contexts of user, so contexts left in them aren't reused by other
+    // agents and aren't reset under other contexts of user.
+    if (agent.m_context.AreEventsPending() || agent.m_context.AreEventsBlocking())
+      return;
+
+    std::lock_guard<std::mutex> lock(agentMetadata.m_contextsMutex);
+    // Other contexts are destroyed with agents.
+    if (agentMetadata.m_contextsCount == kMaxFreeAgentContextsCount)
+      return;
+
+    agentMetadata.m_userContexts[userAddr].push_back(std::move(agent.m_context));
+    ++agentMetadata.m_contextsCount;
+  }
+}
+
+template <class TScAgent>
+bool ScAgentManager<TScAgent>::IsActionClassDeactivated(
+    ScAgentMetadata const & agentMetadata,
+    TScAgent & agent) noexcept
+{
+  if (!agentMetadata.m_actionClassAddr.IsValid())
+    return agent.IsActionClassDeactivated();
+
+  // Deactivation is checked in knowledge base on each call, so action class deactivated just before initiation of
+  // action is never performed.
+  return ScMemory::ms_globalContext->CheckConnector(
+      ScKeynodes::action_deactivated, agentMetadata.m_actionClassAddr, ScType::ConstPermPosArc);
+}
+
+template <class TScAgent>
+bool ScAgentManager<TScAgent>::IsAgentDeactivated(ScAgentMetadata const & agentMetadata, TScAgent & agent) noexcept
+{
+  if (!IsActionClassDeactivated(agentMetadata, agent))
+    return false;
+
+  agent.m_logger.Warning(
+      "Agent `",
+      agentMetadata.m_agentClassName,
+      "` was finished because actions with class `",
+      agent.GetActionClass().Hash(),
+      "` are deactivated.");
+  agentMetadata.m_metrics->RecordDeactivation();
+  return true;
+}
+
+template <class TScAgent>
+std::optional<ScResult> ScAgentManager<TScAgent>::PerformAction(
+    ScAgentMetadata const & agentMetadata,
+    TScAgent & agent,
+    ScAction & action,
+    std::function<ScResult()> const & program) noexcept
+{
+  std::string const & agentName = agentMetadata.m_agentClassName;
+  ScAgentMetrics & metrics = *agentMetadata.m_metrics;
+
+  auto const programBeginTime = std::chrono::steady_clock::now();
+  sc_uint64 const programBeginWaitingTime = ScAgentMetrics::GetThreadWaitingTime();
+  auto const & RecordProgram = [&](sc_result code, bool isSuspended) -> void
+  {
+    auto const programDuration = std::chrono::steady_clock::now() - programBeginTime;
+    metrics.RecordProgram(
+        code,
+        isSuspended,
+        std::chrono::duration_cast<std::chrono::microseconds>(programDuration).count(),
+        ScAgentMetrics::GetThreadWaitingTime() - programBeginWaitingTime);
+  };
+
+  ScResult result;
+  try
+  {
+    agent.m_logger.Info("Agent `", agentName, "` started performing action.");
+    result = program();
+  }
+  catch (utils::ScException const & exception)
+  {
+    RecordProgram(SC_RESULT_ERROR, false);
+    try
+    {
+      action.FinishWithError();
+      SC_LOG_ERROR(
+          "Agent `" << agentName << "` was finished because error was occurred.\nError description:\n"
+                    << exception.Description());
+    }
+    catch (utils::ScException const & finishingActionException)
+    {
+      SC_LOG_ERROR(
+          "It was tried to finish agent `"
+          << agentName << "` because error was occurred.\nError description:\n"
+          << exception.Description() << "\nBut agent `" << agentName
+          << "` can not be finished because error was occurred during its finishing.\nError description:\n"
+          << finishingActionException.Description());
+    }
+    return std::nullopt;
+  }
+
+  RecordProgram(result.m_code, result.m_isSuspended);
+  if (result.m_isSuspended)
+  {
+    agent.m_logger.Info("Agent `", agentName, "` suspended performing action.");
+    return std::nullopt;
+  }
+
+  if (result == SC_RESULT_OK)
+    agent.m_logger.Info("Agent `", agentName, "` finished performing action successfully.");
+  else if (result == SC_RESULT_NO)
+    agent.m_logger.Info("Agent `", agentName, "` finished performing action unsuccessfully.");
+  else
+    agent.m_logger.Info("Agent `", agentName, "` finished performing action with error.");
+
+  return result;
+}
+
 template <class TScAgent>
 std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAgent>::GetCallback(
+    ScAgentMetadataPtr const & agentMetadata,
     ScAddr const & agentImplementationAddr,
     std::function<void(void)> const & postEraseEventCallback) noexcept
 {
@@ -414,9 +636,9 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
   static_assert(
       HasOneOverride<TScAgent>::DoProgramMethod::value, "TScAgent must have one override `DoProgram` method.");
 
-  return [agentImplementationAddr, postEraseEventCallback](TScEvent const & event) -> void
+  return [agentMetadata, agentImplementationAddr, postEraseEventCallback](TScEvent const & event) -> void
   {
-    auto const & ResolveAction = [](TScEvent const & event, ScAgent<TScEvent, TScContext> & agent) -> ScAction
+    auto const & ResolveAction = [&agentMetadata](TScEvent const & event, TScAgent & agent) -> ScAction
     {
       auto [subscriptionElementAddr, _, otherElementAddr] = event.GetTriple();
       if (subscriptionElementAddr == ScKeynodes::action_initiated)
@@ -425,33 +647,32 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
         return agent.m_context.ConvertToAction(actionAddr);
       }
 
-      return agent.m_context.GenerateAction(agent.GetActionClass()).Initiate();
+      ScAddr const & actionClassAddr = agentMetadata->m_actionClassAddr;
+      return agent.m_context.GenerateAction(actionClassAddr.IsValid() ? actionClassAddr : agent.GetActionClass())
+          .Initiate();
     };
 
-    auto const & PostCallback = [&postEraseEventCallback]() -> void
+    TScAgent agent;
+    ScAddr const & userAddr = event.GetUser();
+    agent.m_logger.SetPrefix(agentMetadata->m_loggerPrefix);
+    AcquireAgentContext(*agentMetadata, agent, userAddr);
+    agent.SetImplementation(agentImplementationAddr);
+
+    auto const & PostCallback = [&]() -> void
     {
+      ReleaseAgentContext(*agentMetadata, agent, userAddr);
       if (postEraseEventCallback)
         postEraseEventCallback();
     };
 
-    TScAgent agent;
-    agent.m_logger.SetPrefix(agent.GetName() + ": ");
-    agent.SetInitiator(event.GetUser());
-    agent.SetImplementation(agentImplementationAddr);
-
-    std::string const & agentName = GetAgentClassName(&agent.m_context, agent);
+    std::string const & agentName = agentMetadata->m_agentClassName;
     agent.m_logger.Info("Agent `", agentName, "` reacted to primary initiation condition.");
 
-    if (agent.IsActionClassDeactivated())
-    {
-      agent.m_logger.Warning(
-          "Agent `",
-          agentName,
-          "` was finished because actions with class `",
-          agent.GetActionClass().Hash(),
-          "` are deactivated.");
+    ScAgentMetrics & metrics = *agentMetadata->m_metrics;
+    metrics.RecordInvocation();
+
+    if (IsAgentDeactivated(*agentMetadata, agent))
       return PostCallback();
-    }
 
     agent.m_logger.Info("Agent `", agentName, "` started checking initiation condition.");
     bool isInitiationConditionCheckedSuccessfully = false;
@@ -470,49 +691,68 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
     {
       agent.m_logger.Warning(
           "Agent `", agentName, "` was finished because its initiation condition was checked unsuccessfully.");
+      metrics.RecordInitiationConditionRejection();
       return PostCallback();
     }
     agent.m_logger.Info("Agent `", agentName, "` finished checking initiation condition.");
 
     ScAction action = ResolveAction(event, agent);
-    ScResult result;
 
-    try
+    // arguments are watched until action is performed, so their changes during performing prevent memoizing result
+    std::optional<ScAgentResultsCache::ScTicket> resultTicket;
+    if (agentMetadata->m_resultsCache != nullptr)
     {
-      agent.m_logger.Info("Agent `", agentName, "` started performing action.");
-      if constexpr (HasOverride<TScAgent>::DoProgramWithEventArgument::value)
-        result = agent.DoProgram(event, action);
-      else
-        result = agent.DoProgram(action);
+      try
+      {
+        ScAgentResultsCache::ScKey const & resultKey = agentMetadata->m_resultsCache->GetKey(agent.m_context, action);
+        ScAddr const & memoizedResultAddr = agentMetadata->m_resultsCache->Get(resultKey);
+        if (memoizedResultAddr.IsValid())
+        {
+          action.SetResult(memoizedResultAddr);
+          action.FinishSuccessfully();
+          agent.m_logger.Info("Agent `", agentName, "` finished performing action with memoized result.");
+          metrics.RecordMemoizedResult();
+          return PostCallback();
+        }
+        resultTicket.emplace(agentMetadata->m_resultsCache->Watch(resultKey));
+      }
+      catch (utils::ScException const & exception)
+      {
+        resultTicket.reset();
+        agent.m_logger.Warning(
+            "Not able to use memoized result of action, because error was occurred. ", exception.Message());
+      }
     }
-    catch (utils::ScException const & exception)
+
+    std::optional<ScResult> const performingResult = PerformAction(
+        *agentMetadata,
+        agent,
+        action,
+        [&]() -> ScResult
+        {
+          if constexpr (HasOverride<TScAgent>::DoProgramWithEventArgument::value)
+            return agent.DoProgram(event, action);
+          else
+            return agent.DoProgram(action);
+        });
+    if (!performingResult)
+      return PostCallback();
+
+    ScResult result = *performingResult;
+
+    if (result == SC_RESULT_OK && resultTicket)
     {
       try
       {
-        action.FinishWithError();
-        SC_LOG_ERROR(
-            "Agent `" << agentName << "` was finished because error was occurred.\nError description:\n"
-                      << exception.Description());
+        agentMetadata->m_resultsCache->Put(*resultTicket, action.GetResult());
       }
-      catch (utils::ScException const & finishingActionException)
+      catch (utils::ScException const & exception)
       {
-        SC_LOG_ERROR(
-            "It was tried to finish agent `"
-            << agentName << "` because error was occurred.\nError description:\n"
-            << exception.Description() << "\nBut agent `" << agentName
-            << "` can not be finished because error was occurred during its finishing.\nError description:\n"
-            << finishingActionException.Description());
+        agent.m_logger.Warning(
+            "Not able to memoize result of action, because error was occurred. ", exception.Message());
       }
-      return PostCallback();
     }
 
-    if (result == SC_RESULT_OK)
-      agent.m_logger.Info("Agent `", agentName, "` finished performing action successfully.");
-    else if (result == SC_RESULT_NO)
-      agent.m_logger.Info("Agent `", agentName, "` finished performing action unsuccessfully.");
-    else
-      agent.m_logger.Info("Agent `", agentName, "` finished performing action with error.");
-
     agent.m_logger.Info("Agent `", agentName, "` started checking result condition.");
     bool isResultConditionCheckedSuccessfully = false;
     try
@@ -536,3 +776,210 @@ std::function<void(typename TScAgent::TEventType const &)> ScAgentManager<TScAge
     return PostCallback();
   };
 }
+
+template <class TScAgent>
+template <class TScEventArgument>
+std::function<void(TScEventArgument const &)> ScAgentManager<TScAgent>::GetExecutorCallback(
+    std::shared_ptr<ScAgentExecutor> const & executor,
+    std::function<void(TScEventArgument const &)> const & callback) noexcept
+{
+  if (executor == nullptr)
+    return callback;
+
+  return [executor, callback](TScEventArgument const & eventArgument) -> void
+  {
+    // sc-event is destroyed after subscription callback returns, so executor gets its copy
+    std::shared_ptr<TScEventArgument const> const eventArgumentCopy =
+        std::make_shared<TScEventArgument const>(eventArgument);
+    ScEvent const * event;
+    if constexpr (std::is_same<std::vector<TScEvent>, TScEventArgument>::value)
+      event = &eventArgumentCopy->front();
+    else
+      event = eventArgumentCopy.get();
+
+    executor->Execute(
+        *event,
+        [callback, eventArgumentCopy]() -> void
+        {
+          callback(*eventArgumentCopy);
+        });
+  };
+}
+
+template <class TScAgent>
+ScEventSubscription * ScAgentManager<TScAgent>::GenerateSubscription(
+    ScMemoryContext * context,
+    TScAgent & agent,
+    ScAddr const & eventClassAddr,
+    ScAddr const & subscriptionElementAddr,
+    ScAddr const & agentImplementationAddr,
+    std::shared_ptr<ScAgentExecutor> const & agentExecutor,
+    std::function<void(void)> const & postEraseEventCallback)
+{
+  ScAgentMetadataPtr const & agentMetadata = GenerateAgentMetadata(context, agent);
+  agentMetadata->m_metrics = ScAgentMetrics::Resolve(agentMetadata->m_agentClassName, agentImplementationAddr);
+  if constexpr (std::is_base_of<ScActionInitiatedAgent, TScAgent>::value)
+  {
+    size_t const maxMemoizedResultsCount = agent.GetMaxMemoizedResultsCount();
+    if (maxMemoizedResultsCount > 0 && agentMetadata->m_actionClassAddr.IsValid())
+      agentMetadata->m_resultsCache = std::make_unique<ScAgentResultsCache>(
+          agentMetadata->m_actionClassAddr, maxMemoizedResultsCount, agent.IsResultMemoizedByContentOfLinks());
+  }
+  // agent subscribed to sc-event of erasing sc-element must be called before sc-element is erased
+  std::shared_ptr<ScAgentExecutor> const executor = postEraseEventCallback ? nullptr : agentExecutor;
+
+  ScEventSubscription * subscription;
+  if constexpr (std::is_base_of<ScBatchAgent<TScEvent, TScContext>, TScAgent>::value)
+  {
+    if (subscriptionElementAddr == ScKeynodes::action_initiated
+        || eventClassAddr == ScKeynodes::sc_event_before_erase_element)
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Not able to subscribe batch agent `"
+              << GetAgentClassName(context, agent)
+              << "` to initiated actions or to sc-event of erasing sc-element, because these sc-events can't be "
+                 "batched.");
+
+    size_t const maxBatchSize = agent.GetMaxBatchSize();
+    if (maxBatchSize == 0)
+      SC_THROW_EXCEPTION(
+          utils::ExceptionInvalidParams,
+          "Not able to subscribe batch agent `" << GetAgentClassName(context, agent)
+                                                << "` because max batch size is 0.");
+
+    if constexpr (std::is_same<ScElementaryEvent, TScEvent>::value)
+      subscription = new ScEventSubscriptionBatch<TScEvent>(
+          *context,
+          eventClassAddr,
+          subscriptionElementAddr,
+          maxBatchSize,
+          agent.GetMaxBatchDelay(),
+          GetExecutorCallback(executor, GetBatchCallback(agentMetadata, agentImplementationAddr)));
+    else
+      subscription = new ScEventSubscriptionBatch<TScEvent>(
+          *context,
+          subscriptionElementAddr,
+          maxBatchSize,
+          agent.GetMaxBatchDelay(),
+          GetExecutorCallback(executor, GetBatchCallback(agentMetadata, agentImplementationAddr)));
+  }
+  else if constexpr (IsDispatchedByActionClass<TScAgent>::value)
+  {
+    if (subscriptionElementAddr == ScKeynodes::action_initiated)
+    {
+      // agent specified in knowledge base may have initiation condition with other action class, so it receives all
+      // initiated actions
+      ScAddr const & actionClassAddr = agent.MayBeSpecified() ? ScAddr::Empty : agentMetadata->m_actionClassAddr;
+      subscription = new ScActionDispatcherSubscription(
+          actionClassAddr,
+          GetExecutorCallback(executor, GetCallback(agentMetadata, agentImplementationAddr, postEraseEventCallback)));
+    }
+    else
+      subscription = new ScElementaryEventSubscription<TScEvent>(
+          *context,
+          subscriptionElementAddr,
+          GetExecutorCallback(executor, GetCallback(agentMetadata, agentImplementationAddr, postEraseEventCallback)));
+  }
+  else
+  {
+    if constexpr (std::is_same<ScElementaryEvent, TScEvent>::value)
+      subscription = new ScElementaryEventSubscription<TScEvent>(
+          *context,
+          eventClassAddr,
+          subscriptionElementAddr,
+          GetExecutorCallback(executor, GetCallback(agentMetadata, agentImplementationAddr, postEraseEventCallback)));
+    else
+      subscription = new ScElementaryEventSubscription<TScEvent>(
+          *context,
+          subscriptionElementAddr,
+          GetExecutorCallback(executor, GetCallback(agentMetadata, agentImplementationAddr, postEraseEventCallback)));
+  }
+
+  subscription->SetPriority(agent.GetEventPriority());
+  return subscription;
+}
+
+template <class TScAgent>
+std::function<void(std::vector<typename TScAgent::TEventType> const &)> ScAgentManager<TScAgent>::GetBatchCallback(
+    ScAgentMetadataPtr const & agentMetadata,
+    ScAddr const & agentImplementationAddr) noexcept
+{
+  static_assert(
+      std::is_base_of<ScBatchAgent<TScEvent, TScContext>, TScAgent>::value,
+      "TScAgent type must be derived from ScBatchAgent type.");
+
+  static_assert(
+      HasNoMoreThanOneOverride<TScAgent>::InitiationConditionMethod::value,
+      "TScAgent must have no more than one override method from methods: `GetInitiationCondition(void)`, "
+      "`GetInitiationCondition(event)` "
+      "and `CheckInitiationCondition`.");
+
+  return [agentMetadata, agentImplementationAddr](std::vector<TScEvent> const & events) -> void
+  {
+    TScAgent agent;
+    ScAddr const & userAddr = events.front().GetUser();
+    agent.m_logger.SetPrefix(agentMetadata->m_loggerPrefix);
+    AcquireAgentContext(*agentMetadata, agent, userAddr);
+    agent.SetImplementation(agentImplementationAddr);
+
+    auto const & PostCallback = [&]() -> void
+    {
+      ReleaseAgentContext(*agentMetadata, agent, userAddr);
+    };
+
+    std::string const & agentName = agentMetadata->m_agentClassName;
+    agent.m_logger.Info(
+        "Agent `", agentName, "` reacted to primary initiation condition ", events.size(), " times in batch.");
+
+    ScAgentMetrics & metrics = *agentMetadata->m_metrics;
+    metrics.RecordInvocation();
+
+    if (IsAgentDeactivated(*agentMetadata, agent))
+      return PostCallback();
+
+    agent.m_logger.Info("Agent `", agentName, "` started checking initiation condition.");
+    std::vector<TScEvent> initiatedEvents;
+    initiatedEvents.reserve(events.size());
+    for (TScEvent const & event : events)
+    {
+      try
+      {
+        if (agent.template ValidateInitiationCondition<TScAgent, HasOverride<TScAgent>>(event))
+          initiatedEvents.push_back(event);
+      }
+      catch (utils::ScException const & exception)
+      {
+        agent.m_logger.Error(
+            "Not able to check initiation condition template, because error was occurred. ", exception.Message());
+      }
+    }
+
+    if (initiatedEvents.empty())
+    {
+      agent.m_logger.Warning(
+          "Agent `", agentName, "` was finished because its initiation condition was checked unsuccessfully.");
+      metrics.RecordInitiationConditionRejection();
+      return PostCallback();
+    }
+    agent.m_logger.Info(
+        "Agent `",
+        agentName,
+        "` finished checking initiation condition, ",
+        initiatedEvents.size(),
+        " sc-events of batch satisfied it.");
+
+    ScAddr const & actionClassAddr = agentMetadata->m_actionClassAddr;
+    ScAction action =
+        agent.m_context.GenerateAction(actionClassAddr.IsValid() ? actionClassAddr : agent.GetActionClass()).Initiate();
+
+    PerformAction(
+        *agentMetadata,
+        agent,
+        action,
+        [&]() -> ScResult
+        {
+          return agent.DoProgram(initiatedEvents, action);
+        });
+    return PostCallback();
+  };
+}
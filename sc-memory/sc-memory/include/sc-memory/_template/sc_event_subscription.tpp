@@ -62,6 +62,37 @@ void ScElementaryEventSubscription<TScEvent>::RemoveDelegate() noexcept
   m_delegate = DelegateFunc();
 }
 
+template <class TScEvent>
+void ScElementaryEventSubscription<TScEvent>::SetPriority(ScEventPriority priority) noexcept
+{
+  utils::ScLockScope lock(m_lock);
+  if (m_event_subscription)
+    sc_event_subscription_set_priority(m_event_subscription, (sc_event_priority)priority);
+}
+
+template <class TScEvent>
+ScEventPriority ScElementaryEventSubscription<TScEvent>::GetPriority() const noexcept
+{
+  utils::ScLockScope lock(m_lock);
+  if (m_event_subscription == nullptr)
+    return ScEventPriority::Normal;
+
+  return (ScEventPriority)sc_event_subscription_get_priority(m_event_subscription);
+}
+
+template <class TScEvent>
+void ScElementaryEventSubscription<TScEvent>::CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept
+{
+  utils::ScLockScope lock(m_lock);
+  if (m_event_subscription == nullptr)
+    return;
+
+  sc_events_latency_stat subscriptionStat;
+  sc_event_subscription_get_latency_stat(m_event_subscription, &subscriptionStat);
+  sc_latency_histogram_merge(&stat.queue_latency, &subscriptionStat.queue_latency);
+  sc_latency_histogram_merge(&stat.execution_duration, &subscriptionStat.execution_duration);
+}
+
 template <class TScEvent>
 sc_result ScElementaryEventSubscription<TScEvent>::Handle(
     sc_event_subscription const * event_subscription,
@@ -113,3 +144,297 @@ sc_result ScElementaryEventSubscription<TScEvent>::HandleDelete(
 
   return SC_RESULT_OK;
 }
+
+template <class TScEvent>
+ScGlobalEventSubscription<TScEvent>::ScGlobalEventSubscription(
+    ScMemoryContext const & context,
+    ScAddr const & setAddr,
+    DelegateFunc const & func) noexcept
+{
+  m_delegate = func;
+  m_event_subscription = sc_event_global_subscription_new(
+      *context,
+      *TScEvent::eventClassAddr,
+      *TScEvent::elementType,
+      *setAddr,
+      (sc_pointer)this,
+      &ScGlobalEventSubscription::Handle,
+      nullptr);
+}
+
+template <class TScEvent>
+ScGlobalEventSubscription<TScEvent>::~ScGlobalEventSubscription() noexcept
+{
+  if (m_event_subscription)
+    sc_event_subscription_destroy(m_event_subscription);
+}
+
+template <class TScEvent>
+void ScGlobalEventSubscription<TScEvent>::RemoveDelegate() noexcept
+{
+  utils::ScLockScope lock(m_lock);
+  m_delegate = DelegateFunc();
+}
+
+template <class TScEvent>
+void ScGlobalEventSubscription<TScEvent>::SetPriority(ScEventPriority priority) noexcept
+{
+  utils::ScLockScope lock(m_lock);
+  if (m_event_subscription)
+    sc_event_subscription_set_priority(m_event_subscription, (sc_event_priority)priority);
+}
+
+template <class TScEvent>
+ScEventPriority ScGlobalEventSubscription<TScEvent>::GetPriority() const noexcept
+{
+  utils::ScLockScope lock(m_lock);
+  if (m_event_subscription == nullptr)
+    return ScEventPriority::Normal;
+
+  return (ScEventPriority)sc_event_subscription_get_priority(m_event_subscription);
+}
+
+template <class TScEvent>
+void ScGlobalEventSubscription<TScEvent>::CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept
+{
+  utils::ScLockScope lock(m_lock);
+  if (m_event_subscription == nullptr)
+    return;
+
+  sc_events_latency_stat subscriptionStat;
+  sc_event_subscription_get_latency_stat(m_event_subscription, &subscriptionStat);
+  sc_latency_histogram_merge(&stat.queue_latency, &subscriptionStat.queue_latency);
+  sc_latency_histogram_merge(&stat.execution_duration, &subscriptionStat.execution_duration);
+}
+
+template <class TScEvent>
+sc_result ScGlobalEventSubscription<TScEvent>::Handle(
+    sc_event_subscription const * event_subscription,
+    sc_addr userAddr,
+    sc_addr subscriptionElementAddr,
+    sc_addr connectorAddr,
+    sc_type connectorType,
+    sc_addr otherAddr) noexcept
+{
+  auto * eventSubscription = (ScGlobalEventSubscription *)sc_event_subscription_get_data(event_subscription);
+
+  DelegateFunc delegateFunc;
+  {
+    utils::ScLockScope lock(eventSubscription->m_lock);
+    delegateFunc = eventSubscription->m_delegate;
+  }
+  if (delegateFunc == nullptr)
+    return SC_RESULT_ERROR;
+
+  try
+  {
+    delegateFunc(TScEvent(userAddr, subscriptionElementAddr, connectorAddr, connectorType, otherAddr));
+  }
+  catch (utils::ScException & e)
+  {
+    SC_LOG_ERROR("ScGlobalEventSubscription: Uncaught exception in delegate function: " << e.Message());
+  }
+
+  return SC_RESULT_OK;
+}
+
+template <class TScEvent>
+ScEventSubscriptionBatch<TScEvent>::ScEventSubscriptionBatch(
+    ScMemoryContext const & context,
+    ScAddr const & subscriptionElementAddr,
+    size_t maxBatchSize,
+    std::chrono::milliseconds const & maxBatchDelay,
+    DelegateFunc const & func) noexcept
+  : m_maxBatchSize(maxBatchSize)
+  , m_maxBatchDelay(maxBatchDelay)
+  , m_delegate(func)
+  , m_batchNumber(0)
+  , m_deadlineId(0)
+  , m_scheduledDeadlinesCount(0)
+{
+  m_events.reserve(m_maxBatchSize);
+  m_subscription.reset(new ScElementaryEventSubscription<TScEvent>(
+      context,
+      subscriptionElementAddr,
+      [this](TScEvent const & event)
+      {
+        Push(event);
+      }));
+}
+
+template <class TScEvent>
+ScEventSubscriptionBatch<TScEvent>::ScEventSubscriptionBatch(
+    ScMemoryContext const & context,
+    ScAddr const & eventClassAddr,
+    ScAddr const & subscriptionElementAddr,
+    size_t maxBatchSize,
+    std::chrono::milliseconds const & maxBatchDelay,
+    DelegateFunc const & func) noexcept
+  : m_maxBatchSize(maxBatchSize)
+  , m_maxBatchDelay(maxBatchDelay)
+  , m_delegate(func)
+  , m_batchNumber(0)
+  , m_deadlineId(0)
+  , m_scheduledDeadlinesCount(0)
+{
+  m_events.reserve(m_maxBatchSize);
+  m_subscription.reset(new ScElementaryEventSubscription<TScEvent>(
+      context,
+      eventClassAddr,
+      subscriptionElementAddr,
+      [this](TScEvent const & event)
+      {
+        Push(event);
+      }));
+}
+
+template <class TScEvent>
+ScEventSubscriptionBatch<TScEvent>::~ScEventSubscriptionBatch() noexcept
+{
+  // no sc-events can be pushed after subscription is destroyed
+  m_subscription.reset();
+  Flush();
+
+  // callbacks of deadlines posted by shared timer use this subscription, so they are waited
+  std::unique_lock<std::mutex> lock(m_eventsMutex);
+  m_eventsCondition.wait(
+      lock,
+      [this]()
+      {
+        return m_scheduledDeadlinesCount == 0;
+      });
+}
+
+template <class TScEvent>
+void ScEventSubscriptionBatch<TScEvent>::RemoveDelegate() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_deliveryMutex);
+  m_delegate = DelegateFunc();
+}
+
+template <class TScEvent>
+void ScEventSubscriptionBatch<TScEvent>::SetPriority(ScEventPriority priority) noexcept
+{
+  m_subscription->SetPriority(priority);
+}
+
+template <class TScEvent>
+ScEventPriority ScEventSubscriptionBatch<TScEvent>::GetPriority() const noexcept
+{
+  return m_subscription->GetPriority();
+}
+
+template <class TScEvent>
+void ScEventSubscriptionBatch<TScEvent>::CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept
+{
+  m_subscription->CollectLatencyStatistics(stat);
+}
+
+template <class TScEvent>
+void ScEventSubscriptionBatch<TScEvent>::Flush() noexcept
+{
+  std::vector<TScEvent> events;
+  {
+    std::lock_guard<std::mutex> lock(m_eventsMutex);
+    events = TakeEvents();
+  }
+
+  if (!events.empty())
+    Deliver(events);
+}
+
+template <class TScEvent>
+void ScEventSubscriptionBatch<TScEvent>::Push(TScEvent const & event) noexcept
+{
+  std::vector<TScEvent> events;
+  {
+    std::lock_guard<std::mutex> lock(m_eventsMutex);
+    if (m_events.empty())
+    {
+      size_t const batchNumber = m_batchNumber;
+      try
+      {
+        m_deadlineId = ScEventSubscriptionBatchTimer::Schedule(
+            std::chrono::steady_clock::now() + m_maxBatchDelay,
+            [this, batchNumber]()
+            {
+              DeliverDelayed(batchNumber);
+            });
+        ++m_scheduledDeadlinesCount;
+      }
+      catch (std::exception const & e)
+      {
+        SC_LOG_ERROR("ScEventSubscriptionBatch: Not able to schedule delivery of batch: " << e.what());
+      }
+    }
+
+    m_events.push_back(event);
+    if (m_events.size() < m_maxBatchSize)
+      return;
+
+    events = TakeEvents();
+  }
+
+  Deliver(events);
+}
+
+template <class TScEvent>
+std::vector<TScEvent> ScEventSubscriptionBatch<TScEvent>::TakeEvents() noexcept
+{
+  if (m_deadlineId != 0 && ScEventSubscriptionBatchTimer::Cancel(m_deadlineId))
+    --m_scheduledDeadlinesCount;
+  m_deadlineId = 0;
+  ++m_batchNumber;
+
+  std::vector<TScEvent> events;
+  events.swap(m_events);
+  m_events.reserve(m_maxBatchSize);
+  return events;
+}
+
+template <class TScEvent>
+void ScEventSubscriptionBatch<TScEvent>::DeliverDelayed(size_t batchNumber) noexcept
+{
+  std::vector<TScEvent> events;
+  {
+    std::lock_guard<std::mutex> lock(m_eventsMutex);
+    // deadline is already taken by timer, so it isn't cancelled
+    if (batchNumber == m_batchNumber)
+    {
+      m_deadlineId = 0;
+      events = TakeEvents();
+    }
+  }
+
+  if (!events.empty())
+    Deliver(events);
+
+  std::lock_guard<std::mutex> lock(m_eventsMutex);
+  --m_scheduledDeadlinesCount;
+  m_eventsCondition.notify_all();
+}
+
+template <class TScEvent>
+void ScEventSubscriptionBatch<TScEvent>::Deliver(std::vector<TScEvent> const & events) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_deliveryMutex);
+  if (m_delegate == nullptr)
+    return;
+
+  try
+  {
+    m_delegate(events);
+  }
+  catch (utils::ScException const & e)
+  {
+    SC_LOG_ERROR("ScEventSubscriptionBatch: Uncaught exception in delegate function: " << e.Message());
+  }
+  catch (std::exception const & e)
+  {
+    SC_LOG_ERROR("ScEventSubscriptionBatch: Uncaught exception in delegate function: " << e.what());
+  }
+  catch (...)
+  {
+    SC_LOG_ERROR("ScEventSubscriptionBatch: Uncaught unknown exception in delegate function.");
+  }
+}
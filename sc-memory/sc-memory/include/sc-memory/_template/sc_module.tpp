@@ -7,6 +7,7 @@
 #include "sc-memory/sc_module.hpp"
 
 #include "sc-memory/sc_agent_builder.hpp"
+#include "sc-memory/sc_agent_executor.hpp"
 
 template <class TScAgent, class... TScAddr, typename>
 ScModule * ScModule::Agent(TScAddr const &... subscriptionAddrs) noexcept
@@ -37,21 +38,36 @@ ScModule * ScModule::Agent() noexcept
   return this;
 }
 
+template <class TScAgent>
+ScModule * ScModule::SetAgentExecutor(std::shared_ptr<ScAgentExecutor> const & executor) noexcept
+{
+  m_agentExecutors[TScAgent::template GetName<TScAgent>()] = executor;
+  return this;
+}
+
 template <class TScAgent>
 ScModule::ScAgentSubscribeCallback ScModule::GetAgentSubscribeCallback() noexcept
 {
-  return [](ScMemoryContext * context, ScAddr const & agentImplementationAddr, ScAddrVector const & addrs) -> void
+  return [this](
+             ScMemoryContext * context,
+             ScAddr const & agentImplementationAddr,
+             ScAddrVector const & addrs,
+             std::shared_ptr<ScAgentExecutor> const & executor) -> void
   {
+    // executor set by agent builder has priority over executors set by module
+    std::shared_ptr<ScAgentExecutor> const & agentExecutor =
+        executor ? executor : GetAgentExecutor(TScAgent::template GetName<TScAgent>());
+
     if (context->IsElement(agentImplementationAddr))
-      ScAgentManager<TScAgent>::Subscribe(context, agentImplementationAddr);
+      ScAgentManager<TScAgent>::Subscribe(context, agentExecutor, agentImplementationAddr);
     else if (!addrs.empty())
     {
       for (ScAddr const & addr : addrs)
-        ScAgentManager<TScAgent>::Subscribe(context, agentImplementationAddr, addr);
+        ScAgentManager<TScAgent>::Subscribe(context, agentExecutor, agentImplementationAddr, addr);
     }
     else
     {
-      ScAgentManager<TScAgent>::Subscribe(context, agentImplementationAddr);
+      ScAgentManager<TScAgent>::Subscribe(context, agentExecutor, agentImplementationAddr);
     }
   };
 }
@@ -14,24 +14,36 @@ namespace utils
 template <typename T, typename... ARGS>
 void ScLogger::Error(T const & t, ARGS const &... others)
 {
+  if (!IsEnabled(ScLogLevel::Level::Error))
+    return;
+
   Message(ScLogLevel::Level::Error, utils::impl::Message(t, others...), ScConsole::Color::Red);
 }
 
 template <typename T, typename... ARGS>
 void ScLogger::Warning(T const & t, ARGS const &... others)
 {
+  if (!IsEnabled(ScLogLevel::Level::Warning))
+    return;
+
   Message(ScLogLevel::Level::Warning, utils::impl::Message(t, others...), ScConsole::Color::Yellow);
 }
 
 template <typename T, typename... ARGS>
 void ScLogger::Info(T const & t, ARGS const &... others)
 {
+  if (!IsEnabled(ScLogLevel::Level::Info))
+    return;
+
   Message(ScLogLevel::Level::Info, utils::impl::Message(t, others...), ScConsole::Color::Grey);
 }
 
 template <typename T, typename... ARGS>
 void ScLogger::Debug(T const & t, ARGS const &... others)
 {
+  if (!IsEnabled(ScLogLevel::Level::Debug))
+    return;
+
   Message(ScLogLevel::Level::Debug, utils::impl::Message(t, others...), ScConsole::Color::LightBlue);
 }
 
@@ -6,14 +6,28 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <utility>
 
+#include "sc_action_completion_registry.hpp"
 #include "sc_addr.hpp"
 
 class ScStructure;
 class ScResult;
 class ScKeynode;
+class ScAction;
+class ScAgentContext;
+
+/*!
+ * @brief Continuation of suspended performing of action.
+ * @param context A context of user who performs action.
+ * @param action Suspended action.
+ * @param isTimedOut true if wait time was over before awaited actions were finished.
+ * @return Result of performing of action or result of the next suspending.
+ */
+using ScActionContinuation =
+    std::function<ScResult(ScAgentContext & context, ScAction & action, bool isTimedOut)>;
 
 /*!
  * @class ScAction
@@ -204,6 +218,50 @@ public:
    */
   _SC_EXTERN ScResult FinishWithError() noexcept(false);
 
+  /*!
+   * @brief Suspends performing of the action until all specified actions are finished and continues it by
+   * continuation. Agent returns result of this method from its program, so worker thread of sc-events isn't blocked
+   * while actions are performed.
+   * @param actionAddrs Sc-addresses of awaited actions. They should be initiated before this call.
+   * @param continuation Continuation of performing of the action. It is called with new context of the same user in
+   * thread that processes sc-event of finish of the last awaited action or in worker thread of sc-events if wait time
+   * is over. Continuation mustn't use agent object, because agent object is destroyed when agent program returns. If
+   * sc-memory is shut down before continuation is called, then the action is finished unsuccessfully.
+   * @param waitTime Wait time in milliseconds. By default, it equals to 5000 milliseconds.
+   * @return Result that marks performing of the action as suspended.
+   * @throws utils::ExceptionInvalidState if the action is not initiated or already finished.
+   * @throws utils::ExceptionInvalidParams if some of awaited actions is not valid.
+   */
+  _SC_EXTERN ScResult AwaitAll(
+      ScAddrVector const & actionAddrs,
+      ScActionContinuation const & continuation,
+      sc_uint32 waitTime = 5000u) noexcept(false);
+
+  /*!
+   * @brief Suspends performing of the action until any of the specified actions is finished and continues it by
+   * continuation. It works like `AwaitAll`.
+   * @param actionAddrs Sc-addresses of awaited actions. They should be initiated before this call.
+   * @param continuation Continuation of performing of the action.
+   * @param waitTime Wait time in milliseconds. By default, it equals to 5000 milliseconds.
+   * @return Result that marks performing of the action as suspended.
+   * @throws utils::ExceptionInvalidState if the action is not initiated or already finished.
+   * @throws utils::ExceptionInvalidParams if some of awaited actions is not valid.
+   */
+  _SC_EXTERN ScResult AwaitAny(
+      ScAddrVector const & actionAddrs,
+      ScActionContinuation const & continuation,
+      sc_uint32 waitTime = 5000u) noexcept(false);
+
+  /*!
+   * @brief Suspends performing of the action for the specified time and continues it by continuation in worker thread
+   * of sc-events. Continuation gets `isTimedOut` equal to true.
+   * @param waitTime Wait time in milliseconds.
+   * @param continuation Continuation of performing of the action.
+   * @return Result that marks performing of the action as suspended.
+   * @throws utils::ExceptionInvalidState if the action is not initiated or already finished.
+   */
+  _SC_EXTERN ScResult AwaitTime(sc_uint32 waitTime, ScActionContinuation const & continuation) noexcept(false);
+
 protected:
   class ScAgentContext * m_context;  ///< Context of the agent.
   ScAddr m_resultAddr;               ///< Result structure of the action.
@@ -231,6 +289,35 @@ protected:
    */
   void Finish(ScAddr const & actionStateAddr) noexcept(false);
 
+  /*!
+   * @brief Checks that the action can be suspended.
+   * @throws utils::ExceptionInvalidState if the action is not initiated or already finished.
+   */
+  void ValidateSuspending() const noexcept(false);
+
+  /*!
+   * @brief Continues suspended performing of action with new context of the user.
+   * @param actionAddr A sc-address of suspended action.
+   * @param userAddr A sc-address of user who performs action.
+   * @param continuation Continuation of performing of action.
+   * @param isTimedOut true if wait time was over.
+   */
+  static void Continue(
+      ScAddr const & actionAddr,
+      ScAddr const & userAddr,
+      ScActionContinuation const & continuation,
+      bool isTimedOut) noexcept;
+
+  /*!
+   * @brief Finishes suspended action unsuccessfully if it isn't finished yet.
+   * @param actionAddr A sc-address of suspended action.
+   * @param userAddr A sc-address of user who performs action.
+   */
+  static void Cancel(ScAddr const & actionAddr, ScAddr const & userAddr) noexcept;
+
+  //! Gets callback that continues or cancels the action when wait of the action is over.
+  ScActionCompletionRegistry::AsyncCallback GetResumption(ScActionContinuation const & continuation) const noexcept;
+
 private:
   /*!
    * @brief Checks if the given action class address is valid by verifying its type.
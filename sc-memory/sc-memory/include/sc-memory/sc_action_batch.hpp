@@ -0,0 +1,82 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "sc_addr.hpp"
+
+/*!
+ * @class ScActionBatch
+ * @brief Represents actions of one class generated and initiated together by
+ * `ScAgentContext::GenerateAndInitiateActions`.
+ *
+ * @code
+ * std::vector<ScAddrVector> argumentsList;
+ * for (ScAddr const & argumentAddr : argumentAddrs)
+ *   argumentsList.push_back({argumentAddr});
+ *
+ * ScActionBatch batch = context.GenerateAndInitiateActions(actionClassAddr, argumentsList);
+ * batch.WaitAll(10000);
+ * for (ScActionBatch::ActionResult const & result : batch.GetResults())
+ * {
+ *   if (result.m_state == ScActionBatch::ActionState::FinishedSuccessfully)
+ *     ...
+ * }
+ * @endcode
+ */
+class _SC_EXTERN ScActionBatch
+{
+  friend class ScAgentContext;
+
+public:
+  //! State of action of batch.
+  enum class ActionState : sc_uint8
+  {
+    NotFinished,
+    Finished,  ///< Action is finished without state of its finish.
+    FinishedSuccessfully,
+    FinishedUnsuccessfully,
+    FinishedWithError
+  };
+
+  //! Result of performing of action of batch.
+  struct ActionResult
+  {
+    ScAddr m_actionAddr;  ///< Action of batch.
+    ActionState m_state;  ///< State of action.
+    ScAddr m_resultAddr;  ///< Result structure of action, or empty sc-address if action doesn't have it.
+  };
+
+  /*!
+   * @brief Gets actions of the batch.
+   * @return Sc-addresses of actions in order of their arguments.
+   */
+  _SC_EXTERN ScAddrVector const & GetActions() const noexcept;
+
+  /*!
+   * @brief Waits until all actions of the batch are finished.
+   * @param waitTime Wait time in milliseconds. By default, it equals to 5000 milliseconds.
+   * @return true if all actions were finished before timeout, otherwise false.
+   * @throws utils::ExceptionInvalidParams if some action was erased.
+   */
+  _SC_EXTERN bool WaitAll(sc_uint32 waitTime = 5000u) const noexcept(false);
+
+  /*!
+   * @brief Gets states and results of actions of the batch. Actions which weren't finished have state
+   * `ActionState::NotFinished`.
+   * @return Results of actions in order of their arguments.
+   * @throws utils::ExceptionInvalidState if user of the batch isn't authorized or doesn't have read permissions.
+   */
+  _SC_EXTERN std::vector<ActionResult> GetResults() const noexcept(false);
+
+protected:
+  ScAddr m_userAddr;           ///< User who generated the batch. Results are read by new context of this user.
+  ScAddrVector m_actionAddrs;  ///< Actions of the batch.
+
+  _SC_EXTERN ScActionBatch(ScAddr const & userAddr, ScAddrVector && actionAddrs) noexcept;
+};
@@ -0,0 +1,204 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <future>
+#include <memory>
+
+#include "sc_addr.hpp"
+#include "sc_defines.hpp"
+
+/*!
+ * @class ScActionCompletionRegistry
+ * @brief Process-wide registry of waits for finish of actions.
+ *
+ * Registry is subscribed to `action_finished` once, when the first finish of action is waited, and passes finished
+ * actions to all waits of them. Waits don't generate sc-event subscriptions, so many actions can be waited together
+ * without changes of table of sc-event subscriptions. Futures of finish of actions also subscribe registry to erasure
+ * of their actions, so waits of erased actions are discarded and their sc-addresses can be reused. Subscription to
+ * erasure of action is destroyed when action is finished or erased, or when the last future of it is destroyed.
+ * Subscription to `action_finished` is destroyed when sc-memory is shut down.
+ * Asynchronous waits don't block calling thread and call callbacks when actions are finished or wait time is over.
+ *
+ * @code
+ * ScAddrVector actionAddrs;
+ * for (ScAddr const & argumentAddr : argumentAddrs)
+ *   actionAddrs.push_back(context.GenerateAction(actionClassAddr).SetArguments(argumentAddr).Initiate());
+ *
+ * if (!ScActionCompletionRegistry::WaitAll(actionAddrs, 10000))
+ *   SC_LOG_WARNING("Not all sub-actions were finished.");
+ * @endcode
+ */
+class _SC_EXTERN ScActionCompletionRegistry final
+{
+  friend class ScMemory;
+  friend class ScAction;
+
+public:
+  /*!
+   * @class ScFinishedFuture
+   * @brief Future resolved when action is finished.
+   *
+   * Copies of future share one wait for finish of action. The wait is unregistered when the last copy is destroyed.
+   */
+  class _SC_EXTERN ScFinishedFuture final
+  {
+    friend class ScActionCompletionRegistry;
+
+  public:
+    _SC_EXTERN ScFinishedFuture() noexcept = default;
+
+    //! Waits until action is finished and gets its sc-address.
+    _SC_EXTERN ScAddr const & get() const noexcept(false);
+
+    _SC_EXTERN void wait() const noexcept(false);
+
+    template <class TRep, class TPeriod>
+    std::future_status wait_for(std::chrono::duration<TRep, TPeriod> const & waitTime) const noexcept(false)
+    {
+      return m_future.wait_for(waitTime);
+    }
+
+    template <class TClock, class TDuration>
+    std::future_status wait_until(std::chrono::time_point<TClock, TDuration> const & waitTime) const noexcept(false)
+    {
+      return m_future.wait_until(waitTime);
+    }
+
+    _SC_EXTERN bool valid() const noexcept;
+
+  private:
+    std::shared_future<ScAddr> m_future;
+    std::shared_ptr<void> m_registration;  ///< Unregisters wait when the last copy of future is destroyed.
+
+    ScFinishedFuture(std::shared_future<ScAddr> && future, std::shared_ptr<void> const & registration) noexcept;
+  };
+
+  /*!
+   * @brief Gets future resolved when the specified action is finished.
+   * @param actionAddr A sc-address of action.
+   * @return Future with sc-address of finished action. If sc-memory is shut down or action is erased before action is
+   * finished, then future holds exception `std::future_error` with `broken_promise` error code.
+   * @throws utils::ExceptionInvalidParams if action is not valid.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static _SC_EXTERN ScFinishedFuture GetFinishedFuture(ScAddr const & actionAddr) noexcept(false);
+
+  /*!
+   * @brief Waits until all specified actions are finished.
+   * @param actionAddrs Sc-addresses of actions.
+   * @param waitTime Wait time in milliseconds. By default, it equals to 5000 milliseconds.
+   * @return true if all actions were finished before timeout, otherwise false.
+   * @throws utils::ExceptionInvalidParams if some action is not valid.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static _SC_EXTERN bool WaitAll(ScAddrVector const & actionAddrs, sc_uint32 waitTime = 5000u) noexcept(false);
+
+  /*!
+   * @brief Waits until any of the specified actions is finished.
+   * @param actionAddrs Sc-addresses of actions.
+   * @param waitTime Wait time in milliseconds. By default, it equals to 5000 milliseconds.
+   * @return Sc-address of finished action, or empty sc-address if none of actions was finished before timeout.
+   * @throws utils::ExceptionInvalidParams if some action is not valid.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static _SC_EXTERN ScAddr WaitAny(ScAddrVector const & actionAddrs, sc_uint32 waitTime = 5000u) noexcept(false);
+
+  /*!
+   * @brief Calls callback when all specified actions are finished or wait time is over. It doesn't block calling
+   * thread.
+   * @param actionAddrs Sc-addresses of actions.
+   * @param callback Callback called once with true if all actions were finished before timeout, otherwise with false.
+   * It is called in thread that processes sc-event of finish of the last action, in worker thread of sc-events if wait
+   * time is over, or in calling thread if all actions had already been finished. If sc-memory is shut down before
+   * actions are finished, then it is called with false.
+   * @param waitTime Wait time in milliseconds. By default, it equals to 5000 milliseconds.
+   * @throws utils::ExceptionInvalidParams if some action is not valid.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static _SC_EXTERN void WaitAllAsync(
+      ScAddrVector const & actionAddrs,
+      std::function<void(bool isFinished)> const & callback,
+      sc_uint32 waitTime = 5000u) noexcept(false);
+
+  /*!
+   * @brief Calls callback when any of the specified actions is finished or wait time is over. It doesn't block
+   * calling thread.
+   * @param actionAddrs Sc-addresses of actions.
+   * @param callback Callback called once with sc-address of finished action, or with empty sc-address if none of
+   * actions was finished before timeout or sc-memory was shut down. It is called in the same threads as callback of
+   * `WaitAllAsync`.
+   * @param waitTime Wait time in milliseconds. By default, it equals to 5000 milliseconds.
+   * @throws utils::ExceptionInvalidParams if some action is not valid.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static _SC_EXTERN void WaitAnyAsync(
+      ScAddrVector const & actionAddrs,
+      std::function<void(ScAddr const & finishedActionAddr)> const & callback,
+      sc_uint32 waitTime = 5000u) noexcept(false);
+
+  /*!
+   * @brief Calls callback in worker thread of sc-events when wait time is over. It doesn't block calling thread.
+   * @param waitTime Wait time in milliseconds.
+   * @param callback Callback called once. It isn't called if sc-memory is shut down before wait time is over.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static _SC_EXTERN void WaitTimeAsync(sc_uint32 waitTime, std::function<void()> const & callback) noexcept(false);
+
+  //! Gets count of actions which finish is waited at the moment.
+  static _SC_EXTERN size_t GetWaitedActionsCount() noexcept;
+
+private:
+  class Registry;
+  struct Waiter;
+  struct AsyncWaiter;
+
+  using CompletionCallback = std::function<void(ScAddr const & actionAddr)>;
+
+  //! State of asynchronous wait when its callback is called.
+  enum class WaitState : sc_uint8
+  {
+    Finished,   ///< Required count of actions was finished.
+    TimedOut,   ///< Wait time was over.
+    Cancelled,  ///< Sc-memory was shut down.
+  };
+
+  //! Callback of asynchronous wait. It gets sc-address of the last finished action if wait is finished.
+  using AsyncCallback = std::function<void(WaitState state, ScAddr const & finishedActionAddr)>;
+
+  /*!
+   * @brief Calls callback when the required count of specified actions is finished, when wait time is over or when
+   * sc-memory is shut down. Timeouts are processed in worker threads of sc-events.
+   * @throws utils::ExceptionInvalidParams if some action is not valid.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static void WaitAsync(
+      ScAddrVector const & actionAddrs,
+      size_t requiredActionsCount,
+      AsyncCallback const & callback,
+      sc_uint32 waitTime) noexcept(false);
+
+  /*!
+   * @brief Calls callback with `WaitState::TimedOut` when wait time is over, or with `WaitState::Cancelled` when
+   * sc-memory is shut down.
+   * @throws utils::ExceptionInvalidState if sc-memory isn't initialized.
+   */
+  static void ScheduleAsync(sc_uint32 waitTime, AsyncCallback const & callback) noexcept(false);
+
+  //! Generates registry. It is called by `ScMemory::Initialize`.
+  static void Initialize() noexcept;
+
+  //! Destroys registry and its subscription. It is called by `ScMemory::Shutdown`.
+  static void Shutdown() noexcept;
+
+  static Registry & GetRegistry() noexcept(false);
+
+  //! Registry is shared with futures, so they don't unregister their waits from destroyed registry.
+  static std::shared_ptr<Registry> ms_registry;
+};
@@ -0,0 +1,67 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+#include "sc_event_subscription.hpp"
+
+/*!
+ * @class ScActionDispatcherSubscription
+ * @brief Subscription of agent to initiated actions of the specified class.
+ *
+ * Agents performing actions aren't subscribed to `action_initiated` separately. All such subscriptions are registered
+ * in process-wide index of action classes. One shared subscription to `action_initiated` for each priority reads
+ * classes of initiated action once and calls delegates of subscriptions registered for these classes only. Delegates
+ * of subscriptions registered with empty action class are called for all initiated actions.
+ *
+ * Delegates of one initiated action are called concurrently: all of them except the last one are posted to worker
+ * threads of sc-events, the last one is called in the thread of shared subscription. Destructor of subscription waits
+ * for its delegate to be finished, posted calls of delegate of destroyed subscription are skipped.
+ */
+class _SC_EXTERN ScActionDispatcherSubscription final : public ScEventSubscription
+{
+  template <class TScAgent>
+  friend class ScAgentManager;
+
+  SC_DISALLOW_COPY_AND_MOVE(ScActionDispatcherSubscription);
+
+public:
+  using DelegateFunc = std::function<void(ScActionInitiatedEvent const & event)>;
+
+  _SC_EXTERN ~ScActionDispatcherSubscription() noexcept override;
+
+  _SC_EXTERN void RemoveDelegate() noexcept override;
+
+  //! Moves subscription to shared subscription with the specified priority.
+  _SC_EXTERN void SetPriority(ScEventPriority priority) noexcept override;
+
+  _SC_EXTERN ScEventPriority GetPriority() const noexcept override;
+
+  //! Adds histograms of latencies of shared subscription, which delegate of this subscription is called by, to \p stat.
+  _SC_EXTERN void CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept override;
+
+  /*!
+   * @brief Gets count of subscriptions registered for the specified action class.
+   * @param actionClassAddr A sc-address of action class. If it is empty, then subscriptions called for all initiated
+   * actions are counted.
+   * @return Count of subscriptions of all priorities.
+   */
+  static _SC_EXTERN size_t GetSubscriptionsCount(ScAddr const & actionClassAddr) noexcept;
+
+protected:
+  explicit _SC_EXTERN ScActionDispatcherSubscription(
+      ScAddr const & actionClassAddr,
+      DelegateFunc const & func) noexcept;
+
+private:
+  struct Entry;
+  class Dispatcher;
+
+  std::shared_ptr<Entry> m_entry;
+};
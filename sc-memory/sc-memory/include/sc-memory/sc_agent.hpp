@@ -236,6 +236,14 @@ public:
    */
   _SC_EXTERN virtual ScTemplate GetResultConditionTemplate(TScEvent const & event, ScAction & action) const;
 
+  /*!
+   * @brief Gets priority of sc-events to which the agent reacts.
+   * @return Priority of sc-events. By default, it is `ScEventPriority::Normal`.
+   * @note Sc-events with high priority are processed before queued sc-events with normal priority, so latency-critical
+   * agents don't wait for bulk ones.
+   */
+  _SC_EXTERN virtual ScEventPriority GetEventPriority() const;
+
 protected:
   mutable TScContext m_context;
   mutable utils::ScLogger m_logger;
@@ -348,6 +356,71 @@ protected:
 
 using ScElementaryEventAgent = ScAgent<ScElementaryEvent>;
 
+/*!
+ * @class ScBatchAgent
+ * @brief An abstract base class for agents that handle sc-events in batches.
+ *
+ * Sc-events to which the agent is subscribed are collected into batches (see `ScEventSubscriptionBatch`). Each batch
+ * is handled by one agent object: sc-events that don't satisfy initiation condition are filtered out, then one action
+ * of class `GetActionClass` is generated and initiated, and `DoProgram` is called for this action and remaining
+ * sc-events. Result condition isn't checked for batches.
+ *
+ * @warning Batch agent can't be subscribed to `action_initiated` and to sc-event of erasing sc-element, because each of
+ * these sc-events must be handled separately.
+ *
+ * @code
+ * class MyBatchAgent : public ScBatchAgent<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>
+ * {
+ * public:
+ *   ScAddr GetActionClass() const override;
+ *
+ *   size_t GetMaxBatchSize() const override;
+ *
+ *   ScResult DoProgram(
+ *       std::vector<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>> const & events,
+ *       ScAction & action) override;
+ * };
+ * @endcode
+ *
+ * @tparam TScEvent The type of sc-event this agent handles.
+ * @tparam TScContext The type of sc-memory context that used by agent.
+ */
+template <class TScEvent, class TScContext = ScAgentContext>
+class _SC_EXTERN ScBatchAgent : public ScAgent<TScEvent, TScContext>
+{
+  static_assert(
+      std::is_base_of<ScElementaryEvent, TScEvent>::value,
+      "TScEvent type must be derived from ScElementaryEvent type.");
+
+public:
+  using ScAgent<TScEvent, TScContext>::DoProgram;
+
+  /*!
+   * @brief Gets max count of sc-events in batch.
+   * @return A max count of sc-events in batch. By default, it is 100.
+   */
+  _SC_EXTERN virtual size_t GetMaxBatchSize() const;
+
+  /*!
+   * @brief Gets max time that sc-event can wait in batch before it is delivered to the agent.
+   * @return A max batch delay. By default, it is 100 milliseconds.
+   */
+  _SC_EXTERN virtual std::chrono::milliseconds GetMaxBatchDelay() const;
+
+  /*!
+   * @brief Executes the program associated with the agent for batch of sc-events.
+   * @param events Sc-events that triggered the agent and satisfied its initiation condition.
+   * @param action A sc-action to be performed by the agent.
+   * @return A result of the program execution.
+   * @warning Derived classes must override this method and finish the action, because result condition isn't checked
+   * for batches.
+   */
+  _SC_EXTERN virtual ScResult DoProgram(std::vector<TScEvent> const & events, ScAction & action) = 0;
+
+protected:
+  _SC_EXTERN ScBatchAgent() noexcept;
+};
+
 /*!
  * @class ScActionInitiatedAgent
  * @brief A specialized agent class for handling sc-actions.
@@ -408,6 +481,24 @@ public:
    */
   _SC_EXTERN ScTemplate GetInitiationConditionTemplate(ScActionInitiatedEvent const & event) const override;
 
+  /*!
+   * @brief Gets max number of memoized results of actions of this agent class.
+   *
+   * Override this method for agent class that performs actions as pure function of their arguments. Then result
+   * structure of action finished successfully is memoized, and actions with the same arguments are finished
+   * successfully with this result structure without calling `DoProgram`, until one of arguments is changed.
+   *
+   * @return A max number of memoized results. By default, it is 0 and results are not memoized.
+   */
+  _SC_EXTERN virtual size_t GetMaxMemoizedResultsCount() const;
+
+  /*!
+   * @brief Checks whether results of actions of this agent class are memoized by content of link arguments.
+   * @return true if actions with different links with the same content have the same memoized result. By default, it
+   * is false, and results are memoized by sc-addresses of arguments.
+   */
+  _SC_EXTERN virtual bool IsResultMemoizedByContentOfLinks() const;
+
 protected:
   ScActionInitiatedAgent() noexcept;
 };
@@ -7,6 +7,7 @@
 #pragma once
 
 #include <functional>
+#include <memory>
 
 #include "sc_object.hpp"
 
@@ -15,6 +16,7 @@
 class ScModule;
 class ScMemoryContext;
 class ScAgentContext;
+class ScAgentExecutor;
 
 /*!
  * @class ScAgentBuilderAbstract
@@ -31,6 +33,12 @@ public:
    */
   virtual ScAddr GetAgentImplementation() const = 0;
 
+  /*!
+   * @brief Gets executor of calls of agents of specified agent class.
+   * @return An executor set by builder or null if it isn't set.
+   */
+  virtual std::shared_ptr<ScAgentExecutor> GetExecutor() const = 0;
+
   /*!
    * @brief Initializes the agent builder with the given memory context.
    * @param context A sc-memory context for initialization.
@@ -109,6 +117,14 @@ public:
   _SC_EXTERN ScAgentBuilder * SetInitiationConditionAndResult(
       std::tuple<ScAddr, ScAddr> const & initiationConditionAndResult) noexcept;
 
+  /*!
+   * @brief Sets executor of calls of agents of specified agent class `TScAgent`. It has priority over executors set by
+   * module.
+   * @param executor An executor of calls of agents. It may be shared with other agent classes.
+   * @return The current instance of ScAgentBuilder.
+   */
+  _SC_EXTERN ScAgentBuilder * SetExecutor(std::shared_ptr<ScAgentExecutor> const & executor) noexcept;
+
   /*!
    * @brief Finalizes build process of specification for specified agent class `TScAgent` and returns the associated
    * module.
@@ -143,12 +159,20 @@ protected:
 
   ScInitializeCallback m_resolveSpecification;
 
+  std::shared_ptr<ScAgentExecutor> m_executor;
+
   /*!
    * @brief Gets agent implementation for specified agent class `TScAgent`.
    * @return A sc-address of agent implementation.
    */
   _SC_EXTERN ScAddr GetAgentImplementation() const noexcept override;
 
+  /*!
+   * @brief Gets executor of calls of agents of specified agent class `TScAgent`.
+   * @return An executor set by `SetExecutor` or null if it isn't set.
+   */
+  _SC_EXTERN std::shared_ptr<ScAgentExecutor> GetExecutor() const noexcept override;
+
   /*!
    * @brief Resolves specification for specified agent class `TScAgent`.
    *
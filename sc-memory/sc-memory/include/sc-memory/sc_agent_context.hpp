@@ -6,9 +6,13 @@
 
 #pragma once
 
+#include <chrono>
+
 #include "sc_memory.hpp"
+#include "sc_agent_metrics.hpp"
 
 class ScAction;
+class ScActionBatch;
 class ScSet;
 class ScOrientedSet;
 class ScStructure;
@@ -17,7 +21,12 @@ class ScElementaryEvent;
 class ScEventSubscription;
 template <class TScEvent>
 class ScElementaryEventSubscription;
+template <class TScEvent>
+class ScEventSubscriptionBatch;
+template <class TScEvent>
+class ScGlobalEventSubscription;
 class ScWaiter;
+class ScTemplateSubscription;
 class ScActionInitiatedAgent;
 
 /*!
@@ -33,6 +42,7 @@ class ScAgentContext : public ScMemoryContext
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   friend class ScAction;
+  friend class ScActionBatch;
   friend class ScServerMessageAction;
 
   SC_DISALLOW_COPY(ScAgentContext);
@@ -98,6 +108,97 @@ public:
       ScAddr const & subscriptionElementAddr,
       std::function<void(TScEvent const &)> const & eventCallback) noexcept(false);
 
+  /*!
+   * @brief Generates sc-event subscription to sc-events of the specified type from all sc-elements of set.
+   *
+   * @code
+   * // Handle sc-arcs generated from any instance of class.
+   * using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+   * auto subscription = context.CreateGlobalEventSubscription<ScEventGenerateArc>(
+   *   classAddr,
+   *   [](ScEventGenerateArc const & event)
+   *   {
+   *     ScAddr const & instanceAddr = event.GetSubscriptionElement();
+   *   });
+   * @endcode
+   *
+   * Unlike subscriptions to each sc-element of set, global subscription is found by sc-event class during emission, so
+   * its cost doesn't depend on count of sc-elements of set. Sc-element, for which sc-event is emitted, should belong to
+   * set via constant permanent positive sc-arc when sc-event is handled.
+   *
+   * @tparam TScEvent A type of sc-event. It must be derived from ScElementaryEvent and define sc-event class.
+   * @param setAddr An address of set which sc-elements of sc-events should belong to.
+   * @param eventCallback A callback function that will be called when sc-event occurs.
+   * @return A shared pointer to generated `ScGlobalEventSubscription`.
+   * @throws utils::ExceptionInvalidParams If set is not valid.
+   */
+  template <class TScEvent>
+  _SC_EXTERN std::shared_ptr<ScGlobalEventSubscription<TScEvent>> CreateGlobalEventSubscription(
+      ScAddr const & setAddr,
+      std::function<void(TScEvent const &)> const & eventCallback) noexcept(false);
+
+  /*!
+   * @brief Generates sc-event subscription to sc-events of the specified type from all sc-elements.
+   * @tparam TScEvent A type of sc-event. It must be derived from ScElementaryEvent and define sc-event class.
+   * @param eventCallback A callback function that will be called when sc-event occurs.
+   * @return A shared pointer to generated `ScGlobalEventSubscription`.
+   */
+  template <class TScEvent>
+  _SC_EXTERN std::shared_ptr<ScGlobalEventSubscription<TScEvent>> CreateGlobalEventSubscription(
+      std::function<void(TScEvent const &)> const & eventCallback) noexcept(false);
+
+  /*!
+   * @brief Generates sc-event subscription that delivers sc-events of the specified class in batches.
+   *
+   * Sc-events are collected into batch and passed to callback when batch reaches `maxBatchSize` sc-events or when
+   * `maxBatchDelay` has passed since the first sc-event of batch was emitted.
+   *
+   * @param eventClassAddr An address of sc-event class to subscribe to.
+   *                       This must be a valid sc-element of type `sc_event`.
+   * @param subscriptionElementAddr An address of subscription sc-element, which must be a valid sc-element.
+   * @param maxBatchSize A max count of sc-events in batch. It must be greater than 0.
+   * @param maxBatchDelay A max time that sc-event can wait in batch before it is delivered.
+   * @param eventsCallback A callback function that will be called for each batch of sc-events.
+   * @return A shared pointer to generated `ScEventSubscriptionBatch`.
+   * @throws utils::ExceptionInvalidParams If the event class address or subscription element address is not valid,
+   *         if the event class does not belong to `sc_event` or if max batch size is 0.
+   */
+  _SC_EXTERN std::shared_ptr<ScEventSubscriptionBatch<ScElementaryEvent>> CreateEventSubscriptionBatch(
+      ScAddr const & eventClassAddr,
+      ScAddr const & subscriptionElementAddr,
+      size_t maxBatchSize,
+      std::chrono::milliseconds const & maxBatchDelay,
+      std::function<void(std::vector<ScElementaryEvent> const &)> const & eventsCallback) noexcept(false);
+
+  /*!
+   * @brief Generates sc-event subscription that delivers sc-events in batches.
+   *
+   * @code
+   * auto subscription = context.CreateEventSubscriptionBatch<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+   *   classAddr,
+   *   100,
+   *   std::chrono::milliseconds(50),
+   *   [](std::vector<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>> const & events)
+   *   {
+   *     // Handle up to 100 sc-events at once.
+   *   });
+   * @endcode
+   *
+   * @tparam TScEvent A type of sc-event. It must be derived from ScElementaryEvent.
+   * @param subscriptionElementAddr An address of subscription sc-element, which must be a valid sc-element.
+   * @param maxBatchSize A max count of sc-events in batch. It must be greater than 0.
+   * @param maxBatchDelay A max time that sc-event can wait in batch before it is delivered.
+   * @param eventsCallback A callback function that will be called for each batch of sc-events.
+   * @return A shared pointer to generated `ScEventSubscriptionBatch`.
+   * @throws utils::ExceptionInvalidParams If subscription sc-element is not valid or if max batch size is 0.
+   */
+  template <class TScEvent>
+  _SC_EXTERN std::shared_ptr<ScEventSubscriptionBatch<TScEvent>> CreateEventSubscriptionBatch(
+      ScAddr const & subscriptionElementAddr,
+      size_t maxBatchSize,
+      std::chrono::milliseconds const & maxBatchDelay,
+      std::function<void(std::vector<TScEvent> const &)> const & eventsCallback) noexcept(false);
+
   /*!
    * @brief Generates sc-event wait for specified event class and subscription sc-element.
    *
@@ -211,6 +312,41 @@ public:
       ScAddr const & subscriptionElementAddr,
       std::function<bool(TScEvent const &)> const & checkCallback) noexcept(false);
 
+  /*!
+   * @brief Generates continuous query by sc-template.
+   *
+   * Sc-constructions found by sc-template are maintained from sc-events of generating and erasing sc-connectors.
+   * Only newly formed and broken sc-constructions are passed to delegates, sc-constructions existing at the moment of
+   * subscription aren't passed to `onAddedCallback`.
+   *
+   * @code
+   * ScTemplate templ;
+   * templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_instance");
+   * auto subscription = context.CreateTemplateSubscription(
+   *   templ,
+   *   [](ScTemplateResultItem const & item)
+   *   {
+   *     // Handle new instance of class.
+   *     ScAddr const & instanceAddr = item["_instance"];
+   *   },
+   *   [](ScTemplateResultItem const & item)
+   *   {
+   *     // Handle instance removed from class.
+   *   });
+   * @endcode
+   *
+   * @param templ A sc-template to subscribe to. It must have fixed sc-element as source or target of some triple.
+   * @param onAddedCallback A callback function that will be called for each newly formed sc-construction.
+   * @param onRemovedCallback A callback function that will be called for each broken sc-construction.
+   * @return A shared pointer to generated `ScTemplateSubscription`.
+   * @throws utils::ExceptionInvalidParams If sc-template is empty or has no fixed sc-elements in sources or targets of
+   * its triples.
+   */
+  _SC_EXTERN std::shared_ptr<ScTemplateSubscription> CreateTemplateSubscription(
+      ScTemplate const & templ,
+      std::function<void(ScTemplateResultItem const &)> const & onAddedCallback,
+      std::function<void(ScTemplateResultItem const &)> const & onRemovedCallback = {}) noexcept(false);
+
   /*!
    * @brief Subscribes agent class to specified sc-events.
    * @tparam TScAgent An agent class to be subscribed to the event.
@@ -265,6 +401,36 @@ public:
   template <class TScAgent>
   _SC_EXTERN void UnsubscribeSpecifiedAgent(ScAddr const & agentImplementationAddr) noexcept(false);
 
+  /*!
+   * @brief Gets latencies of sc-events processed by all subscriptions of agent class.
+   * @tparam TScAgent An agent class which latencies should be got.
+   * @return Percentiles of time from emission of sc-events to start of their processing and percentiles of time of
+   * their processing by agents of this class.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have read
+   * permissions.
+   */
+  template <class TScAgent>
+  _SC_EXTERN ScEventsLatencyStatistics GetAgentEventsLatencyStatistics() const noexcept(false);
+
+  /*!
+   * @brief Gets statistics of calls of agent class: numbers of calls, rejections by initiation condition and results
+   * of actions, durations of `DoProgram` and time of waits in it.
+   * @tparam TScAgent An agent class which statistics should be got.
+   * @return Statistics of agent class for each agent implementation with which it is subscribed.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have read
+   * permissions.
+   */
+  template <class TScAgent>
+  _SC_EXTERN std::vector<ScAgentExecutionStatistics> GetAgentExecutionStatistics() const noexcept(false);
+
+  /*!
+   * @brief Gets statistics of calls of all agent classes subscribed since sc-memory was initialized.
+   * @return Statistics of agent classes for each agent implementation with which they were subscribed.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have read
+   * permissions.
+   */
+  _SC_EXTERN std::vector<ScAgentExecutionStatistics> GetAgentsExecutionStatistics() const noexcept(false);
+
   /*!
    * @brief Generates an action with a given action class.
    * @param actionClassAddr An address of the action class.
@@ -279,6 +445,23 @@ public:
    */
   _SC_EXTERN ScAction ConvertToAction(ScAddr const & actionAddr) noexcept(false);
 
+  /*!
+   * @brief Generates and initiates actions of a given action class, one for each list of arguments.
+   *
+   * It is faster than generating and initiating each action by `GenerateAction`, `SetArguments` and `Initiate`: all
+   * arguments are checked before generation, and sc-events of generated actions, including sc-events of their
+   * initiation, are emitted together after all actions are generated. So agents get actions with all their arguments.
+   *
+   * @param actionClassAddr An address of the action class.
+   * @param argumentsList Lists of arguments of actions. Argument with index `i` in list is set with `rrel_{i + 1}`.
+   * @return Batch of generated actions in order of lists of arguments.
+   * @throws utils::ExceptionInvalidParams if action class or some argument is not valid. In this case no actions are
+   * generated.
+   */
+  _SC_EXTERN ScActionBatch GenerateAndInitiateActions(
+      ScAddr const & actionClassAddr,
+      std::vector<ScAddrVector> const & argumentsList) noexcept(false);
+
   /*!
    * @brief Generates a set.
    * @return ScSet object.
@@ -0,0 +1,117 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+#include "sc_addr.hpp"
+#include "sc_defines.hpp"
+
+class ScEvent;
+
+/*!
+ * @class ScAgentExecutor
+ * @brief Executor of calls of agents by sc-events.
+ *
+ * By default, agents are called in threads of events and agents, so burst of sc-events for one heavy agent class can
+ * occupy all of them. Executor set for agent class by `ScModule` or `ScAgentBuilder` decides where and when agents of
+ * this class are called:
+ * - `Limited` calls no more than specified number of agents at the same time. Other calls are queued and performed by
+ * threads of events and agents which finish previous calls, so they don't block these threads while waiting;
+ * - `Serial` is `Limited` executor that calls one agent at the same time;
+ * - `Dedicated` calls agents in its own threads, so other agents are never starved by agents of this executor;
+ * - `SerialByKey` calls agents for sc-events with the same key in order of sc-events, and for sc-events with different
+ * keys concurrently. By default, key is subscription sc-element of sc-event.
+ *
+ * One executor can be shared by several agent classes, for example, to limit concurrency of all agents of module.
+ *
+ * @code
+ * SC_MODULE_REGISTER(MyModule)
+ *   ->SetAgentsExecutor(ScAgentExecutor::Limited(4))
+ *   ->Agent<MyFastAgent>()
+ *   ->Agent<MyNlpAgent>()
+ *   ->SetAgentExecutor<MyNlpAgent>(ScAgentExecutor::Dedicated(2));
+ * @endcode
+ *
+ * @note Agents subscribed to sc-event of erasing sc-element are always called in threads of events and agents, because
+ * erased sc-element can't be accessed later. Agents subscribed by `ScAgentContext::SubscribeAgent` directly are called
+ * in threads of events and agents too, even if the same agent class is registered in module with executor.
+ */
+class _SC_EXTERN ScAgentExecutor
+{
+public:
+  using ScTask = std::function<void()>;
+  using ScKeyFunction = std::function<ScAddr(ScEvent const &)>;
+
+  /*!
+   * @brief Generates executor that performs no more than specified number of calls of agents at the same time.
+   * @param maxConcurrency A max number of calls of agents performed at the same time.
+   * @throws utils::ExceptionInvalidParams if max concurrency is 0.
+   */
+  static _SC_EXTERN std::shared_ptr<ScAgentExecutor> Limited(size_t maxConcurrency) noexcept(false);
+
+  //! Generates executor that performs calls of agents one by one in order of sc-events.
+  static _SC_EXTERN std::shared_ptr<ScAgentExecutor> Serial() noexcept;
+
+  /*!
+   * @brief Generates executor that performs calls of agents in its own threads.
+   * @param threadsCount A number of threads of executor.
+   * @throws utils::ExceptionInvalidParams if number of threads is 0.
+   */
+  static _SC_EXTERN std::shared_ptr<ScAgentExecutor> Dedicated(size_t threadsCount) noexcept(false);
+
+  /*!
+   * @brief Generates executor that performs calls of agents for sc-events with the same key one by one in order of
+   * sc-events.
+   * @param getKey A function that gets key of sc-event. By default, it gets subscription sc-element of sc-event.
+   */
+  static _SC_EXTERN std::shared_ptr<ScAgentExecutor> SerialByKey(ScKeyFunction const & getKey = {}) noexcept;
+
+  _SC_EXTERN virtual ~ScAgentExecutor() noexcept;
+
+  /*!
+   * @brief Performs or queues call of agent for sc-event.
+   * @param event A sc-event for which agent is called. It is used to get key of call.
+   * @param task A call of agent. It must not depend on lifetime of sc-event.
+   */
+  _SC_EXTERN void Execute(ScEvent const & event, ScTask && task) noexcept;
+
+  /*!
+   * @brief Waits until all queued and performed calls of agents are finished. If it is called by call of agent of this
+   * executor, then this call isn't waited.
+   */
+  _SC_EXTERN void Wait() noexcept;
+
+  //! Gets number of queued calls of agents that are not performed yet.
+  _SC_EXTERN size_t GetQueuedTasksCount() const noexcept;
+
+  //! Gets number of calls of agents performed at the moment.
+  _SC_EXTERN size_t GetRunningTasksCount() const noexcept;
+
+protected:
+  mutable std::mutex m_mutex;
+  std::condition_variable m_idleCondition;  ///< Notified when calls of agents are finished.
+  size_t m_queuedTasksCount = 0;
+  size_t m_runningTasksCount = 0;
+
+  _SC_EXTERN ScAgentExecutor() noexcept;
+
+  /*!
+   * @brief Performs or queues task with key.
+   * @note Implementations update counters of tasks under `m_mutex` and notify `m_idleCondition` when tasks finish.
+   */
+  virtual void Schedule(ScAddr const & key, ScTask && task) noexcept = 0;
+
+  //! Gets key of sc-event. Only executors by key need it.
+  virtual ScAddr GetKey(ScEvent const & event) const noexcept;
+
+  //! Runs task as task of this executor and catches its exceptions.
+  void RunTask(ScTask const & task) noexcept;
+};
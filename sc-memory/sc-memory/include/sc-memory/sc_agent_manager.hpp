@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <mutex>
 #include <optional>
 
 #include "sc_object.hpp"
@@ -14,10 +15,20 @@
 
 template <class TScEvent>
 class ScElementaryEventSubscription;
+template <class TScEvent>
+class ScEventSubscriptionBatch;
+class ScEventSubscription;
+class ScAgentContext;
+class ScAgentMetrics;
+class ScAgentExecutor;
+class ScAgentResultsCache;
+struct ScAgentExecutionStatistics;
 class ScAction;
 class ScResult;
 template <class TScEvent, class TScContext>
 class ScAgent;
+template <class TScEvent, class TScContext>
+class ScBatchAgent;
 
 /*!
  * @class ScAgentManager
@@ -208,6 +219,23 @@ class _SC_EXTERN ScAgentManager : public ScObject
     };
   };
 
+  /*!
+   * @brief Checks if initiated actions are passed to agents of type TScAgentType by classes of these actions.
+   *
+   * Agents performing actions are dispatched by action classes if they don't override methods working with initiation
+   * condition, because default initiation condition of such agents requires action to belong to their action class.
+   *
+   * @tparam TScAgentType The agent type to check.
+   */
+  template <class TScAgentType>
+  struct IsDispatchedByActionClass
+  {
+    static constexpr bool value = std::is_base_of<ScActionInitiatedAgent, TScAgentType>::value
+                                  && !HasOverride<TScAgentType>::CheckInitiationCondition::value
+                                  && !HasOverride<TScAgentType>::GetInitiationCondition::value
+                                  && !HasOverride<TScAgentType>::GetInitiationConditionTemplate::value;
+  };
+
   friend class ScModule;
   friend class ScActionInitiatedAgent;
   friend class ScAgentContext;
@@ -244,6 +272,8 @@ private:
    *
    * @tparam TScAgent An agent class to be subscribed to the event.
    * @param context A sc-memory context used to subscribe agent class to specified sc-event.
+   * @param executor An executor of calls of agents of this class. If it is null, then agents are called in threads of
+   * events and agents.
    * @param agentImplementationAddr A sc-address of agent implementation specified in knowledge base for this agent
    * class.
    * @param subscriptionAddrs A list of sc-addresses of sc-elements to subscribe to.
@@ -258,6 +288,7 @@ private:
   template <class... TScAddr>
   static _SC_EXTERN void Subscribe(
       ScMemoryContext * context,
+      std::shared_ptr<ScAgentExecutor> const & executor,
       ScAddr const & agentImplementationAddr,
       TScAddr const &... subscriptionAddrs) noexcept(false);
 
@@ -309,6 +340,20 @@ private:
       ScAddr const & agentImplementationAddr,
       TScAddr const &... subscriptionAddrs) noexcept(false);
 
+  /*!
+   * @brief Adds histograms of latencies of sc-events processed by all subscriptions of agent class to \p stat.
+   * @param stat Histograms of latencies to be updated.
+   * @warning Agent class shouldn't be subscribed or unsubscribed concurrently with this call.
+   */
+  static _SC_EXTERN void CollectLatencyStatistics(sc_events_latency_stat & stat) noexcept;
+
+  /*!
+   * @brief Adds statistics of calls of agent class with all its agent implementations to \p statistics.
+   * @param statistics Statistics to be updated.
+   * @warning Agent class shouldn't be subscribed or unsubscribed concurrently with this call.
+   */
+  static _SC_EXTERN void CollectExecutionStatistics(std::vector<ScAgentExecutionStatistics> & statistics) noexcept;
+
 protected:
   using ScSubscriptions = ScAddrToValueUnorderedMap<ScEventSubscription *>;
   using ScAgentImplementationsToSubscriptions = ScAddrToValueUnorderedMap<ScSubscriptions>;
@@ -317,6 +362,9 @@ protected:
   //! Map to store agent classes to their corresponding agent implementation subscriptions.
   static inline ScAgentClassesToAgentImplementationSubscriptions m_agentClassesToAgentImplementationSubscriptions;
   static inline std::unordered_map<std::string, std::pair<ScAddr, ScAddr>> m_agentEventClasses;
+  //! Executors of subscriptions of agent class. Calls queued by them are waited when subscriptions are erased.
+  static inline std::unordered_map<ScEventSubscription const *, std::shared_ptr<ScAgentExecutor>>
+      m_subscriptionsExecutors;
 
   template <typename T>
   using Ref = std::reference_wrapper<T>;
@@ -328,6 +376,33 @@ protected:
       OptionalRef<ScAgentManager<TScAgent>::ScAgentImplementationsToSubscriptions>;
   using ScSubscriptionsOptionalRef = OptionalRef<ScSubscriptions>;
 
+  /*!
+   * @brief Metadata of agent class resolved once when agent class is subscribed to sc-event.
+   *
+   * It is shared by all calls of callback of subscription, so agents don't search their names and action classes in
+   * knowledge base for each sc-event.
+   */
+  struct ScAgentMetadata
+  {
+    std::string m_agentClassName;  ///< Name of agent class used in messages of agent.
+    std::string m_loggerPrefix;    ///< Prefix of messages of agent logger.
+    ScAddr m_actionClassAddr;      ///< Action class of agent. It is empty if agent has no action class.
+
+    std::mutex m_contextsMutex;  ///< Mutex for synchronizing access to free contexts of agents.
+    ScAddrToValueUnorderedMap<std::vector<ScAgentContext>> m_userContexts;  ///< Free contexts of agents by users.
+    size_t m_contextsCount = 0;                                            ///< Number of free contexts of agents.
+
+    //! Counters of calls of agent class with agent implementation shared by all its subscriptions.
+    std::shared_ptr<ScAgentMetrics> m_metrics;
+    //! Memoized results of actions. It is null if agent class doesn't memoize results.
+    std::unique_ptr<ScAgentResultsCache> m_resultsCache;
+  };
+
+  using ScAgentMetadataPtr = std::shared_ptr<ScAgentMetadata>;
+
+  //! Maximum number of free contexts of agents kept by metadata of agent class.
+  static size_t constexpr kMaxFreeAgentContextsCount = 64;
+
   /*!
    * @brief Retrieves the class name of a specified agent.
    *
@@ -523,9 +598,59 @@ protected:
       ScAddr const & agentImplementationAddr,
       ScAddr const & subscriptionElementAddr);
 
+  /*!
+   * @brief Generates metadata of agent class.
+   *
+   * This method resolves name and action class of agent class.
+   *
+   * @param context A sc-memory context used to resolve metadata.
+   * @param agent An agent object used to get name and action class of agent class.
+   * @return A pointer to generated metadata.
+   */
+  static ScAgentMetadataPtr GenerateAgentMetadata(ScMemoryContext * context, TScAgent & agent) noexcept(false);
+
+  /*!
+   * @brief Sets sc-memory context of agent for the specified user.
+   *
+   * If agent context type is `ScAgentContext` and metadata has free context of this user, then it is moved to agent
+   * instead of generating new one.
+   *
+   * @param agentMetadata A metadata of agent class.
+   * @param agent An agent which context is set.
+   * @param userAddr A sc-address of user that initiated agent.
+   */
+  static void AcquireAgentContext(ScAgentMetadata & agentMetadata, TScAgent & agent, ScAddr const & userAddr) noexcept;
+
+  //! Returns sc-memory context of agent to free contexts of metadata if there are less than maximum of them.
+  static void ReleaseAgentContext(ScAgentMetadata & agentMetadata, TScAgent & agent, ScAddr const & userAddr) noexcept;
+
+  //! Checks that action class of agent kept by metadata belongs to `action_deactivated` in knowledge base.
+  static bool IsActionClassDeactivated(ScAgentMetadata const & agentMetadata, TScAgent & agent) noexcept;
+
+  //! Checks that action class of agent is deactivated, logs it and records it to metrics of agent class.
+  static bool IsAgentDeactivated(ScAgentMetadata const & agentMetadata, TScAgent & agent) noexcept;
+
+  /*!
+   * @brief Calls program of agent for action, logs and records its result.
+   *
+   * If program throws exception, then action is finished with error.
+   *
+   * @param agentMetadata A metadata of agent class.
+   * @param agent An agent which performs action.
+   * @param action An action performed by agent.
+   * @param program A function that calls `DoProgram` of agent.
+   * @return A result of program, or empty optional if program threw exception or suspended action.
+   */
+  static std::optional<ScResult> PerformAction(
+      ScAgentMetadata const & agentMetadata,
+      TScAgent & agent,
+      ScAction & action,
+      std::function<ScResult()> const & program) noexcept;
+
   /*!
    * @brief Gets the callback function for agent class.
    * @tparam TScAgent An agent class to be subscribed to the event.
+   * @param agentMetadata A metadata of agent class shared by all calls of callback.
    * @param agentImplementationAddr A sc-address of agent implementation specified in knowledge base for this agent.
    * @param postEraseEventCallback A callback function that remove subscription of agent to sc-event of erasing
    * sc-element from common map after agent flow of performing action. class.
@@ -533,8 +658,62 @@ protected:
    * @warning Specified agent class must be derived from class `ScAgent`.
    */
   static _SC_EXTERN std::function<void(TScEvent const &)> GetCallback(
+      ScAgentMetadataPtr const & agentMetadata,
       ScAddr const & agentImplementationAddr,
       std::function<void(void)> const & postEraseEventCallback) noexcept;
+
+  /*!
+   * @brief Gets callback that passes calls of agents to executor.
+   * @param executor An executor of calls of agents. If it is null, then \p callback is returned.
+   * @param callback A callback of agent class that takes sc-event or batch of sc-events.
+   * @return A function that copies sc-event or batch of sc-events and passes call of \p callback with them to
+   * \p executor.
+   */
+  template <class TScEventArgument>
+  static std::function<void(TScEventArgument const &)> GetExecutorCallback(
+      std::shared_ptr<ScAgentExecutor> const & executor,
+      std::function<void(TScEventArgument const &)> const & callback) noexcept;
+
+  /*!
+   * @brief Generates subscription of agent class to sc-event.
+   *
+   * If agent class is derived from class `ScBatchAgent` then this method generates `ScEventSubscriptionBatch` that
+   * passes sc-events to callback from `GetBatchCallback`. If agent class is dispatched by action classes and it is
+   * subscribed to `action_initiated`, then this method generates `ScActionDispatcherSubscription` that passes only
+   * actions of its action class to callback from `GetCallback`. Otherwise, it generates `ScElementaryEventSubscription`
+   * that passes each sc-event to callback from `GetCallback`.
+   *
+   * @param context A sc-memory context used to subscribe agent class to sc-event.
+   * @param agent An agent object used to get batch parameters of agent class.
+   * @param eventClassAddr A sc-address of sc-event class. It is used if TScEvent is ScElementaryEvent.
+   * @param subscriptionElementAddr A sc-address of subscription sc-element.
+   * @param agentImplementationAddr A sc-address of agent implementation specified in knowledge base for this agent.
+   * @param agentExecutor An executor of calls of agents. It isn't used for sc-event of erasing sc-element.
+   * @param postEraseEventCallback A callback function that remove subscription of agent to sc-event of erasing
+   * sc-element from common map after agent flow of performing action.
+   * @return A pointer to generated subscription.
+   * @throws utils::ExceptionInvalidParams if batch agent class is subscribed to `action_initiated` or to sc-event of
+   * erasing sc-element, or if its max batch size is 0.
+   */
+  static ScEventSubscription * GenerateSubscription(
+      ScMemoryContext * context,
+      TScAgent & agent,
+      ScAddr const & eventClassAddr,
+      ScAddr const & subscriptionElementAddr,
+      ScAddr const & agentImplementationAddr,
+      std::shared_ptr<ScAgentExecutor> const & agentExecutor,
+      std::function<void(void)> const & postEraseEventCallback) noexcept(false);
+
+  /*!
+   * @brief Gets the callback function for batch agent class.
+   * @param agentMetadata A metadata of agent class shared by all calls of callback.
+   * @param agentImplementationAddr A sc-address of agent implementation specified in knowledge base for this agent.
+   * @return A function that takes batch of sc-events.
+   * @warning Specified agent class must be derived from class `ScBatchAgent`.
+   */
+  static _SC_EXTERN std::function<void(std::vector<TScEvent> const &)> GetBatchCallback(
+      ScAgentMetadataPtr const & agentMetadata,
+      ScAddr const & agentImplementationAddr) noexcept;
 };
 
 #include "_template/sc_agent_manager.tpp"
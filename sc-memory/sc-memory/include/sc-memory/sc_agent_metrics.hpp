@@ -0,0 +1,126 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "sc_memory.hpp"
+
+/*!
+ * @struct ScAgentExecutionStatistics
+ * @brief Statistics of calls of agents of one agent class with one agent implementation.
+ */
+struct ScAgentExecutionStatistics
+{
+  std::string m_agentClassName;      ///< Name of agent class.
+  ScAddr m_agentImplementationAddr;  ///< Agent implementation. It is empty if agent isn't specified in knowledge base.
+  sc_uint64 m_invocationsNum;        ///< Number of calls of agents by sc-events.
+  sc_uint64 m_deactivationsNum;      ///< Number of calls finished because action class of agent is deactivated.
+  sc_uint64 m_initiationConditionRejectionsNum;  ///< Number of calls finished by check of initiation condition.
+  sc_uint64 m_successfulResultsNum;              ///< Number of actions finished successfully.
+  sc_uint64 m_unsuccessfulResultsNum;            ///< Number of actions finished unsuccessfully.
+  sc_uint64 m_errorResultsNum;                   ///< Number of actions finished with error or by exception.
+  sc_uint64 m_suspendedResultsNum;               ///< Number of actions which performing was suspended.
+  sc_uint64 m_memoizedResultsNum;                ///< Number of actions finished with memoized result.
+  ScMemoryContext::ScLatencyStatistics m_programDuration;  ///< Durations of `DoProgram` in microseconds.
+  sc_uint64 m_programWaitingTime;  ///< Total time in microseconds that `DoProgram` was blocked in wait points.
+};
+
+/*!
+ * @class ScAgentMetrics
+ * @brief Lock-free counters of calls of agents of one agent class with one agent implementation.
+ *
+ * Counters are kept by process-wide registry while sc-memory is initialized, so they are not lost when agent class is
+ * unsubscribed. Statistics can be got via `ScAgentContext::GetAgentExecutionStatistics` and
+ * `ScAgentContext::GetAgentsExecutionStatistics`. They are also logged with sc-memory statistics, if
+ * `dump_memory_statistics` is turned on.
+ */
+class _SC_EXTERN ScAgentMetrics final
+{
+  template <class TScAgent>
+  friend class ScAgentManager;
+  friend class ScAgentContext;
+  friend class ScMemory;
+
+public:
+  _SC_EXTERN ScAgentMetrics(std::string agentClassName, ScAddr const & agentImplementationAddr) noexcept;
+
+  /*!
+   * @brief Adds time of blocking of current thread in wait point to waiting time of agent performed by this thread.
+   * @param waitingTime Time in microseconds.
+   */
+  static _SC_EXTERN void AddThreadWaitingTime(sc_uint64 waitingTime) noexcept;
+
+  //! Gets total time in microseconds of blocking of current thread in wait points.
+  static _SC_EXTERN sc_uint64 GetThreadWaitingTime() noexcept;
+
+protected:
+  std::string m_agentClassName;
+  ScAddr m_agentImplementationAddr;
+
+  std::atomic<sc_uint64> m_invocationsNum{0};
+  std::atomic<sc_uint64> m_deactivationsNum{0};
+  std::atomic<sc_uint64> m_initiationConditionRejectionsNum{0};
+  std::atomic<sc_uint64> m_successfulResultsNum{0};
+  std::atomic<sc_uint64> m_unsuccessfulResultsNum{0};
+  std::atomic<sc_uint64> m_errorResultsNum{0};
+  std::atomic<sc_uint64> m_suspendedResultsNum{0};
+  std::atomic<sc_uint64> m_memoizedResultsNum{0};
+
+  std::array<std::atomic<sc_uint32>, SC_LATENCY_HISTOGRAM_BUCKETS_COUNT> m_programDurationBuckets{};
+  std::atomic<sc_uint32> m_programDurationsNum{0};
+  std::atomic<sc_uint32> m_programMaxDuration{0};
+  std::atomic<sc_uint64> m_programWaitingTime{0};
+
+  _SC_EXTERN void RecordInvocation() noexcept;
+
+  _SC_EXTERN void RecordDeactivation() noexcept;
+
+  _SC_EXTERN void RecordInitiationConditionRejection() noexcept;
+
+  _SC_EXTERN void RecordMemoizedResult() noexcept;
+
+  /*!
+   * @brief Records result of `DoProgram`.
+   * @param code A result code of action. If `DoProgram` threw exception, then it is `SC_RESULT_ERROR`.
+   * @param isSuspended Whether performing of action was suspended.
+   * @param duration Duration of `DoProgram` in microseconds.
+   * @param waitingTime Time in microseconds that `DoProgram` was blocked in wait points.
+   */
+  _SC_EXTERN void RecordProgram(sc_result code, bool isSuspended, sc_uint64 duration, sc_uint64 waitingTime) noexcept;
+
+  _SC_EXTERN ScAgentExecutionStatistics Collect() const noexcept;
+
+  /*!
+   * @brief Gets counters of agent class with agent implementation, generating them if they don't exist.
+   * @param agentClassName A name of agent class.
+   * @param agentImplementationAddr A sc-address of agent implementation. It may be empty.
+   * @return Counters shared by all subscriptions of agent class with agent implementation.
+   */
+  static _SC_EXTERN std::shared_ptr<ScAgentMetrics> Resolve(
+      std::string const & agentClassName,
+      ScAddr const & agentImplementationAddr) noexcept;
+
+  //! Adds statistics of agent class with agent implementation to \p statistics, if agent class was subscribed.
+  static _SC_EXTERN void CollectByAgentClass(
+      std::string const & agentClassName,
+      ScAddr const & agentImplementationAddr,
+      std::vector<ScAgentExecutionStatistics> & statistics) noexcept;
+
+  //! Gets statistics of all agent classes subscribed since sc-memory was initialized.
+  static _SC_EXTERN std::vector<ScAgentExecutionStatistics> CollectAll() noexcept;
+
+  //! Logs statistics of all agent classes. It is called when sc-memory statistics are dumped by period.
+  static void Dump() noexcept;
+
+  //! Removes counters of all agent classes. It is called by `ScMemory::Shutdown`.
+  static void Clear() noexcept;
+};
@@ -0,0 +1,181 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "sc_memory.hpp"
+
+class ScEventSubscription;
+class ScElementaryEvent;
+
+/*!
+ * @class ScAgentResultsCache
+ * @brief Memoized results of actions of one agent class that performs actions as pure function of their arguments.
+ *
+ * Result structure of action finished successfully is kept by key that consists of user, action class of agent, order
+ * relations and arguments of action. If it is needed, then content of link arguments is used in key instead of them, so
+ * actions with different links with the same content have the same result structure. Results of one user aren't given
+ * to other users, because they can have different permissions.
+ *
+ * Result is invalidated when connector incident to one of its arguments is generated or erased, when content of link
+ * argument is changed, or when argument is erased. Connectors from actions of action class of agent and from memoized
+ * result structures don't invalidate results, so new actions with the same arguments can reuse them. If number of
+ * results exceeds max number of results, then the least recently used one is removed.
+ *
+ * Arguments are watched by `Watch` before action is performed, and each change of argument increments its version.
+ * Result is memoized by `Put` only if arguments weren't changed while action was performed, except by connectors of
+ * result structure itself.
+ *
+ * Cache is generated for agent class derived from `ScActionInitiatedAgent`, if its method
+ * `GetMaxMemoizedResultsCount` returns non-zero value.
+ */
+class _SC_EXTERN ScAgentResultsCache final
+{
+public:
+  //! Key of memoized result.
+  struct ScKey
+  {
+    std::vector<ScAddr::HashType> m_values;  ///< Action class, order relations and arguments or their contents.
+    ScAddrVector m_argumentAddrs;            ///< Arguments of action which changes invalidate result.
+  };
+
+  /*!
+   * @brief Versions of arguments of key watched while action is performed.
+   *
+   * Arguments stay watched while ticket exists. Ticket that isn't passed to `Put` unwatches them when it is destroyed.
+   */
+  class _SC_EXTERN ScTicket final
+  {
+    friend class ScAgentResultsCache;
+
+  public:
+    _SC_EXTERN ScTicket(ScTicket && other) noexcept;
+
+    ScTicket(ScTicket const &) = delete;
+    ScTicket & operator=(ScTicket const &) = delete;
+    ScTicket & operator=(ScTicket &&) = delete;
+
+    _SC_EXTERN ~ScTicket() noexcept;
+
+  protected:
+    ScAgentResultsCache * m_cache;
+    ScKey m_key;
+    std::vector<size_t> m_versions;  ///< Versions of arguments when they were watched, 0 if argument is not valid.
+
+    ScTicket(ScAgentResultsCache * cache, ScKey const & key) noexcept;
+  };
+
+  /*!
+   * @brief Constructs cache of results of actions of specified action class.
+   * @param actionClassAddr A sc-address of action class of agent.
+   * @param maxResultsCount A max number of memoized results.
+   * @param isLinksContentHashed Whether content of link arguments is used in key instead of them.
+   */
+  _SC_EXTERN ScAgentResultsCache(
+      ScAddr const & actionClassAddr,
+      size_t maxResultsCount,
+      bool isLinksContentHashed) noexcept;
+
+  _SC_EXTERN ~ScAgentResultsCache() noexcept;
+
+  /*!
+   * @brief Gets key of result of specified action by its arguments.
+   * @param context A sc-memory context of user that performs action. Arguments are read by it.
+   * @param actionAddr A sc-address of action.
+   * @return A key of result.
+   */
+  _SC_EXTERN ScKey GetKey(ScMemoryContext & context, ScAddr const & actionAddr) noexcept(false);
+
+  /*!
+   * @brief Gets memoized result structure by key and marks it as recently used.
+   * @param key A key of result.
+   * @return A sc-address of result structure or empty sc-address if there is no valid result for key.
+   */
+  _SC_EXTERN ScAddr Get(ScKey const & key) noexcept;
+
+  /*!
+   * @brief Starts to watch changes of arguments of key before action is performed.
+   * @param key A key of result.
+   * @return A ticket with versions of arguments.
+   */
+  _SC_EXTERN ScTicket Watch(ScKey const & key) noexcept;
+
+  /*!
+   * @brief Memoizes result structure by key of ticket, if arguments of key weren't changed since they were watched.
+   * @param ticket A ticket got by `Watch` before action was performed. It is released.
+   * @param resultAddr A sc-address of result structure.
+   */
+  _SC_EXTERN void Put(ScTicket & ticket, ScAddr const & resultAddr) noexcept;
+
+  //! Gets number of memoized results.
+  _SC_EXTERN size_t GetResultsCount() const noexcept;
+
+protected:
+  struct ScEntry
+  {
+    std::vector<ScAddr::HashType> m_keyValues;
+    ScAddrVector m_argumentAddrs;
+    ScAddr m_resultAddr;
+  };
+
+  using ScEntries = std::list<ScEntry>;
+  using ScSubscriptions = std::vector<std::unique_ptr<ScEventSubscription>>;
+
+  //! Subscriptions to changes of argument and results that depend on it.
+  struct ScWatch
+  {
+    std::unordered_set<ScEntry const *> m_entries;
+    ScSubscriptions m_subscriptions;
+    size_t m_creationVersion = 0;  ///< Version when watch was generated. Watches of reused sc-address are newer.
+    size_t m_version = 0;          ///< Version of the last change of argument.
+    size_t m_ticketsCount = 0;     ///< Number of tickets that watch argument.
+    //! Versions and other sc-elements of changes made while argument is watched by tickets.
+    std::vector<std::pair<size_t, ScAddr>> m_changes;
+  };
+
+  //! Context of subscriptions to changes of arguments. It has no user, so sc-elements are read by system context.
+  ScMemoryContext m_context;
+  ScAddr const m_actionClassAddr;
+  size_t const m_maxResultsCount;
+  bool const m_isLinksContentHashed;
+
+  mutable std::mutex m_mutex;
+  ScEntries m_entries;  ///< Results in order from the most recently used to the least recently used.
+  std::map<std::vector<ScAddr::HashType>, ScEntries::iterator> m_keysToEntries;
+  ScAddrToValueUnorderedMap<size_t> m_resultsCounts;  ///< Numbers of entries by result structures.
+  ScAddrToValueUnorderedMap<ScWatch> m_watches;
+  size_t m_lastVersion = 0;
+  //! Subscriptions of arguments without results or of erased arguments. They are destroyed by `Put` without lock.
+  ScSubscriptions m_unusedSubscriptions;
+
+  //! Checks whether sc-element exists by system context.
+  static bool IsElement(ScAddr const & addr) noexcept;
+
+  //! Generates subscriptions to sc-events of changing argument, or no subscriptions if argument can't be watched.
+  ScSubscriptions GenerateSubscriptions(ScAddr const & argumentAddr) noexcept;
+
+  //! Invalidates results that depend on argument of sc-event.
+  void OnArgumentChanged(ScElementaryEvent const & event) noexcept;
+
+  //! Removes entry of result and unlinks it from watches of its arguments.
+  void EraseEntry(ScEntries::iterator const & entryIt) noexcept;
+
+  /*!
+   * Unwatches arguments of ticket and checks whether they were changed by other sc-elements than `resultAddr` since
+   * ticket was got.
+   */
+  bool ReleaseTicket(ScTicket & ticket, ScAddr const & resultAddr) noexcept;
+
+  //! Moves subscriptions of watches without results and tickets to unused subscriptions.
+  void CollectUnusedWatches() noexcept;
+};
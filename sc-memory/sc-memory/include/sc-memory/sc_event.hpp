@@ -23,6 +23,8 @@ class _SC_EXTERN ScEvent : public ScObject
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
 
 public:
   _SC_EXTERN virtual ~ScEvent() noexcept;
@@ -44,6 +46,8 @@ class _SC_EXTERN ScElementaryEvent : public ScEvent
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
 
 public:
   _SC_EXTERN ScAddr GetEventClass() const noexcept override;
@@ -106,6 +110,8 @@ class _SC_EXTERN TScElementaryEvent : public ScElementaryEvent
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -134,6 +140,8 @@ class _SC_EXTERN ScEventAfterGenerateConnector : public TScElementaryEvent<tConn
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -203,6 +211,8 @@ class _SC_EXTERN ScEventAfterGenerateEdge final : public ScEventAfterGenerateCon
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -242,6 +252,8 @@ class _SC_EXTERN ScEventAfterGenerateOutgoingArc final : public ScEventAfterGene
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -268,6 +280,8 @@ class _SC_EXTERN ScEventAfterGenerateIncomingArc final : public ScEventAfterGene
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -299,6 +313,8 @@ class _SC_EXTERN ScEventBeforeEraseConnector : public TScElementaryEvent<tConnec
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -372,6 +388,8 @@ class _SC_EXTERN ScEventBeforeEraseEdge final : public ScEventBeforeEraseConnect
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -411,6 +429,8 @@ class _SC_EXTERN ScEventBeforeEraseOutgoingArc final : public ScEventBeforeErase
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -437,6 +457,8 @@ class _SC_EXTERN ScEventBeforeEraseIncomingArc final : public ScEventBeforeErase
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -469,6 +491,8 @@ class _SC_EXTERN ScEventBeforeEraseElement final : public TScElementaryEvent<ScT
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
@@ -498,6 +522,8 @@ class _SC_EXTERN ScEventBeforeChangeLinkContent final : public TScElementaryEven
 {
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   template <class TScEvent, class TScContext>
   friend class ScAgent;
   template <class TScAgent>
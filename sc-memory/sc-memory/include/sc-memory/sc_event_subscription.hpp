@@ -6,12 +6,27 @@
 
 #pragma once
 
+#include <chrono>
+#include <condition_variable>
 #include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
 
 #include "sc_event.hpp"
 
 #include "utils/sc_lock.hpp"
 
+/*!
+ * Priority of sc-events of subscription. Sc-events with high priority are processed before queued sc-events with normal
+ * priority.
+ */
+enum class ScEventPriority : sc_uint8
+{
+  Normal = SC_EVENT_PRIORITY_NORMAL,
+  High = SC_EVENT_PRIORITY_HIGH,
+};
+
 /*!
  * Base class for sc-events subscriptions.
  */
@@ -21,6 +36,17 @@ public:
   _SC_EXTERN ~ScEventSubscription() noexcept override;
 
   _SC_EXTERN virtual void RemoveDelegate() noexcept = 0;
+
+  //! Sets priority of sc-events emitted after this call.
+  _SC_EXTERN virtual void SetPriority(ScEventPriority priority) noexcept = 0;
+
+  _SC_EXTERN virtual ScEventPriority GetPriority() const noexcept = 0;
+
+  /*!
+   * @brief Adds histograms of latencies of sc-events processed by this subscription to \p stat.
+   * @param stat Histograms of latencies to be updated.
+   */
+  _SC_EXTERN virtual void CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept = 0;
 };
 
 SHARED_PTR_TYPE(ScEventSubscription);
@@ -37,6 +63,13 @@ class _SC_EXTERN ScElementaryEventSubscription final : public ScEventSubscriptio
   template <class TScAgent>
   friend class ScAgentManager;
   friend class ScMemoryJsonEventsHandler;
+  friend class ScTemplateSubscription;
+  template <class TScEventType>
+  friend class ScEventSubscriptionBatch;
+  friend class ScActionDispatcherSubscription;
+  friend class ScActionCompletionRegistry;
+  friend class ScAgentResultsCache;
+  friend class ScTemplateCache;
 
   SC_DISALLOW_COPY_AND_MOVE(ScElementaryEventSubscription);
 
@@ -50,6 +83,12 @@ public:
 
   _SC_EXTERN void RemoveDelegate() noexcept override;
 
+  _SC_EXTERN void SetPriority(ScEventPriority priority) noexcept override;
+
+  _SC_EXTERN ScEventPriority GetPriority() const noexcept override;
+
+  _SC_EXTERN void CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept override;
+
 protected:
   explicit _SC_EXTERN ScElementaryEventSubscription(
       ScMemoryContext const & context,
@@ -75,7 +114,181 @@ private:
   sc_event_subscription * m_event_subscription;
 
   DelegateFunc m_delegate;
-  utils::ScLock m_lock;
+  mutable utils::ScLock m_lock;
+};
+
+/*!
+ * @class ScGlobalEventSubscription
+ * @brief Subscription to sc-events of the specified class from all sc-elements.
+ *
+ * Sc-events are filtered by sc-type of sc-connector of `TScEvent` and, optionally, by belonging of sc-element, for
+ * which sc-event is emitted, to set. Global subscriptions are found by sc-event class during emission, so, unlike
+ * subscriptions to each sc-element of set, their cost doesn't depend on count of listened sc-elements. Belonging to
+ * set is checked before delegate is called.
+ *
+ * @tparam TScEvent A type of sc-event. It must be derived from ScElementaryEvent and define sc-event class.
+ */
+template <class TScEvent>
+class _SC_EXTERN ScGlobalEventSubscription final : public ScEventSubscription
+{
+  static_assert(
+      std::is_base_of<ScElementaryEvent, TScEvent>::value && !std::is_same<ScElementaryEvent, TScEvent>::value,
+      "TScEvent type must be derived from ScElementaryEvent type.");
+
+  friend class ScAgentContext;
+
+  SC_DISALLOW_COPY_AND_MOVE(ScGlobalEventSubscription);
+
+public:
+  using DelegateFunc = std::function<void(TScEvent const & event)>;
+
+  _SC_EXTERN ~ScGlobalEventSubscription() noexcept override;
+
+  _SC_EXTERN void RemoveDelegate() noexcept override;
+
+  _SC_EXTERN void SetPriority(ScEventPriority priority) noexcept override;
+
+  _SC_EXTERN ScEventPriority GetPriority() const noexcept override;
+
+  _SC_EXTERN void CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept override;
+
+protected:
+  explicit _SC_EXTERN ScGlobalEventSubscription(
+      ScMemoryContext const & context,
+      ScAddr const & setAddr,
+      DelegateFunc const & func) noexcept;
+
+  _SC_EXTERN static sc_result Handle(
+      sc_event_subscription const * event_subscription,
+      sc_addr userAddr,
+      sc_addr subscriptionElementAddr,
+      sc_addr connectorAddr,
+      sc_type connectorType,
+      sc_addr otherAddr) noexcept;
+
+private:
+  sc_event_subscription * m_event_subscription;
+
+  DelegateFunc m_delegate;
+  mutable utils::ScLock m_lock;
+};
+
+/*!
+ * @class ScEventSubscriptionBatchTimer
+ * @brief Timer shared by all batch subscriptions.
+ *
+ * Timer posts callbacks of batches which exceeded max batch delay to worker threads of sc-events, so batch
+ * subscriptions don't start their own threads. Its thread is started by the first scheduled callback.
+ */
+class _SC_EXTERN ScEventSubscriptionBatchTimer final
+{
+  friend class ScMemory;
+  template <class TScEvent>
+  friend class ScEventSubscriptionBatch;
+
+  using Callback = std::function<void()>;
+
+  /*!
+   * @brief Schedules callback.
+   * @param deadline A time when callback is posted to worker threads of sc-events.
+   * @param callback A callback called once.
+   * @return Identifier of deadline.
+   */
+  static _SC_EXTERN size_t Schedule(std::chrono::steady_clock::time_point const & deadline, Callback const & callback);
+
+  /*!
+   * @brief Removes deadline.
+   * @param deadlineId Identifier of deadline.
+   * @return true if deadline was removed before its callback was posted, otherwise false.
+   */
+  static _SC_EXTERN bool Cancel(size_t deadlineId) noexcept;
+
+  //! Stops timer thread and posts callbacks of all deadlines. It is called by `ScMemory::Shutdown`.
+  static void Shutdown() noexcept;
+};
+
+/*!
+ * @class ScEventSubscriptionBatch
+ * @brief Subscription that delivers sc-events to delegate in batches.
+ *
+ * Sc-events of subscription are coalesced into batch. Batch is delivered when it reaches max batch size or when max
+ * batch delay has passed since its first sc-event was emitted. Delegate calls are serialized, but batches aren't
+ * ordered relative to each other, because sc-events themselves are handled concurrently. Sc-events remaining in batch
+ * are delivered when subscription is destroyed.
+ *
+ * @tparam TScEvent A type of sc-event. It must be derived from ScElementaryEvent.
+ */
+template <class TScEvent = ScElementaryEvent>
+class _SC_EXTERN ScEventSubscriptionBatch final : public ScEventSubscription
+{
+  static_assert(
+      std::is_base_of<ScElementaryEvent, TScEvent>::value,
+      "TScEvent type must be derived from ScElementaryEvent type.");
+
+  friend class ScAgentContext;
+  template <class TScAgent>
+  friend class ScAgentManager;
+
+  SC_DISALLOW_COPY_AND_MOVE(ScEventSubscriptionBatch);
+
+public:
+  using DelegateFunc = std::function<void(std::vector<TScEvent> const & events)>;
+
+  _SC_EXTERN ~ScEventSubscriptionBatch() noexcept override;
+
+  _SC_EXTERN void RemoveDelegate() noexcept override;
+
+  _SC_EXTERN void SetPriority(ScEventPriority priority) noexcept override;
+
+  _SC_EXTERN ScEventPriority GetPriority() const noexcept override;
+
+  _SC_EXTERN void CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept override;
+
+  //! Delivers collected sc-events to delegate without waiting for max batch size or max batch delay.
+  _SC_EXTERN void Flush() noexcept;
+
+protected:
+  explicit _SC_EXTERN ScEventSubscriptionBatch(
+      ScMemoryContext const & context,
+      ScAddr const & subscriptionElementAddr,
+      size_t maxBatchSize,
+      std::chrono::milliseconds const & maxBatchDelay,
+      DelegateFunc const & func) noexcept;
+
+  explicit _SC_EXTERN ScEventSubscriptionBatch(
+      ScMemoryContext const & context,
+      ScAddr const & eventClassAddr,
+      ScAddr const & subscriptionElementAddr,
+      size_t maxBatchSize,
+      std::chrono::milliseconds const & maxBatchDelay,
+      DelegateFunc const & func) noexcept;
+
+private:
+  //! Adds sc-event to batch and delivers batch if it reaches max batch size.
+  void Push(TScEvent const & event) noexcept;
+
+  //! Takes collected sc-events as delivered batch. It is called under lock of sc-events.
+  std::vector<TScEvent> TakeEvents() noexcept;
+
+  //! Delivers batch with the specified number if it exceeded max batch delay and hasn't been delivered yet.
+  void DeliverDelayed(size_t batchNumber) noexcept;
+
+  void Deliver(std::vector<TScEvent> const & events) noexcept;
+
+  size_t m_maxBatchSize;
+  std::chrono::milliseconds m_maxBatchDelay;
+
+  DelegateFunc m_delegate;
+  std::mutex m_deliveryMutex;
+
+  std::vector<TScEvent> m_events;
+  size_t m_batchNumber;              ///< Number of batch which sc-events are collected now.
+  size_t m_deadlineId;               ///< Deadline of current batch in shared timer, or 0 if it isn't scheduled.
+  size_t m_scheduledDeadlinesCount;  ///< Number of deadlines which callbacks can still be called.
+  std::mutex m_eventsMutex;
+  std::condition_variable m_eventsCondition;
+
+  std::unique_ptr<ScElementaryEventSubscription<TScEvent>> m_subscription;
 };
 
 #include "_template/sc_event_subscription.tpp"
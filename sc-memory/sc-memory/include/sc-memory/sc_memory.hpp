@@ -23,6 +23,7 @@
 
 class ScMemoryContext;
 class ScTemplate;
+class ScEventSubscription;
 class ScStream;
 using ScStreamPtr = std::shared_ptr<ScStream>;
 
@@ -79,6 +80,18 @@ public:
   _SC_EXTERN static void LogMute();
   _SC_EXTERN static void LogUnmute();
 
+  /*!
+   * @brief Gets count of sc-templates in process-wide cache of sc-templates.
+   *
+   * @return Count of sc-templates built by `ScMemoryContext::BuildCachedTemplate` and not evicted yet.
+   */
+  _SC_EXTERN static size_t GetCachedTemplatesCount();
+
+  /*!
+   * @brief Removes all sc-templates from process-wide cache of sc-templates.
+   */
+  _SC_EXTERN static void ClearTemplatesCache();
+
   static ScMemoryContext * ms_globalContext;
 };
 
@@ -88,6 +101,7 @@ class ScMemoryContext
   friend class ScMemory;
   friend class ScAction;
   friend class ScTemplateKeynode;
+  friend class ScTemplate;
 
 public:
   struct ScMemoryStatistics
@@ -102,6 +116,46 @@ public:
     }
   };
 
+  //! Statistics of queues of emitted sc-events. Numbers of queued and spilled sc-events are indexed by priority.
+  struct ScEventsQueueStatistics
+  {
+    sc_uint32 m_queuedEventsNum[SC_EVENT_PRIORITY_COUNT];   ///< Numbers of sc-events waiting for processing.
+    sc_uint32 m_spilledEventsNum[SC_EVENT_PRIORITY_COUNT];  ///< Numbers of sc-events that didn't fit in lanes.
+    sc_uint64 m_droppedEventsNum;                           ///< Number of sc-events dropped because queue was full.
+    sc_uint64 m_blockedEmissionsNum;                        ///< Number of emissions that waited for free place.
+
+    sc_uint32 m_workersNum;         ///< Number of worker threads processing sc-events.
+    sc_uint32 m_idleWorkersNum;     ///< Number of worker threads waiting for sc-events.
+    sc_uint32 m_blockedWorkersNum;  ///< Number of worker threads blocked in wait points.
+    sc_uint64 m_grownWorkersNum;    ///< Number of worker threads started by adaptive pool.
+    sc_uint64 m_shrunkWorkersNum;   ///< Number of worker threads stopped by adaptive pool.
+
+    sc_uint64 GetQueuedNum() const
+    {
+      sc_uint64 queuedEventsNum = 0;
+      for (sc_uint32 const num : m_queuedEventsNum)
+        queuedEventsNum += num;
+      return queuedEventsNum;
+    }
+  };
+
+  //! Percentiles of latencies (in microseconds) estimated by histogram of latencies.
+  struct ScLatencyStatistics
+  {
+    sc_uint64 m_num;  ///< Number of measured latencies.
+    sc_uint64 m_p50;  ///< Median latency.
+    sc_uint64 m_p90;  ///< 90th percentile of latencies.
+    sc_uint64 m_p99;  ///< 99th percentile of latencies.
+    sc_uint64 m_max;  ///< Max latency.
+  };
+
+  //! Latencies of processing of emitted sc-events.
+  struct ScEventsLatencyStatistics
+  {
+    ScLatencyStatistics m_queueLatency;       ///< Time from emission of sc-events to start of their processing.
+    ScLatencyStatistics m_executionDuration;  ///< Time of processing of sc-events by delegates.
+  };
+
 public:
   _SC_EXTERN explicit ScMemoryContext() noexcept;
   _SC_EXTERN explicit ScMemoryContext(sc_memory_context * context) noexcept;
@@ -123,8 +177,12 @@ public:
   //! Call this function, when you request to destroy real memory context, before destructor calls for this object
   _SC_EXTERN void Destroy() noexcept;
 
-  //! Begin events pending mode
-  _SC_EXTERN void BeginEventsPending();
+  /*!
+   * @brief Begins events pending mode.
+   * @param coalesceEvents If it is true, then sc-events of sc-connectors generated and erased in this mode aren't
+   * emitted, these sc-connectors are just erased when the mode ends.
+   */
+  _SC_EXTERN void BeginEventsPending(bool coalesceEvents = false);
 
   //! End events pending mode
   _SC_EXTERN void EndEventsPending();
@@ -135,6 +193,12 @@ public:
   //! End events blocking mode
   _SC_EXTERN void EndEventsBlocking();
 
+  //! Checks whether events pending mode is begun
+  _SC_EXTERN bool AreEventsPending() const;
+
+  //! Checks whether events blocking mode is begun
+  _SC_EXTERN bool AreEventsBlocking() const;
+
   /*!
    * @brief Checks if the sc-memory context is valid.
    *
@@ -2084,6 +2148,43 @@ public:
       ScTemplateResultItem & result,
       ScTemplateParams const & params = ScTemplateParams::Empty) noexcept(false);
 
+  /*!
+   * @brief Generates sc-constructions by object of `ScTemplate` for each of specified parameters.
+   *
+   * It is faster than calling `GenerateByTemplate` for each parameters: sc-template is checked and variables specified
+   * by system identifiers are resolved once, all parameters are checked before generation, and sc-events of generated
+   * sc-elements are emitted after all sc-constructions are generated.
+   *
+   * @param templateToGenerate An object of `ScTemplate` to generate sc-constructions by it.
+   * @param paramsList A list of maps of specified sc-template sc-variables to user replacements, one for each
+   * sc-construction.
+   * @param results [out] Generated sc-constructions in order of parameters.
+   * @param threadsCount A count of threads to generate sc-constructions in parallel. Each thread uses its own
+   * sc-memory context of the same user. By default, sc-constructions are generated in the calling thread.
+   * @throws utils::ExceptionInvalidState if the object of `ScTemplate` is not valid.
+   * @throws utils::ExceptionInvalidParams if some parameters are invalid. In this case sc-constructions generated by
+   * this call, including ones generated by other threads, are erased and `results` is empty. Sc-events of their
+   * generation and erasure may be emitted.
+   *
+   * @code
+   * ...
+   * ScTemplate templateToGenerate;
+   * templateToGenerate.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_instance");
+   *
+   * std::vector<ScTemplateParams> paramsList(instances.size());
+   * for (size_t i = 0; i < instances.size(); ++i)
+   *   paramsList[i].Add("_instance", instances[i]);
+   *
+   * std::vector<ScTemplateResultItem> results;
+   * m_context->GenerateByTemplateBatch(templateToGenerate, paramsList, results);
+   * @endcode
+   */
+  _SC_EXTERN void GenerateByTemplateBatch(
+      ScTemplate const & templateToGenerate,
+      std::vector<ScTemplateParams> const & paramsList,
+      std::vector<ScTemplateResultItem> & results,
+      size_t threadsCount = 1) noexcept(false);
+
   /*!
    * @brief Generates sc-constructions by object of `ScTemplate` and accumulates generated sc-construction into
    * `result`.
@@ -2166,6 +2267,69 @@ public:
       ScTemplate const & templateToFind,
       ScTemplateSearchResult & result) noexcept(false);
 
+  /*!
+   * Searches sc-constructions by object of `ScTemplate` among sc-elements of sc-structure and accumulates found
+   * sc-constructions into `result`.
+   * @param templateToFind An object of `ScTemplate` to find sc-constructions by it.
+   * @param structureAddr A sc-address of sc-structure which all sc-elements of found sc-constructions must belong to.
+   * @param result A result vector of found sc-constructions.
+   *
+   * @return true if the sc-constructions are found; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidParams if `structureAddr` is empty.
+   * @throws utils::ExceptionInvalidState if the object of `ScTemplate` is not valid.
+   *
+   * @note Sc-elements of sc-structure are collected once per search, so checking belonging of each candidate
+   * sc-element to sc-structure doesn't depend on power of sc-structure.
+   *
+   * @code
+   * ...
+   * ScAddr const & classAddr = context.SearchElementBySystemIdentifier("my_class");
+   * ScAddr const & ontologyAddr = context.SearchElementBySystemIdentifier("my_ontology");
+   * ...
+   * ScTemplate templateToFind;
+   * templToFind.Triple(
+   *  classAddr,
+   *  ScType::VarPermPosArc >> "_arc",
+   *  ScType::Unknown >> "_addr2"
+   * );
+   *
+   * ScTemplateSearchResult result;
+   * m_context->SearchByTemplateInStructure(templateToFind, ontologyAddr, result);
+   * @endcode
+   */
+  _SC_EXTERN ScTemplate::Result SearchByTemplateInStructure(
+      ScTemplate const & templateToFind,
+      ScAddr const & structureAddr,
+      ScTemplateSearchResult & result) noexcept(false);
+
+  /*!
+   * Searches sc-constructions by object of `ScTemplate`, accumulates found sc-constructions into `result` and collects
+   * statistics of search into `profile`.
+   * @param templateToFind An object of `ScTemplate` to find sc-constructions by it.
+   * @param result A result vector of found sc-constructions.
+   * @param profile [out] Statistics of search: sc-iterators created, candidates visited and rejected, time spent for
+   * each triple of sc-template and order in which triples were iterated.
+   *
+   * @return true if the sc-constructions are found; otherwise, returns false.
+   *
+   * @throws utils::ExceptionInvalidState if the object of `ScTemplate` is not valid.
+   *
+   * @note Profiling slows search down a little, so use this method only to diagnose slow sc-templates.
+   *
+   * @code
+   * ...
+   * ScTemplateSearchResult result;
+   * ScTemplateSearchProfile profile;
+   * m_context->SearchByTemplate(templateToFind, result, profile);
+   * SC_LOG_INFO(profile.ToJSON());
+   * @endcode
+   */
+  _SC_EXTERN ScTemplate::Result SearchByTemplate(
+      ScTemplate const & templateToFind,
+      ScTemplateSearchResult & result,
+      ScTemplateSearchProfile & profile) noexcept(false);
+
   /*!
    * Searches sc-constructions by object of `ScTemplate` and accumulates found sc-constructions into `result`.
    * @param templateToFind An object of `ScTemplate` to find sc-constructions by it.
@@ -2637,6 +2801,52 @@ public:
       ScTemplate & resultTemplate,
       std::string const & translatableSCsTemplate) noexcept(false);
 
+  /*!
+   * Translates a sc-template represented in sc-memory (sc-structure) into object of `ScTemplate` using process-wide
+   * cache of sc-templates. Sc-template structure is read only once for user of sc-memory context, next builds take
+   * its triples from the cache and apply specified params to them. Before each build cached sc-template is checked:
+   * if sc-arcs from its structure, sc-elements of the structure or their sc-types are changed, it is read again.
+   * @param resultTemplate An object of `ScTemplate` to be gotten.
+   * @param translatableTemplateAddr A sc-address of sc-template structure to be translated.
+   * @param params A map of specified sc-template sc-variables to their replacements.
+   * @throws utils::ExceptionInvalidState if sc-template represented in sc-memory is not valid.
+   *
+   * @code
+   * ...
+   * ...
+   * ScTemplate resultTemplate;
+   * ScAddr const & translatableTemplAddr = m_context->SearchElementBySystemIdentifier("my_template");
+   * m_context->BuildCachedTemplate(resultTemplate, translatableTemplAddr);
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN void BuildCachedTemplate(
+      ScTemplate & resultTemplate,
+      ScAddr const & translatableTemplateAddr,
+      ScTemplateParams const & params = ScTemplateParams()) noexcept(false);
+
+  /*!
+   * Translates a sc-template represented in SCs-code into object of `ScTemplate` using process-wide cache of
+   * sc-templates. SCs-code is parsed only once for user of sc-memory context, next builds with the same SCs-code take
+   * its triples from the cache. Before each build cached sc-template is checked: if some its system identifier is
+   * resolved to another sc-element, SCs-code is parsed again.
+   * @param resultTemplate An object of `ScTemplate` to be gotten.
+   * @param translatableSCsTemplate A sc.s-representation of sc-template to be translated.
+   * @throws utils::ExceptionInvalidState if sc-template represented in SCs-code is not valid.
+   *
+   * @code
+   * ...
+   * ...
+   * ScTemplate resultTemplate;
+   * std::string const translatableSCsTemplate = "concept_set _-> _var;;";
+   * m_context->BuildCachedTemplate(resultTemplate, translatableSCsTemplate);
+   * ...
+   * @endcode
+   */
+  _SC_EXTERN void BuildCachedTemplate(
+      ScTemplate & resultTemplate,
+      std::string const & translatableSCsTemplate) noexcept(false);
+
 protected:
   /*!
    * Translates an object of `ScTemplate` to sc-template in sc-memory (sc-structure).
@@ -2674,6 +2884,30 @@ public:
    */
   _SC_EXTERN ScMemoryStatistics CalculateStatistics() const;
 
+  /*! Gets statistics of queues of emitted sc-events: depths of queues of each priority, numbers of dropped sc-events
+   * and blocked emissions, and state of pool of worker threads.
+   *
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have read
+   * permissions.
+   */
+  _SC_EXTERN ScEventsQueueStatistics GetEventsQueueStatistics() const;
+
+  /*! Gets latencies of all sc-events processed by worker threads: percentiles of time from emission of sc-events to
+   * start of their processing and percentiles of time of their processing.
+   *
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have read
+   * permissions.
+   */
+  _SC_EXTERN ScEventsLatencyStatistics GetEventsLatencyStatistics() const;
+
+  /*! Gets latencies of sc-events processed by the specified sc-event subscription.
+   *
+   * @param subscription A sc-event subscription which latencies should be got.
+   * @throws utils::ExceptionInvalidState if the sc-memory context is not authenticated or does not have read
+   * permissions.
+   */
+  _SC_EXTERN ScEventsLatencyStatistics GetEventsLatencyStatistics(ScEventSubscription const & subscription) const;
+
   /*! Calculates sc-element counts.
    *
    * @return sc-nodes, sc-connectors and sc-links counts.
@@ -2705,6 +2939,12 @@ public:
 protected:
   _SC_EXTERN explicit ScMemoryContext(ScAddr const & userAddr) noexcept;
 
+  //! Checks that the sc-memory context can read statistics of sc-events.
+  _SC_EXTERN void CheckEventsLatencyStatisticsAccess() const noexcept(false);
+
+  //! Estimates percentiles of latencies from histograms.
+  _SC_EXTERN static ScEventsLatencyStatistics ConvertEventsLatencyStatistics(sc_events_latency_stat const & stat);
+
   _SC_EXTERN ScAddrSet SearchLinksByContentSubstring(
       ScStreamPtr const & linkContentSubstringStream,
       size_t maxLengthToSearchAsPrefix,
@@ -2718,10 +2958,10 @@ protected:
 class ScMemoryContextEventsPendingGuard
 {
 public:
-  _SC_EXTERN explicit ScMemoryContextEventsPendingGuard(ScMemoryContext & context)
+  _SC_EXTERN explicit ScMemoryContextEventsPendingGuard(ScMemoryContext & context, bool coalesceEvents = false)
     : m_context(context)
   {
-    m_context.BeginEventsPending();
+    m_context.BeginEventsPending(coalesceEvents);
   }
 
   _SC_EXTERN ~ScMemoryContextEventsPendingGuard()
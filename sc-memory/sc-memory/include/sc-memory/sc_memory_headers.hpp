@@ -23,9 +23,15 @@
 
 #include "sc_event.hpp"
 #include "sc_event_subscription.hpp"
+#include "sc_template_subscription.hpp"
 #include "sc_agent.hpp"
 #include "sc_agent_context.hpp"
 #include "sc_action.hpp"
+#include "sc_action_batch.hpp"
+#include "sc_action_completion_registry.hpp"
+#include "sc_agent_metrics.hpp"
+#include "sc_agent_executor.hpp"
+#include "sc_agent_results_cache.hpp"
 #include "sc_result.hpp"
 #include "sc_event_wait.hpp"
 #include "sc_module.hpp"
@@ -15,6 +15,7 @@
 class ScKeynodes;
 class ScActionInitiatedAgent;
 class ScAgentBuilderAbstract;
+class ScAgentExecutor;
 template <class TScAgent>
 class ScAgentBuilder;
 
@@ -82,6 +83,24 @@ public:
   template <class TScAgent>
   _SC_EXTERN ScAgentBuilder<TScAgent> * AgentBuilder(ScAddr const & agentImplementationAddr = ScAddr::Empty) noexcept;
 
+  /*!
+   * @brief Sets executor of calls of module agents which executors are not set by `SetAgentExecutor` or by agent
+   * builders.
+   * @param executor An executor shared by module agents. If it is null, then module agents are called in threads of
+   * events and agents.
+   * @returns A pointer to module instance.
+   */
+  _SC_EXTERN ScModule * SetAgentsExecutor(std::shared_ptr<ScAgentExecutor> const & executor) noexcept;
+
+  /*!
+   * @brief Sets executor of calls of agents of specified agent class.
+   * @tparam TScAgent An agent class of module.
+   * @param executor An executor of calls of agents. It may be shared with other agent classes.
+   * @returns A pointer to module instance.
+   */
+  template <class TScAgent>
+  _SC_EXTERN ScModule * SetAgentExecutor(std::shared_ptr<ScAgentExecutor> const & executor) noexcept;
+
   /*!
    * @brief Subscribes all module agents.
    * @param context A sc-memory context for registering.
@@ -109,11 +128,19 @@ public:
 
 protected:
   /// Registered agents
-  using ScAgentSubscribeCallback = std::function<void(ScMemoryContext *, ScAddr const &, ScAddrVector const &)>;
+  using ScAgentSubscribeCallback = std::function<
+      void(ScMemoryContext *, ScAddr const &, ScAddrVector const &, std::shared_ptr<ScAgentExecutor> const &)>;
   using ScAgentUnsubscribeCallback = std::function<void(ScMemoryContext *, ScAddr const &, ScAddrVector const &)>;
   std::list<std::tuple<ScAgentBuilderAbstract *, ScAgentSubscribeCallback, ScAgentUnsubscribeCallback, ScAddrVector>>
       m_agents;
 
+  /// Executors of agents
+  std::shared_ptr<ScAgentExecutor> m_agentsExecutor;
+  std::unordered_map<std::string, std::shared_ptr<ScAgentExecutor>> m_agentExecutors;
+
+  //! Gets executor of agent class set by `SetAgentExecutor` or by `SetAgentsExecutor`.
+  _SC_EXTERN std::shared_ptr<ScAgentExecutor> GetAgentExecutor(std::string const & agentClassName) const noexcept;
+
   template <class TScAgent>
   ScAgentSubscribeCallback GetAgentSubscribeCallback() noexcept;
 
@@ -21,10 +21,13 @@ class ScResult : public ScObject
 
 protected:
   sc_result m_code;
+  bool m_isSuspended;  ///< Whether performing of action is suspended and will be continued later.
 
   _SC_EXTERN ScResult();
 
   _SC_EXTERN ScResult(sc_result code);
 
+  _SC_EXTERN ScResult(sc_result code, bool isSuspended);
+
   _SC_EXTERN operator sc_result();
 };
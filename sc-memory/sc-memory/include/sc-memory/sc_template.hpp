@@ -6,7 +6,9 @@
 
 #pragma once
 
+#include <chrono>
 #include <functional>
+#include <memory>
 
 #include "sc_addr.hpp"
 #include "sc_type.hpp"
@@ -280,6 +282,47 @@ using ScTemplateSearchResultCallbackWithRequest =
 using ScTemplateSearchResultFilterCallback = std::function<bool(ScTemplateResultItem const & resultItem)>;
 using ScTemplateSearchResultCheckCallback = std::function<bool(ScAddr const & addr)>;
 
+/*!
+ * @brief Represents statistics collected during search by object of `ScTemplate` if profiling is requested.
+ *
+ * ScTemplateSearchProfile shows how many sc-iterators were created and how many candidate sc-constructions were visited
+ * and rejected for each triple of sc-template, how much time was spent in each triple and in which order triples were
+ * iterated. Use it to diagnose slow sc-templates.
+ */
+struct _SC_EXTERN ScTemplateSearchProfile
+{
+  /*!
+   * @brief Represents statistics of one triple of sc-template.
+   */
+  struct TripleProfile
+  {
+    size_t m_tripleIdx = 0;                     ///< An index of triple in sc-template.
+    size_t m_iteratorsCount = 0;                ///< A count of sc-iterators created for triple.
+    size_t m_visitedCandidatesCount = 0;        ///< A count of sc-element triples returned by sc-iterators.
+    size_t m_rejectedByBindingCount = 0;        ///< A count of candidates not matching already found sc-elements.
+    size_t m_rejectedByUsedConnectorCount = 0;  ///< A count of candidates with sc-connector used by other triple.
+    size_t m_rejectedByStructureCount = 0;      ///< A count of candidates rejected by sc-structure or check callback.
+    std::chrono::nanoseconds m_duration{0};     ///< Time spent in triple without time of depended on triples.
+  };
+
+  bool m_isJoined = false;                 ///< Whether sc-template was searched by worst-case optimal join.
+  std::vector<TripleProfile> m_triples;    ///< Statistics of triples ordered by their indices in sc-template.
+  std::vector<size_t> m_executionOrder;    ///< Indices of triples in order they were iterated first time.
+  std::chrono::nanoseconds m_duration{0};  ///< Time spent in search including preparation of sc-template.
+
+  /*!
+   * @brief Clears collected statistics.
+   */
+  _SC_EXTERN void Clear() noexcept;
+
+  /*!
+   * @brief Represents collected statistics in JSON.
+   *
+   * @return A JSON string with fields `algorithm`, `time`, `order` and `triples`. Time is specified in microseconds.
+   */
+  _SC_EXTERN std::string ToJSON() const;
+};
+
 /*!
  * @brief Represents a program object of sc-template used for generating and searching sc-elements in sc-memory.
  *
@@ -294,6 +337,7 @@ class _SC_EXTERN ScTemplate
   friend class ScTemplateBuilder;
   friend class ScTemplateBuilderFromScs;
   friend class ScTemplateLoader;
+  friend class ScTemplateSubscription;
 
 public:
   /*!
@@ -474,6 +518,22 @@ protected:
       ScTemplateParams const & params,
       ScTemplateResultCode * errorCode = nullptr) const noexcept(false);
 
+  /*!
+   * @brief Generates sc-constructions by object of `ScTemplate` for each of parameters.
+   *
+   * @param context A sc-memory context.
+   * @param paramsList A list of template parameters, one for each sc-construction.
+   * @param results [out] Generated sc-constructions in order of parameters.
+   * @param threadsCount A count of threads to generate sc-constructions in parallel.
+   * @throws utils::ExceptionInvalidParams if some parameters are invalid. In this case sc-constructions generated
+   * before error are erased and `results` is empty.
+   */
+  void GenerateBatch(
+      ScMemoryContext & context,
+      std::vector<ScTemplateParams> const & paramsList,
+      std::vector<ScTemplateResultItem> & results,
+      size_t threadsCount) const noexcept(false);
+
   /*!
    * @brief Searches for sc-elements by object of `ScTemplate`.
    *
@@ -484,6 +544,30 @@ protected:
    */
   Result Search(ScMemoryContext & context, ScTemplateSearchResult & result) const noexcept(false);
 
+  /*!
+   * @brief Searches for sc-elements by object of `ScTemplate` among sc-elements of sc-structure.
+   *
+   * @param context A sc-memory context.
+   * @param structureAddr A sc-address of sc-structure which all found sc-elements must belong to.
+   * @param result A result item to store the found elements.
+   * @return A result of the search.
+   * @throws utils::ExceptionInvalidParams if the parameters are invalid.
+   */
+  Result Search(ScMemoryContext & context, ScAddr const & structureAddr, ScTemplateSearchResult & result) const
+      noexcept(false);
+
+  /*!
+   * @brief Searches for sc-elements by object of `ScTemplate` and collects statistics of search.
+   *
+   * @param context A sc-memory context.
+   * @param result A result item to store the found elements.
+   * @param profile [out] Statistics of search.
+   * @return A result of the search.
+   * @throws utils::ExceptionInvalidParams if the parameters are invalid.
+   */
+  Result Search(ScMemoryContext & context, ScTemplateSearchResult & result, ScTemplateSearchProfile & profile) const
+      noexcept(false);
+
   /*!
    * @brief Searches for sc-elements by object of `ScTemplate` with callbacks.
    *
@@ -588,7 +672,8 @@ protected:
  * @brief Represents an item in the result of a sc-template operation.
  *
  * ScTemplateResultItem is used to store and manage the results of sc-template operations, providing access to the found
- * sc-elements.
+ * sc-elements. Items of ScTemplateSearchResult are views of its buffer: they don't copy found sc-addresses and keep
+ * the buffer alive. Copy of item owns its own sc-addresses.
  */
 class _SC_EXTERN ScTemplateResultItem
 {
@@ -596,6 +681,7 @@ class _SC_EXTERN ScTemplateResultItem
   friend class ScSet;
   friend class ScTemplateSearch;
   friend class ScTemplateSearchResult;
+  friend class ScTemplateSubscription;
 
 public:
   _SC_EXTERN ScTemplateResultItem();
@@ -606,6 +692,10 @@ public:
 
   _SC_EXTERN ScTemplateResultItem & operator=(ScTemplateResultItem const & otherItem);
 
+  _SC_EXTERN ScTemplateResultItem(ScTemplateResultItem && otherItem) noexcept;
+
+  _SC_EXTERN ScTemplateResultItem & operator=(ScTemplateResultItem && otherItem) noexcept;
+
   /*! Gets found sc-element address by `varAddr`.
    * @param varAddr A template var sc-element address
    * @param outAddr[out] A found sc-element address by `varAddr`
@@ -693,13 +783,29 @@ public:
   _SC_EXTERN ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & GetReplacements() const noexcept;
 
 protected:
+  using Replacements = ScTemplate::ScTemplateItemsToReplacementsItemsPositions;
+
+  ScTemplateResultItem(ScMemoryContext * context, ScAddrVector results, Replacements replacements);
   ScTemplateResultItem(
       ScMemoryContext * context,
       ScAddrVector results,
-      ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacements);
-  _SC_EXTERN ScTemplateResultItem(
+      std::shared_ptr<Replacements const> replacements);
+
+  /*!
+   * @brief Generates a non-owning view of found construction stored in buffer of search result.
+   *
+   * @param context A sc-memory context.
+   * @param constructions A buffer with found constructions stored one after another.
+   * @param offset A position of the first sc-address of found construction in buffer.
+   * @param size A size of found construction.
+   * @param replacements A map of template items to replacement item positions.
+   */
+  ScTemplateResultItem(
       ScMemoryContext * context,
-      ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacements);
+      std::shared_ptr<ScAddrVector const> constructions,
+      size_t offset,
+      size_t size,
+      std::shared_ptr<Replacements const> replacements);
 
   ScAddr GetAddrByName(std::string const & name) const;
 
@@ -707,8 +813,10 @@ protected:
 
   ScMemoryContext * m_context;
 
-  ScAddrVector m_replacementConstruction;  ///< A vector of sc-addresses that are results.
-  ScTemplate::ScTemplateItemsToReplacementsItemsPositions
+  std::shared_ptr<ScAddrVector const> m_replacementConstructions;  ///< A buffer with found construction.
+  size_t m_replacementConstructionOffset;  ///< A position of found construction in buffer.
+  size_t m_replacementConstructionSize;    ///< A size of found construction.
+  std::shared_ptr<Replacements const>
       m_templateItemsNamesToReplacementItemPositions;  ///< A map of template items to replacement item positions.
 };
 
@@ -781,14 +889,34 @@ public:
   template <typename FnT>
   _SC_EXTERN void ForEach(FnT && f) noexcept
   {
-    for (auto & res : m_replacementConstructions)
-      f(ScTemplateResultItem{m_context, res, m_templateItemsNamesToReplacementItemsPositions});
+    size_t const size = Size();
+    for (size_t i = 0; i < size; ++i)
+      f(ScTemplateResultItem{
+          m_context,
+          m_replacementConstructions,
+          i * m_replacementConstructionSize,
+          m_replacementConstructionSize,
+          m_templateItemsNamesToReplacementItemsPositions});
   }
 
 protected:
   ScMemoryContext * m_context = nullptr;
-  using SearchResults = std::vector<ScAddrVector>;
-  SearchResults m_replacementConstructions;  ///< A vector of replacement constructions.
-  ScTemplate::ScTemplateItemsToReplacementsItemsPositions
+  //! Found constructions stored one after another, each of them has `m_replacementConstructionSize` sc-addresses.
+  std::shared_ptr<ScAddrVector> m_replacementConstructions;
+  size_t m_replacementConstructionSize = 0;  ///< A size of one found construction.
+  std::shared_ptr<ScTemplate::ScTemplateItemsToReplacementsItemsPositions>
       m_templateItemsNamesToReplacementItemsPositions;  ///< A map of template items to replacement item positions.
+
+  //! Gets the first sc-address of found construction with specified index.
+  ScAddr * GetConstruction(size_t index) noexcept
+  {
+    return m_replacementConstructions->data() + index * m_replacementConstructionSize;
+  }
+
+  //! Appends found construction to buffer.
+  void AppendConstruction(ScAddr const * construction)
+  {
+    m_replacementConstructions->insert(
+        m_replacementConstructions->cend(), construction, construction + m_replacementConstructionSize);
+  }
 };
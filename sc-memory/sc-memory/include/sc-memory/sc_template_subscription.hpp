@@ -0,0 +1,177 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <mutex>
+#include <queue>
+#include <unordered_set>
+
+#include "sc_event_subscription.hpp"
+#include "sc_template.hpp"
+
+class ScAgentContext;
+
+/*!
+ * @class ScTemplateSubscription
+ * @brief Represents a continuous query by sc-template.
+ *
+ * ScTemplateSubscription keeps a set of sc-constructions found by sc-template and updates it from sc-events of
+ * generating and erasing sc-connectors, instead of searching by the whole sc-template again. Each template variable has
+ * a set of candidates: sc-elements reachable from fixed sc-elements of sc-template by connectors of its triples. All
+ * candidates are subscribed to sc-events. When new sc-connector of candidate fits some triple, sc-template is searched
+ * with this triple replaced by the sc-connector and its incident sc-elements (delta join), so only sc-constructions
+ * with the new sc-connector are found. When sc-connector of found sc-construction is erased, this sc-construction is
+ * removed.
+ *
+ * @note Delegates are called under lock of the subscription from sc-event threads, one at a time. Don't destroy the
+ * subscription in its delegates.
+ */
+class _SC_EXTERN ScTemplateSubscription final : public ScEventSubscription
+{
+  friend class ScAgentContext;
+
+  SC_DISALLOW_COPY_AND_MOVE(ScTemplateSubscription);
+
+public:
+  using DelegateFunc = std::function<void(ScTemplateResultItem const & item)>;
+
+  _SC_EXTERN ~ScTemplateSubscription() noexcept override;
+
+  /*!
+   * @brief Sets delegate called for each newly formed sc-construction.
+   * @param func A delegate function.
+   */
+  _SC_EXTERN void SetOnAddedDelegate(DelegateFunc && func) noexcept;
+
+  /*!
+   * @brief Sets delegate called for each broken sc-construction.
+   * @param func A delegate function.
+   */
+  _SC_EXTERN void SetOnRemovedDelegate(DelegateFunc && func) noexcept;
+
+  _SC_EXTERN void RemoveDelegate() noexcept override;
+
+  //! Sets priority of sc-events of all subscribed sc-elements, including ones that will be subscribed later.
+  _SC_EXTERN void SetPriority(ScEventPriority priority) noexcept override;
+
+  _SC_EXTERN ScEventPriority GetPriority() const noexcept override;
+
+  //! Collects latencies of sc-events of subscriptions to currently watched sc-elements.
+  _SC_EXTERN void CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept override;
+
+  /*!
+   * @brief Gets count of sc-constructions currently matched by sc-template.
+   * @return Count of matched sc-constructions.
+   */
+  _SC_EXTERN size_t GetMatchesCount() noexcept;
+
+protected:
+  _SC_EXTERN ScTemplateSubscription(
+      std::unique_ptr<ScAgentContext> context,
+      ScTemplate const & templ,
+      DelegateFunc const & onAddedFunc,
+      DelegateFunc const & onRemovedFunc) noexcept(false);
+
+private:
+  struct Variable
+  {
+    ScAddr m_fixedAddr;                ///< A sc-address of variable if it is fixed.
+    ScType m_type;                     ///< A sc-type to check candidates of variable.
+    ScAddrUnorderedSet m_candidates;   ///< Sc-elements that can be bound to variable.
+    std::vector<size_t> m_positions;   ///< Positions of variable in triples.
+    bool m_isWatched;                  ///< Whether variable is source or target of some triple.
+  };
+
+  struct ScAddrVectorHashFunc
+  {
+    size_t operator()(ScAddrVector const & construction) const;
+  };
+
+  struct ElementSubscriptions
+  {
+    size_t m_id;  ///< An identifier of subscriptions to distinguish them from subscriptions of reused sc-address.
+    std::shared_ptr<ScEventSubscription> m_generateConnectorSubscription;
+    std::shared_ptr<ScEventSubscription> m_eraseConnectorSubscription;
+    std::shared_ptr<ScEventSubscription> m_eraseElementSubscription;
+  };
+
+  using Triple = std::array<ScTemplateItem, 3>;
+  using Constructions = std::unordered_set<ScAddrVector, ScAddrVectorHashFunc>;
+
+  void ResolveVariables(ScTemplate const & templ);
+
+  void AddCandidate(size_t variableIdx, ScAddr const & addr);
+
+  void PropagateCandidate(size_t variableIdx, ScAddr const & addr, std::queue<std::pair<size_t, ScAddr>> & candidates);
+
+  bool IsTripleFit(
+      size_t tripleIdx,
+      ScAddr const & sourceAddr,
+      ScAddr const & connectorAddr,
+      ScType const & connectorType,
+      ScAddr const & targetAddr);
+
+  void SearchWithTriple(
+      size_t tripleIdx,
+      ScAddr const & sourceAddr,
+      ScAddr const & connectorAddr,
+      ScAddr const & targetAddr);
+
+  void AddConstruction(ScAddrVector const & construction, bool isNotified);
+
+  void RemoveConstructions(ScAddr const & addr);
+
+  void CheckConnector(ScAddr const & connectorAddr, ScType const & connectorType);
+
+  void CheckConnectorsOfCandidate(ScAddr const & addr);
+
+  void OnConnectorGenerated(ScAddr const & connectorAddr, ScType const & connectorType);
+
+  void OnElementErased(ScAddr const & addr, bool isConnectorErased);
+
+  void Notify(DelegateFunc const & func, ScAddrVector const & construction);
+
+  /*!
+   * Subscribes to sc-events of new candidates and then checks their sc-connectors generated before subscribing. It is
+   * called without lock, because subscribing locks sc-events table.
+   */
+  void WatchCandidates();
+
+  /*!
+   * Destroys subscriptions of erased sc-elements. It is called without lock from sc-event handler of watched sc-element
+   * with subscriptions `id`, because subscriptions wait for their sc-event handlers.
+   */
+  void PruneErasedElementsSubscriptions(ScAddr const & addr, size_t id);
+
+  std::unique_ptr<ScAgentContext> m_context;
+
+  std::vector<Triple> m_triples;
+  std::vector<bool> m_isTriplesRepeated;
+  std::vector<std::array<size_t, 3>> m_triplesVariables;
+  ScTemplate::ScTemplateItemsToReplacementsItemsPositions m_templateItemsNamesToReplacementItemsPositions;
+  std::vector<Variable> m_variables;
+
+  Constructions m_constructions;
+  ScAddrToValueUnorderedMap<std::unordered_set<ScAddrVector const *>> m_elementsConstructions;
+
+  ScAddrVector m_unwatchedCandidates;
+  ScAddrToValueUnorderedMap<ElementSubscriptions> m_watchedElements;
+  std::vector<ElementSubscriptions> m_erasedElementsSubscriptions;
+  size_t m_lastElementSubscriptionsId = 0;
+
+  DelegateFunc m_onAddedDelegate;
+  DelegateFunc m_onRemovedDelegate;
+
+  std::atomic<ScEventPriority> m_priority = ScEventPriority::Normal;
+
+  mutable std::mutex m_mutex;
+  bool m_isDestroying = false;
+};
+
+SHARED_PTR_TYPE(ScTemplateSubscription);
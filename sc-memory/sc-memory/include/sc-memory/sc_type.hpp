@@ -30,6 +30,8 @@ class _SC_EXTERN ScType
   friend class ScMemoryContext;
   template <class TScEvent>
   friend class ScElementaryEventSubscription;
+  template <class TScEvent>
+  friend class ScGlobalEventSubscription;
   friend class scs::Parser;
   friend class ScMemoryGenerateElementsJsonAction;
   friend class ScMemoryHandleKeynodesJsonAction;
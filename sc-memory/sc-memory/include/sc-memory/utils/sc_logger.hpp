@@ -161,6 +161,16 @@ public:
    */
   static ScLogType DefineLogType(std::string const & logType);
 
+  /*!
+   * @brief Checks whether messages with the specified severity level are logged.
+   *
+   * Logging methods and macros check it before formatting messages, so disabled messages don't build any strings.
+   *
+   * @param logLevel A severity level of the message.
+   * @return True if logging isn't muted and the level meets the current logging threshold; otherwise, false.
+   */
+  bool IsEnabled(ScLogLevel const & logLevel) const;
+
   /*!
    * @brief Logs a message with a specific severity level and optional color formatting for console output.
    *
@@ -246,16 +256,19 @@ static utils::ScLogger ms_globalLogger;
  * Macro for logging messages with color support in console output
  *
  * This macro takes in a type (log level), a message, and color,
- * constructs a stringstream for formatting, and sends it through
+ * constructs a stringstream for formatting if the level is enabled, and sends it through
  * ms_globalLogger's Message method with appropriate parameters
  *
  * Usage: SC_LOG_COLOR(logLevel, "Your Message", Color);
  */
 #define SC_LOG_COLOR(__type, __message, __color) \
   { \
-    std::stringstream ss; \
-    ss << __message; \
-    ms_globalLogger.Message(__type, ss.str(), __color); \
+    if (ms_globalLogger.IsEnabled(__type)) \
+    { \
+      std::stringstream ss; \
+      ss << __message; \
+      ms_globalLogger.Message(__type, ss.str(), __color); \
+    } \
   }
 
 /*!
@@ -7,6 +7,7 @@
 #include "sc-memory/sc_action.hpp"
 
 #include "sc-memory/sc_agent_context.hpp"
+#include "sc-memory/sc_action_completion_registry.hpp"
 #include "sc-memory/sc_result.hpp"
 #include "sc-memory/sc_event_wait.hpp"
 #include "sc-memory/sc_structure.hpp"
@@ -170,15 +171,12 @@ bool ScAction::InitiateAndWait(sc_uint32 maxCustomerWaitingTime) noexcept(false)
         "Not able to initiate and wait action " << GetActionPrettyString() << GetActionClassPrettyString()
                                                 << " because it had already been finished.");
 
-  auto wait = std::shared_ptr<ScWaiterActionFinished>(new ScWaiterActionFinished(*m_context, *this));
-  wait->SetOnWaitStartDelegate(
-      [this, &maxCustomerWaitingTime]()
-      {
-        if (!m_context->IsElement(GetMaxCustomerWaitingTimeLink()))
-          GenerateMaxCustomerWaitingTime(maxCustomerWaitingTime);
-        m_context->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::action_initiated, *this);
-      });
-  return wait->Wait(maxCustomerWaitingTime);
+  if (!m_context->IsElement(GetMaxCustomerWaitingTimeLink()))
+    GenerateMaxCustomerWaitingTime(maxCustomerWaitingTime);
+  m_context->GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::action_initiated, *this);
+
+  // Registry checks finish of action after registration of wait, so action finished before it isn't missed.
+  return ScActionCompletionRegistry::WaitAll({*this}, maxCustomerWaitingTime);
 }
 
 ScAction & ScAction::Initiate() noexcept(false)
@@ -277,6 +275,118 @@ ScResult ScAction::FinishWithError() noexcept(false)
   return SC_RESULT_ERROR;
 }
 
+ScResult ScAction::AwaitAll(
+    ScAddrVector const & actionAddrs,
+    ScActionContinuation const & continuation,
+    sc_uint32 waitTime) noexcept(false)
+{
+  ValidateSuspending();
+  ScActionCompletionRegistry::WaitAsync(actionAddrs, actionAddrs.size(), GetResumption(continuation), waitTime);
+  return ScResult(SC_RESULT_OK, true);
+}
+
+ScResult ScAction::AwaitAny(
+    ScAddrVector const & actionAddrs,
+    ScActionContinuation const & continuation,
+    sc_uint32 waitTime) noexcept(false)
+{
+  ValidateSuspending();
+  ScActionCompletionRegistry::WaitAsync(actionAddrs, 1, GetResumption(continuation), waitTime);
+  return ScResult(SC_RESULT_OK, true);
+}
+
+ScResult ScAction::AwaitTime(sc_uint32 waitTime, ScActionContinuation const & continuation) noexcept(false)
+{
+  ValidateSuspending();
+  ScActionCompletionRegistry::ScheduleAsync(waitTime, GetResumption(continuation));
+  return ScResult(SC_RESULT_OK, true);
+}
+
+ScActionCompletionRegistry::AsyncCallback ScAction::GetResumption(
+    ScActionContinuation const & continuation) const noexcept
+{
+  ScAddr const actionAddr = *this;
+  ScAddr const userAddr = m_context->GetUser();
+  return [actionAddr, userAddr, continuation](ScActionCompletionRegistry::WaitState state, ScAddr const &)
+  {
+    if (state == ScActionCompletionRegistry::WaitState::Cancelled)
+      Cancel(actionAddr, userAddr);
+    else
+      Continue(actionAddr, userAddr, continuation, state == ScActionCompletionRegistry::WaitState::TimedOut);
+  };
+}
+
+void ScAction::ValidateSuspending() const noexcept(false)
+{
+  if (!IsInitiated())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to suspend action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                      << " because it had not been initiated yet.");
+
+  if (IsFinished())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to suspend action " << GetActionPrettyString() << GetActionClassPrettyString()
+                                      << " because it had already been finished.");
+}
+
+void ScAction::Continue(
+    ScAddr const & actionAddr,
+    ScAddr const & userAddr,
+    ScActionContinuation const & continuation,
+    bool isTimedOut) noexcept
+{
+  ScAgentContext context{userAddr};
+  try
+  {
+    ScAction action = context.ConvertToAction(actionAddr);
+    try
+    {
+      continuation(context, action, isTimedOut);
+    }
+    catch (utils::ScException const & exception)
+    {
+      SC_LOG_ERROR(
+          "Action " << action.GetActionPrettyString() << action.GetActionClassPrettyString()
+                    << " was finished because error was occurred in its continuation.\nError description:\n"
+                    << exception.Description());
+      if (!action.IsFinished())
+        action.FinishWithError();
+    }
+  }
+  catch (utils::ScException const & exception)
+  {
+    SC_LOG_ERROR(
+        "Not able to continue performing of action `" << actionAddr.Hash()
+                                                      << "` because error was occurred.\nError description:\n"
+                                                      << exception.Description());
+  }
+}
+
+void ScAction::Cancel(ScAddr const & actionAddr, ScAddr const & userAddr) noexcept
+{
+  ScAgentContext context{userAddr};
+  try
+  {
+    ScAction action = context.ConvertToAction(actionAddr);
+    if (action.IsFinished())
+      return;
+
+    SC_LOG_WARNING(
+        "Action " << action.GetActionPrettyString() << action.GetActionClassPrettyString()
+                  << " was finished unsuccessfully because sc-memory was shut down while it was suspended.");
+    action.FinishUnsuccessfully();
+  }
+  catch (utils::ScException const & exception)
+  {
+    SC_LOG_ERROR(
+        "Not able to finish suspended action `" << actionAddr.Hash()
+                                                << "` because error was occurred.\nError description:\n"
+                                                << exception.Description());
+  }
+}
+
 std::string ScAction::GetActionPrettyString() const
 {
   std::string actionName = m_context->GetElementSystemIdentifier(*this);
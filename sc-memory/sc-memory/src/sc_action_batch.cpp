@@ -0,0 +1,59 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_action_batch.hpp"
+
+#include "sc-memory/sc_agent_context.hpp"
+#include "sc-memory/sc_action_completion_registry.hpp"
+#include "sc-memory/sc_keynodes.hpp"
+
+ScActionBatch::ScActionBatch(ScAddr const & userAddr, ScAddrVector && actionAddrs) noexcept
+  : m_userAddr(userAddr)
+  , m_actionAddrs(std::move(actionAddrs))
+{
+}
+
+ScAddrVector const & ScActionBatch::GetActions() const noexcept
+{
+  return m_actionAddrs;
+}
+
+bool ScActionBatch::WaitAll(sc_uint32 waitTime) const noexcept(false)
+{
+  return ScActionCompletionRegistry::WaitAll(m_actionAddrs, waitTime);
+}
+
+std::vector<ScActionBatch::ActionResult> ScActionBatch::GetResults() const noexcept(false)
+{
+  // batch may outlive context that generated it
+  ScAgentContext context{m_userAddr};
+
+  std::vector<ActionResult> results;
+  results.reserve(m_actionAddrs.size());
+  for (ScAddr const & actionAddr : m_actionAddrs)
+  {
+    ActionResult result{actionAddr, ActionState::NotFinished, ScAddr::Empty};
+    if (context.CheckConnector(ScKeynodes::action_finished, actionAddr, ScType::ConstPermPosArc))
+    {
+      if (context.CheckConnector(ScKeynodes::action_finished_successfully, actionAddr, ScType::ConstPermPosArc))
+        result.m_state = ActionState::FinishedSuccessfully;
+      else if (context.CheckConnector(
+                   ScKeynodes::action_finished_unsuccessfully, actionAddr, ScType::ConstPermPosArc))
+        result.m_state = ActionState::FinishedUnsuccessfully;
+      else if (context.CheckConnector(ScKeynodes::action_finished_with_error, actionAddr, ScType::ConstPermPosArc))
+        result.m_state = ActionState::FinishedWithError;
+      else
+        result.m_state = ActionState::Finished;
+
+      ScIterator5Ptr const it5 = context.CreateIterator5(
+          actionAddr, ScType::ConstCommonArc, ScType::Unknown, ScType::ConstPermPosArc, ScKeynodes::nrel_result);
+      if (it5->Next())
+        result.m_resultAddr = it5->Get(2);
+    }
+    results.push_back(result);
+  }
+  return results;
+}
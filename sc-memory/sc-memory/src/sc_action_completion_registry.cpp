@@ -0,0 +1,721 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_action_completion_registry.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "sc-memory/sc_memory.hpp"
+#include "sc-memory/sc_keynodes.hpp"
+#include "sc-memory/sc_event_subscription.hpp"
+#include "sc-memory/sc_agent_metrics.hpp"
+
+//! Shared state of one wait for several actions.
+struct ScActionCompletionRegistry::Waiter
+{
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  size_t m_remainingActionsCount = 0;  ///< Number of actions that must be finished to end wait.
+  ScAddr m_finishedActionAddr;         ///< The first finished action.
+
+  void OnActionFinished(ScAddr const & actionAddr) noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_finishedActionAddr.IsValid())
+      m_finishedActionAddr = actionAddr;
+    if (m_remainingActionsCount > 0 && --m_remainingActionsCount == 0)
+      m_condition.notify_all();
+  }
+
+  bool Wait(sc_uint32 waitTime) noexcept
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // worker thread blocked here doesn't process sc-events, so adaptive pool may start another one
+    sc_memory_wait_point_begin();
+    auto const waitBeginTime = std::chrono::steady_clock::now();
+    bool const result = m_condition.wait_for(
+        lock,
+        std::chrono::milliseconds(waitTime),
+        [this]()
+        {
+          return m_remainingActionsCount == 0;
+        });
+    ScAgentMetrics::AddThreadWaitingTime(
+        std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitBeginTime)
+            .count());
+    sc_memory_wait_point_end();
+    return result;
+  }
+};
+
+//! Shared state of one asynchronous wait for several actions.
+struct ScActionCompletionRegistry::AsyncWaiter
+{
+  std::mutex m_mutex;
+  size_t m_remainingActionsCount = 0;                      ///< Number of actions that must be finished to resume.
+  bool m_isResumed = false;                                ///< Whether callback has already been called.
+  std::vector<std::pair<ScAddr, size_t>> m_registrations;  ///< Callbacks registered for actions.
+  size_t m_deadlineId = 0;                                 ///< Deadline scheduled for wait time.
+  AsyncCallback m_callback;
+};
+
+class ScActionCompletionRegistry::Registry
+{
+public:
+  using ScEventFinishAction = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+  //! Identifiers of callbacks registered for actions.
+  using Registrations = std::vector<std::pair<ScAddr, size_t>>;
+  //! Callback of deadline. It gets true if sc-memory is shut down before wait time is over.
+  using DeadlineCallback = std::function<void(bool isCancelled)>;
+
+  ~Registry() noexcept
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_deadlinesMutex);
+      m_isStopped = true;
+      m_deadlinesCondition.notify_all();
+    }
+    if (m_deadlinesThread.joinable())
+      m_deadlinesThread.join();
+
+    // suspended waits are cancelled, so their actions aren't left unfinished after shutdown
+    Deadlines deadlines;
+    {
+      std::lock_guard<std::mutex> lock(m_deadlinesMutex);
+      deadlines = std::move(m_deadlines);
+      m_deadlinesIterators.clear();
+    }
+    for (auto const & [_, deadline] : deadlines)
+      Call(deadline.second, true);
+
+    {
+      std::unique_lock<std::mutex> lock(m_deadlinesMutex);
+      m_deadlinesCondition.wait(
+          lock,
+          [this]()
+          {
+            return m_postedDeadlinesCount == 0;
+          });
+    }
+
+    // subscriptions wait for their handlers, so they are destroyed without lock
+    std::unique_ptr<ScElementaryEventSubscription<ScEventFinishAction>> subscription;
+    EraseSubscriptions eraseSubscriptions;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      subscription = std::move(m_subscription);
+      for (auto & [_, watch] : m_erasureWatches)
+        m_unusedEraseSubscriptions.push_back(std::move(watch.m_subscription));
+      m_erasureWatches.clear();
+      eraseSubscriptions = std::move(m_unusedEraseSubscriptions);
+    }
+  }
+
+  /*!
+   * @brief Registers callback for finish of actions.
+   * @param actionAddrs Sc-addresses of actions.
+   * @param callback Callback called once for each finished action.
+   * @param isErasureWatched Whether callbacks are discarded when actions are erased. It is used by long waits that
+   * aren't limited by wait time. Each action is subscribed to its erasure while it has such callbacks.
+   * @return Identifiers of registered callbacks.
+   */
+  Registrations Register(
+      ScAddrUnorderedSet const & actionAddrs,
+      CompletionCallback const & callback,
+      bool isErasureWatched = false) noexcept(false)
+  {
+    for (ScAddr const & actionAddr : actionAddrs)
+    {
+      if (!m_context.IsElement(actionAddr))
+        SC_THROW_EXCEPTION(
+            utils::ExceptionInvalidParams,
+            "Not able to wait finish of action `" << actionAddr.Hash() << "` because it is not valid.");
+    }
+
+    Registrations registrations;
+    registrations.reserve(actionAddrs.size());
+    EraseSubscriptions unusedEraseSubscriptions;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      unusedEraseSubscriptions = std::move(m_unusedEraseSubscriptions);
+      if (m_subscription == nullptr)
+        m_subscription.reset(new ScElementaryEventSubscription<ScEventFinishAction>(
+            m_context,
+            ScKeynodes::action_finished,
+            [this](ScEventFinishAction const & event)
+            {
+              Complete(event.GetOtherElement());
+            }));
+
+      // actions are subscribed before callbacks are added, so action erased at the moment leaves no callbacks
+      if (isErasureWatched)
+        WatchErasure(actionAddrs);
+
+      for (ScAddr const & actionAddr : actionAddrs)
+      {
+        size_t const id = ++m_lastCallbackId;
+        m_actionsToCallbacks[actionAddr].emplace_back(id, callback);
+        registrations.emplace_back(actionAddr, id);
+        if (isErasureWatched)
+          m_erasureWatches[actionAddr].m_callbackIds.insert(id);
+      }
+    }
+
+    // Actions finished before registration don't emit sc-events anymore, so they are completed here. Actions finished
+    // after registration are completed by the first of sc-event and this check.
+    for (ScAddr const & actionAddr : actionAddrs)
+    {
+      if (m_context.CheckConnector(ScKeynodes::action_finished, actionAddr, ScType::ConstPermPosArc))
+        Complete(actionAddr);
+    }
+
+    return registrations;
+  }
+
+  void Unregister(Registrations const & registrations) noexcept
+  {
+    EraseSubscriptions unusedEraseSubscriptions;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    for (auto const & [actionAddr, id] : registrations)
+    {
+      UnwatchErasure(actionAddr, id);
+
+      auto const & it = m_actionsToCallbacks.find(actionAddr);
+      if (it == m_actionsToCallbacks.cend())
+        continue;
+
+      Callbacks & callbacks = it->second;
+      for (auto callbackIt = callbacks.begin(); callbackIt != callbacks.end(); ++callbackIt)
+      {
+        if (callbackIt->first == id)
+        {
+          callbacks.erase(callbackIt);
+          break;
+        }
+      }
+      if (callbacks.empty())
+        m_actionsToCallbacks.erase(it);
+    }
+    unusedEraseSubscriptions = std::move(m_unusedEraseSubscriptions);
+  }
+
+  size_t GetWaitedActionsCount() noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_actionsToCallbacks.size();
+  }
+
+  void WaitAsync(
+      ScAddrUnorderedSet const & actionAddrs,
+      size_t requiredActionsCount,
+      AsyncCallback const & callback,
+      sc_uint32 waitTime) noexcept(false)
+  {
+    auto const waiter = std::make_shared<AsyncWaiter>();
+    waiter->m_remainingActionsCount = requiredActionsCount;
+    waiter->m_callback = callback;
+
+    auto const & registrations = Register(
+        actionAddrs,
+        [this, waiter](ScAddr const & actionAddr)
+        {
+          {
+            std::lock_guard<std::mutex> lock(waiter->m_mutex);
+            if (waiter->m_isResumed || --waiter->m_remainingActionsCount > 0)
+              return;
+            waiter->m_isResumed = true;
+          }
+          Resume(*waiter, WaitState::Finished, actionAddr);
+        });
+
+    // Wait may be resumed during registration, then its callbacks are unregistered here.
+    bool isResumed;
+    {
+      std::lock_guard<std::mutex> lock(waiter->m_mutex);
+      isResumed = waiter->m_isResumed;
+      if (!isResumed)
+        waiter->m_registrations = registrations;
+    }
+    if (isResumed)
+    {
+      Unregister(registrations);
+      return;
+    }
+
+    size_t const deadlineId = Schedule(
+        waitTime,
+        [this, waiter](bool isCancelled)
+        {
+          {
+            std::lock_guard<std::mutex> lock(waiter->m_mutex);
+            if (waiter->m_isResumed)
+              return;
+            waiter->m_isResumed = true;
+          }
+          Resume(*waiter, isCancelled ? WaitState::Cancelled : WaitState::TimedOut, ScAddr::Empty);
+        });
+
+    // Wait may be resumed before its deadline is scheduled, then deadline is removed here.
+    {
+      std::lock_guard<std::mutex> lock(waiter->m_mutex);
+      isResumed = waiter->m_isResumed;
+      if (!isResumed)
+        waiter->m_deadlineId = deadlineId;
+    }
+    if (isResumed)
+      Cancel(deadlineId);
+  }
+
+  /*!
+   * @brief Schedules callback. It is posted to worker threads of sc-events when wait time is over, or it is called
+   * with true when registry is destroyed.
+   * @return Identifier of deadline, or 0 if registry is destroyed and callback has already been called.
+   */
+  size_t Schedule(sc_uint32 waitTime, DeadlineCallback const & callback) noexcept
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_deadlinesMutex);
+      if (!m_isStopped)
+      {
+        if (!m_deadlinesThread.joinable())
+          m_deadlinesThread = std::thread(&Registry::ProcessDeadlines, this);
+
+        size_t const id = ++m_lastDeadlineId;
+        auto const & it = m_deadlines.emplace(
+            std::chrono::steady_clock::now() + std::chrono::milliseconds(waitTime), std::make_pair(id, callback));
+        m_deadlinesIterators.emplace(id, it);
+        m_deadlinesCondition.notify_all();
+        return id;
+      }
+    }
+
+    Call(callback, true);
+    return 0;
+  }
+
+  //! Removes deadline if its callback hasn't been posted yet.
+  void Cancel(size_t deadlineId) noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_deadlinesMutex);
+    auto const & it = m_deadlinesIterators.find(deadlineId);
+    if (it == m_deadlinesIterators.cend())
+      return;
+
+    m_deadlines.erase(it->second);
+    m_deadlinesIterators.erase(it);
+  }
+
+private:
+  using Callbacks = std::vector<std::pair<size_t, CompletionCallback>>;
+  using EraseSubscription = ScElementaryEventSubscription<ScEventBeforeEraseElement>;
+  using EraseSubscriptions = std::vector<std::unique_ptr<EraseSubscription>>;
+  using Deadlines = std::multimap<std::chrono::steady_clock::time_point, std::pair<size_t, DeadlineCallback>>;
+
+  //! Subscription to erasure of action and identifiers of its callbacks discarded when action is erased.
+  struct ErasureWatch
+  {
+    std::unique_ptr<EraseSubscription> m_subscription;
+    std::unordered_set<size_t> m_callbackIds;
+  };
+
+  //! Deadline callback posted to worker threads of sc-events.
+  struct DeadlineTask
+  {
+    Registry * m_registry;
+    DeadlineCallback m_callback;
+  };
+
+  void Complete(ScAddr const & actionAddr) noexcept
+  {
+    Callbacks callbacks;
+    EraseSubscriptions unusedEraseSubscriptions;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      UnwatchErasure(actionAddr);
+      unusedEraseSubscriptions = std::move(m_unusedEraseSubscriptions);
+
+      auto const & it = m_actionsToCallbacks.find(actionAddr);
+      if (it == m_actionsToCallbacks.cend())
+        return;
+
+      callbacks = std::move(it->second);
+      m_actionsToCallbacks.erase(it);
+    }
+
+    for (auto const & [_, callback] : callbacks)
+      callback(actionAddr);
+  }
+
+  //! Removes callbacks of erased action, so they aren't called when its sc-address is reused.
+  void Discard(ScAddr const & actionAddr) noexcept
+  {
+    Callbacks callbacks;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      // it is called by subscription of action, so the subscription is destroyed later by other calls
+      UnwatchErasure(actionAddr);
+
+      auto const & it = m_actionsToCallbacks.find(actionAddr);
+      if (it == m_actionsToCallbacks.cend())
+        return;
+
+      callbacks = std::move(it->second);
+      m_actionsToCallbacks.erase(it);
+    }
+    // futures of erased action get `broken_promise` when callbacks are destroyed here
+  }
+
+  //! Subscribes actions to their erasure if they aren't subscribed. It is called under lock.
+  void WatchErasure(ScAddrUnorderedSet const & actionAddrs) noexcept(false)
+  {
+    ScAddrVector watchedActionAddrs;
+    try
+    {
+      for (ScAddr const & actionAddr : actionAddrs)
+      {
+        if (m_erasureWatches.find(actionAddr) != m_erasureWatches.cend())
+          continue;
+
+        m_erasureWatches[actionAddr].m_subscription = std::unique_ptr<EraseSubscription>(new EraseSubscription(
+            m_context,
+            actionAddr,
+            [this](ScEventBeforeEraseElement const & event)
+            {
+              Discard(event.GetSubscriptionElement());
+            }));
+        watchedActionAddrs.push_back(actionAddr);
+      }
+    }
+    catch (utils::ScException const &)
+    {
+      // actions subscribed by this call have no callbacks yet
+      for (ScAddr const & actionAddr : watchedActionAddrs)
+        UnwatchErasure(actionAddr);
+      throw;
+    }
+  }
+
+  /*!
+   * @brief Removes callback from callbacks discarded on erasure of action. Action is unsubscribed from its erasure
+   * when it has no such callbacks. It is called under lock.
+   * @param callbackId Identifier of callback, or 0 to remove all callbacks of action.
+   */
+  void UnwatchErasure(ScAddr const & actionAddr, size_t callbackId = 0) noexcept
+  {
+    auto const & it = m_erasureWatches.find(actionAddr);
+    if (it == m_erasureWatches.cend())
+      return;
+
+    std::unordered_set<size_t> & callbackIds = it->second.m_callbackIds;
+    if (callbackId != 0 && (callbackIds.erase(callbackId) == 0 || !callbackIds.empty()))
+      return;
+
+    // subscriptions wait for their handlers, so unused ones are destroyed after lock is released
+    m_unusedEraseSubscriptions.push_back(std::move(it->second.m_subscription));
+    m_erasureWatches.erase(it);
+  }
+
+  void Resume(AsyncWaiter & waiter, WaitState state, ScAddr const & actionAddr) noexcept
+  {
+    Registrations registrations;
+    size_t deadlineId;
+    {
+      std::lock_guard<std::mutex> lock(waiter.m_mutex);
+      registrations = std::move(waiter.m_registrations);
+      deadlineId = waiter.m_deadlineId;
+    }
+    Unregister(registrations);
+    Cancel(deadlineId);
+
+    try
+    {
+      waiter.m_callback(state, actionAddr);
+    }
+    catch (utils::ScException const & e)
+    {
+      SC_LOG_ERROR("ScActionCompletionRegistry: Uncaught exception in callback: " << e.Message());
+    }
+  }
+
+  static void Call(DeadlineCallback const & callback, bool isCancelled) noexcept
+  {
+    try
+    {
+      callback(isCancelled);
+    }
+    catch (utils::ScException const & e)
+    {
+      SC_LOG_ERROR("ScActionCompletionRegistry: Uncaught exception in callback: " << e.Message());
+    }
+  }
+
+  //! Posts callback of deadline to worker threads of sc-events, so long callbacks don't delay other deadlines.
+  void Post(DeadlineCallback const & callback) noexcept
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_deadlinesMutex);
+      ++m_postedDeadlinesCount;
+    }
+
+    auto * task = new DeadlineTask{this, callback};
+    if (sc_memory_post_task(RunDeadlineTask, task) != SC_RESULT_OK)
+      RunDeadlineTask(task, SC_FALSE);
+  }
+
+  static void RunDeadlineTask(sc_pointer data, sc_bool isCancelled) noexcept
+  {
+    std::unique_ptr<DeadlineTask> const task{static_cast<DeadlineTask *>(data)};
+    Call(task->m_callback, isCancelled);
+
+    Registry * registry = task->m_registry;
+    std::lock_guard<std::mutex> lock(registry->m_deadlinesMutex);
+    if (--registry->m_postedDeadlinesCount == 0)
+      registry->m_deadlinesCondition.notify_all();
+  }
+
+  void ProcessDeadlines() noexcept
+  {
+    std::unique_lock<std::mutex> lock(m_deadlinesMutex);
+    while (!m_isStopped)
+    {
+      if (m_deadlines.empty())
+      {
+        m_deadlinesCondition.wait(lock);
+        continue;
+      }
+
+      auto const it = m_deadlines.begin();
+      if (it->first > std::chrono::steady_clock::now())
+      {
+        m_deadlinesCondition.wait_until(lock, it->first);
+        continue;
+      }
+
+      DeadlineCallback const callback = std::move(it->second.second);
+      m_deadlinesIterators.erase(it->second.first);
+      m_deadlines.erase(it);
+
+      lock.unlock();
+      Post(callback);
+      lock.lock();
+    }
+  }
+
+  ScMemoryContext m_context;
+  std::mutex m_mutex;
+  ScAddrToValueUnorderedMap<Callbacks> m_actionsToCallbacks;
+  size_t m_lastCallbackId = 0;
+  std::unique_ptr<ScElementaryEventSubscription<ScEventFinishAction>> m_subscription;
+  ScAddrToValueUnorderedMap<ErasureWatch> m_erasureWatches;
+  EraseSubscriptions m_unusedEraseSubscriptions;
+
+  std::mutex m_deadlinesMutex;
+  std::condition_variable m_deadlinesCondition;
+  Deadlines m_deadlines;
+  std::unordered_map<size_t, Deadlines::iterator> m_deadlinesIterators;
+  size_t m_lastDeadlineId = 0;
+  size_t m_postedDeadlinesCount = 0;  ///< Number of deadline callbacks posted and not finished yet.
+  std::thread m_deadlinesThread;      ///< Timer thread, it is started by the first asynchronous wait.
+  bool m_isStopped = false;
+};
+
+std::shared_ptr<ScActionCompletionRegistry::Registry> ScActionCompletionRegistry::ms_registry;
+
+ScActionCompletionRegistry::ScFinishedFuture::ScFinishedFuture(
+    std::shared_future<ScAddr> && future,
+    std::shared_ptr<void> const & registration) noexcept
+  : m_future(std::move(future))
+  , m_registration(registration)
+{
+}
+
+ScAddr const & ScActionCompletionRegistry::ScFinishedFuture::get() const noexcept(false)
+{
+  return m_future.get();
+}
+
+void ScActionCompletionRegistry::ScFinishedFuture::wait() const noexcept(false)
+{
+  m_future.wait();
+}
+
+bool ScActionCompletionRegistry::ScFinishedFuture::valid() const noexcept
+{
+  return m_future.valid();
+}
+
+void ScActionCompletionRegistry::Initialize() noexcept
+{
+  ms_registry = std::make_shared<Registry>();
+}
+
+void ScActionCompletionRegistry::Shutdown() noexcept
+{
+  ms_registry.reset();
+}
+
+ScActionCompletionRegistry::Registry & ScActionCompletionRegistry::GetRegistry() noexcept(false)
+{
+  if (ms_registry == nullptr)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to wait finish of actions because sc-memory isn't initialized.");
+
+  return *ms_registry;
+}
+
+ScActionCompletionRegistry::ScFinishedFuture ScActionCompletionRegistry::GetFinishedFuture(
+    ScAddr const & actionAddr) noexcept(false)
+{
+  auto const promise = std::make_shared<std::promise<ScAddr>>();
+  std::shared_future<ScAddr> future = promise->get_future().share();
+  auto const & registrations = GetRegistry().Register(
+      {actionAddr},
+      [promise](ScAddr const & finishedActionAddr)
+      {
+        promise->set_value(finishedActionAddr);
+      },
+      true);
+
+  // registration has no object, its deleter is called when the last copy of future is destroyed
+  std::weak_ptr<Registry> const registry = ms_registry;
+  std::shared_ptr<void> const registration(
+      nullptr,
+      [registry, registrations](void *)
+      {
+        if (auto const actionsRegistry = registry.lock())
+          actionsRegistry->Unregister(registrations);
+      });
+  return ScFinishedFuture{std::move(future), registration};
+}
+
+bool ScActionCompletionRegistry::WaitAll(ScAddrVector const & actionAddrs, sc_uint32 waitTime) noexcept(false)
+{
+  ScAddrUnorderedSet const uniqueActionAddrs{actionAddrs.cbegin(), actionAddrs.cend()};
+  if (uniqueActionAddrs.empty())
+    return true;
+
+  auto const waiter = std::make_shared<Waiter>();
+  waiter->m_remainingActionsCount = uniqueActionAddrs.size();
+
+  Registry & actionsRegistry = GetRegistry();
+  auto const & registrations = actionsRegistry.Register(
+      uniqueActionAddrs,
+      [waiter](ScAddr const & actionAddr)
+      {
+        waiter->OnActionFinished(actionAddr);
+      });
+  bool const result = waiter->Wait(waitTime);
+  actionsRegistry.Unregister(registrations);
+  return result;
+}
+
+ScAddr ScActionCompletionRegistry::WaitAny(ScAddrVector const & actionAddrs, sc_uint32 waitTime) noexcept(false)
+{
+  ScAddrUnorderedSet const uniqueActionAddrs{actionAddrs.cbegin(), actionAddrs.cend()};
+  if (uniqueActionAddrs.empty())
+    return ScAddr::Empty;
+
+  auto const waiter = std::make_shared<Waiter>();
+  waiter->m_remainingActionsCount = 1;
+
+  Registry & actionsRegistry = GetRegistry();
+  auto const & registrations = actionsRegistry.Register(
+      uniqueActionAddrs,
+      [waiter](ScAddr const & actionAddr)
+      {
+        waiter->OnActionFinished(actionAddr);
+      });
+  bool const result = waiter->Wait(waitTime);
+  actionsRegistry.Unregister(registrations);
+
+  if (!result)
+    return ScAddr::Empty;
+
+  std::lock_guard<std::mutex> lock(waiter->m_mutex);
+  return waiter->m_finishedActionAddr;
+}
+
+void ScActionCompletionRegistry::WaitAllAsync(
+    ScAddrVector const & actionAddrs,
+    std::function<void(bool isFinished)> const & callback,
+    sc_uint32 waitTime) noexcept(false)
+{
+  WaitAsync(
+      actionAddrs,
+      actionAddrs.size(),
+      [callback](WaitState state, ScAddr const &)
+      {
+        callback(state == WaitState::Finished);
+      },
+      waitTime);
+}
+
+void ScActionCompletionRegistry::WaitAnyAsync(
+    ScAddrVector const & actionAddrs,
+    std::function<void(ScAddr const & finishedActionAddr)> const & callback,
+    sc_uint32 waitTime) noexcept(false)
+{
+  WaitAsync(
+      actionAddrs,
+      1,
+      [callback](WaitState, ScAddr const & actionAddr)
+      {
+        callback(actionAddr);
+      },
+      waitTime);
+}
+
+void ScActionCompletionRegistry::WaitTimeAsync(
+    sc_uint32 waitTime,
+    std::function<void()> const & callback) noexcept(false)
+{
+  ScheduleAsync(
+      waitTime,
+      [callback](WaitState state, ScAddr const &)
+      {
+        if (state == WaitState::TimedOut)
+          callback();
+      });
+}
+
+void ScActionCompletionRegistry::WaitAsync(
+    ScAddrVector const & actionAddrs,
+    size_t requiredActionsCount,
+    AsyncCallback const & callback,
+    sc_uint32 waitTime) noexcept(false)
+{
+  ScAddrUnorderedSet const uniqueActionAddrs{actionAddrs.cbegin(), actionAddrs.cend()};
+  Registry & actionsRegistry = GetRegistry();
+  requiredActionsCount = std::min(requiredActionsCount, uniqueActionAddrs.size());
+  if (requiredActionsCount == 0)
+    return callback(WaitState::Finished, ScAddr::Empty);
+
+  actionsRegistry.WaitAsync(uniqueActionAddrs, requiredActionsCount, callback, waitTime);
+}
+
+void ScActionCompletionRegistry::ScheduleAsync(sc_uint32 waitTime, AsyncCallback const & callback) noexcept(false)
+{
+  GetRegistry().Schedule(
+      waitTime,
+      [callback](bool isCancelled)
+      {
+        callback(isCancelled ? WaitState::Cancelled : WaitState::TimedOut, ScAddr::Empty);
+      });
+}
+
+size_t ScActionCompletionRegistry::GetWaitedActionsCount() noexcept
+{
+  return ms_registry == nullptr ? 0 : ms_registry->GetWaitedActionsCount();
+}
@@ -0,0 +1,272 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_action_dispatcher.hpp"
+
+#include <array>
+#include <mutex>
+#include <shared_mutex>
+#include <vector>
+
+#include "sc-memory/sc_memory.hpp"
+#include "sc-memory/sc_keynodes.hpp"
+
+struct ScActionDispatcherSubscription::Entry
+{
+  ScAddr m_actionClassAddr;
+  ScEventPriority m_priority = ScEventPriority::Normal;
+
+  DelegateFunc m_delegate;
+  //! It is locked shared while delegate is called and unique while delegate is changed.
+  std::shared_mutex m_mutex;
+};
+
+class ScActionDispatcherSubscription::Dispatcher
+{
+public:
+  using Entries = std::vector<std::shared_ptr<Entry>>;
+  using Subscription = ScElementaryEventSubscription<ScActionInitiatedEvent>;
+
+  static Dispatcher & GetInstance()
+  {
+    static Dispatcher dispatcher;
+    return dispatcher;
+  }
+
+  void Register(std::shared_ptr<Entry> const & entry) noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_context == nullptr)
+      m_context = std::make_shared<ScMemoryContext>();
+
+    auto & index = m_indices[GetPriorityIndex(entry->m_priority)];
+    index.m_actionClassesToEntries[entry->m_actionClassAddr].push_back(entry);
+    ++index.m_entriesCount;
+
+    if (index.m_subscription == nullptr)
+    {
+      auto const priority = entry->m_priority;
+      index.m_subscription.reset(new Subscription(
+          *m_context,
+          ScKeynodes::action_initiated,
+          [this, priority](ScActionInitiatedEvent const & event)
+          {
+            Dispatch(priority, event);
+          }));
+      index.m_subscription->SetPriority(priority);
+    }
+  }
+
+  void Unregister(std::shared_ptr<Entry> const & entry) noexcept
+  {
+    // shared subscription waits for its handler, so it is destroyed without lock
+    std::unique_ptr<Subscription> subscription;
+    std::shared_ptr<ScMemoryContext> context;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto & index = m_indices[GetPriorityIndex(entry->m_priority)];
+      auto const & it = index.m_actionClassesToEntries.find(entry->m_actionClassAddr);
+      if (it == index.m_actionClassesToEntries.cend())
+        return;
+
+      Entries & entries = it->second;
+      for (auto entryIt = entries.begin(); entryIt != entries.end(); ++entryIt)
+      {
+        if (*entryIt == entry)
+        {
+          entries.erase(entryIt);
+          --index.m_entriesCount;
+          break;
+        }
+      }
+      if (entries.empty())
+        index.m_actionClassesToEntries.erase(it);
+
+      if (index.m_entriesCount == 0)
+        subscription = std::move(index.m_subscription);
+
+      // context is used by shared subscriptions, so it is destroyed after the last of them
+      if (m_indices[0].m_subscription == nullptr && m_indices[1].m_subscription == nullptr)
+        context = std::move(m_context);
+    }
+    subscription.reset();
+  }
+
+  size_t GetEntriesCount(ScAddr const & actionClassAddr) noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t count = 0;
+    for (auto const & index : m_indices)
+    {
+      auto const & it = index.m_actionClassesToEntries.find(actionClassAddr);
+      if (it != index.m_actionClassesToEntries.cend())
+        count += it->second.size();
+    }
+    return count;
+  }
+
+  void CollectLatencyStatistics(ScEventPriority priority, sc_events_latency_stat & stat) noexcept
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto const & index = m_indices[GetPriorityIndex(priority)];
+    if (index.m_subscription != nullptr)
+      index.m_subscription->CollectLatencyStatistics(stat);
+  }
+
+private:
+  struct Index
+  {
+    ScAddrToValueUnorderedMap<Entries> m_actionClassesToEntries;
+    size_t m_entriesCount = 0;
+    std::unique_ptr<Subscription> m_subscription;
+  };
+
+  static size_t GetPriorityIndex(ScEventPriority priority) noexcept
+  {
+    return priority == ScEventPriority::High ? 1 : 0;
+  }
+
+  //! Call of delegate of subscription posted to worker threads of sc-events.
+  struct Task
+  {
+    std::shared_ptr<Entry> m_entry;
+    ScActionInitiatedEvent m_event;
+  };
+
+  static void CallDelegate(Entry & entry, ScActionInitiatedEvent const & event) noexcept
+  {
+    std::shared_lock<std::shared_mutex> lock(entry.m_mutex);
+    if (entry.m_delegate == nullptr)
+      return;
+
+    try
+    {
+      entry.m_delegate(event);
+    }
+    catch (utils::ScException const & e)
+    {
+      SC_LOG_ERROR("ScActionDispatcherSubscription: Uncaught exception in delegate function: " << e.Message());
+    }
+  }
+
+  static void RunTask(sc_pointer data, sc_bool isCancelled) noexcept
+  {
+    std::unique_ptr<Task> const task(static_cast<Task *>(data));
+    if (isCancelled == SC_FALSE)
+      CallDelegate(*task->m_entry, task->m_event);
+  }
+
+  void Dispatch(ScEventPriority priority, ScActionInitiatedEvent const & event) noexcept
+  {
+    ScAddr const & actionAddr = event.GetOtherElement();
+
+    bool hasEntriesOfClasses = false;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto const & index = m_indices[GetPriorityIndex(priority)];
+      // context is reset when the last shared subscription is being destroyed
+      if (m_context == nullptr)
+        return;
+
+      hasEntriesOfClasses = index.m_actionClassesToEntries.size()
+                            > index.m_actionClassesToEntries.count(ScAddr::Empty);
+    }
+
+    // classes of action are read once for all subscriptions and without lock, so other actions are dispatched
+    // concurrently. They are read by system context, because context of subscriptions has no user in user mode.
+    std::vector<ScAddr> actionClassesAddrs{ScAddr::Empty};
+    if (hasEntriesOfClasses && ScMemory::ms_globalContext != nullptr)
+    {
+      try
+      {
+        ScIterator3Ptr const it3 =
+            ScMemory::ms_globalContext->CreateIterator3(ScType::ConstNode, ScType::ConstPermPosArc, actionAddr);
+        while (it3->Next())
+          actionClassesAddrs.push_back(it3->Get(0));
+      }
+      catch (utils::ScException const & e)
+      {
+        SC_LOG_ERROR("ScActionDispatcherSubscription: Classes of action can't be read: " << e.Message());
+        actionClassesAddrs.resize(1);
+      }
+    }
+
+    Entries entries;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto const & index = m_indices[GetPriorityIndex(priority)];
+      for (ScAddr const & actionClassAddr : actionClassesAddrs)
+      {
+        auto const & it = index.m_actionClassesToEntries.find(actionClassAddr);
+        if (it != index.m_actionClassesToEntries.cend())
+          entries.insert(entries.end(), it->second.cbegin(), it->second.cend());
+      }
+    }
+
+    if (entries.empty())
+      return;
+
+    // delegates are called by worker threads of sc-events concurrently, the last one is called by this thread
+    for (size_t i = 0; i + 1 < entries.size(); ++i)
+    {
+      auto * task = new Task{entries[i], event};
+      if (sc_memory_post_task(&Dispatcher::RunTask, task) != SC_RESULT_OK)
+        RunTask(task, SC_FALSE);
+    }
+    CallDelegate(*entries.back(), event);
+  }
+
+  std::shared_ptr<ScMemoryContext> m_context;
+  std::array<Index, 2> m_indices;
+  std::mutex m_mutex;
+};
+
+ScActionDispatcherSubscription::ScActionDispatcherSubscription(
+    ScAddr const & actionClassAddr,
+    DelegateFunc const & func) noexcept
+  : m_entry(std::make_shared<Entry>())
+{
+  m_entry->m_actionClassAddr = actionClassAddr;
+  m_entry->m_delegate = func;
+  Dispatcher::GetInstance().Register(m_entry);
+}
+
+ScActionDispatcherSubscription::~ScActionDispatcherSubscription() noexcept
+{
+  Dispatcher::GetInstance().Unregister(m_entry);
+  RemoveDelegate();
+}
+
+void ScActionDispatcherSubscription::RemoveDelegate() noexcept
+{
+  std::unique_lock<std::shared_mutex> lock(m_entry->m_mutex);
+  m_entry->m_delegate = nullptr;
+}
+
+void ScActionDispatcherSubscription::SetPriority(ScEventPriority priority) noexcept
+{
+  if (m_entry->m_priority == priority)
+    return;
+
+  Dispatcher::GetInstance().Unregister(m_entry);
+  m_entry->m_priority = priority;
+  Dispatcher::GetInstance().Register(m_entry);
+}
+
+ScEventPriority ScActionDispatcherSubscription::GetPriority() const noexcept
+{
+  return m_entry->m_priority;
+}
+
+void ScActionDispatcherSubscription::CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept
+{
+  Dispatcher::GetInstance().CollectLatencyStatistics(m_entry->m_priority, stat);
+}
+
+size_t ScActionDispatcherSubscription::GetSubscriptionsCount(ScAddr const & actionClassAddr) noexcept
+{
+  return Dispatcher::GetInstance().GetEntriesCount(actionClassAddr);
+}
@@ -22,3 +22,13 @@ ScTemplate ScActionInitiatedAgent::GetInitiationConditionTemplate(ScActionInitia
   templ.Triple(GetActionClass(), ScType::VarPermPosArc, event.GetOtherElement());
   return templ;
 }
+
+size_t ScActionInitiatedAgent::GetMaxMemoizedResultsCount() const
+{
+  return 0u;
+}
+
+bool ScActionInitiatedAgent::IsResultMemoizedByContentOfLinks() const
+{
+  return false;
+}
@@ -9,8 +9,10 @@
 #include <algorithm>
 
 #include "sc-memory/sc_event_subscription.hpp"
+#include "sc-memory/sc_template_subscription.hpp"
 
 #include "sc-memory/sc_action.hpp"
+#include "sc-memory/sc_action_batch.hpp"
 #include "sc-memory/sc_keynodes.hpp"
 #include "sc-memory/sc_oriented_set.hpp"
 
@@ -55,6 +57,24 @@ std::shared_ptr<ScElementaryEventSubscription<ScElementaryEvent>> ScAgentContext
           *this, eventClassAddr, subscriptionElementAddr, eventCallback));
 }
 
+std::shared_ptr<ScEventSubscriptionBatch<ScElementaryEvent>> ScAgentContext::CreateEventSubscriptionBatch(
+    ScAddr const & eventClassAddr,
+    ScAddr const & subscriptionElementAddr,
+    size_t maxBatchSize,
+    std::chrono::milliseconds const & maxBatchDelay,
+    std::function<void(std::vector<ScElementaryEvent> const &)> const & eventsCallback) noexcept(false)
+{
+  ValidateEventElements(eventClassAddr, subscriptionElementAddr, "sc-event subscription batch");
+
+  if (maxBatchSize == 0)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Not able to create sc-event subscription batch because max batch size is 0.");
+
+  return std::shared_ptr<ScEventSubscriptionBatch<ScElementaryEvent>>(new ScEventSubscriptionBatch<ScElementaryEvent>(
+      *this, eventClassAddr, subscriptionElementAddr, maxBatchSize, maxBatchDelay, eventsCallback));
+}
+
 std::shared_ptr<ScWaiter> ScAgentContext::CreateEventWaiter(
     ScAddr const & eventClassAddr,
     ScAddr const & subscriptionElementAddr,
@@ -90,6 +110,26 @@ std::shared_ptr<ScWaiter> ScAgentContext::CreateConditionWaiter(
   return CreateConditionWaiter(eventClassAddr, subscriptionElementAddr, {}, checkCallback);
 }
 
+std::shared_ptr<ScTemplateSubscription> ScAgentContext::CreateTemplateSubscription(
+    ScTemplate const & templ,
+    std::function<void(ScTemplateResultItem const &)> const & onAddedCallback,
+    std::function<void(ScTemplateResultItem const &)> const & onRemovedCallback) noexcept(false)
+{
+  if (templ.IsEmpty())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Not able to create template subscription because sc-template is empty.");
+
+  return std::shared_ptr<ScTemplateSubscription>(new ScTemplateSubscription(
+      std::unique_ptr<ScAgentContext>(new ScAgentContext(GetUser())), templ, onAddedCallback, onRemovedCallback));
+}
+
+std::vector<ScAgentExecutionStatistics> ScAgentContext::GetAgentsExecutionStatistics() const
+{
+  CheckEventsLatencyStatisticsAccess();
+
+  return ScAgentMetrics::CollectAll();
+}
+
 ScAction ScAgentContext::GenerateAction(ScAddr const & actionClassAddr) noexcept(false)
 {
   if (!IsElement(actionClassAddr))
@@ -116,6 +156,54 @@ ScAction ScAgentContext::ConvertToAction(ScAddr const & actionAddr) noexcept(fal
   return action;
 }
 
+ScActionBatch ScAgentContext::GenerateAndInitiateActions(
+    ScAddr const & actionClassAddr,
+    std::vector<ScAddrVector> const & argumentsList) noexcept(false)
+{
+  if (!IsElement(actionClassAddr))
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams,
+        "Not able to generate sc-actions with action class `" << actionClassAddr
+                                                              << "`, because action class is not valid.");
+
+  for (size_t actionIdx = 0; actionIdx < argumentsList.size(); ++actionIdx)
+  {
+    ScAddrVector const & argumentAddrs = argumentsList[actionIdx];
+    for (size_t argumentIdx = 0; argumentIdx < argumentAddrs.size(); ++argumentIdx)
+    {
+      if (!IsElement(argumentAddrs[argumentIdx]))
+        SC_THROW_EXCEPTION(
+            utils::ExceptionInvalidParams,
+            "Not able to generate sc-actions with action class `"
+                << actionClassAddr << "`, because argument " << argumentIdx + 1 << " of sc-action " << actionIdx
+                << " is not valid.");
+    }
+  }
+
+  ScAddrVector actionAddrs;
+  actionAddrs.reserve(argumentsList.size());
+  {
+    // sc-events of all actions are emitted after they are generated with their arguments and initiated
+    ScMemoryContextEventsPendingGuard guard(*this);
+    for (ScAddrVector const & argumentAddrs : argumentsList)
+    {
+      ScAddr const & actionAddr = GenerateNode(ScType::ConstNode);
+      GenerateConnector(ScType::ConstPermPosArc, actionClassAddr, actionAddr);
+      for (size_t argumentIdx = 0; argumentIdx < argumentAddrs.size(); ++argumentIdx)
+      {
+        ScAddr const & arcAddr = GenerateConnector(ScType::ConstPermPosArc, actionAddr, argumentAddrs[argumentIdx]);
+        GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::GetRrelIndex(argumentIdx + 1), arcAddr);
+      }
+      actionAddrs.push_back(actionAddr);
+    }
+
+    for (ScAddr const & actionAddr : actionAddrs)
+      GenerateConnector(ScType::ConstPermPosArc, ScKeynodes::action_initiated, actionAddr);
+  }
+
+  return ScActionBatch{GetUser(), std::move(actionAddrs)};
+}
+
 ScSet ScAgentContext::GenerateSet()
 {
   ScAddr const & setAddr = GenerateNode(ScType::ConstNode);
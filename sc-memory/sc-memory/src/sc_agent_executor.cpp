@@ -0,0 +1,329 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_agent_executor.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <thread>
+#include <vector>
+
+#include "sc-memory/sc_event.hpp"
+#include "sc-memory/utils/sc_logger.hpp"
+
+namespace
+{
+//! Executor which task is run by current thread.
+thread_local ScAgentExecutor const * currentExecutor = nullptr;
+}  // namespace
+
+//! Runs tasks in threads that schedule them, no more than specified number of tasks at the same time.
+class ScLimitedAgentExecutor final : public ScAgentExecutor
+{
+public:
+  explicit ScLimitedAgentExecutor(size_t maxConcurrency) noexcept
+    : m_maxConcurrency(maxConcurrency)
+  {
+  }
+
+protected:
+  size_t const m_maxConcurrency;
+  std::deque<ScTask> m_tasks;
+
+  void Schedule(ScAddr const &, ScTask && task) noexcept override
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_runningTasksCount == m_maxConcurrency)
+      {
+        m_tasks.push_back(std::move(task));
+        ++m_queuedTasksCount;
+        return;
+      }
+      ++m_runningTasksCount;
+    }
+
+    // thread that has finished task runs queued tasks, so threads of events and agents don't wait for free place
+    ScTask nextTask = std::move(task);
+    while (true)
+    {
+      RunTask(nextTask);
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_tasks.empty())
+      {
+        --m_runningTasksCount;
+        m_idleCondition.notify_all();
+        return;
+      }
+
+      nextTask = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      --m_queuedTasksCount;
+    }
+  }
+};
+
+//! Runs tasks in own threads.
+class ScDedicatedAgentExecutor final : public ScAgentExecutor
+{
+public:
+  explicit ScDedicatedAgentExecutor(size_t threadsCount) noexcept
+    : m_isDestroyedByTask(std::make_shared<std::atomic<bool>>(false))
+  {
+    m_threads.reserve(threadsCount);
+    for (size_t i = 0; i < threadsCount; ++i)
+      m_threads.emplace_back(
+          [this, isDestroyedByTask = m_isDestroyedByTask]()
+          {
+            ProcessTasks(*isDestroyedByTask);
+          });
+  }
+
+  ~ScDedicatedAgentExecutor() noexcept override
+  {
+    // executor may be destroyed by its own task, for example, when agent is unsubscribed by itself. Thread of this task
+    // is detached and doesn't access executor after task, it only reads flag shared with it.
+    auto const & currentThreadIt = std::find_if(
+        m_threads.begin(),
+        m_threads.end(),
+        [](std::thread const & thread)
+        {
+          return thread.get_id() == std::this_thread::get_id();
+        });
+    bool const isDestroyedByTask = currentThreadIt != m_threads.end();
+    if (isDestroyedByTask)
+    {
+      m_isDestroyedByTask->store(true);
+      currentThreadIt->detach();
+    }
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_isStopped = true;
+    }
+    m_tasksCondition.notify_all();
+
+    for (std::thread & thread : m_threads)
+    {
+      if (thread.joinable())
+        thread.join();
+    }
+
+    // other threads stop after their current tasks if executor is destroyed by task, so queued tasks are performed here
+    while (!m_tasks.empty())
+    {
+      ScTask const task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      RunTask(task);
+    }
+  }
+
+protected:
+  std::vector<std::thread> m_threads;
+  std::condition_variable m_tasksCondition;
+  std::deque<ScTask> m_tasks;
+  bool m_isStopped = false;
+  //! Shared with threads, so they can check it when executor is destroyed.
+  std::shared_ptr<std::atomic<bool>> const m_isDestroyedByTask;
+
+  void Schedule(ScAddr const &, ScTask && task) noexcept override
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_tasks.push_back(std::move(task));
+      ++m_queuedTasksCount;
+    }
+    m_tasksCondition.notify_one();
+  }
+
+  void ProcessTasks(std::atomic<bool> const & isDestroyedByTask) noexcept
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true)
+    {
+      m_tasksCondition.wait(
+          lock,
+          [this]()
+          {
+            return m_isStopped || !m_tasks.empty();
+          });
+      // queued tasks are performed before threads are stopped
+      if (m_tasks.empty())
+        return;
+
+      ScTask const task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      --m_queuedTasksCount;
+      ++m_runningTasksCount;
+
+      lock.unlock();
+      RunTask(task);
+      // executor may be destroyed by this task
+      if (isDestroyedByTask.load())
+        return;
+      lock.lock();
+
+      --m_runningTasksCount;
+      m_idleCondition.notify_all();
+    }
+  }
+};
+
+//! Runs tasks with the same key one by one in threads that schedule them.
+class ScSerialByKeyAgentExecutor final : public ScAgentExecutor
+{
+public:
+  explicit ScSerialByKeyAgentExecutor(ScKeyFunction const & getKey) noexcept
+    : m_getKey(getKey)
+  {
+  }
+
+protected:
+  ScKeyFunction const m_getKey;
+  //! Queued tasks by keys. Key is in map while task with this key is run.
+  ScAddrToValueUnorderedMap<std::deque<ScTask>> m_keysTasks;
+
+  ScAddr GetKey(ScEvent const & event) const noexcept override
+  {
+    if (!m_getKey)
+      return event.GetSubscriptionElement();
+
+    try
+    {
+      return m_getKey(event);
+    }
+    catch (utils::ScException const & e)
+    {
+      SC_LOG_ERROR("ScAgentExecutor: Uncaught exception in getting key of sc-event: " << e.Message());
+      return ScAddr::Empty;
+    }
+  }
+
+  void Schedule(ScAddr const & key, ScTask && task) noexcept override
+  {
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto const & it = m_keysTasks.find(key);
+      if (it != m_keysTasks.cend())
+      {
+        it->second.push_back(std::move(task));
+        ++m_queuedTasksCount;
+        return;
+      }
+      m_keysTasks.insert({key, {}});
+      ++m_runningTasksCount;
+    }
+
+    ScTask nextTask = std::move(task);
+    while (true)
+    {
+      RunTask(nextTask);
+
+      std::lock_guard<std::mutex> lock(m_mutex);
+      auto const & it = m_keysTasks.find(key);
+      if (it->second.empty())
+      {
+        m_keysTasks.erase(it);
+        --m_runningTasksCount;
+        m_idleCondition.notify_all();
+        return;
+      }
+
+      nextTask = std::move(it->second.front());
+      it->second.pop_front();
+      --m_queuedTasksCount;
+    }
+  }
+};
+
+std::shared_ptr<ScAgentExecutor> ScAgentExecutor::Limited(size_t maxConcurrency) noexcept(false)
+{
+  if (maxConcurrency == 0)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Not able to generate limited agent executor because max concurrency is 0.");
+
+  return std::make_shared<ScLimitedAgentExecutor>(maxConcurrency);
+}
+
+std::shared_ptr<ScAgentExecutor> ScAgentExecutor::Serial() noexcept
+{
+  return std::make_shared<ScLimitedAgentExecutor>(1u);
+}
+
+std::shared_ptr<ScAgentExecutor> ScAgentExecutor::Dedicated(size_t threadsCount) noexcept(false)
+{
+  if (threadsCount == 0)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Not able to generate dedicated agent executor because number of threads is 0.");
+
+  return std::make_shared<ScDedicatedAgentExecutor>(threadsCount);
+}
+
+std::shared_ptr<ScAgentExecutor> ScAgentExecutor::SerialByKey(ScKeyFunction const & getKey) noexcept
+{
+  return std::make_shared<ScSerialByKeyAgentExecutor>(getKey);
+}
+
+ScAgentExecutor::ScAgentExecutor() noexcept = default;
+
+ScAgentExecutor::~ScAgentExecutor() noexcept = default;
+
+void ScAgentExecutor::Execute(ScEvent const & event, ScTask && task) noexcept
+{
+  Schedule(GetKey(event), std::move(task));
+}
+
+void ScAgentExecutor::Wait() noexcept
+{
+  if (currentExecutor == this)
+    return;
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_idleCondition.wait(
+      lock,
+      [this]()
+      {
+        return m_queuedTasksCount == 0 && m_runningTasksCount == 0;
+      });
+}
+
+size_t ScAgentExecutor::GetQueuedTasksCount() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queuedTasksCount;
+}
+
+size_t ScAgentExecutor::GetRunningTasksCount() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_runningTasksCount;
+}
+
+ScAddr ScAgentExecutor::GetKey(ScEvent const &) const noexcept
+{
+  return ScAddr::Empty;
+}
+
+void ScAgentExecutor::RunTask(ScTask const & task) noexcept
+{
+  ScAgentExecutor const * previousExecutor = currentExecutor;
+  currentExecutor = this;
+  try
+  {
+    task();
+  }
+  catch (utils::ScException const & e)
+  {
+    SC_LOG_ERROR("ScAgentExecutor: Uncaught exception in call of agent: " << e.Message());
+  }
+  catch (std::exception const & e)
+  {
+    SC_LOG_ERROR("ScAgentExecutor: Uncaught exception in call of agent: " << e.what());
+  }
+  currentExecutor = previousExecutor;
+}
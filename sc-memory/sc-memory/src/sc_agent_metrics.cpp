@@ -0,0 +1,172 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_agent_metrics.hpp"
+
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <utility>
+
+#include "sc-memory/utils/sc_logger.hpp"
+
+extern "C"
+{
+#include <sc-core/sc_event_subscription.h>
+}
+
+namespace
+{
+//! Counters of agent classes by names of agent classes and agent implementations.
+std::mutex metricsMutex;
+std::map<std::pair<std::string, ScAddr::HashType>, std::shared_ptr<ScAgentMetrics>> metricsByAgentClasses;
+
+thread_local sc_uint64 threadWaitingTime = 0;
+
+void AddToMax(std::atomic<sc_uint32> & max, sc_uint32 value)
+{
+  sc_uint32 currentMax = max.load(std::memory_order_relaxed);
+  while (value > currentMax && !max.compare_exchange_weak(currentMax, value, std::memory_order_relaxed))
+    ;
+}
+}  // namespace
+
+ScAgentMetrics::ScAgentMetrics(std::string agentClassName, ScAddr const & agentImplementationAddr) noexcept
+  : m_agentClassName(std::move(agentClassName))
+  , m_agentImplementationAddr(agentImplementationAddr)
+{
+}
+
+void ScAgentMetrics::AddThreadWaitingTime(sc_uint64 waitingTime) noexcept
+{
+  threadWaitingTime += waitingTime;
+}
+
+sc_uint64 ScAgentMetrics::GetThreadWaitingTime() noexcept
+{
+  return threadWaitingTime;
+}
+
+void ScAgentMetrics::RecordInvocation() noexcept
+{
+  m_invocationsNum.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ScAgentMetrics::RecordDeactivation() noexcept
+{
+  m_deactivationsNum.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ScAgentMetrics::RecordInitiationConditionRejection() noexcept
+{
+  m_initiationConditionRejectionsNum.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ScAgentMetrics::RecordMemoizedResult() noexcept
+{
+  m_memoizedResultsNum.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ScAgentMetrics::RecordProgram(sc_result code, bool isSuspended, sc_uint64 duration, sc_uint64 waitingTime) noexcept
+{
+  if (isSuspended)
+    m_suspendedResultsNum.fetch_add(1, std::memory_order_relaxed);
+  else if (code == SC_RESULT_OK)
+    m_successfulResultsNum.fetch_add(1, std::memory_order_relaxed);
+  else if (code == SC_RESULT_NO)
+    m_unsuccessfulResultsNum.fetch_add(1, std::memory_order_relaxed);
+  else
+    m_errorResultsNum.fetch_add(1, std::memory_order_relaxed);
+
+  m_programDurationBuckets[sc_latency_histogram_get_bucket_index(duration)].fetch_add(1, std::memory_order_relaxed);
+  m_programDurationsNum.fetch_add(1, std::memory_order_relaxed);
+  AddToMax(m_programMaxDuration, (sc_uint32)std::min(duration, (sc_uint64)SC_MAXUINT32));
+  m_programWaitingTime.fetch_add(waitingTime, std::memory_order_relaxed);
+}
+
+ScAgentExecutionStatistics ScAgentMetrics::Collect() const noexcept
+{
+  sc_latency_histogram histogram;
+  for (sc_uint32 i = 0; i < SC_LATENCY_HISTOGRAM_BUCKETS_COUNT; ++i)
+    histogram.buckets[i] = m_programDurationBuckets[i].load(std::memory_order_relaxed);
+  histogram.count = m_programDurationsNum.load(std::memory_order_relaxed);
+  histogram.max = m_programMaxDuration.load(std::memory_order_relaxed);
+
+  return {
+      m_agentClassName,
+      m_agentImplementationAddr,
+      m_invocationsNum.load(std::memory_order_relaxed),
+      m_deactivationsNum.load(std::memory_order_relaxed),
+      m_initiationConditionRejectionsNum.load(std::memory_order_relaxed),
+      m_successfulResultsNum.load(std::memory_order_relaxed),
+      m_unsuccessfulResultsNum.load(std::memory_order_relaxed),
+      m_errorResultsNum.load(std::memory_order_relaxed),
+      m_suspendedResultsNum.load(std::memory_order_relaxed),
+      m_memoizedResultsNum.load(std::memory_order_relaxed),
+      {histogram.count,
+       sc_latency_histogram_get_percentile(&histogram, 50),
+       sc_latency_histogram_get_percentile(&histogram, 90),
+       sc_latency_histogram_get_percentile(&histogram, 99),
+       histogram.max},
+      m_programWaitingTime.load(std::memory_order_relaxed)};
+}
+
+std::shared_ptr<ScAgentMetrics> ScAgentMetrics::Resolve(
+    std::string const & agentClassName,
+    ScAddr const & agentImplementationAddr) noexcept
+{
+  std::lock_guard<std::mutex> lock(metricsMutex);
+  auto & metrics = metricsByAgentClasses[{agentClassName, agentImplementationAddr.Hash()}];
+  if (metrics == nullptr)
+    metrics = std::make_shared<ScAgentMetrics>(agentClassName, agentImplementationAddr);
+  return metrics;
+}
+
+void ScAgentMetrics::CollectByAgentClass(
+    std::string const & agentClassName,
+    ScAddr const & agentImplementationAddr,
+    std::vector<ScAgentExecutionStatistics> & statistics) noexcept
+{
+  std::lock_guard<std::mutex> lock(metricsMutex);
+  auto const & it = metricsByAgentClasses.find({agentClassName, agentImplementationAddr.Hash()});
+  if (it != metricsByAgentClasses.cend())
+    statistics.push_back(it->second->Collect());
+}
+
+std::vector<ScAgentExecutionStatistics> ScAgentMetrics::CollectAll() noexcept
+{
+  std::lock_guard<std::mutex> lock(metricsMutex);
+  std::vector<ScAgentExecutionStatistics> statistics;
+  statistics.reserve(metricsByAgentClasses.size());
+  for (auto const & [_, metrics] : metricsByAgentClasses)
+    statistics.push_back(metrics->Collect());
+  return statistics;
+}
+
+void ScAgentMetrics::Dump() noexcept
+{
+  for (ScAgentExecutionStatistics const & statistics : CollectAll())
+  {
+    SC_LOG_INFO(
+        "Agent `" << statistics.m_agentClassName << "` with implementation `"
+                  << statistics.m_agentImplementationAddr.Hash() << "`: calls " << statistics.m_invocationsNum
+                  << ", deactivated " << statistics.m_deactivationsNum << ", rejected by initiation condition "
+                  << statistics.m_initiationConditionRejectionsNum << ", successful "
+                  << statistics.m_successfulResultsNum << ", unsuccessful " << statistics.m_unsuccessfulResultsNum
+                  << ", with error " << statistics.m_errorResultsNum << ", suspended "
+                  << statistics.m_suspendedResultsNum << ", memoized " << statistics.m_memoizedResultsNum
+                  << "; performing p50 " << statistics.m_programDuration.m_p50
+                  << " us, p90 " << statistics.m_programDuration.m_p90 << " us, p99 "
+                  << statistics.m_programDuration.m_p99 << " us, max " << statistics.m_programDuration.m_max
+                  << " us, waiting " << statistics.m_programWaitingTime << " us");
+  }
+}
+
+void ScAgentMetrics::Clear() noexcept
+{
+  std::lock_guard<std::mutex> lock(metricsMutex);
+  metricsByAgentClasses.clear();
+}
@@ -0,0 +1,346 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_agent_results_cache.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+#include "sc-memory/sc_keynodes.hpp"
+#include "sc-memory/sc_event_subscription.hpp"
+
+ScAgentResultsCache::ScTicket::ScTicket(ScAgentResultsCache * cache, ScKey const & key) noexcept
+  : m_cache(cache)
+  , m_key(key)
+{
+}
+
+ScAgentResultsCache::ScTicket::ScTicket(ScTicket && other) noexcept
+  : m_cache(other.m_cache)
+  , m_key(std::move(other.m_key))
+  , m_versions(std::move(other.m_versions))
+{
+  other.m_cache = nullptr;
+}
+
+ScAgentResultsCache::ScTicket::~ScTicket() noexcept
+{
+  if (m_cache != nullptr)
+    m_cache->Put(*this, ScAddr::Empty);
+}
+
+ScAgentResultsCache::ScAgentResultsCache(
+    ScAddr const & actionClassAddr,
+    size_t maxResultsCount,
+    bool isLinksContentHashed) noexcept
+  : m_actionClassAddr(actionClassAddr)
+  , m_maxResultsCount(maxResultsCount)
+  , m_isLinksContentHashed(isLinksContentHashed)
+{
+}
+
+ScAgentResultsCache::~ScAgentResultsCache() noexcept
+{
+  // subscriptions wait for their handlers, so they are destroyed without lock and before other members
+  ScSubscriptions subscriptions;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    subscriptions = std::move(m_unusedSubscriptions);
+    for (auto & [_, watch] : m_watches)
+      std::move(watch.m_subscriptions.begin(), watch.m_subscriptions.end(), std::back_inserter(subscriptions));
+  }
+  subscriptions.clear();
+}
+
+ScAgentResultsCache::ScKey ScAgentResultsCache::GetKey(
+    ScMemoryContext & context,
+    ScAddr const & actionAddr) noexcept(false)
+{
+  std::vector<std::pair<ScAddr, ScAddr>> roleArguments;
+  ScIterator5Ptr const it5 = context.CreateIterator5(
+      actionAddr, ScType::ConstPermPosArc, ScType::Unknown, ScType::ConstPermPosArc, ScType::ConstNodeRole);
+  while (it5->Next())
+    roleArguments.emplace_back(it5->Get(4), it5->Get(2));
+
+  std::sort(
+      roleArguments.begin(),
+      roleArguments.end(),
+      [](auto const & first, auto const & second) -> bool
+      {
+        return std::make_pair(first.first.Hash(), first.second.Hash())
+               < std::make_pair(second.first.Hash(), second.second.Hash());
+      });
+
+  ScKey key;
+  key.m_values.reserve(roleArguments.size() * 2 + 2);
+  key.m_values.push_back(context.GetUser().Hash());
+  key.m_values.push_back(m_actionClassAddr.Hash());
+  for (auto const & [roleAddr, argumentAddr] : roleArguments)
+  {
+    key.m_values.push_back(roleAddr.Hash());
+
+    std::string content;
+    if (m_isLinksContentHashed && context.GetElementType(argumentAddr).IsLink()
+        && context.GetLinkContent(argumentAddr, content))
+      key.m_values.push_back(std::hash<std::string>()(content));
+    else
+      key.m_values.push_back(argumentAddr.Hash());
+
+    key.m_argumentAddrs.push_back(argumentAddr);
+  }
+
+  return key;
+}
+
+ScAddr ScAgentResultsCache::Get(ScKey const & key) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const & it = m_keysToEntries.find(key.m_values);
+  if (it == m_keysToEntries.cend())
+    return ScAddr::Empty;
+
+  ScEntries::iterator const entryIt = it->second;
+  // result structure may be erased with action that it was memoized for
+  if (!IsElement(entryIt->m_resultAddr))
+  {
+    EraseEntry(entryIt);
+    return ScAddr::Empty;
+  }
+
+  m_entries.splice(m_entries.begin(), m_entries, entryIt);
+  return entryIt->m_resultAddr;
+}
+
+ScAgentResultsCache::ScTicket ScAgentResultsCache::Watch(ScKey const & key) noexcept
+{
+  ScTicket ticket{this, key};
+  ticket.m_versions.reserve(key.m_argumentAddrs.size());
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (ScAddr const & argumentAddr : key.m_argumentAddrs)
+  {
+    if (!IsElement(argumentAddr))
+    {
+      ticket.m_versions.push_back(0);
+      continue;
+    }
+
+    // arguments are subscribed before action is performed, so their changes during performing aren't missed
+    ScWatch & watch = m_watches[argumentAddr];
+    if (watch.m_subscriptions.empty())
+    {
+      watch.m_subscriptions = GenerateSubscriptions(argumentAddr);
+      // argument that can't be watched doesn't let result be memoized
+      if (watch.m_subscriptions.empty())
+      {
+        m_watches.erase(argumentAddr);
+        ticket.m_versions.push_back(0);
+        continue;
+      }
+
+      watch.m_creationVersion = ++m_lastVersion;
+      watch.m_version = watch.m_creationVersion;
+    }
+    ++watch.m_ticketsCount;
+    ticket.m_versions.push_back(watch.m_version);
+  }
+
+  return ticket;
+}
+
+void ScAgentResultsCache::Put(ScTicket & ticket, ScAddr const & resultAddr) noexcept
+{
+  if (ticket.m_cache != this)
+    return;
+
+  ScKey const & key = ticket.m_key;
+  // subscriptions wait for their handlers, so unused ones are destroyed after lock is released
+  ScSubscriptions unusedSubscriptions;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    bool const isActual = ReleaseTicket(ticket, resultAddr);
+    if (isActual && resultAddr.IsValid() && m_keysToEntries.count(key.m_values) == 0)
+    {
+      m_entries.push_front({key.m_values, key.m_argumentAddrs, resultAddr});
+      m_keysToEntries.insert({key.m_values, m_entries.begin()});
+      ++m_resultsCounts[resultAddr];
+
+      for (ScAddr const & argumentAddr : key.m_argumentAddrs)
+        m_watches[argumentAddr].m_entries.insert(&m_entries.front());
+
+      while (m_entries.size() > m_maxResultsCount)
+        EraseEntry(std::prev(m_entries.end()));
+    }
+
+    CollectUnusedWatches();
+    unusedSubscriptions = std::move(m_unusedSubscriptions);
+  }
+}
+
+size_t ScAgentResultsCache::GetResultsCount() const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_entries.size();
+}
+
+bool ScAgentResultsCache::IsElement(ScAddr const & addr) noexcept
+{
+  try
+  {
+    return ScMemory::ms_globalContext != nullptr && ScMemory::ms_globalContext->IsElement(addr);
+  }
+  catch (utils::ScException const &)
+  {
+    return false;
+  }
+}
+
+ScAgentResultsCache::ScSubscriptions ScAgentResultsCache::GenerateSubscriptions(ScAddr const & argumentAddr) noexcept
+{
+  ScSubscriptions subscriptions;
+  try
+  {
+    ScAddrVector eventClassAddrs = {
+        ScKeynodes::sc_event_after_generate_connector,
+        ScKeynodes::sc_event_before_erase_connector,
+        ScKeynodes::sc_event_before_erase_element};
+    if (ScMemory::ms_globalContext->GetElementType(argumentAddr).IsLink())
+      eventClassAddrs.push_back(ScKeynodes::sc_event_before_change_link_content);
+
+    for (ScAddr const & eventClassAddr : eventClassAddrs)
+      subscriptions.emplace_back(new ScElementaryEventSubscription<ScElementaryEvent>(
+          m_context,
+          eventClassAddr,
+          argumentAddr,
+          [this](ScElementaryEvent const & event)
+          {
+            OnArgumentChanged(event);
+          }));
+  }
+  catch (utils::ScException const & e)
+  {
+    SC_LOG_WARNING("ScAgentResultsCache: Argument can't be watched: " << e.Message());
+    // subscriptions wait for their handlers, so they are destroyed by `Put` without lock
+    std::move(subscriptions.begin(), subscriptions.end(), std::back_inserter(m_unusedSubscriptions));
+    subscriptions.clear();
+  }
+  return subscriptions;
+}
+
+void ScAgentResultsCache::OnArgumentChanged(ScElementaryEvent const & event) noexcept
+{
+  ScAddr const & eventClassAddr = event.GetEventClass();
+  ScAddr const & argumentAddr = event.GetSubscriptionElement();
+  bool const isConnectorEvent = eventClassAddr == ScKeynodes::sc_event_after_generate_connector
+                                || eventClassAddr == ScKeynodes::sc_event_before_erase_connector;
+
+  // new actions with the same arguments don't change them, results are invalidated if it can't be checked
+  bool isNewAction = false;
+  if (isConnectorEvent)
+  {
+    try
+    {
+      isNewAction = ScMemory::ms_globalContext->CheckConnector(
+          m_actionClassAddr, event.GetOtherElement(), ScType::ConstPermPosArc);
+    }
+    catch (utils::ScException const &)
+    {
+    }
+  }
+  if (isNewAction)
+    return;
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (isConnectorEvent && m_resultsCounts.count(event.GetOtherElement()) != 0)
+    return;
+
+  auto const & watchIt = m_watches.find(argumentAddr);
+  if (watchIt == m_watches.cend())
+    return;
+
+  // results of actions performed at the moment aren't memoized if their arguments are changed by other sc-elements
+  ScWatch & watch = watchIt->second;
+  watch.m_version = ++m_lastVersion;
+  if (watch.m_ticketsCount != 0)
+    watch.m_changes.emplace_back(watch.m_version, isConnectorEvent ? event.GetOtherElement() : ScAddr::Empty);
+
+  std::unordered_set<ScEntry const *> const entries = watchIt->second.m_entries;
+  for (ScEntry const * entry : entries)
+    EraseEntry(m_keysToEntries.find(entry->m_keyValues)->second);
+
+  // subscriptions of erased sc-element are not valid, and its sc-address may be reused by new sc-element
+  if (eventClassAddr == ScKeynodes::sc_event_before_erase_element)
+  {
+    ScSubscriptions & subscriptions = watchIt->second.m_subscriptions;
+    std::move(subscriptions.begin(), subscriptions.end(), std::back_inserter(m_unusedSubscriptions));
+    m_watches.erase(watchIt);
+  }
+}
+
+void ScAgentResultsCache::EraseEntry(ScEntries::iterator const & entryIt) noexcept
+{
+  for (ScAddr const & argumentAddr : entryIt->m_argumentAddrs)
+  {
+    auto const & watchIt = m_watches.find(argumentAddr);
+    if (watchIt != m_watches.cend())
+      watchIt->second.m_entries.erase(&*entryIt);
+  }
+
+  auto const & resultIt = m_resultsCounts.find(entryIt->m_resultAddr);
+  if (resultIt != m_resultsCounts.cend() && --resultIt->second == 0)
+    m_resultsCounts.erase(resultIt);
+
+  m_keysToEntries.erase(entryIt->m_keyValues);
+  m_entries.erase(entryIt);
+}
+
+bool ScAgentResultsCache::ReleaseTicket(ScTicket & ticket, ScAddr const & resultAddr) noexcept
+{
+  ticket.m_cache = nullptr;
+
+  bool isActual = true;
+  for (size_t i = 0; i < ticket.m_key.m_argumentAddrs.size(); ++i)
+  {
+    size_t const version = ticket.m_versions[i];
+    auto const & watchIt = m_watches.find(ticket.m_key.m_argumentAddrs[i]);
+    // argument was not valid or was erased, and its sc-address may be watched again for new sc-element
+    if (version == 0 || watchIt == m_watches.cend() || watchIt->second.m_creationVersion > version)
+    {
+      isActual = false;
+      continue;
+    }
+
+    ScWatch & watch = watchIt->second;
+    for (auto const & [changeVersion, otherAddr] : watch.m_changes)
+    {
+      // connectors between argument and result structure are generated by action itself
+      if (changeVersion > version && (!resultAddr.IsValid() || otherAddr != resultAddr))
+        isActual = false;
+    }
+
+    if (--watch.m_ticketsCount == 0)
+      watch.m_changes.clear();
+  }
+
+  return isActual;
+}
+
+void ScAgentResultsCache::CollectUnusedWatches() noexcept
+{
+  for (auto it = m_watches.begin(); it != m_watches.end();)
+  {
+    if (!it->second.m_entries.empty() || it->second.m_ticketsCount != 0)
+    {
+      ++it;
+      continue;
+    }
+
+    ScSubscriptions & subscriptions = it->second.m_subscriptions;
+    std::move(subscriptions.begin(), subscriptions.end(), std::back_inserter(m_unusedSubscriptions));
+    it = m_watches.erase(it);
+  }
+}
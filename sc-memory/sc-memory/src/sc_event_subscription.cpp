@@ -6,4 +6,133 @@
 
 #include "sc-memory/sc_event_subscription.hpp"
 
+#include <map>
+#include <thread>
+#include <unordered_map>
+
+#include "sc-memory/sc_memory.hpp"
+
 ScEventSubscription::~ScEventSubscription() noexcept = default;
+
+namespace
+{
+//! State of timer shared by all batch subscriptions.
+struct ScEventSubscriptionBatchTimerState
+{
+  using Callback = std::function<void()>;
+  using Deadlines = std::multimap<std::chrono::steady_clock::time_point, std::pair<size_t, Callback>>;
+
+  std::mutex m_mutex;
+  std::condition_variable m_condition;
+  Deadlines m_deadlines;
+  std::unordered_map<size_t, Deadlines::iterator> m_deadlinesIterators;
+  size_t m_lastDeadlineId = 0;
+  std::thread m_thread;
+  bool m_isStopped = false;
+};
+
+ScEventSubscriptionBatchTimerState & GetBatchTimerState()
+{
+  // state isn't destroyed at exit, so timer thread is never destroyed while it is joinable
+  static auto * state = new ScEventSubscriptionBatchTimerState();
+  return *state;
+}
+
+void RunBatchTimerTask(sc_pointer data, sc_bool) noexcept
+{
+  // batch is delivered even if sc-events aren't processed anymore, so its subscription doesn't wait for it forever
+  std::unique_ptr<std::function<void()>> const callback{static_cast<std::function<void()> *>(data)};
+  (*callback)();
+}
+
+void PostBatchTimerTask(std::function<void()> const & callback) noexcept
+{
+  auto * task = new std::function<void()>(callback);
+  if (sc_memory_post_task(RunBatchTimerTask, task) != SC_RESULT_OK)
+    RunBatchTimerTask(task, SC_FALSE);
+}
+
+void RunBatchTimer() noexcept
+{
+  ScEventSubscriptionBatchTimerState & state = GetBatchTimerState();
+  std::unique_lock<std::mutex> lock(state.m_mutex);
+  while (!state.m_isStopped)
+  {
+    if (state.m_deadlines.empty())
+    {
+      state.m_condition.wait(lock);
+      continue;
+    }
+
+    auto const it = state.m_deadlines.begin();
+    if (it->first > std::chrono::steady_clock::now())
+    {
+      state.m_condition.wait_until(lock, it->first);
+      continue;
+    }
+
+    std::function<void()> const callback = std::move(it->second.second);
+    state.m_deadlinesIterators.erase(it->second.first);
+    state.m_deadlines.erase(it);
+
+    lock.unlock();
+    PostBatchTimerTask(callback);
+    lock.lock();
+  }
+}
+}  // namespace
+
+size_t ScEventSubscriptionBatchTimer::Schedule(
+    std::chrono::steady_clock::time_point const & deadline,
+    Callback const & callback)
+{
+  ScEventSubscriptionBatchTimerState & state = GetBatchTimerState();
+  std::lock_guard<std::mutex> lock(state.m_mutex);
+  // deadlines scheduled during shutdown are posted by it
+  if (!state.m_isStopped && !state.m_thread.joinable())
+    state.m_thread = std::thread(RunBatchTimer);
+
+  size_t const id = ++state.m_lastDeadlineId;
+  auto const & it = state.m_deadlines.emplace(deadline, std::make_pair(id, callback));
+  state.m_deadlinesIterators.emplace(id, it);
+  state.m_condition.notify_all();
+  return id;
+}
+
+bool ScEventSubscriptionBatchTimer::Cancel(size_t deadlineId) noexcept
+{
+  ScEventSubscriptionBatchTimerState & state = GetBatchTimerState();
+  std::lock_guard<std::mutex> lock(state.m_mutex);
+  auto const & it = state.m_deadlinesIterators.find(deadlineId);
+  if (it == state.m_deadlinesIterators.cend())
+    return false;
+
+  state.m_deadlines.erase(it->second);
+  state.m_deadlinesIterators.erase(it);
+  return true;
+}
+
+void ScEventSubscriptionBatchTimer::Shutdown() noexcept
+{
+  ScEventSubscriptionBatchTimerState & state = GetBatchTimerState();
+  std::thread thread;
+  {
+    std::lock_guard<std::mutex> lock(state.m_mutex);
+    state.m_isStopped = true;
+    state.m_condition.notify_all();
+    thread = std::move(state.m_thread);
+  }
+  if (thread.joinable())
+    thread.join();
+
+  // batches of subscriptions that weren't destroyed before shutdown are delivered without waiting for their delay
+  ScEventSubscriptionBatchTimerState::Deadlines deadlines;
+  {
+    std::lock_guard<std::mutex> lock(state.m_mutex);
+    deadlines = std::move(state.m_deadlines);
+    state.m_deadlinesIterators.clear();
+    state.m_isStopped = false;
+  }
+  for (auto const & [_, deadline] : deadlines)
+    PostBatchTimerTask(deadline.second);
+}
@@ -6,6 +6,10 @@
 
 #include "sc-memory/sc_event_wait.hpp"
 
+#include <chrono>
+
+#include "sc-memory/sc_agent_metrics.hpp"
+
 ScWaiter::Impl::Impl() noexcept = default;
 ScWaiter::Impl::~Impl() noexcept = default;
 
@@ -55,7 +59,13 @@ bool ScWaiter::Wait(
     std::function<void(void)> const & onWaitSuccess,
     std::function<void(void)> const & onWaitUnsuccess)
 {
+  // worker thread blocked here doesn't process sc-events, so adaptive pool may start another one
+  sc_memory_wait_point_begin();
+  auto const waitBeginTime = std::chrono::steady_clock::now();
   bool const result = m_impl.Wait(timeout_ms, m_waitStartDelegate);
+  ScAgentMetrics::AddThreadWaitingTime(
+      std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - waitBeginTime).count());
+  sc_memory_wait_point_end();
   if (result)
   {
     if (onWaitSuccess)
@@ -9,9 +9,14 @@
 #include "sc-memory/sc_keynodes.hpp"
 #include "sc-memory/sc_utils.hpp"
 #include "sc-memory/sc_stream.hpp"
+#include "sc-memory/sc_event_subscription.hpp"
+#include "sc-memory/sc_action_completion_registry.hpp"
+#include "sc-memory/sc_agent_metrics.hpp"
 
 #include "sc-memory/utils/sc_logger.hpp"
 
+#include "sc_template_cache.hpp"
+
 extern "C"
 {
 #include <glib.h>
@@ -25,6 +30,8 @@ namespace
 
 bool isLogMuted = false;
 
+ScTemplateCache * templatesCache = nullptr;
+
 void _logPrintHandler(sc_char const *, GLogLevelFlags log_level, sc_char const * message, sc_pointer)
 {
   if (isLogMuted)
@@ -79,11 +86,20 @@ bool ScMemory::Initialize(sc_memory_params const & params)
 
   ScKeynodes::Initialize(ms_globalContext);
 
+  templatesCache = new ScTemplateCache();
+  ScActionCompletionRegistry::Initialize();
+
   ms_globalLogger = utils::ScLogger(
       utils::ScLogger::DefineLogType(params.log_type),
       params.log_file,
       utils::ScLogLevel().FromString(params.log_level));
 
+  sc_memory_set_statistics_dump_callback(
+      []()
+      {
+        ScAgentMetrics::Dump();
+      });
+
   return ms_globalContext != nullptr;
 }
 
@@ -94,8 +110,16 @@ bool ScMemory::IsInitialized()
 
 bool ScMemory::Shutdown(bool saveState /* = true */)
 {
+  sc_memory_set_statistics_dump_callback(nullptr);
+  ScAgentMetrics::Clear();
+
   ms_globalLogger = utils::ScLogger();
 
+  delete templatesCache;
+  templatesCache = nullptr;
+  ScActionCompletionRegistry::Shutdown();
+  ScEventSubscriptionBatchTimer::Shutdown();
+
   ScKeynodes::Shutdown(ms_globalContext);
   bool result = sc_memory_shutdown(saveState);
 
@@ -118,6 +142,17 @@ void ScMemory::LogUnmute()
   ms_globalLogger.Unmute();
 }
 
+size_t ScMemory::GetCachedTemplatesCount()
+{
+  return templatesCache == nullptr ? 0 : templatesCache->GetEntriesCount();
+}
+
+void ScMemory::ClearTemplatesCache()
+{
+  if (templatesCache != nullptr)
+    templatesCache->Clear();
+}
+
 // ---------------
 
 ScMemoryContext::ScMemoryContext() noexcept
@@ -189,10 +224,10 @@ sc_memory_context * ScMemoryContext::GetRealContext() const
   return m_context;
 }
 
-void ScMemoryContext::BeginEventsPending()
+void ScMemoryContext::BeginEventsPending(bool coalesceEvents)
 {
   CHECK_CONTEXT;
-  sc_memory_context_pending_begin(m_context);
+  sc_memory_context_pending_begin_ext(m_context, coalesceEvents);
 }
 
 void ScMemoryContext::EndEventsPending()
@@ -213,6 +248,18 @@ void ScMemoryContext::EndEventsBlocking()
   sc_memory_context_blocking_end(m_context);
 }
 
+bool ScMemoryContext::AreEventsPending() const
+{
+  CHECK_CONTEXT;
+  return sc_memory_context_are_events_pending(m_context);
+}
+
+bool ScMemoryContext::AreEventsBlocking() const
+{
+  CHECK_CONTEXT;
+  return sc_memory_context_are_events_blocking(m_context);
+}
+
 bool ScMemoryContext::IsValid() const
 {
   return m_context != nullptr;
@@ -1228,6 +1275,20 @@ void ScMemoryContext::GenerateByTemplate(
   templateToGenerate.Generate(*this, result, params, nullptr);
 }
 
+void ScMemoryContext::GenerateByTemplateBatch(
+    ScTemplate const & templateToGenerate,
+    std::vector<ScTemplateParams> const & paramsList,
+    std::vector<ScTemplateResultItem> & results,
+    size_t threadsCount)
+{
+  CHECK_CONTEXT;
+  if (threadsCount == 0)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Specified count of threads to generate sc-constructions by sc-template is 0.");
+
+  templateToGenerate.GenerateBatch(*this, paramsList, results, threadsCount);
+}
+
 ScTemplate::Result ScMemoryContext::HelperGenTemplate(
     ScTemplate const & templateToGenerate,
     ScTemplateResultItem & result,
@@ -1251,6 +1312,28 @@ ScTemplate::Result ScMemoryContext::HelperSearchTemplate(
   return SearchByTemplate(templateToFind, result);
 }
 
+ScTemplate::Result ScMemoryContext::SearchByTemplateInStructure(
+    ScTemplate const & templateToFind,
+    ScAddr const & structureAddr,
+    ScTemplateSearchResult & result)
+{
+  CHECK_CONTEXT;
+  if (!structureAddr.IsValid())
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidParams, "Specified sc-structure sc-address is invalid to search sc-constructions in it.");
+
+  return templateToFind.Search(*this, structureAddr, result);
+}
+
+ScTemplate::Result ScMemoryContext::SearchByTemplate(
+    ScTemplate const & templateToFind,
+    ScTemplateSearchResult & result,
+    ScTemplateSearchProfile & profile)
+{
+  CHECK_CONTEXT;
+  return templateToFind.Search(*this, result, profile);
+}
+
 void ScMemoryContext::SearchByTemplate(
     ScTemplate const & templateToFind,
     ScTemplateSearchResultCallback const & callback,
@@ -1353,6 +1436,29 @@ ScTemplate::Result ScMemoryContext::HelperBuildTemplate(
   return ScTemplate::Result(true);
 }
 
+void ScMemoryContext::BuildCachedTemplate(
+    ScTemplate & resultTemplate,
+    ScAddr const & translatableTemplateAddr,
+    ScTemplateParams const & params)
+{
+  CHECK_CONTEXT;
+  if (templatesCache == nullptr)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to build sc-template because sc-memory is not initialized.");
+
+  templatesCache->Build(*this, resultTemplate, translatableTemplateAddr, params);
+}
+
+void ScMemoryContext::BuildCachedTemplate(ScTemplate & resultTemplate, std::string const & translatableSCsTemplate)
+{
+  CHECK_CONTEXT;
+  if (templatesCache == nullptr)
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState, "Not able to build sc-template because sc-memory is not initialized.");
+
+  templatesCache->Build(*this, resultTemplate, translatableSCsTemplate);
+}
+
 void ScMemoryContext::LoadTemplate(
     ScTemplate & translatableTemplate,
     ScAddr & resultTemplateAddr,
@@ -1393,6 +1499,103 @@ ScMemoryContext::ScMemoryStatistics ScMemoryContext::CalculateStatistics() const
   return statistics;
 }
 
+ScMemoryContext::ScEventsQueueStatistics ScMemoryContext::GetEventsQueueStatistics() const
+{
+  CHECK_CONTEXT;
+
+  sc_events_queue_stat stat;
+  sc_result const result = sc_memory_events_queue_stat(m_context, &stat);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events queue statistics because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events queue statistics because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  ScEventsQueueStatistics statistics{};
+  for (sc_uint32 priority = 0; priority < SC_EVENT_PRIORITY_COUNT; ++priority)
+  {
+    statistics.m_queuedEventsNum[priority] = stat.queued_events_count[priority];
+    statistics.m_spilledEventsNum[priority] = stat.spilled_events_count[priority];
+  }
+  statistics.m_droppedEventsNum = stat.dropped_events_count;
+  statistics.m_blockedEmissionsNum = stat.blocked_pushes_count;
+  statistics.m_workersNum = stat.workers_count;
+  statistics.m_idleWorkersNum = stat.sleeping_workers_count;
+  statistics.m_blockedWorkersNum = stat.blocked_workers_count;
+  statistics.m_grownWorkersNum = stat.grown_workers_count;
+  statistics.m_shrunkWorkersNum = stat.shrunk_workers_count;
+
+  return statistics;
+}
+
+ScMemoryContext::ScEventsLatencyStatistics ScMemoryContext::GetEventsLatencyStatistics() const
+{
+  CHECK_CONTEXT;
+
+  sc_events_latency_stat stat;
+  sc_result const result = sc_memory_events_latency_stat(m_context, &stat);
+
+  switch (result)
+  {
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_IS_NOT_AUTHENTICATED:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events latency statistics because sc-memory context is not authorized.");
+
+  case SC_RESULT_ERROR_SC_MEMORY_CONTEXT_HAS_NO_READ_PERMISSIONS:
+    SC_THROW_EXCEPTION(
+        utils::ExceptionInvalidState,
+        "Not able to get sc-events latency statistics because sc-memory context hasn't read permissions.");
+
+  default:
+    break;
+  }
+
+  return ConvertEventsLatencyStatistics(stat);
+}
+
+ScMemoryContext::ScEventsLatencyStatistics ScMemoryContext::GetEventsLatencyStatistics(
+    ScEventSubscription const & subscription) const
+{
+  CheckEventsLatencyStatisticsAccess();
+
+  sc_events_latency_stat stat{};
+  subscription.CollectLatencyStatistics(stat);
+  return ConvertEventsLatencyStatistics(stat);
+}
+
+void ScMemoryContext::CheckEventsLatencyStatisticsAccess() const
+{
+  GetEventsLatencyStatistics();
+}
+
+ScMemoryContext::ScEventsLatencyStatistics ScMemoryContext::ConvertEventsLatencyStatistics(
+    sc_events_latency_stat const & stat)
+{
+  auto const & ConvertHistogram = [](sc_latency_histogram const & histogram) -> ScLatencyStatistics
+  {
+    return {
+        histogram.count,
+        sc_latency_histogram_get_percentile(&histogram, 50),
+        sc_latency_histogram_get_percentile(&histogram, 90),
+        sc_latency_histogram_get_percentile(&histogram, 99),
+        histogram.max};
+  };
+
+  return {ConvertHistogram(stat.queue_latency), ConvertHistogram(stat.execution_duration)};
+}
+
 ScMemoryContext::ScMemoryStatistics ScMemoryContext::CalculateStat() const
 {
   return CalculateStatistics();
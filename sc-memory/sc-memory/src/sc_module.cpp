@@ -15,6 +15,18 @@ ScModule * ScModule::Create(ScModule * module) noexcept
   return module;
 }
 
+ScModule * ScModule::SetAgentsExecutor(std::shared_ptr<ScAgentExecutor> const & executor) noexcept
+{
+  m_agentsExecutor = executor;
+  return this;
+}
+
+std::shared_ptr<ScAgentExecutor> ScModule::GetAgentExecutor(std::string const & agentClassName) const noexcept
+{
+  auto const & it = m_agentExecutors.find(agentClassName);
+  return it != m_agentExecutors.cend() ? it->second : m_agentsExecutor;
+}
+
 void ScModule::Register(ScMemoryContext * context) noexcept(false)
 {
   SC_LOG_INFO("Initialize " << this->GetName());
@@ -29,7 +41,7 @@ void ScModule::Register(ScMemoryContext * context) noexcept(false)
     if (builder != nullptr)
       builder->Initialize(context);
     ScAddr const & agentImplementationAddr = builder ? builder->GetAgentImplementation() : ScAddr::Empty;
-    subscribeCallback(context, agentImplementationAddr, addrs);
+    subscribeCallback(context, agentImplementationAddr, addrs, builder ? builder->GetExecutor() : nullptr);
   }
 }
 
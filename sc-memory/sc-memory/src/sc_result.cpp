@@ -7,12 +7,18 @@
 #include "sc-memory/sc_result.hpp"
 
 ScResult::ScResult()
-  : m_code(SC_RESULT_OK)
+  : ScResult(SC_RESULT_OK)
 {
 }
 
 ScResult::ScResult(sc_result code)
+  : ScResult(code, false)
+{
+}
+
+ScResult::ScResult(sc_result code, bool isSuspended)
   : m_code(code)
+  , m_isSuspended(isSuspended)
 {
 }
 
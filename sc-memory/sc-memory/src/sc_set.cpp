@@ -67,7 +67,7 @@ ScSet & ScSet::operator<<(ScTemplateResultItem const & searchResultItem)
 {
   size_t const size = searchResultItem.Size();
   for (size_t i = 0; i < size; ++i)
-    Append(searchResultItem.m_replacementConstruction[i]);
+    Append(searchResultItem[i]);
 
   return *this;
 }
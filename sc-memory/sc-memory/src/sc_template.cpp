@@ -461,25 +461,45 @@ ScTemplate::ScTemplateTripleType ScTemplate::GetPriority(ScTemplateTriple * trip
 
 // --------------------------------
 
+namespace
+{
+ScTemplate::ScTemplateItemsToReplacementsItemsPositions const kEmptyReplacements;
+}
+
 ScTemplateResultItem::ScTemplateResultItem()
   : m_context(nullptr)
+  , m_replacementConstructionOffset(0)
+  , m_replacementConstructionSize(0)
+{
+}
+
+ScTemplateResultItem::ScTemplateResultItem(ScMemoryContext * context, ScAddrVector results, Replacements replacements)
+  : ScTemplateResultItem(context, std::move(results), std::make_shared<Replacements const>(std::move(replacements)))
 {
 }
 
 ScTemplateResultItem::ScTemplateResultItem(
     ScMemoryContext * context,
     ScAddrVector results,
-    ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacements)
+    std::shared_ptr<Replacements const> replacements)
   : m_context(context)
-  , m_replacementConstruction(std::move(results))
+  , m_replacementConstructionOffset(0)
+  , m_replacementConstructionSize(results.size())
   , m_templateItemsNamesToReplacementItemPositions(std::move(replacements))
 {
+  m_replacementConstructions = std::make_shared<ScAddrVector const>(std::move(results));
 }
 
 ScTemplateResultItem::ScTemplateResultItem(
     ScMemoryContext * context,
-    ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacements)
+    std::shared_ptr<ScAddrVector const> constructions,
+    size_t offset,
+    size_t size,
+    std::shared_ptr<Replacements const> replacements)
   : m_context(context)
+  , m_replacementConstructions(std::move(constructions))
+  , m_replacementConstructionOffset(offset)
+  , m_replacementConstructionSize(size)
   , m_templateItemsNamesToReplacementItemPositions(std::move(replacements))
 {
 }
@@ -489,7 +509,7 @@ ScTemplateResultItem::~ScTemplateResultItem() = default;
 ScTemplateResultItem::ScTemplateResultItem(ScTemplateResultItem const & otherItem)
   : ScTemplateResultItem(
         otherItem.m_context,
-        otherItem.m_replacementConstruction,
+        ScAddrVector(otherItem.begin(), otherItem.end()),
         otherItem.m_templateItemsNamesToReplacementItemPositions)
 {
 }
@@ -499,14 +519,43 @@ ScTemplateResultItem & ScTemplateResultItem::operator=(ScTemplateResultItem cons
   if (this == &otherItem)
     return *this;
 
+  // view of search result buffer can be changed by search, so copy owns found sc-addresses
   m_context = otherItem.m_context;
-  m_replacementConstruction.assign(
-      otherItem.m_replacementConstruction.cbegin(), otherItem.m_replacementConstruction.cend());
+  m_replacementConstructions = std::make_shared<ScAddrVector const>(otherItem.begin(), otherItem.end());
+  m_replacementConstructionOffset = 0;
+  m_replacementConstructionSize = otherItem.m_replacementConstructionSize;
   m_templateItemsNamesToReplacementItemPositions = otherItem.m_templateItemsNamesToReplacementItemPositions;
 
   return *this;
 }
 
+ScTemplateResultItem::ScTemplateResultItem(ScTemplateResultItem && otherItem) noexcept
+  : m_context(otherItem.m_context)
+  , m_replacementConstructions(std::move(otherItem.m_replacementConstructions))
+  , m_replacementConstructionOffset(otherItem.m_replacementConstructionOffset)
+  , m_replacementConstructionSize(otherItem.m_replacementConstructionSize)
+  , m_templateItemsNamesToReplacementItemPositions(std::move(otherItem.m_templateItemsNamesToReplacementItemPositions))
+{
+  otherItem.m_replacementConstructionOffset = 0;
+  otherItem.m_replacementConstructionSize = 0;
+}
+
+ScTemplateResultItem & ScTemplateResultItem::operator=(ScTemplateResultItem && otherItem) noexcept
+{
+  if (this == &otherItem)
+    return *this;
+
+  m_context = otherItem.m_context;
+  m_replacementConstructions = std::move(otherItem.m_replacementConstructions);
+  m_replacementConstructionOffset = otherItem.m_replacementConstructionOffset;
+  m_replacementConstructionSize = otherItem.m_replacementConstructionSize;
+  m_templateItemsNamesToReplacementItemPositions = std::move(otherItem.m_templateItemsNamesToReplacementItemPositions);
+
+  otherItem.m_replacementConstructionOffset = 0;
+  otherItem.m_replacementConstructionSize = 0;
+  return *this;
+}
+
 bool ScTemplateResultItem::Get(ScAddr const & varAddr, ScAddr & outAddr) const noexcept
 {
   ScAddr const & addr = GetAddrByVarAddr(varAddr);
@@ -555,7 +604,7 @@ bool ScTemplateResultItem::Get(size_t index, ScAddr & outAddr) const noexcept
 {
   if (index < Size())
   {
-    outAddr = m_replacementConstruction[index];
+    outAddr = begin()[index];
     return true;
   }
 
@@ -566,7 +615,7 @@ bool ScTemplateResultItem::Get(size_t index, ScAddr & outAddr) const noexcept
 ScAddr const & ScTemplateResultItem::operator[](size_t index) const noexcept(false)
 {
   if (index < Size())
-    return m_replacementConstruction[index];
+    return begin()[index];
 
   SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Index=" << index << " must be < size=" << Size());
 }
@@ -585,36 +634,43 @@ bool ScTemplateResultItem::Has(ScAddr const & varAddr) const noexcept
 
 size_t ScTemplateResultItem::Size() const noexcept
 {
-  return m_replacementConstruction.size();
+  return m_replacementConstructionSize;
 }
 
 ScAddrVector::const_iterator ScTemplateResultItem::begin() const
 {
-  return m_replacementConstruction.cbegin();
+  if (m_replacementConstructions == nullptr)
+    return ScAddrVector::const_iterator();
+
+  return m_replacementConstructions->cbegin() + m_replacementConstructionOffset;
 }
 
 ScAddrVector::const_iterator ScTemplateResultItem::end() const
 {
-  return m_replacementConstruction.cend();
+  return begin() + m_replacementConstructionSize;
 }
 
 ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & ScTemplateResultItem::GetReplacements() const noexcept
 {
-  return m_templateItemsNamesToReplacementItemPositions;
+  if (m_templateItemsNamesToReplacementItemPositions == nullptr)
+    return kEmptyReplacements;
+
+  return *m_templateItemsNamesToReplacementItemPositions;
 }
 
 ScAddr ScTemplateResultItem::GetAddrByName(std::string const & name) const
 {
-  auto it = m_templateItemsNamesToReplacementItemPositions.find(name);
-  if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-    return m_replacementConstruction[it->second];
+  Replacements const & replacements = GetReplacements();
+  auto it = replacements.find(name);
+  if (it != replacements.cend())
+    return begin()[it->second];
 
   ScAddr const & addr = m_context->SearchElementBySystemIdentifier(name);
   if (addr.IsValid())
   {
-    it = m_templateItemsNamesToReplacementItemPositions.find(addr);
-    if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-      return m_replacementConstruction[it->second];
+    it = replacements.find(addr);
+    if (it != replacements.cend())
+      return begin()[it->second];
   }
 
   return ScAddr::Empty;
@@ -625,25 +681,31 @@ ScAddr ScTemplateResultItem::GetAddrByVarAddr(ScAddr const & varAddr) const
   if (!varAddr.IsValid())
     return ScAddr::Empty;
 
-  auto it = m_templateItemsNamesToReplacementItemPositions.find(varAddr);
-  if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-    return m_replacementConstruction[it->second];
+  Replacements const & replacements = GetReplacements();
+  auto it = replacements.find(varAddr);
+  if (it != replacements.cend())
+    return begin()[it->second];
 
   std::string const & varIdtf = m_context->GetElementSystemIdentifier(varAddr);
-  it = m_templateItemsNamesToReplacementItemPositions.find(varIdtf);
-  if (it != m_templateItemsNamesToReplacementItemPositions.cend())
-    return m_replacementConstruction[it->second];
+  it = replacements.find(varIdtf);
+  if (it != replacements.cend())
+    return begin()[it->second];
 
   return ScAddr::Empty;
 }
 
 // --------------------------------
 
-ScTemplateSearchResult::ScTemplateSearchResult() noexcept = default;
+ScTemplateSearchResult::ScTemplateSearchResult() noexcept
+  : m_replacementConstructions(std::make_shared<ScAddrVector>())
+  , m_templateItemsNamesToReplacementItemsPositions(
+        std::make_shared<ScTemplate::ScTemplateItemsToReplacementsItemsPositions>())
+{
+}
 
 size_t ScTemplateSearchResult::Size() const noexcept
 {
-  return m_replacementConstructions.size();
+  return m_replacementConstructionSize == 0 ? 0 : m_replacementConstructions->size() / m_replacementConstructionSize;
 }
 
 bool ScTemplateSearchResult::IsEmpty() const noexcept
@@ -657,8 +719,9 @@ bool ScTemplateSearchResult::Get(size_t index, ScTemplateResultItem & outItem) c
   {
     outItem.m_context = m_context;
     outItem.m_templateItemsNamesToReplacementItemPositions = m_templateItemsNamesToReplacementItemsPositions;
-    outItem.m_replacementConstruction.assign(
-        m_replacementConstructions[index].cbegin(), m_replacementConstructions[index].cend());
+    outItem.m_replacementConstructions = m_replacementConstructions;
+    outItem.m_replacementConstructionOffset = index * m_replacementConstructionSize;
+    outItem.m_replacementConstructionSize = m_replacementConstructionSize;
     return true;
   }
 
@@ -668,22 +731,30 @@ bool ScTemplateSearchResult::Get(size_t index, ScTemplateResultItem & outItem) c
 ScTemplateResultItem ScTemplateSearchResult::operator[](size_t index) const noexcept(false)
 {
   if (index < Size())
-    return {m_context, m_replacementConstructions[index], m_templateItemsNamesToReplacementItemsPositions};
+    return {
+        m_context,
+        m_replacementConstructions,
+        index * m_replacementConstructionSize,
+        m_replacementConstructionSize,
+        m_templateItemsNamesToReplacementItemsPositions};
 
   SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, "Index=" << index << " must be < size=" << Size());
 }
 
 void ScTemplateSearchResult::Clear() noexcept
 {
-  m_replacementConstructions.clear();
-  m_templateItemsNamesToReplacementItemsPositions.clear();
+  // items of previous results can still refer to buffers, so they aren't reused
+  m_replacementConstructions = std::make_shared<ScAddrVector>();
+  m_replacementConstructionSize = 0;
+  m_templateItemsNamesToReplacementItemsPositions =
+      std::make_shared<ScTemplate::ScTemplateItemsToReplacementsItemsPositions>();
 }
 
 ScTemplate::ScTemplateItemsToReplacementsItemsPositions ScTemplateSearchResult::GetReplacements() const noexcept
 {
   ScTemplate::ScTemplateItemsToReplacementsItemsPositions replacementsItemsPositions;
 
-  for (auto const & item : m_templateItemsNamesToReplacementItemsPositions)
+  for (auto const & item : *m_templateItemsNamesToReplacementItemsPositions)
   {
     replacementsItemsPositions.insert(item);
 
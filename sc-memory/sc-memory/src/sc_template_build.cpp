@@ -14,6 +14,8 @@
 
 #include "sc-memory/sc_memory.hpp"
 
+#include "sc_template_cache.hpp"
+
 namespace
 {
 
@@ -88,53 +90,32 @@ private:
 
 class ScTemplateBuilder
 {
-  friend class ScTemplate;
+  friend void CollectTemplateStructureTriples(
+      ScMemoryContext & context,
+      ScAddr const & templateAddr,
+      ScTemplateStructureTriples & triples);
+
   using ConnectorDependencyMap = std::unordered_multimap<ScAddr::HashType, ScAddr::HashType>;
   using ObjectHashToInfoMap = std::unordered_map<ScAddr::HashType, TemplateObjectInfo>;
   using HashSet = std::set<ScAddr::HashType>;
   using LevelCache = std::unordered_map<ScAddr::HashType, size_t>;
 
 protected:
-  ScTemplateBuilder(ScAddr const & templateAddr, ScMemoryContext & context, ScTemplateParams const & params)
+  ScTemplateBuilder(ScAddr const & templateAddr, ScMemoryContext & context)
     : m_templateAddr(templateAddr)
     , m_context(context)
   {
-    auto const & replacements = params.GetAll();
-    for (auto const & item : replacements)
-    {
-      ScAddr const & addr = m_context.SearchElementBySystemIdentifier(item.first);
-      if (m_context.IsElement(addr))
-      {
-        TemplateObjectInfo objInfo = CollectObjectInfo(item.second, addr);
-        m_objectInfos.insert({addr.Hash(), objInfo});
-      }
-      else
-      {
-        TemplateObjectInfo objInfo = CollectObjectInfo(item.second, item.second);
-        std::stringstream ss(item.first);
-        ScAddr::HashType hash;
-        ss >> hash;
-        ScAddr varNode(hash);
-        m_objectInfos.insert({varNode.Hash(), objInfo});
-      }
-    }
   }
 
-  void operator()(ScTemplate * targetTemplate)
+  void operator()(ScTemplateStructureTriples & triples)
   {
-    if (!targetTemplate)
-      return;
-
     HashSet independentConnectorHashes;
 
     ScIterator3Ptr iterator = m_context.CreateIterator3(m_templateAddr, ScType::ConstPermPosArc, ScType::Unknown);
     while (iterator->Next())
     {
       ScAddr const & objectAddr = iterator->Get(2);
-
-      // Try to find object info in the map, otherwise collect it from memory
-      auto const & it = m_objectInfos.find(objectAddr.Hash());
-      TemplateObjectInfo objInfo = it == m_objectInfos.cend() ? CollectObjectInfo(objectAddr) : it->second;
+      TemplateObjectInfo objInfo = CollectObjectInfo(objectAddr);
 
       if (objInfo.IsConnector())
       {
@@ -162,8 +143,13 @@ protected:
     connectorsByDependencyLevel.emplace_back(independentConnectorHashes);
     GroupConnectorsByDependencyLevel(connectorsByDependencyLevel);
 
+    auto const & object = [](TemplateObjectInfo const & objInfo) -> ScTemplateStructureObject
+    {
+      return {objInfo.GetAddr(), objInfo.GetType(), objInfo.GetIdentifier()};
+    };
+
     // For each group of connectors with the same dependency level,
-    // add the corresponding triples to the template
+    // collect the corresponding triples of the template
     for (auto const & connectorsWithSameLevel : connectorsByDependencyLevel)
     {
       for (ScAddr::HashType const & connectorHash : connectorsWithSameLevel)
@@ -172,18 +158,7 @@ protected:
         TemplateObjectInfo const & sourceInfo = m_objectInfos.at(connectorInfo.GetSourceHash());
         TemplateObjectInfo const & targetInfo = m_objectInfos.at(connectorInfo.GetTargetHash());
 
-        auto const & param = [targetTemplate](TemplateObjectInfo const & objInfo) -> ScTemplateItem
-        {
-          // If the object is constant, use its address and identifier
-          // Otherwise, use its identifier or type + identifier depending on replacements
-          return objInfo.GetType().IsConst() ? objInfo.GetAddr() >> objInfo.GetIdentifier()
-                                             : (targetTemplate->HasReplacement(objInfo.GetIdentifier())
-                                                    ? objInfo.GetIdentifier()
-                                                    : objInfo.GetType() >> objInfo.GetIdentifier());
-        };
-
-        // Add the triple (source, connector, target) to the template
-        targetTemplate->Triple(param(sourceInfo), param(connectorInfo), param(targetInfo));
+        triples.push_back({object(sourceInfo), object(connectorInfo), object(targetInfo)});
       }
     }
   }
@@ -191,7 +166,6 @@ protected:
 protected:
   ScAddr m_templateAddr;
   ScMemoryContext & m_context;
-  ScTemplateParams m_params;
 
   ObjectHashToInfoMap m_objectInfos;
   ConnectorDependencyMap m_connectorDependencyMap;
@@ -265,11 +239,61 @@ private:
   }
 };
 
+void CollectTemplateStructureTriples(
+    ScMemoryContext & context,
+    ScAddr const & templateAddr,
+    ScTemplateStructureTriples & triples)
+{
+  ScTemplateBuilder builder(templateAddr, context);
+  builder(triples);
+}
+
+void TranslateTemplateStructureTriples(
+    ScMemoryContext & context,
+    ScTemplateStructureTriples const & triples,
+    ScTemplateParams const & params,
+    ScTemplate & templ)
+{
+  std::unordered_map<ScAddr::HashType, ScTemplateStructureObject> replacements;
+  for (auto const & item : params.GetAll())
+  {
+    ScAddr const & addr = context.SearchElementBySystemIdentifier(item.first);
+    if (context.IsElement(addr))
+      replacements.insert({addr.Hash(), {item.second, context.GetElementType(item.second), std::string(addr)}});
+    else
+    {
+      std::stringstream ss(item.first);
+      ScAddr::HashType hash;
+      ss >> hash;
+      ScAddr varNode(hash);
+      replacements.insert(
+          {varNode.Hash(), {item.second, context.GetElementType(item.second), std::string(item.second)}});
+    }
+  }
+
+  auto const & param = [&templ, &replacements](ScTemplateStructureObject const & object) -> ScTemplateItem
+  {
+    auto const & it = replacements.find(object.m_addr.Hash());
+    ScTemplateStructureObject const & objInfo = it == replacements.cend() ? object : it->second;
+
+    // If the object is constant, use its address and identifier
+    // Otherwise, use its identifier or type + identifier depending on replacements
+    return objInfo.m_type.IsConst()
+               ? objInfo.m_addr >> objInfo.m_idtf
+               : (templ.HasReplacement(objInfo.m_idtf) ? objInfo.m_idtf : objInfo.m_type >> objInfo.m_idtf);
+  };
+
+  // Add the triples (source, connector, target) to the template
+  for (auto const & [source, connector, target] : triples)
+    templ.Triple(param(source), param(connector), param(target));
+}
+
 void ScTemplate::TranslateFrom(
     ScMemoryContext & ctx,
     ScAddr const & translatableTemplateAddr,
     ScTemplateParams const & params)
 {
-  ScTemplateBuilder builder(translatableTemplateAddr, ctx, params);
-  builder(this);
+  ScTemplateStructureTriples triples;
+  CollectTemplateStructureTriples(ctx, translatableTemplateAddr, triples);
+  TranslateTemplateStructureTriples(ctx, triples, params, *this);
 }
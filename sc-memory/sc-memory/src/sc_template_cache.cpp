@@ -0,0 +1,348 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_template_cache.hpp"
+
+#include <iterator>
+
+#include "sc-memory/sc_memory.hpp"
+#include "sc-memory/sc_keynodes.hpp"
+
+template <typename TKey, typename TEntry, typename THashFunc>
+std::shared_ptr<TEntry const> ScTemplateCache::Entries<TKey, TEntry, THashFunc>::Get(TKey const & key) noexcept
+{
+  auto const & it = m_index.find(key);
+  if (it == m_index.cend())
+    return nullptr;
+
+  m_list.splice(m_list.begin(), m_list, it->second);
+  return it->second->second;
+}
+
+template <typename TKey, typename TEntry, typename THashFunc>
+std::optional<TKey> ScTemplateCache::Entries<TKey, TEntry, THashFunc>::Put(
+    TKey const & key,
+    std::shared_ptr<TEntry const> const & entry)
+{
+  auto const & it = m_index.find(key);
+  if (it != m_index.cend())
+  {
+    it->second->second = entry;
+    m_list.splice(m_list.begin(), m_list, it->second);
+    return std::nullopt;
+  }
+
+  std::optional<TKey> evictedKey;
+  if (m_list.size() >= kMaxEntriesCount)
+  {
+    evictedKey = m_list.back().first;
+    m_index.erase(m_list.back().first);
+    m_list.pop_back();
+  }
+
+  m_list.emplace_front(key, entry);
+  m_index.insert({key, m_list.begin()});
+  return evictedKey;
+}
+
+template <typename TKey, typename TEntry, typename THashFunc>
+bool ScTemplateCache::Entries<TKey, TEntry, THashFunc>::Remove(TKey const & key) noexcept
+{
+  auto const & it = m_index.find(key);
+  if (it == m_index.cend())
+    return false;
+
+  m_list.erase(it->second);
+  m_index.erase(it);
+  return true;
+}
+
+template <typename TKey, typename TEntry, typename THashFunc>
+size_t ScTemplateCache::Entries<TKey, TEntry, THashFunc>::Size() const noexcept
+{
+  return m_list.size();
+}
+
+template <typename TKey, typename TEntry, typename THashFunc>
+void ScTemplateCache::Entries<TKey, TEntry, THashFunc>::Clear() noexcept
+{
+  m_index.clear();
+  m_list.clear();
+}
+
+size_t ScTemplateCache::StructureKeyHashFunc::operator()(StructureKey const & key) const
+{
+  return std::hash<ScAddr::HashType>()(key.first.Hash()) * 31 + std::hash<ScAddr::HashType>()(key.second.Hash());
+}
+
+size_t ScTemplateCache::ScsKeyHashFunc::operator()(ScsKey const & key) const
+{
+  return std::hash<ScAddr::HashType>()(key.first.Hash()) * 31 + std::hash<std::string>()(key.second);
+}
+
+ScTemplateCache::ScTemplateCache() noexcept = default;
+
+ScTemplateCache::~ScTemplateCache() noexcept
+{
+  // handlers of subscriptions use this cache, so subscriptions are destroyed before other members
+  Clear();
+
+  Subscriptions identifiersSubscriptions;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    identifiersSubscriptions = std::move(m_identifiersSubscriptions);
+  }
+}
+
+void ScTemplateCache::Build(
+    ScMemoryContext & context,
+    ScTemplate & templ,
+    ScAddr const & templateAddr,
+    ScTemplateParams const & params)
+{
+  StructureKey const key{context.GetUser(), templateAddr};
+
+  // there is nothing to subscribe to, so sc-template is built without cache
+  if (!context.IsElement(templateAddr))
+  {
+    Subscriptions unusedSubscriptions;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      RemoveStructureEntry(key);
+      unusedSubscriptions = std::move(m_unusedSubscriptions);
+    }
+
+    ScTemplateStructureTriples triples;
+    CollectTemplateStructureTriples(context, templateAddr, triples);
+    TranslateTemplateStructureTriples(context, triples, params, templ);
+    return;
+  }
+
+  // subscriptions wait for their handlers, so unused ones are destroyed after lock is released
+  Subscriptions unusedSubscriptions;
+  std::shared_ptr<StructureEntry const> entry;
+  size_t version;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry = m_structuresEntries.Get(key);
+    version = WatchStructure(templateAddr).m_version;
+    unusedSubscriptions = std::move(m_unusedSubscriptions);
+  }
+
+  if (entry == nullptr || entry->m_version != version)
+  {
+    // structure is subscribed before it is read, so its changes during reading make entry not actual
+    auto builtEntry = std::make_shared<StructureEntry>();
+    builtEntry->m_version = version;
+    try
+    {
+      CollectTemplateStructureTriples(context, templateAddr, builtEntry->m_triples);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      RemoveStructureEntry(key);
+      UnwatchStructure(templateAddr);
+      throw;
+    }
+    entry = builtEntry;
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    PutStructureEntry(key, entry);
+    std::move(m_unusedSubscriptions.begin(), m_unusedSubscriptions.end(), std::back_inserter(unusedSubscriptions));
+    m_unusedSubscriptions.clear();
+  }
+
+  TranslateTemplateStructureTriples(context, entry->m_triples, params, templ);
+}
+
+void ScTemplateCache::Build(ScMemoryContext & context, ScTemplate & templ, std::string const & translatableSCsTemplate)
+{
+  ScsKey const key{context.GetUser(), translatableSCsTemplate};
+
+  Subscriptions unusedSubscriptions;
+  std::shared_ptr<ScsEntry const> entry;
+  size_t version;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    entry = m_scsEntries.Get(key);
+    if (m_identifiersSubscriptions.empty())
+    {
+      m_identifiersVersion = ++m_lastVersion;
+      try
+      {
+        ScAddrVector const eventClassAddrs = {
+            ScKeynodes::sc_event_after_generate_outgoing_arc, ScKeynodes::sc_event_before_erase_outgoing_arc};
+        for (ScAddr const & eventClassAddr : eventClassAddrs)
+          m_identifiersSubscriptions.emplace_back(new ScElementaryEventSubscription<ScElementaryEvent>(
+              *ScMemory::ms_globalContext,
+              eventClassAddr,
+              ScKeynodes::nrel_system_identifier,
+              [this](ScElementaryEvent const &)
+              {
+                OnIdentifierChanged();
+              }));
+      }
+      catch (utils::ScException const & e)
+      {
+        SC_LOG_WARNING("ScTemplateCache: System identifiers can't be watched: " << e.Message());
+        std::move(
+            m_identifiersSubscriptions.begin(),
+            m_identifiersSubscriptions.end(),
+            std::back_inserter(m_unusedSubscriptions));
+        m_identifiersSubscriptions.clear();
+      }
+    }
+    version = m_identifiersVersion;
+    unusedSubscriptions = std::move(m_unusedSubscriptions);
+  }
+
+  if (entry == nullptr || entry->m_version != version)
+  {
+    auto builtEntry = std::make_shared<ScsEntry>();
+    builtEntry->m_version = version;
+    CollectTemplateScsTriples(context, translatableSCsTemplate, builtEntry->m_triples);
+    entry = builtEntry;
+
+    // entry is added if system identifiers weren't changed while sc.s-template was parsed
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!m_identifiersSubscriptions.empty() && m_identifiersVersion == version)
+      m_scsEntries.Put(key, entry);
+    else
+      m_scsEntries.Remove(key);
+  }
+
+  for (auto const & [sourceItem, connectorItem, targetItem] : entry->m_triples)
+    templ.Triple(sourceItem, connectorItem, targetItem);
+}
+
+size_t ScTemplateCache::GetEntriesCount() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_structuresEntries.Size() + m_scsEntries.Size();
+}
+
+void ScTemplateCache::Clear() noexcept
+{
+  Subscriptions unusedSubscriptions;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_structuresEntries.Clear();
+    m_scsEntries.Clear();
+
+    for (auto & [templateAddr, watch] : m_structuresWatches)
+      std::move(
+          watch.m_subscriptions.begin(), watch.m_subscriptions.end(), std::back_inserter(m_unusedSubscriptions));
+    m_structuresWatches.clear();
+    unusedSubscriptions = std::move(m_unusedSubscriptions);
+  }
+}
+
+ScTemplateCache::StructureWatch & ScTemplateCache::WatchStructure(ScAddr const & templateAddr) noexcept
+{
+  StructureWatch & watch = m_structuresWatches[templateAddr];
+  if (!watch.m_subscriptions.empty())
+    return watch;
+
+  watch.m_version = ++m_lastVersion;
+  try
+  {
+    ScAddrVector const eventClassAddrs = {
+        ScKeynodes::sc_event_after_generate_outgoing_arc,
+        ScKeynodes::sc_event_before_erase_outgoing_arc,
+        ScKeynodes::sc_event_before_erase_element};
+    for (ScAddr const & eventClassAddr : eventClassAddrs)
+      watch.m_subscriptions.emplace_back(new ScElementaryEventSubscription<ScElementaryEvent>(
+          *ScMemory::ms_globalContext,
+          eventClassAddr,
+          templateAddr,
+          [this](ScElementaryEvent const & event)
+          {
+            OnStructureChanged(
+                event.GetSubscriptionElement(), event.GetEventClass() == ScKeynodes::sc_event_before_erase_element);
+          }));
+  }
+  catch (utils::ScException const & e)
+  {
+    SC_LOG_WARNING("ScTemplateCache: Sc-template structure can't be watched: " << e.Message());
+    std::move(watch.m_subscriptions.begin(), watch.m_subscriptions.end(), std::back_inserter(m_unusedSubscriptions));
+    watch.m_subscriptions.clear();
+  }
+  return watch;
+}
+
+void ScTemplateCache::PutStructureEntry(StructureKey const & key, std::shared_ptr<StructureEntry const> const & entry)
+{
+  ScAddr const & templateAddr = key.second;
+  auto const & watchIt = m_structuresWatches.find(templateAddr);
+
+  // entry is added if structure is subscribed and wasn't changed while it was read
+  if (watchIt == m_structuresWatches.cend() || watchIt->second.m_subscriptions.empty()
+      || watchIt->second.m_version != entry->m_version)
+  {
+    RemoveStructureEntry(key);
+    UnwatchStructure(templateAddr);
+    return;
+  }
+
+  if (m_structuresEntries.Get(key) == nullptr)
+    ++watchIt->second.m_entriesCount;
+
+  std::optional<StructureKey> const evictedKey = m_structuresEntries.Put(key, entry);
+  if (!evictedKey.has_value())
+    return;
+
+  auto const & evictedWatchIt = m_structuresWatches.find(evictedKey->second);
+  if (evictedWatchIt != m_structuresWatches.cend() && evictedWatchIt->second.m_entriesCount != 0)
+    --evictedWatchIt->second.m_entriesCount;
+  UnwatchStructure(evictedKey->second);
+}
+
+void ScTemplateCache::RemoveStructureEntry(StructureKey const & key) noexcept
+{
+  if (!m_structuresEntries.Remove(key))
+    return;
+
+  auto const & watchIt = m_structuresWatches.find(key.second);
+  if (watchIt != m_structuresWatches.cend() && watchIt->second.m_entriesCount != 0)
+    --watchIt->second.m_entriesCount;
+  UnwatchStructure(key.second);
+}
+
+void ScTemplateCache::UnwatchStructure(ScAddr const & templateAddr) noexcept
+{
+  auto const & watchIt = m_structuresWatches.find(templateAddr);
+  if (watchIt == m_structuresWatches.cend() || watchIt->second.m_entriesCount != 0)
+    return;
+
+  Subscriptions & subscriptions = watchIt->second.m_subscriptions;
+  std::move(subscriptions.begin(), subscriptions.end(), std::back_inserter(m_unusedSubscriptions));
+  m_structuresWatches.erase(watchIt);
+}
+
+void ScTemplateCache::OnStructureChanged(ScAddr const & templateAddr, bool isErased) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto const & watchIt = m_structuresWatches.find(templateAddr);
+  if (watchIt == m_structuresWatches.cend())
+    return;
+
+  StructureWatch & watch = watchIt->second;
+  watch.m_version = ++m_lastVersion;
+
+  // subscriptions of erased structure are not valid, and its sc-address may be reused by new sc-template structure
+  if (isErased)
+  {
+    std::move(watch.m_subscriptions.begin(), watch.m_subscriptions.end(), std::back_inserter(m_unusedSubscriptions));
+    watch.m_subscriptions.clear();
+  }
+}
+
+void ScTemplateCache::OnIdentifierChanged() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_identifiersVersion = ++m_lastVersion;
+}
@@ -0,0 +1,217 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <array>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "sc-memory/sc_template.hpp"
+#include "sc-memory/sc_event_subscription.hpp"
+
+//! Sc-element of sc-template structure with its sc-type and identifier used in object of `ScTemplate`.
+struct ScTemplateStructureObject
+{
+  ScAddr m_addr;
+  ScType m_type;
+  std::string m_idtf;
+};
+
+//! Triples of sc-template structure in the order they are added to object of `ScTemplate`.
+using ScTemplateStructureTriples = std::vector<std::array<ScTemplateStructureObject, 3>>;
+//! Triples of sc.s-template in the order they are added to object of `ScTemplate`.
+using ScTemplateItemsTriples = std::vector<std::array<ScTemplateItem, 3>>;
+
+/*!
+ * @brief Collects triples of sc-template structure ordered by dependency levels of their sc-connectors.
+ * @param context A sc-memory context used to read sc-template structure.
+ * @param templateAddr A sc-address of sc-template structure.
+ * @param triples Collected triples.
+ */
+void CollectTemplateStructureTriples(
+    ScMemoryContext & context,
+    ScAddr const & templateAddr,
+    ScTemplateStructureTriples & triples);
+
+/*!
+ * @brief Adds triples of sc-template structure to object of `ScTemplate`, replacing sc-variables by parameters.
+ * @param context A sc-memory context used to resolve parameters.
+ * @param triples Triples of sc-template structure.
+ * @param params Parameters of sc-template.
+ * @param templ An object of `ScTemplate` to be built.
+ */
+void TranslateTemplateStructureTriples(
+    ScMemoryContext & context,
+    ScTemplateStructureTriples const & triples,
+    ScTemplateParams const & params,
+    ScTemplate & templ);
+
+/*!
+ * @brief Parses sc.s-template and collects its triples.
+ * @param context A sc-memory context used to resolve system identifiers.
+ * @param translatableSCsTemplate A sc.s-template.
+ * @param triples Collected triples.
+ * @throws utils::ExceptionParseError if sc.s-template can't be parsed.
+ * @throws utils::ExceptionInvalidState if some sc-constant of sc.s-template can't be found.
+ */
+void CollectTemplateScsTriples(
+    ScMemoryContext & context,
+    std::string const & translatableSCsTemplate,
+    ScTemplateItemsTriples & triples);
+
+/*!
+ * @class ScTemplateCache
+ * @brief Process-wide cache of built sc-templates.
+ *
+ * Sc-templates represented in sc-memory are cached by sc-addresses of their structures, sc.s-templates are cached by
+ * their texts. Entries are scoped by users of sc-memory contexts that build sc-templates, so sc-template read with
+ * permissions of one user is never given to another one. Each entry stores triples to be added to object of
+ * `ScTemplate`, so building cached sc-template doesn't read sc-template structure or parse sc.s-text. Parameters of
+ * sc-templates in sc-memory are applied to cached triples on each build.
+ *
+ * Entries are invalidated by sc-event subscriptions, so build of cached sc-template costs O(1) checks. Sc-template
+ * structure is subscribed to generating and erasing of its sc-arcs and to its erasure while it has entries. Entries of
+ * sc.s-templates are invalidated when some system identifier is assigned or removed. Each change increments version,
+ * and entry is actual while it has the version it was built with, so changes made while entry is built aren't missed.
+ * When count of entries of some kind reaches its maximum, the least recently used entry is evicted.
+ */
+class ScTemplateCache
+{
+public:
+  //! Max count of entries of sc-templates represented in sc-memory and of sc.s-templates.
+  static size_t constexpr kMaxEntriesCount = 1024;
+
+  ScTemplateCache() noexcept;
+
+  ~ScTemplateCache() noexcept;
+
+  /*!
+   * @brief Builds sc-template represented in sc-memory using cache.
+   * @param context A sc-memory context used to build sc-template if it isn't cached.
+   * @param templ An object of `ScTemplate` to be built.
+   * @param templateAddr A sc-address of sc-template structure.
+   * @param params Parameters of sc-template.
+   */
+  void Build(
+      ScMemoryContext & context,
+      ScTemplate & templ,
+      ScAddr const & templateAddr,
+      ScTemplateParams const & params) noexcept(false);
+
+  /*!
+   * @brief Builds sc.s-template using cache.
+   * @param context A sc-memory context used to build sc-template if it isn't cached.
+   * @param templ An object of `ScTemplate` to be built.
+   * @param translatableSCsTemplate A sc.s-template.
+   */
+  void Build(ScMemoryContext & context, ScTemplate & templ, std::string const & translatableSCsTemplate) noexcept(
+      false);
+
+  //! Gets count of cached sc-templates.
+  size_t GetEntriesCount() noexcept;
+
+  //! Removes all entries.
+  void Clear() noexcept;
+
+private:
+  struct StructureEntry
+  {
+    ScTemplateStructureTriples m_triples;
+    size_t m_version = 0;  ///< Version of sc-template structure when it was read.
+  };
+
+  struct ScsEntry
+  {
+    ScTemplateItemsTriples m_triples;
+    size_t m_version = 0;  ///< Version of system identifiers when sc.s-template was parsed.
+  };
+
+  using StructureKey = std::pair<ScAddr, ScAddr>;
+  using ScsKey = std::pair<ScAddr, std::string>;
+  using Subscriptions = std::vector<std::unique_ptr<ScEventSubscription>>;
+
+  struct StructureKeyHashFunc
+  {
+    size_t operator()(StructureKey const & key) const;
+  };
+
+  struct ScsKeyHashFunc
+  {
+    size_t operator()(ScsKey const & key) const;
+  };
+
+  //! Subscriptions to changes of sc-template structure and count of its entries of different users.
+  struct StructureWatch
+  {
+    Subscriptions m_subscriptions;  ///< They are empty if structure is erased.
+    size_t m_version = 0;           ///< Version of the last change of structure.
+    size_t m_entriesCount = 0;
+  };
+
+  //! Entries of one kind ordered from the most recently used to the least recently used one.
+  template <typename TKey, typename TEntry, typename THashFunc>
+  class Entries
+  {
+  public:
+    //! Gets entry by key and marks it as the most recently used one. Returns nullptr if there is no entry.
+    std::shared_ptr<TEntry const> Get(TKey const & key) noexcept;
+
+    /*!
+     * Adds or replaces entry by key. Evicts the least recently used entry if there is no place for new one.
+     * @return Key of evicted entry, if some entry is evicted.
+     */
+    std::optional<TKey> Put(TKey const & key, std::shared_ptr<TEntry const> const & entry);
+
+    //! Removes entry by key. Returns false if there is no entry.
+    bool Remove(TKey const & key) noexcept;
+
+    size_t Size() const noexcept;
+
+    void Clear() noexcept;
+
+  private:
+    using List = std::list<std::pair<TKey, std::shared_ptr<TEntry const>>>;
+
+    List m_list;
+    std::unordered_map<TKey, typename List::iterator, THashFunc> m_index;
+  };
+
+  //! Gets watch of sc-template structure and subscribes structure if it isn't subscribed. It is called under lock.
+  StructureWatch & WatchStructure(ScAddr const & templateAddr) noexcept;
+
+  //! Adds entry if its structure wasn't changed since it was read. It is called under lock.
+  void PutStructureEntry(StructureKey const & key, std::shared_ptr<StructureEntry const> const & entry);
+
+  //! Removes entry of sc-template structure. It is called under lock.
+  void RemoveStructureEntry(StructureKey const & key) noexcept;
+
+  //! Unsubscribes sc-template structure if it has no entries. It is called under lock.
+  void UnwatchStructure(ScAddr const & templateAddr) noexcept;
+
+  //! Increments version of sc-template structure. Subscriptions of erased structure become unused.
+  void OnStructureChanged(ScAddr const & templateAddr, bool isErased) noexcept;
+
+  //! Increments version of system identifiers.
+  void OnIdentifierChanged() noexcept;
+
+  Entries<StructureKey, StructureEntry, StructureKeyHashFunc> m_structuresEntries;
+  Entries<ScsKey, ScsEntry, ScsKeyHashFunc> m_scsEntries;
+
+  ScAddrToValueUnorderedMap<StructureWatch> m_structuresWatches;
+  Subscriptions m_identifiersSubscriptions;
+  size_t m_identifiersVersion = 0;
+  size_t m_lastVersion = 0;
+  //! Subscriptions of unwatched sc-elements. They wait for their handlers, so they are destroyed without lock.
+  Subscriptions m_unusedSubscriptions;
+
+  std::mutex m_mutex;
+};
@@ -6,6 +6,11 @@
 
 #include "sc-memory/sc_template.hpp"
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+
 #include "sc_template_private.hpp"
 #include "sc-memory/sc_memory.hpp"
 
@@ -21,9 +26,11 @@ public:
       ScMemoryContext & context)
     : m_replacements(replacements)
     , m_triples(triples)
-    , m_params(params)
+    , m_params(&params)
     , m_context(context)
+    , m_resultContext(&context)
   {
+    m_generatedElements.reserve(m_triples.size() * 3);
   }
 
   ScTemplateResultCode operator()(ScTemplateGenResult & result)
@@ -32,11 +39,59 @@ public:
     ScMemoryContextEventsPendingGuard guard(m_context);
 
     PreCheckTemplateAndParams();
+    return Generate(result);
+  }
+
+  /*!
+   * Generates sc-constructions for parameters with indices in [beginIdx, endIdx). All parameters must be checked
+   * by `PreCheckParams` before. Sc-events of all generated sc-constructions are emitted at the end. Generated
+   * sc-elements of all sc-constructions are kept, so `CleanupCreatedElements` erases all of them.
+   */
+  void GenerateBatch(
+      std::vector<ScTemplateParams> const & paramsList,
+      size_t beginIdx,
+      size_t endIdx,
+      std::vector<ScTemplateGenResult> & results)
+  {
+    ScMemoryContextEventsPendingGuard guard(m_context);
+
+    for (size_t i = beginIdx; i < endIdx; ++i)
+    {
+      SetParams(paramsList[i]);
+      Generate(results[i]);
+    }
+  }
 
-    result = ScTemplateResultItem{&m_context, m_replacements};
-    result.m_replacementConstruction.resize(m_triples.size() * 3);
+  void SetParams(ScTemplateParams const & params)
+  {
+    m_params = &params;
+  }
+
+  //! Sets sc-memory context for generated sc-constructions if they are generated by other context.
+  void SetResultContext(ScMemoryContext & context)
+  {
+    m_resultContext = &context;
+  }
+
+  void CleanupCreatedElements()
+  {
+    for (auto & m_generatedElement : m_generatedElements)
+      m_context.EraseElement(m_generatedElement);
+    m_generatedElements.clear();
+  }
+
+  //! Checks parameters of one of sc-constructions before generation of all of them.
+  void PreCheckParams(ScTemplateParams const & params)
+  {
+    SetParams(params);
+    PreCheckTemplateAndParams();
+  }
+
+private:
+  ScTemplateResultCode Generate(ScTemplateGenResult & result)
+  {
+    ScAddrVector replacementConstruction(m_triples.size() * 3);
 
-    ScAddrVector generatedElements;
     size_t resultIdx = 0;
 
     for (auto const & triple : m_triples)
@@ -52,7 +107,7 @@ public:
             "You can't generate sc-element with unknown sc-type as the first item of triple "
                 << sourceItem.GetPrettyName() << ".");
 
-      ScAddr sourceAddr = TryFindElementReplacement(sourceItem, result.m_replacementConstruction);
+      ScAddr sourceAddr = TryFindElementReplacement(sourceItem, replacementConstruction);
       if (sourceItem.IsType() && sourceItem.m_typeValue.IsConnector() && !sourceAddr.IsValid())
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
@@ -67,7 +122,7 @@ public:
             "You can't generate sc-element with unknown sc-type as the third item of triple "
                 << targetItem.GetPrettyName() << ".");
 
-      ScAddr targetAddr = TryFindElementReplacement(targetItem, result.m_replacementConstruction);
+      ScAddr targetAddr = TryFindElementReplacement(targetItem, replacementConstruction);
       if (targetItem.IsType() && targetItem.m_typeValue.IsConnector() && !targetAddr.IsValid())
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
@@ -82,7 +137,7 @@ public:
             "You can't generate sc-element with unknown sc-type as the second item of triple "
                 << connectorItem.GetPrettyName() << ".");
 
-      ScAddr connectorAddr = TryFindElementReplacement(connectorItem, result.m_replacementConstruction);
+      ScAddr connectorAddr = TryFindElementReplacement(connectorItem, replacementConstruction);
       if (connectorAddr.IsValid())
         CheckIncidenceBetweenConnectorAndIncidentElements(connectorItem, connectorAddr, sourceItem, targetItem);
 
@@ -102,22 +157,20 @@ public:
       if (!connectorAddr.IsValid())
         connectorAddr = GenerateConnector(connectorItem.m_typeValue.UpConstType(), sourceAddr, targetAddr);
 
-      result.m_replacementConstruction[resultIdx++] = sourceAddr;
-      result.m_replacementConstruction[resultIdx++] = connectorAddr;
-      result.m_replacementConstruction[resultIdx++] = targetAddr;
+      replacementConstruction[resultIdx++] = sourceAddr;
+      replacementConstruction[resultIdx++] = connectorAddr;
+      replacementConstruction[resultIdx++] = targetAddr;
     }
 
-    return ScTemplateResultCode::Success;
-  }
+    // results of one generator share map of template items to replacement item positions
+    if (m_sharedReplacements == nullptr)
+      m_sharedReplacements =
+          std::make_shared<ScTemplate::ScTemplateItemsToReplacementsItemsPositions const>(m_replacements);
+    result = ScTemplateResultItem{m_resultContext, std::move(replacementConstruction), m_sharedReplacements};
 
-  void CleanupCreatedElements()
-  {
-    for (auto & m_generatedElement : m_generatedElements)
-      m_context.EraseElement(m_generatedElement);
-    m_generatedElements.clear();
+    return ScTemplateResultCode::Success;
   }
 
-private:
   ScAddr GenerateNodeOrLink(ScType const & type)
   {
     ScAddr addr;
@@ -139,32 +192,45 @@ private:
     return addr;
   }
 
-  [[nodiscard]] ScAddr GetAddrFromParams(ScTemplateItem const & itemValue) const
+  [[nodiscard]] ScAddr GetAddrFromParams(ScTemplateItem const & itemValue)
   {
     ScAddr result;
-    if (m_params.Get(itemValue.m_name, result))
+    if (m_params->Get(itemValue.m_name, result))
       return result;
 
-    std::stringstream stream(itemValue.m_name);
-    sc_addr_hash hash;
-    stream >> hash;
-    if (stream.fail() || !stream.eof())
-      return ScAddr::Empty;
+    std::string const & name = GetVariableSystemIdentifier(itemValue.m_name);
+    if (!name.empty())
+      m_params->Get(name, result);
 
-    ScAddr const & varAddr = ScAddr(hash);
-    if (!varAddr.IsValid() || !m_context.IsElement(varAddr))
-      return ScAddr::Empty;
+    return result;
+  }
+
+  //! Gets system identifier of sc-variable which sc-address hash is `itemName`. It is cached for next parameters.
+  std::string const & GetVariableSystemIdentifier(std::string const & itemName)
+  {
+    auto const & found = m_variablesSystemIdentifiers.find(itemName);
+    if (found != m_variablesSystemIdentifiers.cend())
+      return found->second;
 
-    std::string const & name = m_context.GetElementSystemIdentifier(varAddr);
-    m_params.Get(name, result);
+    std::string name;
 
-    return result;
+    std::stringstream stream(itemName);
+    sc_addr_hash hash;
+    stream >> hash;
+    if (!stream.fail() && stream.eof())
+    {
+      ScAddr const & varAddr = ScAddr(hash);
+      if (varAddr.IsValid() && m_context.IsElement(varAddr))
+        name = m_context.GetElementSystemIdentifier(varAddr);
+    }
+
+    return m_variablesSystemIdentifiers.insert({itemName, name}).first->second;
   }
 
-  [[nodiscard]] ScAddr TryFindElementReplacement(ScTemplateItem const & item, ScAddrVector const & resultAddrs) const
+  [[nodiscard]] ScAddr TryFindElementReplacement(ScTemplateItem const & item, ScAddrVector const & resultAddrs)
   {
     // replace by value from params
-    if (!m_params.IsEmpty() && item.HasName())
+    if (!m_params->IsEmpty() && item.HasName())
     {
       ScAddr const & addr = GetAddrFromParams(item);
       if (addr.IsValid())
@@ -203,8 +269,8 @@ private:
 
     if (sourceItem.HasName())
     {
-      auto const & itemIt = m_params.m_templateItemsToParams.find(sourceItem.m_name);
-      if (itemIt != m_params.m_templateItemsToParams.cend() && itemIt->second != foundSourceAddr)
+      auto const & itemIt = m_params->m_templateItemsToParams.find(sourceItem.m_name);
+      if (itemIt != m_params->m_templateItemsToParams.cend() && itemIt->second != foundSourceAddr)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "Specified sc-connector `" << connectorAddr << "` as parameter for the second item in sc-template "
@@ -226,8 +292,8 @@ private:
 
     if (targetItem.HasName())
     {
-      auto const & itemIt = m_params.m_templateItemsToParams.find(targetItem.m_name);
-      if (itemIt != m_params.m_templateItemsToParams.cend() && itemIt->second != foundTargetAddr)
+      auto const & itemIt = m_params->m_templateItemsToParams.find(targetItem.m_name);
+      if (itemIt != m_params->m_templateItemsToParams.cend() && itemIt->second != foundTargetAddr)
         SC_THROW_EXCEPTION(
             utils::ExceptionInvalidParams,
             "Specified sc-connector `" << connectorAddr << "` as parameter for the second item in sc-template "
@@ -238,7 +304,7 @@ private:
     }
   };
 
-  void PreCheckTemplateAndParams() const
+  void PreCheckTemplateAndParams()
   {
     auto const & CheckCorrespondenceBetweenTemplateParamReplacementNameAndTemplateItemReplacementName =
         [&](std::string const & templateParamReplacementName, size_t & templateItemPosition)
@@ -250,6 +316,16 @@ private:
       if (replacementIt != m_replacements.cend())
         goto end;
 
+      // parameters given by system identifiers of variables are resolved once for all generated sc-constructions
+      {
+        auto const & foundPositionIt = m_paramsSystemIdentifiersToPositions.find(templateParamReplacementName);
+        if (foundPositionIt != m_paramsSystemIdentifiersToPositions.cend())
+        {
+          templateItemPosition = foundPositionIt->second;
+          return;
+        }
+      }
+
       varAddr = m_context.SearchElementBySystemIdentifier(templateParamReplacementName);
       if (!varAddr.IsValid())
         SC_THROW_EXCEPTION(
@@ -267,6 +343,8 @@ private:
                 << addrHashStr
                 << "` given in parameters, for which you want to perform substitution from these parameters.");
 
+      m_paramsSystemIdentifiersToPositions.insert({templateParamReplacementName, replacementIt->second});
+
     end:
       templateItemPosition = replacementIt->second;
     };
@@ -289,7 +367,7 @@ private:
                              << "` and up-constant template item type can't be extended to template parameter type.");
     };
 
-    for (auto const & item : m_params.m_templateItemsToParams)
+    for (auto const & item : m_params->m_templateItemsToParams)
     {
       std::string const & templateParamReplacementName = item.first;
 
@@ -319,10 +397,15 @@ private:
   }
 
   ScTemplate::ScTemplateItemsToReplacementsItemsPositions const & m_replacements;
+  std::shared_ptr<ScTemplate::ScTemplateItemsToReplacementsItemsPositions const> m_sharedReplacements;
   ScTemplate::ScTemplateTriplesVector const & m_triples;
-  ScTemplateParams const & m_params;
+  ScTemplateParams const * m_params;
   ScMemoryContext & m_context;
-  ScAddrList m_generatedElements;
+  ScMemoryContext * m_resultContext;
+  ScAddrVector m_generatedElements;
+
+  std::unordered_map<std::string, std::string> m_variablesSystemIdentifiers;
+  std::unordered_map<std::string, size_t> m_paramsSystemIdentifiersToPositions;
 };
 
 ScTemplate::Result ScTemplate::Generate(
@@ -349,3 +432,95 @@ ScTemplate::Result ScTemplate::Generate(
 
   return ScTemplate::Result(true);
 }
+
+void ScTemplate::GenerateBatch(
+    ScMemoryContext & ctx,
+    std::vector<ScTemplateParams> const & paramsList,
+    std::vector<ScTemplateGenResult> & results,
+    size_t threadsCount) const
+{
+  results.clear();
+  results.resize(paramsList.size());
+  if (paramsList.empty())
+    return;
+
+  // check all parameters before generation, so invalid parameters don't leave a part of sc-constructions generated
+  ScTemplateGenerator gen(
+      m_templateItemsNamesToReplacementItemsPositions, m_templateTriples, ScTemplateParams::Empty, ctx);
+  for (ScTemplateParams const & params : paramsList)
+    gen.PreCheckParams(params);
+
+  threadsCount = std::min(threadsCount, paramsList.size());
+  if (threadsCount <= 1)
+  {
+    try
+    {
+      gen.GenerateBatch(paramsList, 0, paramsList.size(), results);
+    }
+    catch (utils::ExceptionInvalidParams const & exception)
+    {
+      gen.CleanupCreatedElements();
+      results.clear();
+      SC_THROW_EXCEPTION(utils::ExceptionInvalidParams, exception.Message());
+    }
+    return;
+  }
+
+  // each worker generates its own range of sc-constructions by its own sc-memory context, so workers don't share
+  // pending sc-events and don't wait for each other. Generators outlive workers to erase sc-constructions of all
+  // workers if one of them fails.
+  ScAddr const & userAddr = ctx.GetUser();
+  size_t const chunkSize = (paramsList.size() + threadsCount - 1) / threadsCount;
+  std::vector<std::unique_ptr<ScMemoryContext>> workerContexts;
+  std::vector<std::unique_ptr<ScTemplateGenerator>> workerGens;
+  std::vector<std::exception_ptr> exceptions(threadsCount);
+  std::vector<std::thread> workers;
+  workers.reserve(threadsCount);
+  for (size_t workerIdx = 0; workerIdx < threadsCount; ++workerIdx)
+  {
+    size_t const beginIdx = workerIdx * chunkSize;
+    size_t const endIdx = std::min(beginIdx + chunkSize, paramsList.size());
+    if (beginIdx >= endIdx)
+      break;
+
+    // constructor of sc-memory context by user is available only for friends, so it is called directly
+    workerContexts.push_back(std::unique_ptr<ScMemoryContext>(new ScMemoryContext(userAddr)));
+    workerGens.push_back(std::make_unique<ScTemplateGenerator>(
+        m_templateItemsNamesToReplacementItemsPositions,
+        m_templateTriples,
+        ScTemplateParams::Empty,
+        *workerContexts.back()));
+    workerGens.back()->SetResultContext(ctx);
+
+    workers.emplace_back(
+        [&, workerGen = workerGens.back().get(), workerIdx, beginIdx, endIdx]()
+        {
+          try
+          {
+            workerGen->GenerateBatch(paramsList, beginIdx, endIdx, results);
+          }
+          catch (...)
+          {
+            exceptions[workerIdx] = std::current_exception();
+          }
+        });
+  }
+
+  for (std::thread & worker : workers)
+    worker.join();
+
+  auto const & exceptionIt = std::find_if(
+      exceptions.cbegin(),
+      exceptions.cend(),
+      [](std::exception_ptr const & exception)
+      {
+        return exception != nullptr;
+      });
+  if (exceptionIt == exceptions.cend())
+    return;
+
+  for (auto const & workerGen : workerGens)
+    workerGen->CleanupCreatedElements();
+  results.clear();
+  std::rethrow_exception(*exceptionIt);
+}
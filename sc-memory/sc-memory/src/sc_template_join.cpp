@@ -0,0 +1,389 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc_template_join.hpp"
+
+#include <algorithm>
+#include <chrono>
+
+#include "sc-memory/sc_memory.hpp"
+
+ScTemplateJoin::ScTemplateJoin(
+    ScMemoryContext & context,
+    std::vector<Variable> variables,
+    std::vector<Relation> relations,
+    size_t triplesCount)
+  : m_context(context)
+  , m_variables(std::move(variables))
+  , m_relations(std::move(relations))
+  , m_triplesCount(triplesCount)
+{
+}
+
+bool ScTemplateJoin::Plan()
+{
+  // group equal relations to assign them combinations of connectors and iterate their
+  // adjacencies once
+  for (size_t relationIdx = 0; relationIdx < m_relations.size(); ++relationIdx)
+  {
+    Relation const & relation = m_relations[relationIdx];
+    auto const & found = std::find_if(
+        m_relationGroups.begin(),
+        m_relationGroups.end(),
+        [&](std::vector<size_t> const & group)
+        {
+          Relation const & otherRelation = m_relations[group.front()];
+          return otherRelation.m_sourceVariableIdx == relation.m_sourceVariableIdx
+                 && otherRelation.m_targetVariableIdx == relation.m_targetVariableIdx
+                 && otherRelation.m_connectorType == relation.m_connectorType;
+        });
+
+    if (found == m_relationGroups.end())
+      m_relationGroups.push_back({relationIdx});
+    else
+      found->push_back(relationIdx);
+  }
+
+  std::vector<bool> boundVariables(m_variables.size(), false);
+  size_t unboundVariablesCount = m_variables.size();
+  for (size_t i = 0; i < m_variables.size(); ++i)
+  {
+    if (m_variables[i].m_fixedAddr.IsValid())
+    {
+      boundVariables[i] = true;
+      --unboundVariablesCount;
+    }
+  }
+
+  while (unboundVariablesCount > 0)
+  {
+    size_t bestVariableIdx = m_variables.size();
+    size_t bestBoundRelationsCount = 0;
+    for (size_t i = 0; i < m_variables.size(); ++i)
+    {
+      if (boundVariables[i])
+        continue;
+
+      size_t boundRelationsCount = 0;
+      for (Relation const & relation : m_relations)
+      {
+        if ((relation.m_sourceVariableIdx == i && boundVariables[relation.m_targetVariableIdx])
+            || (relation.m_targetVariableIdx == i && boundVariables[relation.m_sourceVariableIdx]))
+          ++boundRelationsCount;
+      }
+
+      if (boundRelationsCount > bestBoundRelationsCount)
+      {
+        bestVariableIdx = i;
+        bestBoundRelationsCount = boundRelationsCount;
+      }
+    }
+
+    // variable isn't connected with fixed ones, it can be found only by iterating all sc-elements
+    if (bestVariableIdx == m_variables.size())
+      return false;
+
+    Level level{bestVariableIdx, {}};
+    for (std::vector<size_t> const & group : m_relationGroups)
+    {
+      size_t const relationIdx = group.front();
+      Relation const & relation = m_relations[relationIdx];
+      if (relation.m_targetVariableIdx == bestVariableIdx && boundVariables[relation.m_sourceVariableIdx])
+        level.m_incidentRelations.push_back({relationIdx, true});
+      else if (relation.m_sourceVariableIdx == bestVariableIdx && boundVariables[relation.m_targetVariableIdx])
+        level.m_incidentRelations.push_back({relationIdx, false});
+    }
+    m_levels.push_back(std::move(level));
+
+    boundVariables[bestVariableIdx] = true;
+    --unboundVariablesCount;
+  }
+
+  return true;
+}
+
+void ScTemplateJoin::Run(
+    ScElementCheckCallback const & checkCallback,
+    ScConstructionCallback const & constructionCallback)
+{
+  m_checkCallback = checkCallback;
+  m_constructionCallback = constructionCallback;
+
+  m_boundVariables.assign(m_variables.size(), ScAddr::Empty);
+  m_construction.assign(m_triplesCount * 3, ScAddr::Empty);
+  m_usedConnectors.clear();
+
+  if (m_profile)
+    ProfileExecutionOrder();
+
+  for (size_t i = 0; i < m_variables.size(); ++i)
+  {
+    ScAddr const & fixedAddr = m_variables[i].m_fixedAddr;
+    if (!fixedAddr.IsValid())
+      continue;
+
+    if (m_checkCallback && !m_checkCallback(fixedAddr))
+      return;
+
+    m_boundVariables[i] = fixedAddr;
+  }
+
+  BindLevel(0);
+}
+
+void ScTemplateJoin::SetProfile(ScTemplateSearchProfile & profile)
+{
+  m_profile = &profile;
+}
+
+void ScTemplateJoin::ProfileExecutionOrder()
+{
+  auto & executionOrder = m_profile->m_executionOrder;
+  auto const & AddGroup = [&](std::vector<size_t> const & group)
+  {
+    for (size_t const relationIdx : group)
+    {
+      size_t const tripleIdx = m_relations[relationIdx].m_tripleIdx;
+      if (std::find(executionOrder.cbegin(), executionOrder.cend(), tripleIdx) == executionOrder.cend())
+        executionOrder.push_back(tripleIdx);
+    }
+  };
+
+  // relations are iterated when their variables are bound, and connectors of the rest of them are iterated after all
+  // variables are bound
+  for (Level const & level : m_levels)
+  {
+    for (IncidentRelation const & incidentRelation : level.m_incidentRelations)
+    {
+      for (std::vector<size_t> const & group : m_relationGroups)
+      {
+        if (group.front() == incidentRelation.m_relationIdx)
+          AddGroup(group);
+      }
+    }
+  }
+
+  for (std::vector<size_t> const & group : m_relationGroups)
+    AddGroup(group);
+}
+
+ScAddrVector const & ScTemplateJoin::GetSortedAdjacency(IncidentRelation const & incidentRelation)
+{
+  Relation const & relation = m_relations[incidentRelation.m_relationIdx];
+  size_t const boundVariableIdx =
+      incidentRelation.m_isVariableTarget ? relation.m_sourceVariableIdx : relation.m_targetVariableIdx;
+  ScAddr const & boundAddr = m_boundVariables[boundVariableIdx];
+
+  AdjacencyKey const key{incidentRelation.m_relationIdx, boundAddr.Hash()};
+  auto const & found = m_sortedAdjacencies.find(key);
+  if (found != m_sortedAdjacencies.cend())
+    return found->second;
+
+  std::chrono::steady_clock::time_point beginTime;
+  if (m_profile)
+    beginTime = std::chrono::steady_clock::now();
+
+  ScAddrVector adjacency;
+  if (incidentRelation.m_isVariableTarget)
+  {
+    ScType const & targetType = m_variables[relation.m_targetVariableIdx].m_type;
+    ScIterator3Ptr const it = m_context.CreateIterator3(boundAddr, relation.m_connectorType, targetType);
+    while (it->Next())
+      adjacency.push_back(it->Get(2));
+  }
+  else
+  {
+    ScType const & sourceType = m_variables[relation.m_sourceVariableIdx].m_type;
+    ScIterator3Ptr const it = m_context.CreateIterator3(sourceType, relation.m_connectorType, boundAddr);
+    while (it->Next())
+      adjacency.push_back(it->Get(0));
+  }
+
+  if (m_profile)
+  {
+    auto & tripleProfile = m_profile->m_triples[relation.m_tripleIdx];
+    ++tripleProfile.m_iteratorsCount;
+    tripleProfile.m_visitedCandidatesCount += adjacency.size();
+  }
+
+  std::sort(adjacency.begin(), adjacency.end(), ScAddrLessFunc());
+  adjacency.erase(std::unique(adjacency.begin(), adjacency.end()), adjacency.end());
+
+  if (m_profile)
+    m_profile->m_triples[relation.m_tripleIdx].m_duration += std::chrono::steady_clock::now() - beginTime;
+
+  return m_sortedAdjacencies.emplace(key, std::move(adjacency)).first->second;
+}
+
+void ScTemplateJoin::Intersect(Level const & level, ScAddrVector & candidates)
+{
+  std::vector<ScAddrVector const *> adjacencies;
+  adjacencies.reserve(level.m_incidentRelations.size());
+  for (IncidentRelation const & incidentRelation : level.m_incidentRelations)
+  {
+    ScAddrVector const & adjacency = GetSortedAdjacency(incidentRelation);
+    if (adjacency.empty())
+      return;
+
+    adjacencies.push_back(&adjacency);
+  }
+
+  std::sort(
+      adjacencies.begin(),
+      adjacencies.end(),
+      [](ScAddrVector const * first, ScAddrVector const * second)
+      {
+        return first->size() < second->size();
+      });
+
+  // leapfrog the smallest adjacency through others, so intersection costs no more than the smallest adjacency
+  ScAddrLessFunc const less;
+  std::vector<ScAddrVector::const_iterator> positions;
+  positions.reserve(adjacencies.size());
+  for (ScAddrVector const * adjacency : adjacencies)
+    positions.push_back(adjacency->cbegin());
+
+  for (ScAddr const & candidateAddr : *adjacencies.front())
+  {
+    bool isInAll = true;
+    for (size_t i = 1; i < adjacencies.size(); ++i)
+    {
+      positions[i] = std::lower_bound(positions[i], adjacencies[i]->cend(), candidateAddr, less);
+      if (positions[i] == adjacencies[i]->cend())
+        return;
+
+      if (*positions[i] != candidateAddr)
+      {
+        isInAll = false;
+        break;
+      }
+    }
+
+    if (isInAll)
+      candidates.push_back(candidateAddr);
+  }
+}
+
+bool ScTemplateJoin::BindLevel(size_t levelIdx)
+{
+  if (levelIdx == m_levels.size())
+    return AssignConnectors(0);
+
+  Level const & level = m_levels[levelIdx];
+
+  ScAddrVector candidates;
+  Intersect(level, candidates);
+
+  for (ScAddr const & candidateAddr : candidates)
+  {
+    if (m_checkCallback && !m_checkCallback(candidateAddr))
+    {
+      if (m_profile)
+      {
+        size_t const relationIdx = level.m_incidentRelations.front().m_relationIdx;
+        ++m_profile->m_triples[m_relations[relationIdx].m_tripleIdx].m_rejectedByStructureCount;
+      }
+      continue;
+    }
+
+    m_boundVariables[level.m_variableIdx] = candidateAddr;
+    if (!BindLevel(levelIdx + 1))
+      return false;
+  }
+
+  m_boundVariables[level.m_variableIdx] = ScAddr::Empty;
+  return true;
+}
+
+bool ScTemplateJoin::AssignConnectors(size_t groupIdx)
+{
+  if (groupIdx == m_relationGroups.size())
+  {
+    for (Relation const & relation : m_relations)
+    {
+      size_t const itemIdx = relation.m_tripleIdx * 3;
+      m_construction[itemIdx] = m_boundVariables[relation.m_sourceVariableIdx];
+      m_construction[itemIdx + 2] = m_boundVariables[relation.m_targetVariableIdx];
+    }
+
+    return m_constructionCallback(m_construction);
+  }
+
+  Relation const & relation = m_relations[m_relationGroups[groupIdx].front()];
+
+  ScTemplateSearchProfile::TripleProfile * tripleProfile = nullptr;
+  std::chrono::steady_clock::time_point beginTime;
+  if (m_profile)
+  {
+    tripleProfile = &m_profile->m_triples[relation.m_tripleIdx];
+    ++tripleProfile->m_iteratorsCount;
+    beginTime = std::chrono::steady_clock::now();
+  }
+
+  ScAddrVector connectors;
+  ScIterator3Ptr const it = m_context.CreateIterator3(
+      m_boundVariables[relation.m_sourceVariableIdx],
+      relation.m_connectorType,
+      m_boundVariables[relation.m_targetVariableIdx]);
+  while (it->Next())
+  {
+    ScAddr const & connectorAddr = it->Get(1);
+    if (tripleProfile)
+      ++tripleProfile->m_visitedCandidatesCount;
+
+    if (m_usedConnectors.find(connectorAddr) != m_usedConnectors.cend())
+    {
+      if (tripleProfile)
+        ++tripleProfile->m_rejectedByUsedConnectorCount;
+      continue;
+    }
+
+    if (m_checkCallback && !m_checkCallback(connectorAddr))
+    {
+      if (tripleProfile)
+        ++tripleProfile->m_rejectedByStructureCount;
+      continue;
+    }
+
+    connectors.push_back(connectorAddr);
+  }
+
+  if (tripleProfile)
+    tripleProfile->m_duration += std::chrono::steady_clock::now() - beginTime;
+
+  if (connectors.size() < m_relationGroups[groupIdx].size())
+    return true;
+
+  return ChooseConnectors(groupIdx, connectors, 0, 0);
+}
+
+bool ScTemplateJoin::ChooseConnectors(
+    size_t groupIdx,
+    ScAddrVector const & connectors,
+    size_t from,
+    size_t chosenCount)
+{
+  std::vector<size_t> const & group = m_relationGroups[groupIdx];
+  if (chosenCount == group.size())
+    return AssignConnectors(groupIdx + 1);
+
+  size_t const relationIdx = group[chosenCount];
+  for (size_t i = from; i + (group.size() - chosenCount) <= connectors.size(); ++i)
+  {
+    ScAddr const & connectorAddr = connectors[i];
+
+    m_usedConnectors.insert(connectorAddr);
+    m_construction[m_relations[relationIdx].m_tripleIdx * 3 + 1] = connectorAddr;
+
+    bool const isContinued = ChooseConnectors(groupIdx, connectors, i + 1, chosenCount + 1);
+
+    m_usedConnectors.erase(connectorAddr);
+    if (!isContinued)
+      return false;
+  }
+
+  return true;
+}
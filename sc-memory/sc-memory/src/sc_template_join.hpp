@@ -0,0 +1,138 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include <functional>
+#include <unordered_map>
+
+#include "sc-memory/sc_addr.hpp"
+#include "sc-memory/sc_type.hpp"
+
+class ScMemoryContext;
+struct ScTemplateSearchProfile;
+
+/*!
+ * @brief Worst-case optimal join for cyclic sc-templates.
+ *
+ * Sc-template is represented as a set of variables (source and target items of triples) and relations between them
+ * (triples with variable connectors). Variables are bound one by one, each of them to intersection of sorted
+ * adjacency lists of already bound variables (leapfrog join), so triangle- and diamond-shaped sc-templates aren't
+ * iterated through all pairs of adjacent sc-elements. Connectors are assigned after all variables are bound. Equal
+ * relations (with the same variables and connector type) get combinations of distinct connectors, not permutations.
+ */
+class ScTemplateJoin
+{
+public:
+  struct Variable
+  {
+    ScAddr m_fixedAddr;  ///< A sc-address of variable if it is fixed.
+    ScType m_type;       ///< A sc-type used to iterate sc-elements of variable.
+  };
+
+  struct Relation
+  {
+    size_t m_tripleIdx;          ///< An index of triple in sc-template.
+    size_t m_sourceVariableIdx;  ///< An index of source variable.
+    ScType m_connectorType;      ///< A sc-type used to iterate connectors of relation.
+    size_t m_targetVariableIdx;  ///< An index of target variable.
+  };
+
+  //! Checks if found sc-element may be used in found sc-construction.
+  using ScElementCheckCallback = std::function<bool(ScAddr const &)>;
+  //! Handles found sc-construction. Returns false to stop join.
+  using ScConstructionCallback = std::function<bool(ScAddrVector const &)>;
+
+  ScTemplateJoin(
+      ScMemoryContext & context,
+      std::vector<Variable> variables,
+      std::vector<Relation> relations,
+      size_t triplesCount);
+
+  /*!
+   * @brief Orders variables so that each next variable has the most relations with already bound ones.
+   * @returns false if some variable isn't reachable from fixed variables, so sc-template can't be joined.
+   */
+  bool Plan();
+
+  /*!
+   * @brief Finds all sc-constructions and passes them to `constructionCallback`.
+   * @param checkCallback A callback to check each found sc-element.
+   * @param constructionCallback A callback to handle each found sc-construction.
+   */
+  void Run(ScElementCheckCallback const & checkCallback, ScConstructionCallback const & constructionCallback);
+
+  /*!
+   * @brief Collects statistics of join into `profile` during next runs. Statistics of each relation group are
+   * accounted to its first triple.
+   * @param profile A profile with statistics for each triple of sc-template.
+   */
+  void SetProfile(ScTemplateSearchProfile & profile);
+
+private:
+  struct IncidentRelation
+  {
+    size_t m_relationIdx;
+    bool m_isVariableTarget;
+  };
+
+  struct Level
+  {
+    size_t m_variableIdx;
+    std::vector<IncidentRelation> m_incidentRelations;
+  };
+
+  struct AdjacencyKey
+  {
+    size_t m_relationIdx;
+    ScAddr::HashType m_boundAddrHash;
+
+    bool operator==(AdjacencyKey const & other) const
+    {
+      return m_relationIdx == other.m_relationIdx && m_boundAddrHash == other.m_boundAddrHash;
+    }
+  };
+
+  struct AdjacencyKeyHashFunc
+  {
+    size_t operator()(AdjacencyKey const & key) const
+    {
+      return std::hash<ScAddr::HashType>()(key.m_boundAddrHash) * 31 + key.m_relationIdx;
+    }
+  };
+
+  ScAddrVector const & GetSortedAdjacency(IncidentRelation const & incidentRelation);
+
+  void Intersect(Level const & level, ScAddrVector & candidates);
+
+  bool BindLevel(size_t levelIdx);
+
+  bool AssignConnectors(size_t groupIdx);
+
+  bool ChooseConnectors(size_t groupIdx, ScAddrVector const & connectors, size_t from, size_t chosenCount);
+
+  void ProfileExecutionOrder();
+
+  ScMemoryContext & m_context;
+
+  std::vector<Variable> m_variables;
+  std::vector<Relation> m_relations;
+  size_t m_triplesCount;
+
+  std::vector<Level> m_levels;
+  std::vector<std::vector<size_t>> m_relationGroups;
+
+  std::unordered_map<AdjacencyKey, ScAddrVector, AdjacencyKeyHashFunc> m_sortedAdjacencies;
+
+  ScElementCheckCallback m_checkCallback;
+  ScConstructionCallback m_constructionCallback;
+
+  ScAddrVector m_boundVariables;
+  ScAddrVector m_construction;
+  ScAddrUnorderedSet m_usedConnectors;
+
+  ScTemplateSearchProfile * m_profile = nullptr;
+};
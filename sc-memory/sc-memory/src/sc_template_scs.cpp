@@ -12,6 +12,8 @@
 
 #include "sc-memory/utils/sc_keynode_cache.hpp"
 
+#include "sc_template_cache.hpp"
+
 class ScTemplateBuilderFromScs
 {
 public:
@@ -22,16 +24,16 @@ public:
   {
   }
 
-  void operator()(ScTemplate * templ)
+  void operator()(ScTemplateItemsTriples & triples)
   {
     if (!m_parser.Parse(m_translatableSCsTemplate))
       SC_THROW_EXCEPTION(utils::ExceptionParseError, m_parser.GetParseError());
 
-    BuildImpl(templ);
+    BuildImpl(triples);
   }
 
 protected:
-  void BuildImpl(ScTemplate * templ) const
+  void BuildImpl(ScTemplateItemsTriples & triples) const
   {
     utils::ScKeynodeCache keynodes(m_ctx);
     std::unordered_set<std::string> passed;
@@ -72,7 +74,7 @@ protected:
           MakeTemplItem(connector, connectorItem);
           MakeTemplItem(target, targetItem);
 
-          templ->Triple(sourceItem, connectorItem, targetItem);
+          triples.push_back({sourceItem, connectorItem, targetItem});
         });
   }
 
@@ -83,8 +85,19 @@ private:
   scs::Parser m_parser;
 };
 
+void CollectTemplateScsTriples(
+    ScMemoryContext & context,
+    std::string const & translatableSCsTemplate,
+    ScTemplateItemsTriples & triples)
+{
+  ScTemplateBuilderFromScs builder(translatableSCsTemplate, context);
+  builder(triples);
+}
+
 void ScTemplate::TranslateFrom(ScMemoryContext & ctx, std::string const & translatableSCsTemplate)
 {
-  ScTemplateBuilderFromScs builder(translatableSCsTemplate, ctx);
-  builder(this);
+  ScTemplateItemsTriples triples;
+  CollectTemplateScsTriples(ctx, translatableSCsTemplate, triples);
+  for (auto const & [sourceItem, connectorItem, targetItem] : triples)
+    Triple(sourceItem, connectorItem, targetItem);
 }
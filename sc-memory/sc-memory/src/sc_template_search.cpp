@@ -7,8 +7,12 @@
 #include "sc-memory/sc_template.hpp"
 
 #include <algorithm>
+#include <numeric>
+
+#include <nlohmann/json.hpp>
 
 #include "sc_template_private.hpp"
+#include "sc_template_join.hpp"
 #include "sc-memory/sc_memory.hpp"
 
 class ScTemplateSearch
@@ -45,6 +49,19 @@ public:
     m_checkCallback = checkCallback;
   }
 
+  void SetProfile(ScTemplateSearchProfile & profile)
+  {
+    m_profile = &profile;
+
+    profile.m_isJoined = m_join != nullptr;
+    profile.m_triples.resize(m_template.m_templateTriples.size());
+    for (size_t i = 0; i < profile.m_triples.size(); ++i)
+      profile.m_triples[i].m_tripleIdx = i;
+
+    if (m_join)
+      m_join->SetProfile(profile);
+  }
+
 private:
   /*!
    * Prepares input sc-template to minimize search
@@ -54,12 +71,134 @@ private:
     if (m_template.Size() == 1)
       return;
 
+    if (PrepareJoin())
+      return;
+
     SetUpDependenciesBetweenTriples();
     RemoveCycledDependenciesBetweenTriples();
     FindConnectivityComponents();
     FindTriplesWithMostMinimalArcsForFirstItem();
   }
 
+  /*!
+   * Chooses worst-case optimal join for sc-template if it is cyclic and connectors of its triples aren't used as
+   * items of other triples. Nested iteration of triples of such sc-templates with post-filtering explodes for
+   * triangle- and diamond-shaped sc-templates over dense relations.
+   * @returns true if sc-template will be searched by join.
+   */
+  bool PrepareJoin()
+  {
+    std::unordered_map<std::string, size_t> itemsNamesCounts;
+    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    {
+      for (ScTemplateItem const & item : triple->GetValues())
+      {
+        if (item.HasName())
+          ++itemsNamesCounts[item.m_name];
+      }
+    }
+
+    std::vector<ScTemplateJoin::Variable> variables;
+    std::unordered_map<std::string, size_t> variablesNamesToIndices;
+    ScAddrToValueUnorderedMap<size_t> fixedAddrsToIndices;
+
+    auto const & ResolveVariable = [&](ScTemplateItem const & item, size_t & variableIdx) -> bool
+    {
+      if (item.IsAddr())
+      {
+        auto const & found = fixedAddrsToIndices.find(item.m_addrValue);
+        if (found != fixedAddrsToIndices.cend())
+        {
+          variableIdx = found->second;
+          return true;
+        }
+
+        variableIdx = variables.size();
+        variables.push_back({item.m_addrValue, ScType::Unknown});
+        fixedAddrsToIndices.insert({item.m_addrValue, variableIdx});
+        return true;
+      }
+
+      if (!item.HasName())
+      {
+        if (!item.IsType())
+          return false;
+
+        variableIdx = variables.size();
+        variables.push_back({ScAddr::Empty, PrepareType(item)});
+        return true;
+      }
+
+      // replacement of unknown sc-template item
+      if (m_template.m_templateItemsNamesToTypes.find(item.m_name) == m_template.m_templateItemsNamesToTypes.cend())
+        return false;
+
+      auto const & found = variablesNamesToIndices.find(item.m_name);
+      if (found != variablesNamesToIndices.cend())
+      {
+        variableIdx = found->second;
+        return true;
+      }
+
+      variableIdx = variables.size();
+      variables.push_back({ScAddr::Empty, PrepareType(item)});
+      variablesNamesToIndices.insert({item.m_name, variableIdx});
+      return true;
+    };
+
+    std::vector<ScTemplateJoin::Relation> relations;
+    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    {
+      ScTemplateItem const & connectorItem = (*triple)[1];
+      // connector is fixed or is used as item of other triple
+      if (!connectorItem.IsType() || (connectorItem.HasName() && itemsNamesCounts[connectorItem.m_name] > 1))
+        return false;
+
+      size_t sourceVariableIdx = 0;
+      size_t targetVariableIdx = 0;
+      if (!ResolveVariable((*triple)[0], sourceVariableIdx) || !ResolveVariable((*triple)[2], targetVariableIdx)
+          || sourceVariableIdx == targetVariableIdx)
+        return false;
+
+      relations.push_back({triple->m_index, sourceVariableIdx, PrepareType(connectorItem), targetVariableIdx});
+    }
+
+    // find cycle by disjoint sets of variables
+    std::vector<size_t> variablesComponents(variables.size());
+    std::iota(variablesComponents.begin(), variablesComponents.end(), 0);
+    auto const & FindComponent = [&variablesComponents](size_t variableIdx) -> size_t
+    {
+      while (variablesComponents[variableIdx] != variableIdx)
+        variableIdx = variablesComponents[variableIdx] = variablesComponents[variablesComponents[variableIdx]];
+      return variableIdx;
+    };
+
+    bool isCycled = false;
+    for (ScTemplateJoin::Relation const & relation : relations)
+    {
+      size_t const sourceComponent = FindComponent(relation.m_sourceVariableIdx);
+      size_t const targetComponent = FindComponent(relation.m_targetVariableIdx);
+      if (sourceComponent == targetComponent)
+      {
+        isCycled = true;
+        break;
+      }
+
+      variablesComponents[sourceComponent] = targetComponent;
+    }
+
+    if (!isCycled)
+      return false;
+
+    auto join = std::make_unique<ScTemplateJoin>(
+        m_context, std::move(variables), std::move(relations), m_template.m_templateTriples.size());
+    if (!join->Plan())
+      return false;
+
+    m_join = std::move(join);
+    return true;
+  }
+
   /*!
    * Find all dependencies between triples. Compares replacement name of each item of the triple
    * with replacement name of each item of the other triple, and if they are equal, then adds
@@ -491,21 +630,57 @@ private:
     return m_structure.IsValid();
   }
 
+  /*!
+   * Checks sc-element belonging to sc-structure. Candidates are checked by sc-arcs incoming to them and the answers
+   * are remembered, so small searches in large sc-structure don't read all its sc-elements. When count of checked
+   * candidates reaches count of sc-arcs from sc-structure, all its sc-elements are collected once, so other checks are
+   * hash lookups and the whole search costs at most twice as much as collecting sc-structure elements.
+   */
   inline bool IsInStructure(ScAddr const & addr)
   {
-    return m_context.CheckConnector(m_structure, addr, ScType::ConstPermPosArc);
+    if (m_isStructureElementsCollected)
+      return m_structureElements.find(addr) != m_structureElements.cend();
+
+    auto const & it = m_checkedStructureElements.find(addr);
+    if (it != m_checkedStructureElements.cend())
+      return it->second;
+
+    if (m_structureArcsCount == 0)
+      m_structureArcsCount = m_context.GetElementEdgesAndOutgoingArcsCount(m_structure);
+
+    if (m_checkedStructureElements.size() >= m_structureArcsCount)
+    {
+      CollectStructureElements();
+      return m_structureElements.find(addr) != m_structureElements.cend();
+    }
+
+    bool const isInStructure = m_context.CheckConnector(m_structure, addr, ScType::ConstPermPosArc);
+    m_checkedStructureElements.insert({addr, isInStructure});
+    return isInStructure;
+  }
+
+  void CollectStructureElements()
+  {
+    m_structureElements.reserve(m_structureArcsCount);
+
+    ScIterator3Ptr const it = m_context.CreateIterator3(m_structure, ScType::ConstPermPosArc, ScType::Unknown);
+    while (it->Next())
+      m_structureElements.insert(it->Get(2));
+
+    m_isStructureElementsCollected = true;
+    m_checkedStructureElements.clear();
   }
 
   ScAddr const & ResolveAddr(
       ScTemplateItem const & templateItem,
-      ScAddrVector const & replacementConstruction,
+      ScAddr const * replacementConstruction,
       ScTemplateSearchResult & result) const
   {
     auto const & GetItemAddrInReplacements = [&replacementConstruction,
                                               &result](ScTemplateItem const & item) -> ScAddr const &
     {
-      auto const & it = result.m_templateItemsNamesToReplacementItemsPositions.find(item.m_name);
-      if (it != result.m_templateItemsNamesToReplacementItemsPositions.cend())
+      auto const & it = result.m_templateItemsNamesToReplacementItemsPositions->find(item.m_name);
+      if (it != result.m_templateItemsNamesToReplacementItemsPositions->cend())
       {
         ScAddr const & addr = replacementConstruction[it->second];
         if (addr.IsValid())
@@ -551,9 +726,25 @@ private:
     }
   }
 
+  ScType PrepareType(ScTemplateItem const & item) const
+  {
+    ScType type = item.m_typeValue;
+    if (!item.m_name.empty())
+    {
+      auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
+      if (found != m_template.m_templateItemsNamesToTypes.cend())
+        type = found->second;
+    }
+
+    if (type.HasConstancyFlag())
+      return type.UpConstType();
+
+    return type;
+  }
+
   ScIterator3Ptr CreateIterator(
       ScTemplateTriple const * templateTriple,
-      ScAddrVector const & replacementConstruction,
+      ScAddr const * replacementConstruction,
       ScTemplateSearchResult & result)
   {
     ScTemplateItem const & item1 = (*templateTriple)[0];
@@ -564,22 +755,6 @@ private:
     ScAddr const & addr2 = ResolveAddr(item2, replacementConstruction, result);
     ScAddr const & addr3 = ResolveAddr(item3, replacementConstruction, result);
 
-    auto const & PrepareType = [this](ScTemplateItem const & item) -> ScType
-    {
-      ScType type = item.m_typeValue;
-      if (!item.m_name.empty())
-      {
-        auto const & found = m_template.m_templateItemsNamesToTypes.find(item.m_name);
-        if (found != m_template.m_templateItemsNamesToTypes.cend())
-          type = found->second;
-      }
-
-      if (type.HasConstancyFlag())
-        return type.UpConstType();
-
-      return type;
-    };
-
     if (addr1.IsValid())
     {
       if (!addr2.IsValid())
@@ -706,11 +881,19 @@ private:
     size_t templateTripleIdx = *templateTriples.begin();
     ScTemplateTriple * templateTriple = m_template.m_templateTriples[templateTripleIdx];
 
+    size_t const iteratedTemplateTripleIdx = templateTripleIdx;
+    std::chrono::steady_clock::time_point beginTime;
+    if (m_profile)
+    {
+      beginTime = std::chrono::steady_clock::now();
+      BeginTripleProfile(iteratedTemplateTripleIdx);
+      ++m_profile->m_triples[iteratedTemplateTripleIdx].m_iteratorsCount;
+    }
+
     bool isForLastTemplateTripleAllChildrenFinished = true;
     bool isLastTemplateTripleHasNoChildren = false;
 
-    ScIterator3Ptr it =
-        CreateIterator(templateTriple, result.m_replacementConstructions[replacementConstructionIdx], result);
+    ScIterator3Ptr it = CreateIterator(templateTriple, result.GetConstruction(replacementConstructionIdx), result);
     if (!it || !it->IsValid())
       SC_THROW_EXCEPTION(
           utils::ExceptionInvalidState,
@@ -720,7 +903,9 @@ private:
 
     size_t checkedCurrentResultEqualTemplateTriplesCount = 0;
 
-    ScAddrVector nextResultReplacementTriples{result.m_replacementConstructions[replacementConstructionIdx]};
+    ScAddr const * replacementConstruction = result.GetConstruction(replacementConstructionIdx);
+    ScAddrVector nextResultReplacementTriples{
+        replacementConstruction, replacementConstruction + result.m_replacementConstructionSize};
     ScTemplateTriples nextCheckedTemplateTriples{
         m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx]};
     UsedConnectors nextUsedReplacementConnectors{
@@ -734,6 +919,9 @@ private:
       if (it->Next())
       {
         replacementTriple = it->Get();
+        if (m_profile)
+          ++m_profile->m_triples[iteratedTemplateTripleIdx].m_visitedCandidatesCount;
+
         auto copiedTemplateTriplesIterator = templateTriplesIterator;
         if (copiedTemplateTriplesIterator != templateTriples.cend())
         {
@@ -751,7 +939,10 @@ private:
       auto & notUsedConnectorsInCurrentTemplateTriple = m_notUsedConnectorsInTemplateTriples[templateTriple->m_index];
       if (notUsedConnectorsInCurrentTemplateTriple.find(replacementTriple[1])
           != notUsedConnectorsInCurrentTemplateTriple.cend())
+      {
+        ProfileRejectedByUsedConnector(iteratedTemplateTripleIdx);
         continue;
+      }
 
       bool isFoundInOtherTemplateTriples = false;
       for (size_t const otherTemplateTripleIdx : templateTriples)
@@ -767,14 +958,20 @@ private:
         }
       }
       if (isFoundInOtherTemplateTriples)
+      {
+        ProfileRejectedByUsedConnector(iteratedTemplateTripleIdx);
         continue;
+      }
 
       // check if connector is used for other equal triple
       auto & usedConnectorsInCurrentReplacementConstruction =
           m_usedConnectorsInReplacementConstructions[replacementConstructionIdx];
       if (usedConnectorsInCurrentReplacementConstruction.find(replacementTriple[1])
           != usedConnectorsInCurrentReplacementConstruction.cend())
+      {
+        ProfileRejectedByUsedConnector(iteratedTemplateTripleIdx);
         continue;
+      }
 
       // check triple elements by structure belonging or predicate callback
       if ((IsStructureValid()
@@ -784,6 +981,9 @@ private:
               && (!m_checkCallback(replacementTriple[0]) || !m_checkCallback(replacementTriple[1])
                   || !m_checkCallback(replacementTriple[2]))))
       {
+        if (m_profile)
+          ++m_profile->m_triples[iteratedTemplateTripleIdx].m_rejectedByStructureCount;
+
         m_usedConnectorsInReplacementConstructions[replacementConstructionIdx].insert(replacementTriple[1]);
         continue;
       }
@@ -806,7 +1006,7 @@ private:
 
           ReserveResult(replacementConstructionIdx, result);
 
-          result.m_replacementConstructions.emplace_back(nextResultReplacementTriples);
+          result.AppendConstruction(nextResultReplacementTriples.data());
           m_checkedTemplateTriplesInReplacementConstructions.emplace_back(nextCheckedTemplateTriples);
           m_usedConnectorsInReplacementConstructions.emplace_back(DEFAULT_RESULT_RESERVE_SIZE);
 
@@ -817,8 +1017,10 @@ private:
             m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx];
         if (!isForLastTemplateTripleAllChildrenFinished)
         {
-          result.m_replacementConstructions[replacementConstructionIdx].assign(
-              nextResultReplacementTriples.cbegin(), nextResultReplacementTriples.cend());
+          std::copy(
+              nextResultReplacementTriples.cbegin(),
+              nextResultReplacementTriples.cend(),
+              result.GetConstruction(replacementConstructionIdx));
           checkedTemplateTriplesInCurrentReplacementConstruction = nextCheckedTemplateTriples;
           m_usedConnectorsInReplacementConstructions[replacementConstructionIdx] = nextUsedReplacementConnectors;
         }
@@ -837,7 +1039,8 @@ private:
             != checkedTemplateTriplesInCurrentReplacementConstruction.cend())
           continue;
 
-        ScAddrVector & replacementConstruction = result.m_replacementConstructions[replacementConstructionIdx];
+        // buffer of search result can be reallocated by depended on triples, so construction isn't kept after them
+        ScAddr const * replacementConstruction = result.GetConstruction(replacementConstructionIdx);
 
         bool isFinished = true;
         auto const & items = templateTriple->GetValues();
@@ -846,6 +1049,9 @@ private:
           ScAddr const & resolvedAddr = ResolveAddr(items[i], replacementConstruction, result);
           if (resolvedAddr.IsValid() && resolvedAddr != replacementTriple[i])
           {
+            if (m_profile)
+              ++m_profile->m_triples[iteratedTemplateTripleIdx].m_rejectedByBindingCount;
+
             isForLastTemplateTripleAllChildrenFinished = false;
             isFinished = false;
             break;
@@ -900,7 +1106,7 @@ private:
                   otherTemplateTripleIdx);
             }
             childrenTemplateTriples.clear();
-            ClearResult(templateTripleIdx, replacementConstructionIdx, replacementConstruction);
+            ClearResult(templateTripleIdx, replacementConstructionIdx, result);
             continue;
           }
 
@@ -925,15 +1131,40 @@ private:
           && m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].size()
                  == m_template.m_templateTriples.size())
       {
-        if (!m_filterCallback
-            || m_filterCallback(
-                {&m_context,
-                 result.m_replacementConstructions[replacementConstructionIdx],
-                 result.m_templateItemsNamesToReplacementItemsPositions}))
+        if (!m_filterCallback || m_filterCallback(GetResultItem(result, replacementConstructionIdx)))
           AppendFoundReplacementConstruction(result, replacementConstructionIdx);
       }
     }
     while (!isStopped);
+
+    if (m_profile)
+      EndTripleProfile(iteratedTemplateTripleIdx, std::chrono::steady_clock::now() - beginTime);
+  }
+
+  void BeginTripleProfile(size_t tripleIdx)
+  {
+    auto & executionOrder = m_profile->m_executionOrder;
+    if (std::find(executionOrder.cbegin(), executionOrder.cend(), tripleIdx) == executionOrder.cend())
+      executionOrder.push_back(tripleIdx);
+
+    m_profileNestedDurations.emplace_back(0);
+  }
+
+  //! Accounts time of triple iteration without time of nested iterations of depended on triples.
+  void EndTripleProfile(size_t tripleIdx, std::chrono::nanoseconds const & duration)
+  {
+    std::chrono::nanoseconds const nestedDuration = m_profileNestedDurations.back();
+    m_profileNestedDurations.pop_back();
+
+    m_profile->m_triples[tripleIdx].m_duration += duration - nestedDuration;
+    if (!m_profileNestedDurations.empty())
+      m_profileNestedDurations.back() += duration;
+  }
+
+  void ProfileRejectedByUsedConnector(size_t tripleIdx)
+  {
+    if (m_profile)
+      ++m_profile->m_triples[tripleIdx].m_rejectedByUsedConnectorCount;
   }
 
   void UpdateResult(
@@ -943,14 +1174,14 @@ private:
       ScTemplateSearchResult & result)
   {
     auto const & UpdateResultByItem =
-        [&result](ScTemplateItem const & item, ScAddr const & addr, size_t const elementNum, ScAddrVector & resultAddrs)
+        [&result](ScTemplateItem const & item, ScAddr const & addr, size_t const elementNum, ScAddr * resultAddrs)
     {
       resultAddrs[elementNum] = addr;
 
       if (item.m_name.empty())
         return;
 
-      result.m_templateItemsNamesToReplacementItemsPositions[item.m_name] = elementNum;
+      (*result.m_templateItemsNamesToReplacementItemsPositions)[item.m_name] = elementNum;
     };
 
     m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].insert(templateTriple->m_index);
@@ -959,7 +1190,7 @@ private:
     size_t itemIdx = templateTriple->m_index * 3;
     for (size_t i = replacementConstructionIdx; i < result.Size(); ++i)
     {
-      ScAddrVector & resultAddrs = result.m_replacementConstructions[i];
+      ScAddr * resultAddrs = result.GetConstruction(i);
 
       UpdateResultByItem((*templateTriple)[0], replacementTriple[0], itemIdx, resultAddrs);
       UpdateResultByItem((*templateTriple)[1], replacementTriple[1], itemIdx + 1, resultAddrs);
@@ -967,11 +1198,9 @@ private:
     }
   };
 
-  void ClearResult(
-      size_t const tripleIdx,
-      size_t const replacementConstructionIdx,
-      ScAddrVector & replacementConstruction)
+  void ClearResult(size_t const tripleIdx, size_t const replacementConstructionIdx, ScTemplateSearchResult & result)
   {
+    ScAddr * replacementConstruction = result.GetConstruction(replacementConstructionIdx);
     m_checkedTemplateTriplesInReplacementConstructions[replacementConstructionIdx].erase(tripleIdx);
 
     size_t itemIdx = tripleIdx * 3;
@@ -983,21 +1212,26 @@ private:
     replacementConstruction[++itemIdx] = ScAddr::Empty;
   };
 
+  //! Gets view of construction in buffer of search result. Its copies made by callbacks own their sc-addresses.
+  ScTemplateResultItem GetResultItem(ScTemplateSearchResult & result, size_t resultIdx)
+  {
+    return {
+        &m_context,
+        result.m_replacementConstructions,
+        resultIdx * result.m_replacementConstructionSize,
+        result.m_replacementConstructionSize,
+        result.m_templateItemsNamesToReplacementItemsPositions};
+  }
+
   void AppendFoundReplacementConstruction(ScTemplateSearchResult & result, size_t & resultIdx)
   {
     if (m_callback)
     {
-      m_callback(
-          {&m_context,
-           result.m_replacementConstructions[resultIdx],
-           result.m_templateItemsNamesToReplacementItemsPositions});
+      m_callback(GetResultItem(result, resultIdx));
     }
     else if (m_callbackWithRequest)
     {
-      ScTemplateSearchRequest const & request = m_callbackWithRequest(
-          {&m_context,
-           result.m_replacementConstructions[resultIdx],
-           result.m_templateItemsNamesToReplacementItemsPositions});
+      ScTemplateSearchRequest const & request = m_callbackWithRequest(GetResultItem(result, resultIdx));
       switch (request)
       {
       case ScTemplateSearchRequest::STOP:
@@ -1022,8 +1256,10 @@ private:
     if (replacementConstructionIdx < DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount)
       return;
 
-    ++m_resultReserveCount;
-    result.m_replacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
+    // capacity grows geometrically, so constructions aren't copied on each reservation
+    m_resultReserveCount *= 2;
+    result.m_replacementConstructions->reserve(
+        DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount * result.m_replacementConstructionSize);
     m_checkedTemplateTriplesInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
     m_usedConnectorsInReplacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE * m_resultReserveCount);
   }
@@ -1033,10 +1269,15 @@ private:
     if (m_template.IsEmpty())
       return;
 
-    ScAddrVector newResult;
-    newResult.resize(CalculateOneResultSize());
-    result.m_replacementConstructions.reserve(DEFAULT_RESULT_RESERVE_SIZE);
-    result.m_replacementConstructions.emplace_back(newResult);
+    if (m_join)
+    {
+      DoJoinIterations(result);
+      return;
+    }
+
+    result.m_replacementConstructionSize = CalculateOneResultSize();
+    result.m_replacementConstructions->reserve(DEFAULT_RESULT_RESERVE_SIZE * result.m_replacementConstructionSize);
+    result.m_replacementConstructions->resize(result.m_replacementConstructionSize);
 
     m_notUsedConnectorsInTemplateTriples.resize(m_template.Size());
     m_usedConnectorsInTemplateTriples.resize(m_template.Size());
@@ -1055,20 +1296,57 @@ private:
     DoIterationOnNextEqualTriples(startTriples, "", 0, {}, childrenTemplateTriples, result, isFinished, isLast);
   }
 
+  void DoJoinIterations(ScTemplateSearchResult & result)
+  {
+    result.m_replacementConstructionSize = CalculateOneResultSize();
+    for (ScTemplateTriple const * triple : m_template.m_templateTriples)
+    {
+      for (size_t i = 0; i < 3; ++i)
+      {
+        ScTemplateItem const & item = (*triple)[i];
+        if (item.HasName())
+          result.m_templateItemsNamesToReplacementItemsPositions->insert({item.m_name, triple->m_index * 3 + i});
+      }
+    }
+
+    bool const isResultAccumulated = !m_callback && !m_callbackWithRequest;
+    m_join->Run(
+        [this](ScAddr const & addr) -> bool
+        {
+          return (!IsStructureValid() || IsInStructure(addr)) && (!m_checkCallback || m_checkCallback(addr));
+        },
+        [&](ScAddrVector const & construction) -> bool
+        {
+          size_t resultIdx = result.Size();
+          result.AppendConstruction(construction.data());
+
+          bool const isFound = !m_filterCallback || m_filterCallback(GetResultItem(result, resultIdx));
+          if (isFound)
+            AppendFoundReplacementConstruction(result, resultIdx);
+
+          if (!isFound || !isResultAccumulated)
+            result.m_replacementConstructions->resize(resultIdx * result.m_replacementConstructionSize);
+
+          return !isStopped;
+        });
+  }
+
 public:
   ScTemplate::Result operator()(ScTemplateSearchResult & result)
   {
     result.Clear();
     DoIterations(result);
 
-    std::vector<ScAddrVector> checkedResults;
-    checkedResults.reserve(result.Size());
+    // buffer of search has unfinished constructions too, so found ones are moved to buffer of exact size
+    auto checkedResults = std::make_shared<ScAddrVector>();
+    checkedResults->reserve(m_foundReplacementConstructions.size() * result.m_replacementConstructionSize);
     for (size_t const foundIdx : m_foundReplacementConstructions)
     {
-      checkedResults.emplace_back(result.m_replacementConstructions[foundIdx]);
+      ScAddr const * construction = result.GetConstruction(foundIdx);
+      checkedResults->insert(checkedResults->cend(), construction, construction + result.m_replacementConstructionSize);
     }
     result.m_context = &m_context;
-    result.m_replacementConstructions.assign(checkedResults.cbegin(), checkedResults.cend());
+    result.m_replacementConstructions = checkedResults;
 
     return ScTemplate::Result(result.Size() > 0);
   }
@@ -1089,6 +1367,7 @@ private:
   ScMemoryContext & m_context;
 
   // fields for template preprocessing
+  std::unique_ptr<ScTemplateJoin> m_join;
   std::map<std::string, ScTemplateTriples> m_templateItemsNamesToDependedTemplateTriples;
   ScTemplateTriples m_cycledTemplateTriples;
   std::vector<ScTemplateTriples> m_connectivityComponentsTemplateTriples;
@@ -1109,10 +1388,18 @@ private:
   bool isStopped = false;
 
   ScAddr const m_structure;
+  size_t m_structureArcsCount = 0;
+  ScAddrToValueUnorderedMap<bool> m_checkedStructureElements;
+  bool m_isStructureElementsCollected = false;
+  ScAddrUnorderedSet m_structureElements;
+
   ScTemplateSearchResultCallback m_callback;
   ScTemplateSearchResultCallbackWithRequest m_callbackWithRequest;
   ScTemplateSearchResultFilterCallback m_filterCallback;
   ScTemplateSearchResultCheckCallback m_checkCallback;
+
+  ScTemplateSearchProfile * m_profile = nullptr;
+  std::vector<std::chrono::nanoseconds> m_profileNestedDurations;
 };
 
 ScTemplate::Result ScTemplate::Search(ScMemoryContext & ctx, ScTemplateSearchResult & result) const
@@ -1121,6 +1408,31 @@ ScTemplate::Result ScTemplate::Search(ScMemoryContext & ctx, ScTemplateSearchRes
   return search(result);
 }
 
+ScTemplate::Result ScTemplate::Search(
+    ScMemoryContext & ctx,
+    ScAddr const & structureAddr,
+    ScTemplateSearchResult & result) const
+{
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, structureAddr);
+  return search(result);
+}
+
+ScTemplate::Result ScTemplate::Search(
+    ScMemoryContext & ctx,
+    ScTemplateSearchResult & result,
+    ScTemplateSearchProfile & profile) const
+{
+  profile.Clear();
+
+  auto const beginTime = std::chrono::steady_clock::now();
+  ScTemplateSearch search(const_cast<ScTemplate &>(*this), ctx, ScAddr::Empty);
+  search.SetProfile(profile);
+  ScTemplate::Result const isFound = search(result);
+  profile.m_duration = std::chrono::steady_clock::now() - beginTime;
+
+  return isFound;
+}
+
 void ScTemplate::Search(
     ScMemoryContext & ctx,
     ScTemplateSearchResultCallback const & callback,
@@ -1146,3 +1458,39 @@ void ScTemplate::Search(
   search.SetCheckCallback(checkCallback);
   search();
 }
+
+void ScTemplateSearchProfile::Clear() noexcept
+{
+  m_isJoined = false;
+  m_triples.clear();
+  m_executionOrder.clear();
+  m_duration = std::chrono::nanoseconds(0);
+}
+
+std::string ScTemplateSearchProfile::ToJSON() const
+{
+  auto const & ToMicroseconds = [](std::chrono::nanoseconds const & duration) -> double
+  {
+    return std::chrono::duration<double, std::micro>(duration).count();
+  };
+
+  nlohmann::json triplesJson = nlohmann::json::array();
+  for (TripleProfile const & triple : m_triples)
+  {
+    triplesJson.push_back(
+        {{"index", triple.m_tripleIdx},
+         {"iterators", triple.m_iteratorsCount},
+         {"visited", triple.m_visitedCandidatesCount},
+         {"rejectedByBinding", triple.m_rejectedByBindingCount},
+         {"rejectedByUsedConnector", triple.m_rejectedByUsedConnectorCount},
+         {"rejectedByStructure", triple.m_rejectedByStructureCount},
+         {"time", ToMicroseconds(triple.m_duration)}});
+  }
+
+  nlohmann::json const profileJson = {
+      {"algorithm", m_isJoined ? "join" : "dependence"},
+      {"time", ToMicroseconds(m_duration)},
+      {"order", m_executionOrder},
+      {"triples", triplesJson}};
+  return profileJson.dump();
+}
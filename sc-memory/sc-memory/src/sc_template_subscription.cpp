@@ -0,0 +1,608 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include "sc-memory/sc_template_subscription.hpp"
+
+#include <algorithm>
+
+#include "sc-memory/sc_agent_context.hpp"
+
+#include "sc_template_private.hpp"
+
+extern "C"
+{
+#include <sc-core/sc_iterator3.h>
+}
+
+size_t ScTemplateSubscription::ScAddrVectorHashFunc::operator()(ScAddrVector const & construction) const
+{
+  size_t hash = construction.size();
+  for (ScAddr const & addr : construction)
+    hash ^= std::hash<ScAddr::HashType>()(addr.Hash()) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+ScTemplateSubscription::ScTemplateSubscription(
+    std::unique_ptr<ScAgentContext> context,
+    ScTemplate const & templ,
+    DelegateFunc const & onAddedFunc,
+    DelegateFunc const & onRemovedFunc) noexcept(false)
+  : m_context(std::move(context))
+  , m_templateItemsNamesToReplacementItemsPositions(templ.m_templateItemsNamesToReplacementItemsPositions)
+  , m_onAddedDelegate(onAddedFunc)
+  , m_onRemovedDelegate(onRemovedFunc)
+{
+  ResolveVariables(templ);
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    for (size_t variableIdx = 0; variableIdx < m_variables.size(); ++variableIdx)
+    {
+      if (m_variables[variableIdx].m_fixedAddr.IsValid())
+        AddCandidate(variableIdx, m_variables[variableIdx].m_fixedAddr);
+    }
+
+    // already existing sc-constructions aren't newly formed, they are only tracked to notify when they are broken
+    m_context->SearchByTemplate(
+        templ,
+        [this](ScTemplateResultItem const & item)
+        {
+          AddConstruction({item.begin(), item.end()}, false);
+        });
+  }
+
+  // sc-constructions formed after search and before subscribing are found by checking sc-connectors of candidates
+  // after subscribing, and ones formed after subscribing are found by sc-events. Both are deduplicated with found ones.
+  WatchCandidates();
+}
+
+ScTemplateSubscription::~ScTemplateSubscription() noexcept
+{
+  ScAddrToValueUnorderedMap<ElementSubscriptions> watchedElements;
+  std::vector<ElementSubscriptions> erasedElementsSubscriptions;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_isDestroying = true;
+    watchedElements = std::move(m_watchedElements);
+    erasedElementsSubscriptions = std::move(m_erasedElementsSubscriptions);
+  }
+
+  // subscriptions wait for their sc-event handlers, so they are destroyed without lock
+  watchedElements.clear();
+  erasedElementsSubscriptions.clear();
+}
+
+void ScTemplateSubscription::SetOnAddedDelegate(DelegateFunc && func) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_onAddedDelegate = std::move(func);
+}
+
+void ScTemplateSubscription::SetOnRemovedDelegate(DelegateFunc && func) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_onRemovedDelegate = std::move(func);
+}
+
+void ScTemplateSubscription::RemoveDelegate() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_onAddedDelegate = DelegateFunc();
+  m_onRemovedDelegate = DelegateFunc();
+}
+
+void ScTemplateSubscription::SetPriority(ScEventPriority priority) noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_priority = priority;
+  for (auto & [_, elementSubscriptions] : m_watchedElements)
+  {
+    elementSubscriptions.m_generateConnectorSubscription->SetPriority(priority);
+    elementSubscriptions.m_eraseConnectorSubscription->SetPriority(priority);
+    elementSubscriptions.m_eraseElementSubscription->SetPriority(priority);
+  }
+}
+
+ScEventPriority ScTemplateSubscription::GetPriority() const noexcept
+{
+  return m_priority;
+}
+
+void ScTemplateSubscription::CollectLatencyStatistics(sc_events_latency_stat & stat) const noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  for (auto const & [_, elementSubscriptions] : m_watchedElements)
+  {
+    elementSubscriptions.m_generateConnectorSubscription->CollectLatencyStatistics(stat);
+    elementSubscriptions.m_eraseConnectorSubscription->CollectLatencyStatistics(stat);
+    elementSubscriptions.m_eraseElementSubscription->CollectLatencyStatistics(stat);
+  }
+}
+
+size_t ScTemplateSubscription::GetMatchesCount() noexcept
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_constructions.size();
+}
+
+void ScTemplateSubscription::ResolveVariables(ScTemplate const & templ)
+{
+  std::unordered_map<std::string, size_t> variablesNamesToIndices;
+  auto const & ResolveVariable = [&](ScTemplateItem const & item) -> size_t
+  {
+    if (item.HasName())
+    {
+      auto const & found = variablesNamesToIndices.find(item.m_name);
+      if (found != variablesNamesToIndices.cend())
+        return found->second;
+    }
+
+    ScType type = item.m_typeValue;
+    auto const & found = templ.m_templateItemsNamesToTypes.find(item.m_name);
+    if (found != templ.m_templateItemsNamesToTypes.cend())
+      type = found->second;
+
+    size_t const variableIdx = m_variables.size();
+    m_variables.push_back(
+        {item.IsFixed() ? item.m_addrValue : ScAddr::Empty,
+         type.HasConstancyFlag() ? type.UpConstType() : type,
+         {},
+         {},
+         false});
+    if (item.HasName())
+      variablesNamesToIndices.insert({item.m_name, variableIdx});
+    return variableIdx;
+  };
+
+  auto const & IsItemsEqual = [](ScTemplateItem const & item, ScTemplateItem const & otherItem) -> bool
+  {
+    return item.m_itemType == otherItem.m_itemType && item.m_addrValue == otherItem.m_addrValue
+           && item.m_typeValue == otherItem.m_typeValue && item.m_name == otherItem.m_name;
+  };
+
+  for (ScTemplateTriple const * triple : templ.m_templateTriples)
+  {
+    Triple const & items = triple->GetValues();
+
+    std::array<size_t, 3> tripleVariables{};
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+      tripleVariables[i] = ResolveVariable(items[i]);
+
+      Variable & variable = m_variables[tripleVariables[i]];
+      variable.m_positions.push_back(m_triples.size() * 3 + i);
+      // only sources and targets of triples are subscribed, connectors are caught by their incident sc-elements
+      variable.m_isWatched |= i != 1;
+    }
+
+    // equal triples give the same sc-constructions with new sc-connector, so they are searched once
+    bool const isTripleRepeated = std::any_of(
+        m_triples.cbegin(),
+        m_triples.cend(),
+        [&](Triple const & otherItems)
+        {
+          return IsItemsEqual(items[0], otherItems[0]) && IsItemsEqual(items[1], otherItems[1])
+                 && IsItemsEqual(items[2], otherItems[2]);
+        });
+
+    m_triples.push_back(items);
+    m_triplesVariables.push_back(tripleVariables);
+    m_isTriplesRepeated.push_back(isTripleRepeated);
+  }
+
+  for (Variable const & variable : m_variables)
+  {
+    if (variable.m_fixedAddr.IsValid() && variable.m_isWatched)
+      return;
+  }
+
+  SC_THROW_EXCEPTION(
+      utils::ExceptionInvalidParams,
+      "Not able to subscribe to sc-template, because it has no fixed sc-elements in sources or targets of its triples. "
+      "Sc-constructions of such sc-template can't be found by sc-events.");
+}
+
+void ScTemplateSubscription::AddCandidate(size_t variableIdx, ScAddr const & addr)
+{
+  std::queue<std::pair<size_t, ScAddr>> candidates;
+  candidates.push({variableIdx, addr});
+
+  while (!candidates.empty())
+  {
+    auto const [candidateVariableIdx, candidateAddr] = candidates.front();
+    candidates.pop();
+
+    Variable & variable = m_variables[candidateVariableIdx];
+    if (!variable.m_isWatched)
+      continue;
+
+    if (variable.m_fixedAddr.IsValid() && variable.m_fixedAddr != candidateAddr)
+      continue;
+
+    if (!variable.m_candidates.insert(candidateAddr).second)
+      continue;
+
+    if (m_watchedElements.find(candidateAddr) == m_watchedElements.cend())
+      m_unwatchedCandidates.push_back(candidateAddr);
+
+    PropagateCandidate(candidateVariableIdx, candidateAddr, candidates);
+  }
+}
+
+void ScTemplateSubscription::PropagateCandidate(
+    size_t variableIdx,
+    ScAddr const & addr,
+    std::queue<std::pair<size_t, ScAddr>> & candidates)
+{
+  for (size_t const position : m_variables[variableIdx].m_positions)
+  {
+    size_t const tripleIdx = position / 3;
+    std::array<size_t, 3> const & tripleVariables = m_triplesVariables[tripleIdx];
+    Variable const & sourceVariable = m_variables[tripleVariables[0]];
+    Variable const & connectorVariable = m_variables[tripleVariables[1]];
+    Variable const & targetVariable = m_variables[tripleVariables[2]];
+
+    ScIterator3Ptr it;
+    switch (position % 3)
+    {
+    case 0:
+      if (targetVariable.m_fixedAddr.IsValid())
+        it = m_context->CreateIterator3(addr, connectorVariable.m_type, targetVariable.m_fixedAddr);
+      else
+        it = m_context->CreateIterator3(addr, connectorVariable.m_type, targetVariable.m_type);
+      break;
+    case 2:
+      if (sourceVariable.m_fixedAddr.IsValid())
+        it = m_context->CreateIterator3(sourceVariable.m_fixedAddr, connectorVariable.m_type, addr);
+      else
+        it = m_context->CreateIterator3(sourceVariable.m_type, connectorVariable.m_type, addr);
+      break;
+    default:
+    {
+      if (!m_context->GetElementType(addr).IsConnector())
+        continue;
+
+      auto const [sourceAddr, targetAddr] = m_context->GetConnectorIncidentElements(addr);
+      if (IsTripleFit(tripleIdx, sourceAddr, addr, m_context->GetElementType(addr), targetAddr))
+      {
+        candidates.push({tripleVariables[0], sourceAddr});
+        candidates.push({tripleVariables[2], targetAddr});
+      }
+      continue;
+    }
+    }
+
+    while (it->Next())
+    {
+      candidates.push({tripleVariables[0], it->Get(0)});
+      candidates.push({tripleVariables[1], it->Get(1)});
+      candidates.push({tripleVariables[2], it->Get(2)});
+    }
+  }
+}
+
+bool ScTemplateSubscription::IsTripleFit(
+    size_t tripleIdx,
+    ScAddr const & sourceAddr,
+    ScAddr const & connectorAddr,
+    ScType const & connectorType,
+    ScAddr const & targetAddr)
+{
+  std::array<size_t, 3> const & tripleVariables = m_triplesVariables[tripleIdx];
+  if (tripleVariables[0] == tripleVariables[2] && sourceAddr != targetAddr)
+    return false;
+
+  std::array<ScAddr const *, 3> const addrs{&sourceAddr, &connectorAddr, &targetAddr};
+  for (size_t i = 0; i < addrs.size(); ++i)
+  {
+    Variable const & variable = m_variables[tripleVariables[i]];
+    if (variable.m_fixedAddr.IsValid())
+    {
+      if (variable.m_fixedAddr != *addrs[i])
+        return false;
+
+      continue;
+    }
+
+    ScType const & elementType = i == 1 ? connectorType : m_context->GetElementType(*addrs[i]);
+    if (!sc_iterator_compare_type(*elementType, *variable.m_type))
+      return false;
+  }
+
+  return true;
+}
+
+void ScTemplateSubscription::SearchWithTriple(
+    size_t tripleIdx,
+    ScAddr const & sourceAddr,
+    ScAddr const & connectorAddr,
+    ScAddr const & targetAddr)
+{
+  std::array<ScAddr, 3> const addrs{sourceAddr, connectorAddr, targetAddr};
+  std::unordered_map<std::string, ScAddr> itemsNamesToAddrs;
+  for (size_t i = 0; i < addrs.size(); ++i)
+  {
+    ScTemplateItem const & item = m_triples[tripleIdx][i];
+    if (item.HasName())
+      itemsNamesToAddrs.insert({item.m_name, addrs[i]});
+  }
+
+  // replace items of triple and all items with the same names by sc-elements of new sc-connector
+  ScTemplate templ;
+  for (size_t otherTripleIdx = 0; otherTripleIdx < m_triples.size(); ++otherTripleIdx)
+  {
+    Triple items = m_triples[otherTripleIdx];
+    for (size_t i = 0; i < items.size(); ++i)
+    {
+      ScTemplateItem & item = items[i];
+      auto const & found = itemsNamesToAddrs.find(item.m_name);
+      if (found != itemsNamesToAddrs.cend())
+        item = ScTemplateItem(found->second, item.m_name.c_str());
+      else if (otherTripleIdx == tripleIdx)
+        item = ScTemplateItem(addrs[i]);
+    }
+
+    templ.Triple(items[0], items[1], items[2]);
+  }
+
+  std::vector<ScAddrVector> constructions;
+  m_context->SearchByTemplate(
+      templ,
+      [&constructions](ScTemplateResultItem const & item)
+      {
+        constructions.emplace_back(item.begin(), item.end());
+      });
+
+  for (ScAddrVector const & construction : constructions)
+    AddConstruction(construction, true);
+}
+
+void ScTemplateSubscription::AddConstruction(ScAddrVector const & construction, bool isNotified)
+{
+  auto const & [it, isInserted] = m_constructions.insert(construction);
+  if (!isInserted)
+    return;
+
+  ScAddrVector const * constructionPtr = &*it;
+  for (size_t position = 0; position < construction.size(); ++position)
+  {
+    ScAddr const & addr = construction[position];
+    m_elementsConstructions[addr].insert(constructionPtr);
+
+    AddCandidate(m_triplesVariables[position / 3][position % 3], addr);
+  }
+
+  if (isNotified)
+    Notify(m_onAddedDelegate, construction);
+}
+
+void ScTemplateSubscription::RemoveConstructions(ScAddr const & addr)
+{
+  auto const & found = m_elementsConstructions.find(addr);
+  if (found == m_elementsConstructions.cend())
+    return;
+
+  std::unordered_set<ScAddrVector const *> const constructionsPtrs = std::move(found->second);
+  m_elementsConstructions.erase(found);
+
+  for (ScAddrVector const * constructionPtr : constructionsPtrs)
+  {
+    ScAddrVector const construction = *constructionPtr;
+    for (ScAddr const & elementAddr : construction)
+    {
+      auto const & foundElement = m_elementsConstructions.find(elementAddr);
+      if (foundElement == m_elementsConstructions.cend())
+        continue;
+
+      foundElement->second.erase(constructionPtr);
+      if (foundElement->second.empty())
+        m_elementsConstructions.erase(foundElement);
+    }
+    m_constructions.erase(construction);
+
+    Notify(m_onRemovedDelegate, construction);
+  }
+}
+
+void ScTemplateSubscription::CheckConnector(ScAddr const & connectorAddr, ScType const & connectorType)
+{
+  auto const [sourceAddr, targetAddr] = m_context->GetConnectorIncidentElements(connectorAddr);
+  auto const & CheckTriples = [&](ScAddr const & tripleSourceAddr, ScAddr const & tripleTargetAddr)
+  {
+    for (size_t tripleIdx = 0; tripleIdx < m_triples.size(); ++tripleIdx)
+    {
+      if (m_isTriplesRepeated[tripleIdx]
+          || !IsTripleFit(tripleIdx, tripleSourceAddr, connectorAddr, connectorType, tripleTargetAddr))
+        continue;
+
+      // sc-construction with new sc-connector can be formed only if one of its incident sc-elements is already
+      // reachable from fixed sc-elements
+      std::array<size_t, 3> const & tripleVariables = m_triplesVariables[tripleIdx];
+      ScAddrUnorderedSet const & sourceCandidates = m_variables[tripleVariables[0]].m_candidates;
+      ScAddrUnorderedSet const & targetCandidates = m_variables[tripleVariables[2]].m_candidates;
+      if (sourceCandidates.find(tripleSourceAddr) != sourceCandidates.cend()
+          || targetCandidates.find(tripleTargetAddr) != targetCandidates.cend())
+      {
+        AddCandidate(tripleVariables[0], tripleSourceAddr);
+        AddCandidate(tripleVariables[1], connectorAddr);
+        AddCandidate(tripleVariables[2], tripleTargetAddr);
+        SearchWithTriple(tripleIdx, tripleSourceAddr, connectorAddr, tripleTargetAddr);
+      }
+    }
+  };
+
+  CheckTriples(sourceAddr, targetAddr);
+  if (connectorType.IsCommonEdge() && sourceAddr != targetAddr)
+    CheckTriples(targetAddr, sourceAddr);
+}
+
+void ScTemplateSubscription::CheckConnectorsOfCandidate(ScAddr const & addr)
+{
+  auto const & CheckConnectors = [&](ScIterator3Ptr const & it)
+  {
+    while (it->Next())
+    {
+      // sc-connectors of found sc-constructions are already checked
+      ScAddr const & connectorAddr = it->Get(1);
+      if (m_elementsConstructions.find(connectorAddr) == m_elementsConstructions.cend())
+        CheckConnector(connectorAddr, m_context->GetElementType(connectorAddr));
+    }
+  };
+
+  CheckConnectors(m_context->CreateIterator3(addr, ScType::Unknown, ScType::Unknown));
+  CheckConnectors(m_context->CreateIterator3(ScType::Unknown, ScType::Unknown, addr));
+}
+
+void ScTemplateSubscription::OnConnectorGenerated(ScAddr const & connectorAddr, ScType const & connectorType)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isDestroying || !m_context->IsElement(connectorAddr))
+      return;
+
+    CheckConnector(connectorAddr, connectorType);
+  }
+
+  WatchCandidates();
+}
+
+void ScTemplateSubscription::OnElementErased(ScAddr const & addr, bool isConnectorErased)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (m_isDestroying)
+    return;
+
+  RemoveConstructions(addr);
+  if (isConnectorErased)
+    return;
+
+  // sc-address of erased sc-element can be reused, so it is no longer candidate
+  for (Variable & variable : m_variables)
+    variable.m_candidates.erase(addr);
+
+  auto const & found = m_watchedElements.find(addr);
+  if (found != m_watchedElements.cend())
+  {
+    m_erasedElementsSubscriptions.push_back(std::move(found->second));
+    m_watchedElements.erase(found);
+  }
+}
+
+void ScTemplateSubscription::Notify(DelegateFunc const & func, ScAddrVector const & construction)
+{
+  if (func)
+    func(ScTemplateResultItem(m_context.get(), construction, m_templateItemsNamesToReplacementItemsPositions));
+}
+
+void ScTemplateSubscription::WatchCandidates()
+{
+  using ScEventGenerateConnectorSubscription =
+      ScElementaryEventSubscription<ScEventAfterGenerateConnector<ScType::Unknown>>;
+  using ScEventEraseConnectorSubscription = ScElementaryEventSubscription<ScEventBeforeEraseConnector<ScType::Unknown>>;
+  using ScEventEraseElementSubscription = ScElementaryEventSubscription<ScEventBeforeEraseElement>;
+
+  // checking sc-connectors of new candidates can find other new candidates, so it is repeated until all are watched
+  while (true)
+  {
+    ScAddrVector candidates;
+    size_t lastId;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (m_isDestroying || m_unwatchedCandidates.empty())
+        return;
+
+      candidates.swap(m_unwatchedCandidates);
+      lastId = m_lastElementSubscriptionsId;
+      m_lastElementSubscriptionsId += candidates.size();
+    }
+
+    std::vector<std::pair<ScAddr, ElementSubscriptions>> subscriptions;
+    for (ScAddr const & candidateAddr : candidates)
+    {
+      size_t const id = ++lastId;
+      if (!m_context->IsElement(candidateAddr))
+        continue;
+
+      ElementSubscriptions elementSubscriptions;
+      elementSubscriptions.m_id = id;
+      elementSubscriptions.m_generateConnectorSubscription.reset(new ScEventGenerateConnectorSubscription(
+          *m_context,
+          candidateAddr,
+          [this, candidateAddr, id](ScEventAfterGenerateConnector<ScType::Unknown> const & event)
+          {
+            OnConnectorGenerated(event.GetConnector(), event.GetConnectorType());
+            PruneErasedElementsSubscriptions(candidateAddr, id);
+          }));
+      elementSubscriptions.m_eraseConnectorSubscription.reset(new ScEventEraseConnectorSubscription(
+          *m_context,
+          candidateAddr,
+          [this, candidateAddr, id](ScEventBeforeEraseConnector<ScType::Unknown> const & event)
+          {
+            OnElementErased(event.GetConnector(), true);
+            PruneErasedElementsSubscriptions(candidateAddr, id);
+          }));
+      elementSubscriptions.m_eraseElementSubscription.reset(new ScEventEraseElementSubscription(
+          *m_context,
+          candidateAddr,
+          [this](ScEventBeforeEraseElement const & event)
+          {
+            OnElementErased(event.GetSubscriptionElement(), false);
+          }));
+      subscriptions.emplace_back(candidateAddr, std::move(elementSubscriptions));
+    }
+
+    std::vector<ElementSubscriptions> unusedSubscriptions;
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      ScAddrVector watchedCandidates;
+      for (auto & [candidateAddr, elementSubscriptions] : subscriptions)
+      {
+        if (m_isDestroying || !m_watchedElements.insert({candidateAddr, elementSubscriptions}).second)
+        {
+          unusedSubscriptions.push_back(std::move(elementSubscriptions));
+          continue;
+        }
+
+        // priority is applied under lock, so it isn't overwritten by previous priority after `SetPriority` call
+        elementSubscriptions.m_generateConnectorSubscription->SetPriority(m_priority);
+        elementSubscriptions.m_eraseConnectorSubscription->SetPriority(m_priority);
+        elementSubscriptions.m_eraseElementSubscription->SetPriority(m_priority);
+        watchedCandidates.push_back(candidateAddr);
+      }
+
+      // sc-connectors generated before candidates were subscribed aren't caught by sc-events
+      for (ScAddr const & candidateAddr : watchedCandidates)
+      {
+        if (m_context->IsElement(candidateAddr))
+          CheckConnectorsOfCandidate(candidateAddr);
+      }
+    }
+
+    // subscriptions wait for their sc-event handlers, so they are destroyed without lock
+    unusedSubscriptions.clear();
+  }
+}
+
+void ScTemplateSubscription::PruneErasedElementsSubscriptions(ScAddr const & addr, size_t id)
+{
+  std::vector<ElementSubscriptions> erasedElementsSubscriptions;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_isDestroying || m_erasedElementsSubscriptions.empty())
+      return;
+
+    // handler of erased sc-element doesn't destroy subscriptions, because its own subscriptions may be among them, and
+    // other handler may wait for it while destroying them
+    auto const & found = m_watchedElements.find(addr);
+    if (found == m_watchedElements.cend() || found->second.m_id != id)
+      return;
+
+    erasedElementsSubscriptions.swap(m_erasedElementsSubscriptions);
+  }
+
+  erasedElementsSubscriptions.clear();
+}
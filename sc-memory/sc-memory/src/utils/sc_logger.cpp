@@ -149,16 +149,21 @@ ScLogger::ScLogType ScLogger::DefineLogType(std::string const & logType)
   return logType == "Console" ? ScLogger::ScLogType::Console : ScLogger::ScLogType::File;
 }
 
+bool ScLogger::IsEnabled(ScLogLevel const & logLevel) const
+{
+  // Do nothing on mute
+  if (m_isMuted)
+    return false;
+
+  return logLevel <= m_logLevel;
+}
+
 void ScLogger::Message(
     ScLogLevel logLevel,
     std::string const & message,
     ScConsole::Color color /*= ScConsole::Color::White*/)
 {
-  // Do nothing on mute
-  if (m_isMuted)
-    return;
-
-  if (!(logLevel <= m_logLevel))
+  if (!IsEnabled(logLevel))
     return;
 
   utils::ScLockScope lock(gLock);
@@ -15,10 +15,15 @@
 #include "units/memory_erase_set_elements.hpp"
 
 #include "units/memory_erase_elements.hpp"
+#include "units/memory_user_mode_read.hpp"
+
+#include "units/event_emission.hpp"
+#include "units/agent_invocation.hpp"
 
 #include "units/sc_code_base_vs_extend.hpp"
 
 #include "units/template_search_complex.hpp"
+#include "units/template_search_cyclic.hpp"
 #include "units/template_search_smoke.hpp"
 
 #include <atomic>
@@ -373,6 +378,51 @@ BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestIteratorSearch)
 ->Arg(kSetPower)
 ->Unit(benchmark::TimeUnit::kMicrosecond);
 
+int constexpr kUserModeReadIters = 1000000;
+int constexpr kUserModeReadNodes = 1000;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestUserModeRead)
+->Threads(1)
+->Iterations(kUserModeReadIters / 1)
+->Arg(kUserModeReadNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestUserModeRead)
+->Threads(2)
+->Iterations(kUserModeReadIters / 2)
+->Arg(kUserModeReadNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestUserModeRead)
+->Threads(3)
+->Iterations(kUserModeReadIters / 3)
+->Arg(kUserModeReadNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestUserModeRead)
+->Threads(4)
+->Iterations(kUserModeReadIters / 4)
+->Arg(kUserModeReadNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestUserModeRead)
+->Threads(8)
+->Iterations(kUserModeReadIters / 8)
+->Arg(kUserModeReadNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestUserModeRead)
+->Threads(16)
+->Iterations(kUserModeReadIters / 16)
+->Arg(kUserModeReadNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestUserModeRead)
+->Threads(32)
+->Iterations(kUserModeReadIters / 32)
+->Arg(kUserModeReadNodes)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
 BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestSearchLinkByContent)
 ->Threads(1)
 ->Iterations(kSetPower)
@@ -510,6 +560,43 @@ BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEraseElements)
 ->Arg(10)->Arg(100)->Arg(1000)
 ->Iterations(5000);
 
+int constexpr kEventsTargetsNum = 1000;
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEventEmissionLatency)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(kEventsTargetsNum)
+->Iterations(10000);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestEventEmissionThroughput)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(1000)->Arg(10000)->Arg(100000)
+->Iterations(10);
+
+int constexpr kEventsIters = 100000;
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEventEmissionConcurrent)
+->Threads(1)
+->Iterations(kEventsIters)
+->Arg(kEventsTargetsNum)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEventEmissionConcurrent)
+->Threads(4)
+->Iterations(kEventsIters / 4)
+->Arg(kEventsTargetsNum)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryThreaded2, TestEventEmissionConcurrent)
+->Threads(16)
+->Iterations(kEventsIters / 16)
+->Arg(kEventsTargetsNum)
+->Unit(benchmark::TimeUnit::kMicrosecond);
+
+BENCHMARK_TEMPLATE(BM_MemoryRanged, TestAgentInvocation)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(0)
+->Iterations(10000);
+
 // ------------------------------------
 template <class BMType>
 void BM_Template(benchmark::State & state)
@@ -532,10 +619,23 @@ BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchSmoke)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50)->Arg(500);
 
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchSmoke)
+->Unit(benchmark::TimeUnit::kMillisecond)
+->Arg(100000)
+->Iterations(10);
+
 BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchComplex)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
 ->Arg(5)->Arg(50);
 
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchCyclicTriangle)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(10)->Arg(50)->Arg(100);
+
+BENCHMARK_TEMPLATE(BM_Template, TestTemplateSearchCyclicDiamond)
+->Unit(benchmark::TimeUnit::kMicrosecond)
+->Arg(10)->Arg(50);
+
 // SC-code base vs extended
 BENCHMARK_TEMPLATE(BM_Template, TestScCodeBase)
 ->Unit(benchmark::TimeUnit::kMicrosecond)
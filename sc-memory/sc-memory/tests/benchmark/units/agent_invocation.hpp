@@ -0,0 +1,74 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_agent.hpp"
+#include "sc-memory/sc_agent_context.hpp"
+
+#include <atomic>
+#include <thread>
+
+//! Agent that does nothing, so only flow of calling agents is measured.
+class TestEmptyAgent : public ScActionInitiatedAgent
+{
+public:
+  static inline ScAddr ms_actionClassAddr;
+  static inline std::atomic_size_t ms_performedActionsCount = 0;
+
+  TestEmptyAgent()
+  {
+    m_logger.SetLogLevel(utils::ScLogLevel::Error);
+  }
+
+  ScAddr GetActionClass() const override
+  {
+    return ms_actionClassAddr;
+  }
+
+  ScResult DoProgram(ScAction & action) override
+  {
+    ++ms_performedActionsCount;
+    return action.FinishSuccessfully();
+  }
+};
+
+//! Measures time from initiation of action to the end of its performing by agent that does nothing.
+class TestAgentInvocation : public TestMemory
+{
+public:
+  void Setup(size_t) override
+  {
+    m_agentCtx = std::make_unique<ScAgentContext>();
+    TestEmptyAgent::ms_actionClassAddr = m_agentCtx->GenerateNode(ScType::ConstNodeClass);
+    m_agentCtx->SubscribeAgent<TestEmptyAgent>();
+  }
+
+  void Run()
+  {
+    m_agentCtx->GenerateAction(TestEmptyAgent::ms_actionClassAddr).Initiate();
+    ++m_initiatedActionsCount;
+
+    while (TestEmptyAgent::ms_performedActionsCount.load() < m_initiatedActionsCount)
+      std::this_thread::yield();
+  }
+
+  void Shutdown()
+  {
+    m_agentCtx->UnsubscribeAgent<TestEmptyAgent>();
+    m_agentCtx.reset();
+    TestEmptyAgent::ms_performedActionsCount = 0;
+    m_initiatedActionsCount = 0;
+
+    TestMemory::Shutdown();
+  }
+
+protected:
+  std::unique_ptr<ScAgentContext> m_agentCtx;
+  size_t m_initiatedActionsCount = 0;
+};
@@ -0,0 +1,109 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_agent_context.hpp"
+#include "sc-memory/sc_event_subscription.hpp"
+
+#include <atomic>
+#include <thread>
+
+class TestEventEmission : public TestMemory
+{
+public:
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  void Setup(size_t targetsNum) override
+  {
+    m_subscriptionAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_targets.reserve(targetsNum);
+    for (size_t i = 0; i < targetsNum; ++i)
+      m_targets.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+
+    m_agentCtx = std::make_unique<ScAgentContext>();
+    m_subscription = m_agentCtx->CreateElementaryEventSubscription<ScEventGenerateArc>(
+        m_subscriptionAddr,
+        [](ScEventGenerateArc const &)
+        {
+          ++m_handledEventsCount;
+        });
+  }
+
+  void Shutdown()
+  {
+    m_subscription.reset();
+    m_agentCtx.reset();
+    m_targets.clear();
+    m_emittedEventsCount = 0;
+    m_handledEventsCount = 0;
+
+    TestMemory::Shutdown();
+  }
+
+protected:
+  void EmitEvent()
+  {
+    m_ctx->GenerateConnector(
+        ScType::ConstPermPosArc, m_subscriptionAddr, m_targets[m_emittedEventsCount++ % m_targets.size()]);
+  }
+
+  void WaitForHandledEvents()
+  {
+    while (m_handledEventsCount.load() < m_emittedEventsCount.load())
+      std::this_thread::yield();
+  }
+
+  static ScAddr m_subscriptionAddr;
+  static ScAddrVector m_targets;
+  static std::unique_ptr<ScAgentContext> m_agentCtx;
+  static std::shared_ptr<ScElementaryEventSubscription<ScEventGenerateArc>> m_subscription;
+  static std::atomic_size_t m_emittedEventsCount;
+  static std::atomic_size_t m_handledEventsCount;
+};
+
+ScAddr TestEventEmission::m_subscriptionAddr;
+ScAddrVector TestEventEmission::m_targets;
+std::unique_ptr<ScAgentContext> TestEventEmission::m_agentCtx;
+std::shared_ptr<ScElementaryEventSubscription<TestEventEmission::ScEventGenerateArc>>
+    TestEventEmission::m_subscription;
+std::atomic_size_t TestEventEmission::m_emittedEventsCount = 0;
+std::atomic_size_t TestEventEmission::m_handledEventsCount = 0;
+
+//! Measures time from emission of sc-event to the end of its handling.
+class TestEventEmissionLatency : public TestEventEmission
+{
+public:
+  void Run()
+  {
+    EmitEvent();
+    WaitForHandledEvents();
+  }
+};
+
+//! Measures time of emission and handling of burst of sc-events.
+class TestEventEmissionThroughput : public TestEventEmission
+{
+public:
+  void Run()
+  {
+    for (size_t i = 0; i < m_targets.size(); ++i)
+      EmitEvent();
+    WaitForHandledEvents();
+  }
+};
+
+//! Measures time of emission of sc-events by concurrent producers.
+class TestEventEmissionConcurrent : public TestEventEmission
+{
+public:
+  void Run()
+  {
+    EmitEvent();
+  }
+};
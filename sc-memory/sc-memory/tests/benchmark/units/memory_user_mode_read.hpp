@@ -0,0 +1,73 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "memory_test.hpp"
+
+#include "sc-memory/sc_keynodes.hpp"
+
+//! Reads sc-elements by contexts of user in user mode, so each read checks permissions of user.
+class TestUserModeRead : public TestMemory
+{
+public:
+  void Initialize(size_t nodesNum = 0)
+  {
+    sc_memory_params params;
+    sc_memory_params_clear(&params);
+    params.clear = SC_TRUE;
+    params.storage = "test_repo";
+    params.user_mode = SC_TRUE;
+
+    ScMemory::LogMute();
+    ScMemory::Initialize(params);
+
+    m_ctx = std::make_unique<ScMemoryContext>(sc_memory_context_new_ext(*ScKeynodes::myself));
+    Setup(nodesNum);
+    InitContext();
+  }
+
+  void InitContext()
+  {
+    m_ctx = std::make_unique<ScMemoryContext>(sc_memory_context_new_ext(*m_userAddr));
+  }
+
+  void Run()
+  {
+    BENCHMARK_BUILTIN_EXPECT(m_ctx->GetElementType(m_nodes[m_nodeIndex++ % m_nodes.size()]) == ScType::ConstNode, true);
+  }
+
+  void Setup(size_t nodesNum) override
+  {
+    m_userAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    ScAddr const & arcAddr =
+        m_ctx->GenerateConnector(ScType::ConstCommonArc, m_userAddr, ScKeynodes::action_read_from_sc_memory);
+    m_ctx->GenerateConnector(ScType::ConstTempPosArc, ScKeynodes::nrel_user_action_class, arcAddr);
+
+    m_nodes.clear();
+    for (size_t i = 0; i < std::max<size_t>(nodesNum, 1); ++i)
+      m_nodes.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+
+    // permissions are added by sc-event, so reading is measured after they are added
+    sc_memory_context * userContext = sc_memory_context_new_ext(*m_userAddr);
+    sc_type type;
+    while (sc_memory_get_element_type(userContext, *m_nodes.front(), &type) != SC_RESULT_OK)
+      std::this_thread::yield();
+    sc_memory_context_free(userContext);
+  }
+
+private:
+  size_t m_nodeIndex = 0;
+  static ScAddr m_userAddr;
+  static std::vector<ScAddr> m_nodes;
+};
+
+ScAddr TestUserModeRead::m_userAddr;
+std::vector<ScAddr> TestUserModeRead::m_nodes;
@@ -0,0 +1,69 @@
+/*
+* This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+* Distributed under the MIT License
+* (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+*/
+
+#pragma once
+
+#include "template_test.hpp"
+
+class TestTemplateSearchCyclic : public TestTemplate
+{
+protected:
+  //! Generates a dense graph of `constrCount` class members, where each member has arcs to half of others.
+  ScAddrVector GenerateDenseGraph(ScAddr const & classAddr, size_t constrCount)
+  {
+    ScAddrVector members;
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      ScAddr const memberAddr = m_ctx->GenerateNode(ScType::ConstNode);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, memberAddr);
+      members.push_back(memberAddr);
+    }
+
+    for (size_t i = 0; i < constrCount; ++i)
+    {
+      for (size_t j = 1; j <= constrCount / 2; ++j)
+        m_ctx->GenerateConnector(ScType::ConstCommonArc, members[i], members[(i + j) % constrCount]);
+    }
+
+    return members;
+  }
+};
+
+class TestTemplateSearchCyclicTriangle : public TestTemplateSearchCyclic
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+    GenerateDenseGraph(classAddr, constrCount);
+
+    m_templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_a");
+    m_templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_b");
+    m_templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_c");
+    m_templ.Triple("_a", ScType::VarCommonArc, "_b");
+    m_templ.Triple("_b", ScType::VarCommonArc, "_c");
+    m_templ.Triple("_a", ScType::VarCommonArc, "_c");
+  }
+};
+
+class TestTemplateSearchCyclicDiamond : public TestTemplateSearchCyclic
+{
+public:
+  void Setup(size_t constrCount) override
+  {
+    ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+    GenerateDenseGraph(classAddr, constrCount);
+
+    m_templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_a");
+    m_templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_b");
+    m_templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_c");
+    m_templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_d");
+    m_templ.Triple("_a", ScType::VarCommonArc, "_b");
+    m_templ.Triple("_a", ScType::VarCommonArc, "_c");
+    m_templ.Triple("_b", ScType::VarCommonArc, "_d");
+    m_templ.Triple("_c", ScType::VarCommonArc, "_d");
+  }
+};
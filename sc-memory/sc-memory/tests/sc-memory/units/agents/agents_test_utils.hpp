@@ -9,3 +9,4 @@
 #include <sc-memory/test/sc_test.hpp>
 
 using ScAgentTest = ScMemoryTest;
+using ScAgentTestWithUserMode = ScMemoryTestWithUserMode;
@@ -7,6 +7,8 @@
 #include <sc-memory/test/sc_test.hpp>
 
 #include <sc-memory/sc_action.hpp>
+#include <sc-memory/sc_action_batch.hpp>
+#include <sc-memory/sc_action_completion_registry.hpp>
 
 #include "test_sc_agent.hpp"
 
@@ -708,3 +710,305 @@ TEST_F(ScActionTest, SetExpectedExecutionTimeAndInitiateAndWaitActionAndCheckSto
 
   m_ctx->UnsubscribeAgent<ATestCheckResult>();
 }
+
+TEST_F(ScActionTest, WaitAllActionsFinishedByAgent)
+{
+  m_ctx->SubscribeAgent<ATestCheckResult>();
+
+  ScAddrVector actionAddrs;
+  for (size_t i = 0; i < 5; ++i)
+    actionAddrs.push_back(m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+                              .SetArguments(
+                                  ATestGenerateOutgoingArc::generate_outgoing_arc_action,
+                                  ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+                              .Initiate());
+
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll(actionAddrs));
+  for (ScAddr const & actionAddr : actionAddrs)
+    EXPECT_TRUE(m_ctx->ConvertToAction(actionAddr).IsFinishedSuccessfully());
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+
+  m_ctx->UnsubscribeAgent<ATestCheckResult>();
+}
+
+TEST_F(ScActionTest, WaitAllNotFinishedActions)
+{
+  ScAction action1 = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  action1.Initiate().FinishSuccessfully();
+  ScAction action2 = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+
+  EXPECT_FALSE(ScActionCompletionRegistry::WaitAll({action1, action2}, 100));
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({action1, action1}, 100));
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({}, 100));
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+}
+
+TEST_F(ScActionTest, WaitAnyAction)
+{
+  ScAction action1 = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  ScAction action2 = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+
+  EXPECT_EQ(ScActionCompletionRegistry::WaitAny({action1, action2}, 100), ScAddr::Empty);
+
+  action2.Initiate().FinishSuccessfully();
+  EXPECT_EQ(ScActionCompletionRegistry::WaitAny({action1, action2}, 100), action2);
+  EXPECT_EQ(ScActionCompletionRegistry::WaitAny({}, 100), ScAddr::Empty);
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+}
+
+TEST_F(ScActionTest, GetFinishedFutureOfAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  ScActionCompletionRegistry::ScFinishedFuture future = ScActionCompletionRegistry::GetFinishedFuture(action);
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 1u);
+
+  action.Initiate().FinishSuccessfully();
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+  EXPECT_EQ(future.get(), action);
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+}
+
+TEST_F(ScActionTest, DropFinishedFutureOfAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  {
+    ScActionCompletionRegistry::ScFinishedFuture future = ScActionCompletionRegistry::GetFinishedFuture(action);
+    ScActionCompletionRegistry::ScFinishedFuture const futureCopy = future;
+    future = ScActionCompletionRegistry::ScFinishedFuture();
+    EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 1u);
+    EXPECT_TRUE(futureCopy.valid());
+  }
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+}
+
+TEST_F(ScActionTest, GetFinishedFutureOfErasedAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  ScActionCompletionRegistry::ScFinishedFuture const future = ScActionCompletionRegistry::GetFinishedFuture(action);
+
+  m_ctx->EraseElement(action);
+  EXPECT_EQ(future.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+  EXPECT_THROW(future.get(), std::future_error);
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+}
+
+TEST_F(ScActionTest, GetFinishedFuturesOfErasedAndFinishedActions)
+{
+  ScAction erasedAction = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  ScAction finishedAction = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  ScActionCompletionRegistry::ScFinishedFuture const erasedFuture =
+      ScActionCompletionRegistry::GetFinishedFuture(erasedAction);
+  ScActionCompletionRegistry::ScFinishedFuture const finishedFuture =
+      ScActionCompletionRegistry::GetFinishedFuture(finishedAction);
+
+  // erasure of other sc-elements and of other waited action doesn't discard wait of action
+  m_ctx->EraseElement(m_ctx->GenerateNode(ScType::ConstNode));
+  m_ctx->EraseElement(erasedAction);
+  EXPECT_EQ(erasedFuture.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+  EXPECT_THROW(erasedFuture.get(), std::future_error);
+  EXPECT_EQ(finishedFuture.wait_for(std::chrono::milliseconds(10)), std::future_status::timeout);
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 1u);
+
+  finishedAction.Initiate().FinishSuccessfully();
+  EXPECT_EQ(finishedFuture.wait_for(std::chrono::milliseconds(5000)), std::future_status::ready);
+  EXPECT_EQ(finishedFuture.get(), finishedAction);
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+
+  // finished action isn't watched anymore, so its erasure doesn't affect its future
+  m_ctx->EraseElement(finishedAction);
+  EXPECT_EQ(finishedFuture.get(), finishedAction);
+}
+
+TEST_F(ScActionTest, WaitInvalidAction)
+{
+  EXPECT_THROW(ScActionCompletionRegistry::WaitAll({ScAddr::Empty}, 100), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ScActionCompletionRegistry::WaitAny({ScAddr::Empty}, 100), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ScActionCompletionRegistry::GetFinishedFuture(ScAddr::Empty), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScActionTest, AwaitTimeAndContinueAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  action.Initiate();
+
+  action.AwaitTime(
+      10,
+      [](ScAgentContext &, ScAction & action, bool isTimedOut) -> ScResult
+      {
+        EXPECT_TRUE(isTimedOut);
+        return action.FinishSuccessfully();
+      });
+  EXPECT_FALSE(action.IsFinished());
+
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({action}));
+  EXPECT_TRUE(action.IsFinishedSuccessfully());
+}
+
+TEST_F(ScActionTest, AsyncWaitIsResumedWhenMemoryIsShutDown)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  action.Initiate();
+
+  auto const isFinished = std::make_shared<std::atomic_int>(-1);
+  auto const isTimeCallbackCalled = std::make_shared<std::atomic_bool>(false);
+  ScActionCompletionRegistry::WaitAllAsync(
+      {action},
+      [isFinished](bool result)
+      {
+        *isFinished = result;
+      },
+      100000);
+  ScActionCompletionRegistry::WaitTimeAsync(
+      100000,
+      [isTimeCallbackCalled]()
+      {
+        *isTimeCallbackCalled = true;
+      });
+
+  m_ctx->Destroy();
+  Shutdown();
+  EXPECT_EQ(*isFinished, 0);
+  EXPECT_FALSE(*isTimeCallbackCalled);
+
+  Initialize();
+  m_ctx = std::make_unique<ScAgentContext>();
+}
+
+TEST_F(ScActionTest, AwaitAnyAndContinueActionWithFinishedAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  action.Initiate();
+  ScAction subAction1 = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  ScAction subAction2 = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  subAction2.Initiate().FinishSuccessfully();
+
+  action.AwaitAny(
+      {subAction1, subAction2},
+      [](ScAgentContext &, ScAction & action, bool isTimedOut) -> ScResult
+      {
+        EXPECT_FALSE(isTimedOut);
+        return action.FinishSuccessfully();
+      });
+
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({action}));
+  EXPECT_TRUE(action.IsFinishedSuccessfully());
+  EXPECT_EQ(ScActionCompletionRegistry::GetWaitedActionsCount(), 0u);
+}
+
+TEST_F(ScActionTest, ContinuationThrowsException)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  action.Initiate();
+
+  action.AwaitTime(
+      10,
+      [](ScAgentContext &, ScAction &, bool) -> ScResult
+      {
+        SC_THROW_EXCEPTION(utils::ExceptionInvalidState, "Test exception.");
+      });
+
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({action}));
+  EXPECT_TRUE(action.IsFinishedWithError());
+}
+
+TEST_F(ScActionTest, AwaitNotInitiatedAction)
+{
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  auto const & continuation = [](ScAgentContext &, ScAction & action, bool) -> ScResult
+  {
+    return action.FinishSuccessfully();
+  };
+
+  EXPECT_THROW(action.AwaitAll({}, continuation), utils::ExceptionInvalidState);
+  EXPECT_THROW(action.AwaitAny({}, continuation), utils::ExceptionInvalidState);
+  EXPECT_THROW(action.AwaitTime(10, continuation), utils::ExceptionInvalidState);
+
+  action.Initiate().FinishSuccessfully();
+  EXPECT_THROW(action.AwaitAll({}, continuation), utils::ExceptionInvalidState);
+}
+
+TEST_F(ScActionTest, GenerateAndInitiateActionsAndWaitAll)
+{
+  m_ctx->SubscribeAgent<ATestCheckResult>();
+
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  std::vector<ScAddrVector> argumentsList{
+      {argumentAddr, argumentAddr}, {argumentAddr}, {}, {argumentAddr, argumentAddr}};
+  ScActionBatch batch =
+      m_ctx->GenerateAndInitiateActions(ATestGenerateOutgoingArc::generate_outgoing_arc_action, argumentsList);
+  EXPECT_EQ(batch.GetActions().size(), argumentsList.size());
+
+  EXPECT_TRUE(batch.WaitAll());
+  std::vector<ScActionBatch::ActionResult> const & results = batch.GetResults();
+  EXPECT_EQ(results.size(), argumentsList.size());
+  EXPECT_EQ(results[0].m_state, ScActionBatch::ActionState::FinishedSuccessfully);
+  EXPECT_EQ(results[1].m_state, ScActionBatch::ActionState::FinishedUnsuccessfully);
+  EXPECT_EQ(results[2].m_state, ScActionBatch::ActionState::FinishedWithError);
+  EXPECT_EQ(results[3].m_state, ScActionBatch::ActionState::FinishedSuccessfully);
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    EXPECT_EQ(results[i].m_actionAddr, batch.GetActions()[i]);
+    ScAction action = m_ctx->ConvertToAction(results[i].m_actionAddr);
+    EXPECT_EQ(action.GetClass(), ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+    EXPECT_TRUE(action.IsInitiated());
+    EXPECT_EQ(action.GetArgument(1), argumentsList[i].empty() ? ScAddr::Empty : argumentAddr);
+  }
+
+  m_ctx->UnsubscribeAgent<ATestCheckResult>();
+}
+
+TEST_F(ScActionTest, GenerateAndInitiateActionsAndWaitAllUntilTimeout)
+{
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScActionBatch batch = m_ctx->GenerateAndInitiateActions(
+      ATestGenerateOutgoingArc::generate_outgoing_arc_action, {{argumentAddr}, {argumentAddr}});
+
+  m_ctx->ConvertToAction(batch.GetActions()[0]).FormResult(argumentAddr).FinishSuccessfully();
+  EXPECT_FALSE(batch.WaitAll(100));
+
+  std::vector<ScActionBatch::ActionResult> const & results = batch.GetResults();
+  EXPECT_EQ(results[0].m_state, ScActionBatch::ActionState::FinishedSuccessfully);
+  EXPECT_TRUE(m_ctx->IsElement(results[0].m_resultAddr));
+  EXPECT_EQ(results[1].m_state, ScActionBatch::ActionState::NotFinished);
+  EXPECT_EQ(results[1].m_resultAddr, ScAddr::Empty);
+}
+
+TEST_F(ScActionTest, GetResultsOfActionsAfterContextIsDestroyed)
+{
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  std::unique_ptr<ScActionBatch> batch;
+  {
+    ScAgentContext context;
+    batch = std::make_unique<ScActionBatch>(
+        context.GenerateAndInitiateActions(ATestGenerateOutgoingArc::generate_outgoing_arc_action, {{argumentAddr}}));
+  }
+
+  m_ctx->ConvertToAction(batch->GetActions()[0]).FinishUnsuccessfully();
+  std::vector<ScActionBatch::ActionResult> const & results = batch->GetResults();
+  EXPECT_EQ(results[0].m_state, ScActionBatch::ActionState::FinishedUnsuccessfully);
+}
+
+TEST_F(ScActionTest, GetResultsOfErasedActions)
+{
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScActionBatch batch = m_ctx->GenerateAndInitiateActions(
+      ATestGenerateOutgoingArc::generate_outgoing_arc_action, {{argumentAddr}});
+
+  m_ctx->EraseElement(batch.GetActions()[0]);
+  std::vector<ScActionBatch::ActionResult> const & results = batch.GetResults();
+  EXPECT_EQ(results[0].m_state, ScActionBatch::ActionState::NotFinished);
+}
+
+TEST_F(ScActionTest, GenerateAndInitiateActionsWithInvalidArguments)
+{
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_THROW(
+      m_ctx->GenerateAndInitiateActions(ScAddr::Empty, {{argumentAddr}}), utils::ExceptionInvalidParams);
+  EXPECT_THROW(
+      m_ctx->GenerateAndInitiateActions(
+          ATestGenerateOutgoingArc::generate_outgoing_arc_action, {{argumentAddr}, {argumentAddr, ScAddr::Empty}}),
+      utils::ExceptionInvalidParams);
+  EXPECT_EQ(m_ctx->GetElementEdgesAndIncomingArcsCount(argumentAddr), 0u);
+}
@@ -62,6 +62,63 @@ ScResult ATestGenerateOutgoingArc::DoProgram(
 
 /// --------------------------------------
 
+ScAddr ATestBatchGenerateOutgoingArc::GetActionClass() const
+{
+  return ATestBatchGenerateOutgoingArc::batch_generate_outgoing_arc_action;
+}
+
+size_t ATestBatchGenerateOutgoingArc::GetMaxBatchSize() const
+{
+  return 3u;
+}
+
+std::chrono::milliseconds ATestBatchGenerateOutgoingArc::GetMaxBatchDelay() const
+{
+  return std::chrono::hours(1);
+}
+
+ScResult ATestBatchGenerateOutgoingArc::DoProgram(
+    std::vector<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>> const & events,
+    ScAction & action)
+{
+  msEventsCount += events.size();
+  msWaiter.Unlock();
+  return action.FinishSuccessfully();
+}
+
+/// --------------------------------------
+
+void ATestConcurrentGenerateOutgoingArc::Reset()
+{
+  msCallsCount = 0;
+  msRunningCallsCount = 0;
+  msMaxRunningCallsCount = 0;
+}
+
+ScAddr ATestConcurrentGenerateOutgoingArc::GetActionClass() const
+{
+  return ATestConcurrentGenerateOutgoingArc::concurrent_generate_outgoing_arc_action;
+}
+
+ScResult ATestConcurrentGenerateOutgoingArc::DoProgram(
+    ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &,
+    ScAction & action)
+{
+  size_t const runningCallsCount = ++msRunningCallsCount;
+  size_t maxRunningCallsCount = msMaxRunningCallsCount;
+  while (runningCallsCount > maxRunningCallsCount
+         && !msMaxRunningCallsCount.compare_exchange_weak(maxRunningCallsCount, runningCallsCount))
+    ;
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  --msRunningCallsCount;
+  ++msCallsCount;
+  return action.FinishSuccessfully();
+}
+
+/// --------------------------------------
+
 ScAddr ATestGenerateEdge::GetActionClass() const
 {
   return ATestGenerateEdge::add_edge_action;
@@ -291,6 +348,49 @@ ScResult ATestCheckResult::DoProgram(ScActionInitiatedEvent const &, ScAction &
 
 /// --------------------------------------
 
+ScAddr ATestMemoizedResult::GetActionClass() const
+{
+  return ATestMemoizedResult::memoized_result_action;
+}
+
+size_t ATestMemoizedResult::GetMaxMemoizedResultsCount() const
+{
+  return 2u;
+}
+
+ScResult ATestMemoizedResult::DoProgram(ScAction & action)
+{
+  ++msCallsCount;
+  action.FormResult(action.GetArgument(1));
+  return action.FinishSuccessfully();
+}
+
+/// --------------------------------------
+
+ScAddr ATestMemoizedResultByContentOfLinks::GetActionClass() const
+{
+  return ATestMemoizedResultByContentOfLinks::memoized_result_by_content_of_links_action;
+}
+
+size_t ATestMemoizedResultByContentOfLinks::GetMaxMemoizedResultsCount() const
+{
+  return 2u;
+}
+
+bool ATestMemoizedResultByContentOfLinks::IsResultMemoizedByContentOfLinks() const
+{
+  return true;
+}
+
+ScResult ATestMemoizedResultByContentOfLinks::DoProgram(ScAction & action)
+{
+  ++msCallsCount;
+  action.FormResult(action.GetArgument(1));
+  return action.FinishSuccessfully();
+}
+
+/// --------------------------------------
+
 ScAddr ATestGetInitiationConditionTemplate::GetActionClass() const
 {
   return ATestGenerateOutgoingArc::generate_outgoing_arc_action;
@@ -495,6 +595,43 @@ ScResult ATestActionDeactivated::DoProgram(ScActionInitiatedEvent const &, ScAct
 
 /// --------------------------------------
 
+ATestActionDispatch::ATestActionDispatch()
+{
+  ++msAgentsCount;
+}
+
+ScAddr ATestActionDispatch::GetActionClass() const
+{
+  return ATestGenerateOutgoingArc::generate_outgoing_arc_action;
+}
+
+ScResult ATestActionDispatch::DoProgram(ScAction & action)
+{
+  msWaiter.Unlock();
+  return action.FinishSuccessfully();
+}
+
+/// --------------------------------------
+
+ScAddr ATestAwaitSubAction::GetActionClass() const
+{
+  return await_sub_action;
+}
+
+ScResult ATestAwaitSubAction::DoProgram(ScAction & action)
+{
+  auto const & [subActionAddr] = action.GetArguments<1>();
+  return action.AwaitAll(
+      {subActionAddr},
+      [](ScAgentContext &, ScAction & action, bool isTimedOut) -> ScResult
+      {
+        return isTimedOut ? action.FinishUnsuccessfully() : action.FinishSuccessfully();
+      },
+      300);
+}
+
+/// --------------------------------------
+
 ATestLogger::ATestLogger()
 {
   m_logger = utils::ScLogger(utils::ScLogger::ScLogType::Console, "", utils::ScLogLevel::Level::Info);
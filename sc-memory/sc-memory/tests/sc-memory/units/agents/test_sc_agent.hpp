@@ -6,6 +6,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <thread>
 
 #include <sc-memory/sc_addr.hpp>
@@ -97,6 +98,46 @@ public:
       override;
 };
 
+class ATestBatchGenerateOutgoingArc
+  : public ScBatchAgent<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>
+{
+public:
+  static inline ScKeynode const batch_generate_outgoing_arc_action{
+      "batch_generate_outgoing_arc_action",
+      ScType::ConstNodeClass};
+  static inline TestWaiter msWaiter;
+  static inline std::atomic_size_t msEventsCount = 0;
+
+  ScAddr GetActionClass() const override;
+
+  size_t GetMaxBatchSize() const override;
+
+  std::chrono::milliseconds GetMaxBatchDelay() const override;
+
+  ScResult DoProgram(
+      std::vector<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>> const & events,
+      ScAction & action) override;
+};
+
+class ATestConcurrentGenerateOutgoingArc
+  : public ScAgent<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>
+{
+public:
+  static inline ScKeynode const concurrent_generate_outgoing_arc_action{
+      "concurrent_generate_outgoing_arc_action",
+      ScType::ConstNodeClass};
+  static inline std::atomic_size_t msCallsCount = 0;
+  static inline std::atomic_size_t msRunningCallsCount = 0;
+  static inline std::atomic_size_t msMaxRunningCallsCount = 0;
+
+  static void Reset();
+
+  ScAddr GetActionClass() const override;
+
+  ScResult DoProgram(ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const & event, ScAction & action)
+      override;
+};
+
 class ATestGenerateEdge : public ScAgent<ScEventAfterGenerateEdge<ScType::ConstCommonEdge>>
 {
 public:
@@ -265,6 +306,36 @@ public:
   ScResult DoProgram(ScActionInitiatedEvent const & event, ScAction & action) override;
 };
 
+class ATestMemoizedResult : public ScActionInitiatedAgent
+{
+public:
+  static inline ScKeynode const memoized_result_action{"memoized_result_action", ScType::ConstNodeClass};
+  static inline std::atomic_size_t msCallsCount = 0;
+
+  ScAddr GetActionClass() const override;
+
+  size_t GetMaxMemoizedResultsCount() const override;
+
+  ScResult DoProgram(ScAction & action) override;
+};
+
+class ATestMemoizedResultByContentOfLinks : public ScActionInitiatedAgent
+{
+public:
+  static inline ScKeynode const memoized_result_by_content_of_links_action{
+      "memoized_result_by_content_of_links_action",
+      ScType::ConstNodeClass};
+  static inline std::atomic_size_t msCallsCount = 0;
+
+  ScAddr GetActionClass() const override;
+
+  size_t GetMaxMemoizedResultsCount() const override;
+
+  bool IsResultMemoizedByContentOfLinks() const override;
+
+  ScResult DoProgram(ScAction & action) override;
+};
+
 class ATestGetInitiationConditionTemplate : public ScActionInitiatedAgent
 {
 public:
@@ -404,6 +475,30 @@ public:
   ScResult DoProgram(ScActionInitiatedEvent const & event, ScAction & action) override;
 };
 
+class ATestActionDispatch : public ScActionInitiatedAgent
+{
+public:
+  static inline TestWaiter msWaiter;
+  static inline std::atomic_size_t msAgentsCount = 0;
+
+  ATestActionDispatch();
+
+  ScAddr GetActionClass() const override;
+
+  ScResult DoProgram(ScAction & action) override;
+};
+
+class ATestAwaitSubAction : public ScActionInitiatedAgent
+{
+public:
+  static inline ScKeynode const await_sub_action{"await_sub_action", ScType::ConstNodeClass};
+  static inline ScKeynode const awaited_sub_action{"awaited_sub_action", ScType::ConstNodeClass};
+
+  ScAddr GetActionClass() const override;
+
+  ScResult DoProgram(ScAction & action) override;
+};
+
 class ATestLogger : public ScActionInitiatedAgent
 {
 public:
@@ -7,6 +7,9 @@
 #include "agents_test_utils.hpp"
 
 #include <sc-memory/sc_agent.hpp>
+#include <sc-memory/sc_action_dispatcher.hpp>
+#include <sc-memory/sc_action_completion_registry.hpp>
+#include <sc-memory/sc_agent_executor.hpp>
 
 #include "test_sc_agent.hpp"
 #include "test_sc_module.hpp"
@@ -112,6 +115,51 @@ TEST_F(ScAgentTest, ATestGenerateOutgoingArc)
   m_ctx->UnsubscribeAgent<ATestGenerateOutgoingArc>(subscriptionElementAddr);
 }
 
+TEST_F(ScAgentTest, ATestGenerateOutgoingArcLatencyStatistics)
+{
+  ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->SubscribeAgent<ATestGenerateOutgoingArc>(subscriptionElementAddr);
+  EXPECT_EQ(m_ctx->GetAgentEventsLatencyStatistics<ATestGenerateOutgoingArc>().m_executionDuration.m_num, 0u);
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, subscriptionElementAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(ATestGenerateOutgoingArc::msWaiter.Wait());
+
+  // latencies are recorded after agent finishes
+  ScTimer timer(5);
+  while (m_ctx->GetAgentEventsLatencyStatistics<ATestGenerateOutgoingArc>().m_executionDuration.m_num != 1u
+         && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  ScMemoryContext::ScEventsLatencyStatistics const statistics =
+      m_ctx->GetAgentEventsLatencyStatistics<ATestGenerateOutgoingArc>();
+  EXPECT_EQ(statistics.m_queueLatency.m_num, 1u);
+  EXPECT_EQ(statistics.m_executionDuration.m_num, 1u);
+  EXPECT_EQ(statistics.m_executionDuration.m_p50, statistics.m_executionDuration.m_max);
+
+  m_ctx->UnsubscribeAgent<ATestGenerateOutgoingArc>(subscriptionElementAddr);
+  EXPECT_EQ(m_ctx->GetAgentEventsLatencyStatistics<ATestGenerateOutgoingArc>().m_executionDuration.m_num, 0u);
+}
+
+TEST_F(ScAgentTest, ATestBatchGenerateOutgoingArc)
+{
+  ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->SubscribeAgent<ATestBatchGenerateOutgoingArc>(subscriptionElementAddr);
+
+  for (size_t i = 0; i < 3u; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, subscriptionElementAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(ATestBatchGenerateOutgoingArc::msWaiter.Wait());
+  EXPECT_EQ(ATestBatchGenerateOutgoingArc::msEventsCount, 3u);
+
+  m_ctx->UnsubscribeAgent<ATestBatchGenerateOutgoingArc>(subscriptionElementAddr);
+}
+
+TEST_F(ScAgentTest, SubscribeBatchAgentToInitiatedActions)
+{
+  EXPECT_THROW(
+      m_ctx->SubscribeAgent<ATestBatchGenerateOutgoingArc>(ScKeynodes::action_initiated),
+      utils::ExceptionInvalidParams);
+}
+
 TEST_F(ScAgentTest, ATestGenerateEdge)
 {
   ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
@@ -406,6 +454,209 @@ TEST_F(ScAgentTest, ATestCheckResultTwoArgumentsWithWaitingActionToBeFinished)
   m_ctx->UnsubscribeAgent<ATestCheckResult>();
 }
 
+TEST_F(ScAgentTest, ATestCheckResultExecutionStatistics)
+{
+  m_ctx->SubscribeAgent<ATestCheckResult>();
+  std::vector<ScAgentExecutionStatistics> statistics = m_ctx->GetAgentExecutionStatistics<ATestCheckResult>();
+  EXPECT_EQ(statistics.size(), 1u);
+  EXPECT_EQ(statistics[0].m_invocationsNum, 0u);
+
+  ScAddr const & argumentAddr = ATestGenerateOutgoingArc::generate_outgoing_arc_action;
+  EXPECT_TRUE(m_ctx->GenerateAction(argumentAddr).SetArgument(1, argumentAddr).InitiateAndWait(2000));
+  EXPECT_TRUE(m_ctx->GenerateAction(argumentAddr).SetArgument(2, argumentAddr).InitiateAndWait(2000));
+  EXPECT_TRUE(m_ctx->GenerateAction(argumentAddr).SetArguments(argumentAddr, argumentAddr).InitiateAndWait(2000));
+
+  // results are recorded after actions are finished
+  ScTimer timer(5);
+  while (m_ctx->GetAgentExecutionStatistics<ATestCheckResult>()[0].m_programDuration.m_num != 3u
+         && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  statistics = m_ctx->GetAgentExecutionStatistics<ATestCheckResult>();
+  EXPECT_EQ(statistics[0].m_agentImplementationAddr, ScAddr::Empty);
+  EXPECT_EQ(statistics[0].m_invocationsNum, 3u);
+  EXPECT_EQ(statistics[0].m_initiationConditionRejectionsNum, 0u);
+  EXPECT_EQ(statistics[0].m_successfulResultsNum, 1u);
+  EXPECT_EQ(statistics[0].m_unsuccessfulResultsNum, 1u);
+  EXPECT_EQ(statistics[0].m_errorResultsNum, 1u);
+  EXPECT_EQ(statistics[0].m_suspendedResultsNum, 0u);
+  EXPECT_EQ(statistics[0].m_programDuration.m_num, 3u);
+  EXPECT_LE(statistics[0].m_programDuration.m_p50, statistics[0].m_programDuration.m_max);
+
+  m_ctx->UnsubscribeAgent<ATestCheckResult>();
+  EXPECT_TRUE(m_ctx->GetAgentExecutionStatistics<ATestCheckResult>().empty());
+
+  // statistics of unsubscribed agents are kept until sc-memory is shut down
+  statistics = m_ctx->GetAgentsExecutionStatistics();
+  EXPECT_EQ(statistics.size(), 1u);
+  EXPECT_EQ(statistics[0].m_invocationsNum, 3u);
+}
+
+TEST_F(ScAgentTest, ATestCheckInitiationConditionExecutionStatistics)
+{
+  m_ctx->SubscribeAgent<ATestCheckInitiationCondition>();
+
+  m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action).SetArguments().Initiate();
+  EXPECT_FALSE(ATestCheckInitiationCondition::msWaiter.Wait(0.2));
+
+  std::vector<ScAgentExecutionStatistics> const & statistics =
+      m_ctx->GetAgentExecutionStatistics<ATestCheckInitiationCondition>();
+  EXPECT_EQ(statistics.size(), 1u);
+  EXPECT_EQ(statistics[0].m_invocationsNum, 1u);
+  EXPECT_EQ(statistics[0].m_initiationConditionRejectionsNum, 1u);
+  EXPECT_EQ(statistics[0].m_programDuration.m_num, 0u);
+
+  m_ctx->UnsubscribeAgent<ATestCheckInitiationCondition>();
+}
+
+TEST_F(ScAgentTest, ATestMemoizedResult)
+{
+  ATestMemoizedResult::msCallsCount = 0;
+  m_ctx->SubscribeAgent<ATestMemoizedResult>();
+
+  ScAddr const & actionClassAddr = ATestMemoizedResult::memoized_result_action;
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAction firstAction = m_ctx->GenerateAction(actionClassAddr).SetArgument(1, argumentAddr);
+  EXPECT_TRUE(firstAction.InitiateAndWait(2000));
+  EXPECT_TRUE(firstAction.IsFinishedSuccessfully());
+
+  ScAction secondAction = m_ctx->GenerateAction(actionClassAddr).SetArgument(1, argumentAddr);
+  EXPECT_TRUE(secondAction.InitiateAndWait(2000));
+  EXPECT_TRUE(secondAction.IsFinishedSuccessfully());
+  EXPECT_EQ(secondAction.GetResult(), firstAction.GetResult());
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 1u);
+
+  ScAction otherAction =
+      m_ctx->GenerateAction(actionClassAddr).SetArgument(1, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(otherAction.InitiateAndWait(2000));
+  EXPECT_NE(otherAction.GetResult(), firstAction.GetResult());
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 2u);
+
+  m_ctx->UnsubscribeAgent<ATestMemoizedResult>();
+}
+
+TEST_F(ScAgentTest, ATestMemoizedResultIsScopedByUsers)
+{
+  ATestMemoizedResult::msCallsCount = 0;
+  m_ctx->SubscribeAgent<ATestMemoizedResult>();
+
+  ScAddr const & actionClassAddr = ATestMemoizedResult::memoized_result_action;
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->GenerateAction(actionClassAddr).SetArgument(1, argumentAddr).InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 1u);
+
+  // result memoized for one user isn't given to other user
+  TestScMemoryContext userContext{m_ctx->GenerateNode(ScType::ConstNode)};
+  EXPECT_TRUE(userContext.GenerateAction(actionClassAddr).SetArgument(1, argumentAddr).InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 2u);
+
+  EXPECT_TRUE(userContext.GenerateAction(actionClassAddr).SetArgument(1, argumentAddr).InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 2u);
+
+  m_ctx->UnsubscribeAgent<ATestMemoizedResult>();
+}
+
+TEST_F(ScAgentTest, ATestMemoizedResultIsInvalidatedByChangeOfArgument)
+{
+  ATestMemoizedResult::msCallsCount = 0;
+  m_ctx->SubscribeAgent<ATestMemoizedResult>();
+
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                  .SetArgument(1, argumentAddr)
+                  .InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 1u);
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_ctx->GenerateNode(ScType::ConstNodeClass), argumentAddr);
+
+  // memoized result is invalidated by sc-event of generating connector after it is processed
+  ScTimer timer(5);
+  while (ATestMemoizedResult::msCallsCount == 1u && !timer.IsTimeOut())
+    EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                    .SetArgument(1, argumentAddr)
+                    .InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 2u);
+
+  m_ctx->UnsubscribeAgent<ATestMemoizedResult>();
+}
+
+TEST_F(ScAgentTestWithUserMode, ATestMemoizedResultInUserMode)
+{
+  ATestMemoizedResult::msCallsCount = 0;
+  m_ctx->SubscribeAgent<ATestMemoizedResult>();
+
+  // arguments are watched and checked by system context, so cache works although its context has no user
+  ScAddr const & argumentAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                  .SetArgument(1, argumentAddr)
+                  .InitiateAndWait(2000));
+  EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                  .SetArgument(1, argumentAddr)
+                  .InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 1u);
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, m_ctx->GenerateNode(ScType::ConstNodeClass), argumentAddr);
+
+  ScTimer timer(5);
+  while (ATestMemoizedResult::msCallsCount == 1u && !timer.IsTimeOut())
+    EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                    .SetArgument(1, argumentAddr)
+                    .InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 2u);
+
+  m_ctx->UnsubscribeAgent<ATestMemoizedResult>();
+}
+
+TEST_F(ScAgentTest, ATestMemoizedResultIsEvictedByLeastRecentUse)
+{
+  ATestMemoizedResult::msCallsCount = 0;
+  m_ctx->SubscribeAgent<ATestMemoizedResult>();
+
+  ScAddrVector const argumentAddrs = {
+      m_ctx->GenerateNode(ScType::ConstNode),
+      m_ctx->GenerateNode(ScType::ConstNode),
+      m_ctx->GenerateNode(ScType::ConstNode)};
+  for (ScAddr const & argumentAddr : argumentAddrs)
+    EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                    .SetArgument(1, argumentAddr)
+                    .InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 3u);
+
+  // max number of memoized results is 2, so result for the first argument is evicted
+  EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                  .SetArgument(1, argumentAddrs[2])
+                  .InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 3u);
+  EXPECT_TRUE(m_ctx->GenerateAction(ATestMemoizedResult::memoized_result_action)
+                  .SetArgument(1, argumentAddrs[0])
+                  .InitiateAndWait(2000));
+  EXPECT_EQ(ATestMemoizedResult::msCallsCount, 4u);
+
+  m_ctx->UnsubscribeAgent<ATestMemoizedResult>();
+}
+
+TEST_F(ScAgentTest, ATestMemoizedResultByContentOfLinks)
+{
+  ATestMemoizedResultByContentOfLinks::msCallsCount = 0;
+  m_ctx->SubscribeAgent<ATestMemoizedResultByContentOfLinks>();
+
+  ScAddr const & actionClassAddr = ATestMemoizedResultByContentOfLinks::memoized_result_by_content_of_links_action;
+  ScAddr const & firstLinkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  m_ctx->SetLinkContent(firstLinkAddr, "content");
+  ScAddr const & secondLinkAddr = m_ctx->GenerateLink(ScType::ConstNodeLink);
+  m_ctx->SetLinkContent(secondLinkAddr, "content");
+
+  ScAction firstAction = m_ctx->GenerateAction(actionClassAddr).SetArgument(1, firstLinkAddr);
+  EXPECT_TRUE(firstAction.InitiateAndWait(2000));
+  ScAction secondAction = m_ctx->GenerateAction(actionClassAddr).SetArgument(1, secondLinkAddr);
+  EXPECT_TRUE(secondAction.InitiateAndWait(2000));
+  EXPECT_TRUE(secondAction.IsFinishedSuccessfully());
+  EXPECT_EQ(secondAction.GetResult(), firstAction.GetResult());
+  EXPECT_EQ(ATestMemoizedResultByContentOfLinks::msCallsCount, 1u);
+
+  m_ctx->UnsubscribeAgent<ATestMemoizedResultByContentOfLinks>();
+}
+
 TEST_F(ScAgentTest, ATestGetInitiationConditionTemplate)
 {
   m_ctx->SubscribeAgent<ATestGetInitiationConditionTemplate>();
@@ -559,6 +810,93 @@ TEST_F(ScAgentTest, ActionDeactivated)
   m_ctx->UnsubscribeAgent<ATestActionDeactivated>();
 }
 
+TEST_F(ScAgentTest, ActionDeactivatedBeforeAgentSubscription)
+{
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(
+      ScType::ConstPermPosArc, ScKeynodes::action_deactivated, ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+
+  m_ctx->SubscribeAgent<ATestActionDeactivated>();
+
+  m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action).SetArguments().Initiate();
+
+  EXPECT_FALSE(ATestActionDeactivated::msWaiter.Wait(0.2));
+
+  m_ctx->EraseElement(arcAddr);
+
+  m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action).SetArguments().Initiate();
+
+  EXPECT_TRUE(ATestActionDeactivated::msWaiter.Wait(1));
+
+  m_ctx->UnsubscribeAgent<ATestActionDeactivated>();
+}
+
+TEST_F(ScAgentTest, ActionInitiatedAgentReactsOnlyToActionsOfItsClass)
+{
+  m_ctx->SubscribeAgent<ATestActionDispatch>();
+  ScAddr const & actionClassAddr = ATestGenerateOutgoingArc::generate_outgoing_arc_action;
+  EXPECT_EQ(ScActionDispatcherSubscription::GetSubscriptionsCount(actionClassAddr), 1u);
+
+  size_t const agentsCount = ATestActionDispatch::msAgentsCount;
+
+  ScAddr const & otherActionClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->GenerateAction(otherActionClassAddr).Initiate();
+  m_ctx->GenerateAction(actionClassAddr).Initiate();
+
+  EXPECT_TRUE(ATestActionDispatch::msWaiter.Wait());
+  // agent is constructed only for action of its class
+  EXPECT_EQ(ATestActionDispatch::msAgentsCount, agentsCount + 1);
+
+  m_ctx->UnsubscribeAgent<ATestActionDispatch>();
+  EXPECT_EQ(ScActionDispatcherSubscription::GetSubscriptionsCount(actionClassAddr), 0u);
+}
+
+TEST_F(ScAgentTestWithUserMode, ActionInitiatedAgentReactsToActionOfItsClassInUserMode)
+{
+  m_ctx->SubscribeAgent<ATestActionDispatch>();
+
+  // classes of action are read by dispatcher although context of its subscription has no user
+  ScAction action = m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action);
+  action.Initiate();
+
+  EXPECT_TRUE(ATestActionDispatch::msWaiter.Wait());
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({action}));
+  EXPECT_TRUE(action.IsFinishedSuccessfully());
+
+  m_ctx->UnsubscribeAgent<ATestActionDispatch>();
+}
+
+TEST_F(ScAgentTest, AgentAwaitsFinishOfSubAction)
+{
+  m_ctx->SubscribeAgent<ATestAwaitSubAction>();
+
+  ScAction subAction = m_ctx->GenerateAction(ATestAwaitSubAction::awaited_sub_action);
+  subAction.Initiate();
+  ScAction action = m_ctx->GenerateAction(ATestAwaitSubAction::await_sub_action).SetArguments(subAction);
+  action.Initiate();
+  subAction.FinishSuccessfully();
+
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({action}));
+  EXPECT_TRUE(action.IsFinishedSuccessfully());
+
+  m_ctx->UnsubscribeAgent<ATestAwaitSubAction>();
+}
+
+TEST_F(ScAgentTest, AgentAwaitsFinishOfSubActionUntilTimeout)
+{
+  m_ctx->SubscribeAgent<ATestAwaitSubAction>();
+
+  ScAction subAction = m_ctx->GenerateAction(ATestAwaitSubAction::awaited_sub_action);
+  subAction.Initiate();
+  ScAction action = m_ctx->GenerateAction(ATestAwaitSubAction::await_sub_action).SetArguments(subAction);
+  action.Initiate();
+
+  EXPECT_TRUE(ScActionCompletionRegistry::WaitAll({action}));
+  EXPECT_TRUE(action.IsFinishedUnsuccessfully());
+  EXPECT_FALSE(subAction.IsFinished());
+
+  m_ctx->UnsubscribeAgent<ATestAwaitSubAction>();
+}
+
 TEST_F(ScAgentTest, RegisterAgentWithinModule)
 {
   ATestGenerateOutgoingArc::msWaiter.Reset();
@@ -611,6 +949,196 @@ TEST_F(ScAgentTest, RegisterActionErasingElementWithinModule)
   module.Unregister(&*m_ctx);
 }
 
+static void GenerateOutgoingArcsAndWaitConcurrentAgent(
+    ScMemoryContext & context,
+    ScAddrVector const & subscriptionElementAddrs,
+    size_t arcsCount)
+{
+  for (size_t i = 0; i < arcsCount; ++i)
+    context.GenerateConnector(
+        ScType::ConstPermPosArc,
+        subscriptionElementAddrs[i % subscriptionElementAddrs.size()],
+        context.GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(5);
+  while (ATestConcurrentGenerateOutgoingArc::msCallsCount != arcsCount && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+}
+
+TEST_F(ScAgentTest, RegisterAgentWithSerialExecutorWithinModule)
+{
+  ATestConcurrentGenerateOutgoingArc::Reset();
+
+  ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  std::shared_ptr<ScAgentExecutor> const executor = ScAgentExecutor::Serial();
+
+  TestModule module;
+  module.Agent<ATestConcurrentGenerateOutgoingArc>(subscriptionElementAddr)
+      ->SetAgentExecutor<ATestConcurrentGenerateOutgoingArc>(executor);
+  module.Register(&*m_ctx);
+
+  GenerateOutgoingArcsAndWaitConcurrentAgent(*m_ctx, {subscriptionElementAddr}, 8u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msCallsCount, 8u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msMaxRunningCallsCount, 1u);
+
+  module.Unregister(&*m_ctx);
+  EXPECT_EQ(executor->GetQueuedTasksCount(), 0u);
+  EXPECT_EQ(executor->GetRunningTasksCount(), 0u);
+}
+
+TEST_F(ScAgentTest, RegisterAgentWithLimitedExecutorOfModule)
+{
+  ATestConcurrentGenerateOutgoingArc::Reset();
+
+  ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  TestModule module;
+  module.SetAgentsExecutor(ScAgentExecutor::Limited(2))
+      ->Agent<ATestConcurrentGenerateOutgoingArc>(subscriptionElementAddr);
+  module.Register(&*m_ctx);
+
+  GenerateOutgoingArcsAndWaitConcurrentAgent(*m_ctx, {subscriptionElementAddr}, 8u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msCallsCount, 8u);
+  EXPECT_LE(ATestConcurrentGenerateOutgoingArc::msMaxRunningCallsCount, 2u);
+
+  module.Unregister(&*m_ctx);
+}
+
+TEST_F(ScAgentTest, RegisterAgentWithDedicatedExecutorWithinModule)
+{
+  ATestConcurrentGenerateOutgoingArc::Reset();
+
+  ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  std::shared_ptr<ScAgentExecutor> const executor = ScAgentExecutor::Dedicated(1);
+
+  TestModule module;
+  module.SetAgentsExecutor(ScAgentExecutor::Limited(4))
+      ->Agent<ATestConcurrentGenerateOutgoingArc>(subscriptionElementAddr)
+      ->SetAgentExecutor<ATestConcurrentGenerateOutgoingArc>(executor);
+  module.Register(&*m_ctx);
+
+  GenerateOutgoingArcsAndWaitConcurrentAgent(*m_ctx, {subscriptionElementAddr}, 4u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msCallsCount, 4u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msMaxRunningCallsCount, 1u);
+
+  module.Unregister(&*m_ctx);
+  EXPECT_EQ(executor->GetQueuedTasksCount(), 0u);
+  EXPECT_EQ(executor->GetRunningTasksCount(), 0u);
+}
+
+TEST_F(ScAgentTest, RegisterAgentWithSerialByKeyExecutorWithinModule)
+{
+  ATestConcurrentGenerateOutgoingArc::Reset();
+
+  ScAddr const & firstSubscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & secondSubscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  TestModule module;
+  module.Agent<ATestConcurrentGenerateOutgoingArc>(firstSubscriptionElementAddr, secondSubscriptionElementAddr)
+      ->SetAgentExecutor<ATestConcurrentGenerateOutgoingArc>(ScAgentExecutor::SerialByKey());
+  module.Register(&*m_ctx);
+
+  GenerateOutgoingArcsAndWaitConcurrentAgent(*m_ctx, {firstSubscriptionElementAddr, secondSubscriptionElementAddr}, 8u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msCallsCount, 8u);
+  EXPECT_LE(ATestConcurrentGenerateOutgoingArc::msMaxRunningCallsCount, 2u);
+
+  module.Unregister(&*m_ctx);
+}
+
+TEST_F(ScAgentTest, RegisterActionInitiatedAgentWithSerialExecutorWithinModule)
+{
+  ATestCheckResult::msWaiter.Reset();
+
+  TestModule module;
+  module.SetAgentsExecutor(ScAgentExecutor::Serial())->Agent<ATestCheckResult>();
+  module.Register(&*m_ctx);
+
+  m_ctx->GenerateAction(ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+      .SetArgument(1, ATestGenerateOutgoingArc::generate_outgoing_arc_action)
+      .Initiate();
+
+  EXPECT_TRUE(ATestCheckResult::msWaiter.Wait());
+
+  module.Unregister(&*m_ctx);
+}
+
+TEST_F(ScAgentTest, GenerateAgentExecutorsWithInvalidParams)
+{
+  EXPECT_THROW(ScAgentExecutor::Limited(0), utils::ExceptionInvalidParams);
+  EXPECT_THROW(ScAgentExecutor::Dedicated(0), utils::ExceptionInvalidParams);
+}
+
+//! Counts tasks and runs them in threads that schedule them.
+class TestCountingAgentExecutor : public ScAgentExecutor
+{
+public:
+  std::atomic_size_t m_tasksCount = 0;
+
+protected:
+  void Schedule(ScAddr const &, ScTask && task) noexcept override
+  {
+    ++m_tasksCount;
+    RunTask(task);
+  }
+};
+
+TEST_F(ScAgentTest, SubscribeAgentDirectlyDoesNotUseExecutorOfModule)
+{
+  ATestConcurrentGenerateOutgoingArc::Reset();
+
+  ScAddr const & moduleSubscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  auto const executor = std::make_shared<TestCountingAgentExecutor>();
+
+  TestModule module;
+  module.Agent<ATestConcurrentGenerateOutgoingArc>(moduleSubscriptionElementAddr)
+      ->SetAgentExecutor<ATestConcurrentGenerateOutgoingArc>(executor);
+  module.Register(&*m_ctx);
+  m_ctx->SubscribeAgent<ATestConcurrentGenerateOutgoingArc>(subscriptionElementAddr);
+
+  GenerateOutgoingArcsAndWaitConcurrentAgent(*m_ctx, {subscriptionElementAddr}, 2u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msCallsCount, 2u);
+  EXPECT_EQ(executor->m_tasksCount, 0u);
+
+  ATestConcurrentGenerateOutgoingArc::Reset();
+  GenerateOutgoingArcsAndWaitConcurrentAgent(*m_ctx, {moduleSubscriptionElementAddr}, 2u);
+  EXPECT_EQ(ATestConcurrentGenerateOutgoingArc::msCallsCount, 2u);
+  EXPECT_EQ(executor->m_tasksCount, 2u);
+
+  m_ctx->UnsubscribeAgent<ATestConcurrentGenerateOutgoingArc>(subscriptionElementAddr);
+  module.Unregister(&*m_ctx);
+}
+
+TEST_F(ScAgentTest, DestroyDedicatedExecutorByItsTask)
+{
+  ScAddr const & subscriptionElementAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  std::shared_ptr<ScAgentExecutor> executor = ScAgentExecutor::Dedicated(2);
+  ScAgentExecutor * executorPtr = executor.get();
+  TestWaiter waiter;
+
+  {
+    auto const subscription =
+        m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+            subscriptionElementAddr,
+            [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const & event)
+            {
+              executorPtr->Execute(
+                  event,
+                  [&]()
+                  {
+                    executor.reset();
+                    waiter.Unlock();
+                  });
+            });
+
+    m_ctx->GenerateConnector(
+        ScType::ConstPermPosArc, subscriptionElementAddr, m_ctx->GenerateNode(ScType::ConstNode));
+    EXPECT_TRUE(waiter.Wait());
+  }
+
+  EXPECT_EQ(executor, nullptr);
+}
+
 TEST_F(ScAgentTest, AgentHasNoSpecificationInKb)
 {
   ATestCheckResult agent;
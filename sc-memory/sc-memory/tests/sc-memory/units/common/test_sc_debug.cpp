@@ -225,6 +225,34 @@ TEST_F(ScLoggerTest, ChangeSeverityLogLevel)
   EXPECT_TRUE(m_loggerResult.str().empty());
 }
 
+struct TestFormattedArgument
+{
+  size_t & m_formatsCount;
+};
+
+std::ostream & operator<<(std::ostream & stream, TestFormattedArgument const & argument)
+{
+  ++argument.m_formatsCount;
+  return stream << "argument";
+}
+
+TEST_F(ScLoggerTest, DisabledLevelDoesNotFormatMessage)
+{
+  size_t formatsCount = 0;
+  TestFormattedArgument const argument{formatsCount};
+
+  m_logger.SetLogLevel(utils::ScLogLevel::Error);
+  EXPECT_FALSE(m_logger.IsEnabled(utils::ScLogLevel::Info));
+  EXPECT_TRUE(m_logger.IsEnabled(utils::ScLogLevel::Error));
+
+  m_logger.Info("This message should not be formatted: ", argument);
+  EXPECT_EQ(formatsCount, 0u);
+  EXPECT_TRUE(m_loggerResult.str().empty());
+
+  m_logger.Error("This message should be formatted: ", argument);
+  EXPECT_EQ(formatsCount, 1u);
+}
+
 TEST_F(ScLoggerTest, MutePreventsLogging)
 {
   m_logger.Mute();
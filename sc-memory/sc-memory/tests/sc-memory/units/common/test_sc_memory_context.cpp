@@ -752,6 +752,35 @@ TEST_F(ScMemoryTestWithUserMode, SeveralHandleElementsByAuthenticatedUserGenerat
   }
 }
 
+TEST_F(ScMemoryTestWithUserMode, HandleElementsByAuthenticatedUserWithContextReleasedBefore)
+{
+  ScAddr const & userAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  {
+    TestScMemoryContext userContext{userAddr};
+    TestActionsUnsuccessfully(m_ctx, userContext);
+  }
+
+  std::atomic_bool isAuthenticated = false;
+  auto eventSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::MembershipArc>>(
+          ScKeynodes::concept_authenticated_user,
+          [&isAuthenticated](ScEventAfterGenerateOutgoingArc<ScType::MembershipArc> const &)
+          {
+            isAuthenticated = true;
+          });
+
+  TestAddAllPermissionsForUserToInitActions(m_ctx, userAddr);
+  TestAuthenticationRequestUser(m_ctx, userAddr);
+
+  SC_LOCK_WAIT_WHILE_TRUE(!isAuthenticated.load());
+  EXPECT_TRUE(isAuthenticated.load());
+
+  // released context of user is reused, but its permissions are resolved again
+  TestScMemoryContext userContext{userAddr};
+  TestActionsSuccessfully(m_ctx, userContext);
+  TestIteratorsSuccessfully(m_ctx, userContext);
+}
+
 TEST_F(
     ScMemoryTestWithUserMode,
     HandleElementsByAuthenticatedUserGeneratedBeforeAndUnauthenticatedAfterAndAuthenticatedAfter)
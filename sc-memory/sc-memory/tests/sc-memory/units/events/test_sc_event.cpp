@@ -87,6 +87,160 @@ TEST(ScEventQueueTest, EventsQueueDestroy)
   ScMemory::Shutdown();
 }
 
+TEST(ScEventQueueTest, EventsQueueDropsOldestEvents)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_and_agents_threads = 1;
+  params.max_events_queue_size = 2;
+  params.events_queue_overflow_policy = "DropOldest";
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+  ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+
+  std::atomic_bool isReleased = false;
+  std::atomic_size_t handledEventsCount = 0;
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            while (!isReleased)
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            ++handledEventsCount;
+          });
+
+  size_t const eventsCount = 10;
+  for (size_t i = 0; i < eventsCount; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, nodeAddr, ctx.GenerateNode(ScType::ConstNode));
+
+  // one sc-event is processed by the only worker and two sc-events are queued, others are dropped
+  ScMemoryContext::ScEventsQueueStatistics statistics = ctx.GetEventsQueueStatistics();
+  EXPECT_GE(statistics.m_droppedEventsNum, eventsCount - 3);
+  EXPECT_LE(statistics.GetQueuedNum(), 2u);
+
+  isReleased = true;
+  ScTimer timer(5);
+  while (handledEventsCount + statistics.m_droppedEventsNum < eventsCount && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  EXPECT_EQ(handledEventsCount + statistics.m_droppedEventsNum, eventsCount);
+  EXPECT_EQ(ctx.GetEventsQueueStatistics().GetQueuedNum(), 0u);
+
+  eventSubscription.reset();
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, EventsQueueBlocksEmission)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.max_events_and_agents_threads = 1;
+  params.max_events_queue_size = 1;
+  params.events_queue_overflow_policy = "Block";
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+  ScAddr const nodeAddr = ctx.GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t handledEventsCount = 0;
+  auto eventSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            std::this_thread::sleep_for(std::chrono::milliseconds(10));
+            ++handledEventsCount;
+          });
+
+  size_t const eventsCount = 5;
+  for (size_t i = 0; i < eventsCount; ++i)
+    ctx.GenerateConnector(ScType::ConstPermPosArc, nodeAddr, ctx.GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(5);
+  while (handledEventsCount < eventsCount && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  // no sc-events are dropped, emitter waits for worker instead
+  ScMemoryContext::ScEventsQueueStatistics const statistics = ctx.GetEventsQueueStatistics();
+  EXPECT_EQ(handledEventsCount, eventsCount);
+  EXPECT_EQ(statistics.m_droppedEventsNum, 0u);
+  EXPECT_GT(statistics.m_blockedEmissionsNum, 0u);
+
+  eventSubscription.reset();
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
+TEST(ScEventQueueTest, AdaptiveWorkersPoolGrowsWhenWorkerIsBlocked)
+{
+  sc_memory_params params;
+  sc_memory_params_clear(&params);
+  params.clear = SC_TRUE;
+  params.storage = "repo";
+  params.log_level = "Debug";
+  params.adaptive_events_and_agents_threads = SC_TRUE;
+  params.min_events_and_agents_threads = 1;
+  params.max_events_and_agents_threads = 4;
+  params.limit_max_threads_by_max_physical_cores = SC_FALSE;
+
+  ScMemory::Initialize(params);
+
+  ScAgentContext ctx;
+  ScAddr const blockingNodeAddr = ctx.GenerateNode(ScType::ConstNode);
+  ScAddr const resolvingNodeAddr = ctx.GenerateNode(ScType::ConstNode);
+
+  ScWaiter waiter;
+  std::atomic_bool isResolved = false;
+  std::atomic_bool isWaitFinished = false;
+  auto blockingSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          blockingNodeAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            // the only worker is blocked here until the next sc-event is processed by another worker
+            isResolved = waiter.Wait(5000);
+            isWaitFinished = true;
+          });
+  auto resolvingSubscription =
+      ctx.CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          resolvingNodeAddr,
+          [&](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            waiter.Resolve();
+          });
+
+  EXPECT_EQ(ctx.GetEventsQueueStatistics().m_workersNum, 1u);
+
+  ctx.GenerateConnector(ScType::ConstPermPosArc, blockingNodeAddr, ctx.GenerateNode(ScType::ConstNode));
+  ctx.GenerateConnector(ScType::ConstPermPosArc, resolvingNodeAddr, ctx.GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(10);
+  while (!isWaitFinished && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_TRUE(isResolved);
+  ScMemoryContext::ScEventsQueueStatistics const statistics = ctx.GetEventsQueueStatistics();
+  EXPECT_GE(statistics.m_grownWorkersNum, 1u);
+  EXPECT_GE(statistics.m_workersNum, 2u);
+  EXPECT_EQ(statistics.m_blockedWorkersNum, 0u);
+
+  blockingSubscription.reset();
+  resolvingSubscription.reset();
+  ctx.Destroy();
+  ScMemory::Shutdown();
+}
+
 double const kTestTimeout = 0.1;
 
 template <ScType const & subscriptionConnectorType, ScType const & eventConnectorType>
@@ -1099,6 +1253,380 @@ TEST_F(ScEventTest, SetRemoveDelegateFuncForSubscriptionWithDynamicEventType)
   EXPECT_FALSE(isDone);
 }
 
+TEST_F(ScEventTest, SeveralSubscriptionsForOneElement)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t firstCount = 0;
+  std::atomic_size_t secondCount = 0;
+  auto firstSubscription = m_ctx->CreateElementaryEventSubscription<ScEventGenerateArc>(
+      nodeAddr,
+      [&](ScEventGenerateArc const &)
+      {
+        ++firstCount;
+      });
+  auto secondSubscription = m_ctx->CreateElementaryEventSubscription<ScEventGenerateArc>(
+      nodeAddr,
+      [&](ScEventGenerateArc const &)
+      {
+        ++secondCount;
+      });
+
+  auto const & WaitCounts = [&](size_t expectedFirstCount, size_t expectedSecondCount)
+  {
+    ScTimer timer(kTestTimeout * 10);
+    while ((firstCount != expectedFirstCount || secondCount != expectedSecondCount) && !timer.IsTimeOut())
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+    return firstCount == expectedFirstCount && secondCount == expectedSecondCount;
+  };
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(WaitCounts(1u, 1u));
+
+  // the remaining subscription still receives sc-events
+  firstSubscription.reset();
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(WaitCounts(1u, 2u));
+
+  // sc-element can be subscribed again after all its subscriptions are destroyed
+  secondSubscription.reset();
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  firstSubscription = m_ctx->CreateElementaryEventSubscription<ScEventGenerateArc>(
+      nodeAddr,
+      [&](ScEventGenerateArc const &)
+      {
+        ++firstCount;
+      });
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  EXPECT_TRUE(WaitCounts(2u, 2u));
+}
+
+TEST_F(ScEventTest, EventSubscriptionBatchDeliversFullBatches)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::mutex mutex;
+  std::vector<size_t> batchSizes;
+  ScAddrUnorderedSet arcAddrs;
+  auto subscription = m_ctx->CreateEventSubscriptionBatch<ScEventGenerateArc>(
+      nodeAddr,
+      4u,
+      std::chrono::hours(1),
+      [&](std::vector<ScEventGenerateArc> const & events)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        batchSizes.push_back(events.size());
+        for (auto const & event : events)
+          arcAddrs.insert(event.GetArc());
+      });
+
+  for (size_t i = 0; i < 8u; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(kTestTimeout * 10);
+  while (!timer.IsTimeOut())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (batchSizes.size() == 2u)
+        break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ(batchSizes, std::vector<size_t>({4u, 4u}));
+  EXPECT_EQ(arcAddrs.size(), 8u);
+}
+
+TEST_F(ScEventTest, EventSubscriptionBatchDeliversBatchAfterDelay)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t batchesCount = 0;
+  std::atomic_size_t eventsCount = 0;
+  auto subscription = m_ctx->CreateEventSubscriptionBatch(
+      ScKeynodes::sc_event_after_generate_outgoing_arc,
+      nodeAddr,
+      100u,
+      std::chrono::milliseconds(50),
+      [&](std::vector<ScElementaryEvent> const & events)
+      {
+        eventsCount += events.size();
+        ++batchesCount;
+      });
+
+  for (size_t i = 0; i < 3u; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(kTestTimeout * 10);
+  while (eventsCount != 3u && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(eventsCount, 3u);
+  EXPECT_GE(batchesCount, 1u);
+}
+
+TEST_F(ScEventTest, EventSubscriptionBatchFlushesOnDestroy)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t eventsCount = 0;
+  auto subscription = m_ctx->CreateEventSubscriptionBatch<ScEventGenerateArc>(
+      nodeAddr,
+      100u,
+      std::chrono::hours(1),
+      [&](std::vector<ScEventGenerateArc> const & events)
+      {
+        eventsCount += events.size();
+      });
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  subscription.reset();
+  EXPECT_EQ(eventsCount, 2u);
+}
+
+TEST_F(ScEventTest, InvalidEventSubscriptionBatch)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  EXPECT_THROW(
+      m_ctx->CreateEventSubscriptionBatch<ScEventGenerateArc>(ScAddr::Empty, 10u, std::chrono::milliseconds(10), {}),
+      utils::ExceptionInvalidParams);
+  EXPECT_THROW(
+      m_ctx->CreateEventSubscriptionBatch<ScEventGenerateArc>(nodeAddr, 0u, std::chrono::milliseconds(10), {}),
+      utils::ExceptionInvalidParams);
+  EXPECT_THROW(
+      m_ctx->CreateEventSubscriptionBatch(nodeAddr, nodeAddr, 10u, std::chrono::milliseconds(10), {}),
+      utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScEventTest, GlobalEventSubscriptionFiltersByConnectorType)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  std::mutex mutex;
+  ScAddrUnorderedSet arcAddrs;
+  ScAddrUnorderedSet sourceAddrs;
+  auto subscription = m_ctx->CreateGlobalEventSubscription<ScEventGenerateArc>(
+      [&](ScEventGenerateArc const & event)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        arcAddrs.insert(event.GetArc());
+        sourceAddrs.insert(event.GetSubscriptionElement());
+      });
+
+  ScAddr const firstNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const secondNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const firstArcAddr =
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, firstNodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  ScAddr const secondArcAddr =
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, secondNodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  m_ctx->GenerateConnector(ScType::ConstTempPosArc, firstNodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(kTestTimeout);
+  while (!timer.IsTimeOut())
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex);
+      if (arcAddrs.size() == 2u)
+        break;
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+
+  std::lock_guard<std::mutex> lock(mutex);
+  EXPECT_EQ(arcAddrs, ScAddrUnorderedSet({firstArcAddr, secondArcAddr}));
+  EXPECT_EQ(sourceAddrs, ScAddrUnorderedSet({firstNodeAddr, secondNodeAddr}));
+}
+
+TEST_F(ScEventTest, GlobalEventSubscriptionFiltersBySet)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const instanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, instanceAddr);
+  ScAddr const otherNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t eventsCount = 0;
+  std::atomic_bool isOtherNodeHandled = false;
+  auto subscription = m_ctx->CreateGlobalEventSubscription<ScEventGenerateArc>(
+      classAddr,
+      [&](ScEventGenerateArc const & event)
+      {
+        if (event.GetSubscriptionElement() != instanceAddr)
+          isOtherNodeHandled = true;
+        ++eventsCount;
+      });
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, otherNodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, instanceAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(kTestTimeout);
+  while (eventsCount == 0u && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+
+  EXPECT_EQ(eventsCount, 1u);
+  EXPECT_FALSE(isOtherNodeHandled);
+}
+
+TEST_F(ScEventTest, InvalidGlobalEventSubscription)
+{
+  EXPECT_THROW(
+      m_ctx->CreateGlobalEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(ScAddr::Empty, {}),
+      utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScEventTest, EventSubscriptionPriority)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t eventsCount = 0;
+  auto subscription = m_ctx->CreateElementaryEventSubscription<ScEventGenerateArc>(
+      nodeAddr,
+      [&](ScEventGenerateArc const &)
+      {
+        ++eventsCount;
+      });
+  EXPECT_EQ(subscription->GetPriority(), ScEventPriority::Normal);
+
+  subscription->SetPriority(ScEventPriority::High);
+  EXPECT_EQ(subscription->GetPriority(), ScEventPriority::High);
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(kTestTimeout * 10);
+  while (eventsCount != 1u && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(eventsCount, 1u);
+  EXPECT_EQ(m_ctx->GetEventsQueueStatistics().m_queuedEventsNum[SC_EVENT_PRIORITY_HIGH], 0u);
+}
+
+TEST_F(ScEventTest, EventSubscriptionLatencyStatistics)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  auto subscription = m_ctx->CreateElementaryEventSubscription<ScEventGenerateArc>(
+      nodeAddr,
+      [](ScEventGenerateArc const &)
+      {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      });
+
+  ScMemoryContext::ScEventsLatencyStatistics statistics = m_ctx->GetEventsLatencyStatistics(*subscription);
+  EXPECT_EQ(statistics.m_queueLatency.m_num, 0u);
+  EXPECT_EQ(statistics.m_executionDuration.m_num, 0u);
+  EXPECT_EQ(statistics.m_executionDuration.m_max, 0u);
+
+  size_t const eventsCount = 5;
+  for (size_t i = 0; i < eventsCount; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  // latencies are recorded after delegate returns
+  ScTimer timer(kTestTimeout * 50);
+  while (m_ctx->GetEventsLatencyStatistics(*subscription).m_executionDuration.m_num != eventsCount
+         && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  statistics = m_ctx->GetEventsLatencyStatistics(*subscription);
+  EXPECT_EQ(statistics.m_queueLatency.m_num, eventsCount);
+  EXPECT_EQ(statistics.m_executionDuration.m_num, eventsCount);
+  EXPECT_GE(statistics.m_executionDuration.m_p50, 2000u);
+  EXPECT_LE(statistics.m_executionDuration.m_p50, statistics.m_executionDuration.m_p90);
+  EXPECT_LE(statistics.m_executionDuration.m_p90, statistics.m_executionDuration.m_p99);
+  EXPECT_LE(statistics.m_executionDuration.m_p99, statistics.m_executionDuration.m_max);
+  EXPECT_LE(statistics.m_queueLatency.m_p99, statistics.m_queueLatency.m_max);
+
+  ScMemoryContext::ScEventsLatencyStatistics const globalStatistics = m_ctx->GetEventsLatencyStatistics();
+  EXPECT_GE(globalStatistics.m_executionDuration.m_num, eventsCount);
+  EXPECT_GE(globalStatistics.m_executionDuration.m_max, statistics.m_executionDuration.m_max);
+}
+
+TEST(ScEventLatencyHistogramTest, Percentiles)
+{
+  sc_latency_histogram histogram{};
+  EXPECT_EQ(sc_latency_histogram_get_percentile(&histogram, 50), 0u);
+
+  // values less than 8 microseconds are counted exactly
+  for (sc_uint32 value = 1; value <= 4; ++value)
+  {
+    histogram.buckets[value] = 1;
+    ++histogram.count;
+  }
+  histogram.max = 4;
+  EXPECT_EQ(sc_latency_histogram_get_percentile(&histogram, 0), 1u);
+  EXPECT_EQ(sc_latency_histogram_get_percentile(&histogram, 50), 2u);
+  EXPECT_EQ(sc_latency_histogram_get_percentile(&histogram, 75), 3u);
+  EXPECT_EQ(sc_latency_histogram_get_percentile(&histogram, 100), 4u);
+
+  sc_latency_histogram other{};
+  other.buckets[SC_LATENCY_HISTOGRAM_BUCKETS_COUNT - 1] = 4;
+  other.count = 4;
+  other.max = 1000000;
+  sc_latency_histogram_merge(&histogram, &other);
+  EXPECT_EQ(histogram.count, 8u);
+  EXPECT_EQ(histogram.max, 1000000u);
+  EXPECT_EQ(sc_latency_histogram_get_percentile(&histogram, 50), 4u);
+  EXPECT_EQ(sc_latency_histogram_get_percentile(&histogram, 99), 1000000u);
+}
+
+TEST_F(ScEventTest, SubscribeWhileGeneratingConnectorsOfElement)
+{
+  using ScEventGenerateArc = ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>;
+
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_bool isStopped = false;
+  std::thread generator(
+      [&]()
+      {
+        ScMemoryContext context;
+        while (!isStopped)
+          context.GenerateConnector(ScType::ConstPermPosArc, nodeAddr, context.GenerateNode(ScType::ConstNode));
+      });
+
+  // subscribing and unsubscribing don't wait for emitters holding monitor of sc-element and vice versa
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    auto subscription =
+        m_ctx->CreateElementaryEventSubscription<ScEventGenerateArc>(nodeAddr, [](ScEventGenerateArc const &) {});
+  }
+
+  isStopped = true;
+  generator.join();
+
+  std::atomic_bool isDone = false;
+  auto subscription = m_ctx->CreateElementaryEventSubscription<ScEventGenerateArc>(
+      nodeAddr,
+      [&](ScEventGenerateArc const &)
+      {
+        isDone = true;
+      });
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTimer timer(kTestTimeout * 10);
+  while (!isDone && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  EXPECT_TRUE(isDone);
+}
+
 TEST_F(ScEventTest, DestroyOrder)
 {
   ScAddr const node = m_ctx->GenerateNode(ScType::Unknown);
@@ -1263,6 +1791,138 @@ TEST_F(ScEventTest, PendEvents)
   EXPECT_EQ(passedCount, el_num);
 }
 
+TEST_F(ScEventTest, PendEventsOfErasedConnector)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t generatedArcsCount = 0;
+  std::atomic_size_t erasedArcsCount = 0;
+  auto generateSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&generatedArcsCount](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            ++generatedArcsCount;
+          });
+  auto eraseSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&erasedArcsCount](ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            ++erasedArcsCount;
+          });
+
+  ScAddr arcAddr;
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx);
+    EXPECT_TRUE(m_ctx->AreEventsPending());
+    arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+    EXPECT_TRUE(m_ctx->EraseElement(arcAddr));
+  }
+  EXPECT_FALSE(m_ctx->AreEventsPending());
+
+  ScTimer timer(kTestTimeout * 50);
+  while ((generatedArcsCount != 1u || erasedArcsCount != 1u || m_ctx->IsElement(arcAddr)) && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  EXPECT_EQ(generatedArcsCount, 1u);
+  EXPECT_EQ(erasedArcsCount, 1u);
+  EXPECT_FALSE(m_ctx->IsElement(arcAddr));
+}
+
+TEST_F(ScEventTest, PendEventsCoalescesGeneratedAndErasedConnector)
+{
+  ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+
+  std::atomic_size_t generatedArcsCount = 0;
+  std::atomic_size_t erasedArcsCount = 0;
+  auto generateSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&generatedArcsCount](ScEventAfterGenerateOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            ++generatedArcsCount;
+          });
+  auto eraseSubscription =
+      m_ctx->CreateElementaryEventSubscription<ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc>>(
+          nodeAddr,
+          [&erasedArcsCount](ScEventBeforeEraseOutgoingArc<ScType::ConstPermPosArc> const &)
+          {
+            ++erasedArcsCount;
+          });
+
+  ScAddr erasedArcAddr;
+  ScAddr arcAddr;
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx, true);
+    erasedArcAddr =
+        m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+    EXPECT_TRUE(m_ctx->EraseElement(erasedArcAddr));
+    arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, m_ctx->GenerateNode(ScType::ConstNode));
+  }
+
+  // coalesced sc-connector is erased when pending mode ends
+  EXPECT_FALSE(m_ctx->IsElement(erasedArcAddr));
+  EXPECT_TRUE(m_ctx->IsElement(arcAddr));
+
+  ScTimer timer(kTestTimeout * 50);
+  while (generatedArcsCount != 1u && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  EXPECT_EQ(generatedArcsCount, 1u);
+  EXPECT_EQ(erasedArcsCount, 0u);
+}
+
+TEST_F(ScEventTest, PendEventsOfErasedElementWithoutSubscriptions)
+{
+  ScAddr nodeAddr;
+  {
+    ScMemoryContextEventsPendingGuard guard(*m_ctx);
+    nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    EXPECT_TRUE(m_ctx->EraseElement(nodeAddr));
+  }
+
+  EXPECT_FALSE(m_ctx->IsElement(nodeAddr));
+}
+
+TEST_F(ScEventTest, PendEventsOfElementsErasedConcurrently)
+{
+  size_t const threadsCount = 4;
+  size_t const nodesCount = 100;
+
+  // erasure of each sc-node with sc-arc pends several events
+  ScAddr const targetNodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  std::vector<ScAddrVector> nodesAddrs(threadsCount);
+  for (auto & threadNodesAddrs : nodesAddrs)
+    for (size_t i = 0; i < nodesCount; ++i)
+    {
+      ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, targetNodeAddr);
+      threadNodesAddrs.push_back(nodeAddr);
+    }
+
+  {
+    // events of erasing sc-elements by different threads are interleaved in one pending events block
+    ScMemoryContextEventsPendingGuard guard(*m_ctx);
+    std::vector<std::thread> threads;
+    for (auto const & threadNodesAddrs : nodesAddrs)
+      threads.emplace_back(
+          [this, &threadNodesAddrs]()
+          {
+            for (ScAddr const & nodeAddr : threadNodesAddrs)
+              m_ctx->EraseElement(nodeAddr);
+          });
+    for (auto & thread : threads)
+      thread.join();
+  }
+
+  for (auto const & threadNodesAddrs : nodesAddrs)
+    for (ScAddr const & nodeAddr : threadNodesAddrs)
+      EXPECT_FALSE(m_ctx->IsElement(nodeAddr));
+  EXPECT_FALSE(m_ctx->CreateIterator3(ScType::ConstNode, ScType::ConstPermPosArc, targetNodeAddr)->Next());
+}
+
 TEST_F(ScEventTest, BlockEventsAndNotEmitAfter)
 {
   ScAddr const nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
@@ -1300,12 +1960,16 @@ TEST_F(ScEventTest, BlockEventsAndEmitAfter)
             isCalled = true;
           });
 
+  EXPECT_FALSE(m_ctx->AreEventsBlocking());
   m_ctx->BeginEventsBlocking();
+  EXPECT_TRUE(m_ctx->AreEventsBlocking());
+  EXPECT_FALSE(m_ctx->AreEventsPending());
 
   ScAddr nodeAddr2 = m_ctx->GenerateNode(ScType::ConstNode);
   m_ctx->GenerateConnector(ScType::ConstPermPosArc, nodeAddr, nodeAddr2);
 
   m_ctx->EndEventsBlocking();
+  EXPECT_FALSE(m_ctx->AreEventsBlocking());
 
   std::this_thread::sleep_for(std::chrono::milliseconds(10));
   EXPECT_FALSE(isCalled);
@@ -0,0 +1,190 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#include <sc-memory/sc_template_subscription.hpp>
+
+#include <sc-memory/sc_memory.hpp>
+#include <sc-memory/sc_timer.hpp>
+
+#include "event_test_utils.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace
+{
+double const kTestTimeout = 5;
+
+bool WaitFor(std::function<bool()> const & condition)
+{
+  ScTimer timer(kTestTimeout);
+  while (!condition() && !timer.IsTimeOut())
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  return condition();
+}
+}  // namespace
+
+using ScTemplateSubscriptionTest = ScEventTest;
+
+TEST_F(ScTemplateSubscriptionTest, AddedAndRemovedConstructions)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & oldInstanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, oldInstanceAddr);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc >> "_arc", ScType::VarNode >> "_instance");
+
+  std::atomic_size_t addedCount = 0;
+  std::atomic_size_t removedCount = 0;
+  ScAddr addedInstanceAddr;
+  ScAddr removedArcAddr;
+  auto subscription = m_ctx->CreateTemplateSubscription(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        addedInstanceAddr = item["_instance"];
+        ++addedCount;
+      },
+      [&](ScTemplateResultItem const & item)
+      {
+        removedArcAddr = item["_arc"];
+        ++removedCount;
+      });
+  EXPECT_EQ(subscription->GetMatchesCount(), 1u);
+
+  ScAddr const & instanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, instanceAddr);
+  EXPECT_TRUE(WaitFor(
+      [&]()
+      {
+        return addedCount == 1u;
+      }));
+  EXPECT_EQ(addedInstanceAddr, instanceAddr);
+  EXPECT_EQ(subscription->GetMatchesCount(), 2u);
+
+  // sc-connector of other type doesn't form sc-construction
+  m_ctx->GenerateConnector(ScType::ConstTempPosArc, classAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  m_ctx->EraseElement(arcAddr);
+  EXPECT_TRUE(WaitFor(
+      [&]()
+      {
+        return removedCount == 1u;
+      }));
+  EXPECT_EQ(removedArcAddr, arcAddr);
+  EXPECT_EQ(addedCount, 1u);
+  EXPECT_EQ(subscription->GetMatchesCount(), 1u);
+
+  m_ctx->EraseElement(oldInstanceAddr);
+  EXPECT_TRUE(WaitFor(
+      [&]()
+      {
+        return removedCount == 2u;
+      }));
+  EXPECT_EQ(subscription->GetMatchesCount(), 0u);
+}
+
+TEST_F(ScTemplateSubscriptionTest, CyclicConstructions)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrVector members;
+  for (size_t i = 0; i < 3; ++i)
+  {
+    members.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, members.back());
+  }
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[0], members[1]);
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[1], members[2]);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_a");
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_b");
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_c");
+  templ.Triple("_a", ScType::VarCommonArc, "_b");
+  templ.Triple("_b", ScType::VarCommonArc, "_c");
+  templ.Triple("_a", ScType::VarCommonArc >> "_ac", "_c");
+
+  std::atomic_size_t addedCount = 0;
+  std::atomic_size_t removedCount = 0;
+  auto subscription = m_ctx->CreateTemplateSubscription(
+      templ,
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_EQ(item["_a"], members[0]);
+        EXPECT_EQ(item["_b"], members[1]);
+        EXPECT_EQ(item["_c"], members[2]);
+        ++addedCount;
+      },
+      [&](ScTemplateResultItem const &)
+      {
+        ++removedCount;
+      });
+  EXPECT_EQ(subscription->GetMatchesCount(), 0u);
+
+  // the last sc-connector of triangle connects sc-elements that aren't in any sc-construction yet
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstCommonArc, members[0], members[2]);
+  EXPECT_TRUE(WaitFor(
+      [&]()
+      {
+        return addedCount == 1u;
+      }));
+  EXPECT_EQ(subscription->GetMatchesCount(), 1u);
+
+  m_ctx->EraseElement(members[1]);
+  EXPECT_TRUE(WaitFor(
+      [&]()
+      {
+        return removedCount == 1u;
+      }));
+  EXPECT_EQ(subscription->GetMatchesCount(), 0u);
+  EXPECT_TRUE(m_ctx->IsElement(arcAddr));
+}
+
+TEST_F(ScTemplateSubscriptionTest, TemplateWithoutFixedElements)
+{
+  ScTemplate templ;
+  EXPECT_THROW(
+      m_ctx->CreateTemplateSubscription(templ, [](ScTemplateResultItem const &) {}), utils::ExceptionInvalidParams);
+
+  templ.Triple(ScType::VarNode, ScType::VarPermPosArc, ScType::VarNode);
+  EXPECT_THROW(
+      m_ctx->CreateTemplateSubscription(templ, [](ScTemplateResultItem const &) {}), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScTemplateSubscriptionTest, ConstructionsGeneratedWhileSubscribing)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_instance");
+  templ.Triple("_instance", ScType::VarCommonArc, ScType::VarNode);
+
+  size_t const constructionsCount = 500;
+  std::thread generator(
+      [&]()
+      {
+        ScMemoryContext context;
+        for (size_t i = 0; i < constructionsCount; ++i)
+        {
+          ScAddr const & instanceAddr = context.GenerateNode(ScType::ConstNode);
+          context.GenerateConnector(ScType::ConstPermPosArc, classAddr, instanceAddr);
+          context.GenerateConnector(ScType::ConstCommonArc, instanceAddr, context.GenerateNode(ScType::ConstNode));
+        }
+      });
+
+  // sc-constructions generated during subscribing are found by search or by sc-events, and only once
+  auto subscription = m_ctx->CreateTemplateSubscription(templ, [](ScTemplateResultItem const &) {});
+  generator.join();
+
+  EXPECT_TRUE(WaitFor(
+      [&]()
+      {
+        return subscription->GetMatchesCount() == constructionsCount;
+      }));
+  EXPECT_EQ(subscription->GetMatchesCount(), constructionsCount);
+}
@@ -6,6 +6,7 @@
 
 #include <sc-memory/sc_memory.hpp>
 #include <sc-memory/sc_structure.hpp>
+#include <sc-memory/sc_timer.hpp>
 
 #include "template_test_utils.hpp"
 
@@ -150,3 +151,198 @@ TEST_F(ScTemplateBuildTest, GenWithParams)
 
   EXPECT_FALSE(searchResult[0].Has(ScAddr::Empty));
 }
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromStructure)
+{
+  ScMemory::ClearTemplatesCache();
+
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & varAddr = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::VarPermPosArc, classAddr, varAddr);
+
+  ScAddr const & structAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  ScStructure structure = m_ctx->ConvertToStructure(structAddr);
+  structure << classAddr << varAddr << arcAddr;
+
+  ScAddr const & instanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, instanceAddr);
+
+  ScTemplate templ;
+  m_ctx->BuildCachedTemplate(templ, structAddr);
+  EXPECT_EQ(templ.Size(), 1u);
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result[0][varAddr], instanceAddr);
+
+  // the second build takes triples from cache and applies params to them
+  ScAddr const & otherInstanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScTemplateParams params;
+  params.Add(varAddr, otherInstanceAddr);
+  ScTemplate templWithParams;
+  m_ctx->BuildCachedTemplate(templWithParams, structAddr, params);
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+  EXPECT_FALSE(m_ctx->SearchByTemplate(templWithParams, result));
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, otherInstanceAddr);
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templWithParams, result));
+  EXPECT_EQ(result[0][varAddr], otherInstanceAddr);
+
+  // changes of sc-template structure are seen by builds after their sc-events are processed
+  auto const & buildChangedTemplate = [this, &structAddr](ScTemplate & templ, size_t size)
+  {
+    ScTimer timer(5);
+    do
+    {
+      templ.Clear();
+      m_ctx->BuildCachedTemplate(templ, structAddr);
+    } while (templ.Size() != size && !timer.IsTimeOut());
+  };
+
+  ScAddr const & otherVarAddr = m_ctx->GenerateNode(ScType::VarNode);
+  ScAddr const & otherArcAddr = m_ctx->GenerateConnector(ScType::VarCommonArc, varAddr, otherVarAddr);
+  structure << otherVarAddr << otherArcAddr;
+
+  ScTemplate changedTempl;
+  buildChangedTemplate(changedTempl, 2u);
+  EXPECT_EQ(changedTempl.Size(), 2u);
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+
+  structure >> otherArcAddr;
+  ScTemplate reducedTempl;
+  buildChangedTemplate(reducedTempl, 1u);
+  EXPECT_EQ(reducedTempl.Size(), 1u);
+
+  // changed sc-type of sc-element of sc-template structure has no sc-event, so cache is cleared to see it
+  EXPECT_TRUE(m_ctx->SetElementSubtype(varAddr, ScType::VarNodeClass));
+  ScMemory::ClearTemplatesCache();
+  ScTemplate retypedTempl;
+  m_ctx->BuildCachedTemplate(retypedTempl, structAddr);
+  EXPECT_FALSE(m_ctx->SearchByTemplate(retypedTempl, result));
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+
+  // erased sc-template structure isn't built from cache
+  m_ctx->EraseElement(structAddr);
+  ScTemplate erasedTempl;
+  try
+  {
+    m_ctx->BuildCachedTemplate(erasedTempl, structAddr);
+  }
+  catch (utils::ScException const &)
+  {
+  }
+  EXPECT_TRUE(erasedTempl.IsEmpty());
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 0u);
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateFromScs)
+{
+  ScMemory::ClearTemplatesCache();
+
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->SetElementSystemIdentifier("cached_template_class", classAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  std::string const scsTemplate = "cached_template_class _-> _instance;;";
+  for (size_t i = 0; i < 3; ++i)
+  {
+    ScTemplate templ;
+    m_ctx->BuildCachedTemplate(templ, scsTemplate);
+    EXPECT_EQ(templ.Size(), 1u);
+
+    ScTemplateSearchResult result;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+    EXPECT_EQ(result.Size(), 1u);
+  }
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+
+  ScTemplate templ;
+  EXPECT_THROW(
+      m_ctx->BuildCachedTemplate(templ, "unknown_cached_template_class _-> _instance;;"), utils::ExceptionInvalidState);
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+
+  // reassigned system identifier is seen by builds after its sc-events are processed
+  ScSystemIdentifierQuintuple quintuple;
+  EXPECT_TRUE(m_ctx->SearchElementBySystemIdentifier("cached_template_class", quintuple));
+  m_ctx->EraseElement(quintuple.addr3);
+  ScAddr const & otherClassAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  EXPECT_TRUE(m_ctx->SetElementSystemIdentifier("cached_template_class", otherClassAddr));
+
+  ScTimer timer(5);
+  bool isFound = true;
+  while (isFound && !timer.IsTimeOut())
+  {
+    ScTemplate reassignedTempl;
+    m_ctx->BuildCachedTemplate(reassignedTempl, scsTemplate);
+    ScTemplateSearchResult result;
+    isFound = m_ctx->SearchByTemplate(reassignedTempl, result);
+  }
+  EXPECT_FALSE(isFound);
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+
+  // erased sc-constant is seen too
+  m_ctx->EraseElement(otherClassAddr);
+  ScTimer erasureTimer(5);
+  bool isThrown = false;
+  while (!isThrown && !erasureTimer.IsTimeOut())
+  {
+    try
+    {
+      ScTemplate erasedTempl;
+      m_ctx->BuildCachedTemplate(erasedTempl, scsTemplate);
+    }
+    catch (utils::ExceptionInvalidState const &)
+    {
+      isThrown = true;
+    }
+  }
+  EXPECT_TRUE(isThrown);
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplateByDifferentUsers)
+{
+  ScMemory::ClearTemplatesCache();
+
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  m_ctx->SetElementSystemIdentifier("cached_template_users_class", classAddr);
+
+  std::string const scsTemplate = "cached_template_users_class _-> _instance;;";
+  ScTemplate templ;
+  m_ctx->BuildCachedTemplate(templ, scsTemplate);
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1u);
+
+  // sc-templates built by one user aren't given to another one
+  TestScMemoryContext userContext{m_ctx->GenerateNode(ScType::ConstNode)};
+  ScTemplate userTempl;
+  userContext.BuildCachedTemplate(userTempl, scsTemplate);
+  EXPECT_EQ(userTempl.Size(), 1u);
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 2u);
+}
+
+TEST_F(ScTemplateBuildTest, BuildCachedTemplatesMoreThanMax)
+{
+  ScMemory::ClearTemplatesCache();
+
+  // sc.s-templates have no sc-constants, so changes of system identifiers don't invalidate them during the test
+  auto const & scsTemplate = [](size_t i)
+  {
+    return "_class _-> _instance_" + std::to_string(i) + ";;";
+  };
+
+  // the least recently used sc-templates are evicted from cache, other ones stay in it
+  size_t const templatesCount = 1100;
+  for (size_t i = 0; i < templatesCount; ++i)
+  {
+    ScTemplate templ;
+    m_ctx->BuildCachedTemplate(templ, scsTemplate(i));
+
+    ScTemplate firstTempl;
+    m_ctx->BuildCachedTemplate(firstTempl, scsTemplate(0));
+  }
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1024u);
+
+  ScTemplate templ;
+  m_ctx->BuildCachedTemplate(templ, scsTemplate(0));
+  EXPECT_EQ(ScMemory::GetCachedTemplatesCount(), 1024u);
+}
@@ -454,3 +454,112 @@ TEST_F(ScTemplateGenApiTest, GenTemplateWithNodeReplacedByArc)
 
   EXPECT_EQ(result["_addr2"], edgeAddr);
 }
+
+TEST_F(ScTemplateGenApiTest, GenTemplateBatch)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc >> "_arc", ScType::VarNode >> "_instance");
+  templ.Triple("_instance", ScType::VarCommonArc, ScType::VarNodeLink >> "_link");
+
+  ScAddrVector instances;
+  std::vector<ScTemplateParams> paramsList(10);
+  for (ScTemplateParams & params : paramsList)
+  {
+    instances.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+    params.Add("_instance", instances.back());
+  }
+
+  std::vector<ScTemplateResultItem> results;
+  m_ctx->GenerateByTemplateBatch(templ, paramsList, results);
+  ASSERT_EQ(results.size(), instances.size());
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    EXPECT_EQ(results[i]["_instance"], instances[i]);
+    EXPECT_TRUE(m_ctx->CheckConnector(classAddr, instances[i], ScType::ConstPermPosArc));
+    EXPECT_TRUE(m_ctx->CheckConnector(instances[i], results[i]["_link"], ScType::ConstCommonArc));
+  }
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(classAddr), instances.size());
+
+  m_ctx->GenerateByTemplateBatch(templ, {}, results);
+  EXPECT_TRUE(results.empty());
+}
+
+TEST_F(ScTemplateGenApiTest, GenTemplateBatchInParallel)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_instance");
+
+  std::vector<ScTemplateParams> paramsList(100);
+  ScAddrVector instances;
+  for (ScTemplateParams & params : paramsList)
+  {
+    instances.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+    params.Add("_instance", instances.back());
+  }
+
+  std::vector<ScTemplateResultItem> results;
+  m_ctx->GenerateByTemplateBatch(templ, paramsList, results, 4);
+  ASSERT_EQ(results.size(), instances.size());
+
+  for (size_t i = 0; i < results.size(); ++i)
+  {
+    EXPECT_EQ(results[i]["_instance"], instances[i]);
+    EXPECT_TRUE(m_ctx->CheckConnector(classAddr, instances[i], ScType::ConstPermPosArc));
+  }
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(classAddr), instances.size());
+
+  EXPECT_THROW(m_ctx->GenerateByTemplateBatch(templ, paramsList, results, 0), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScTemplateGenApiTest, GenTemplateBatchWithInvalidParams)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_instance");
+
+  std::vector<ScTemplateParams> paramsList(3);
+  paramsList[0].Add("_instance", m_ctx->GenerateNode(ScType::ConstNode));
+  paramsList[1].Add("_instance", m_ctx->GenerateNode(ScType::ConstNode));
+  paramsList[2].Add("_other_instance", m_ctx->GenerateNode(ScType::ConstNode));
+
+  std::vector<ScTemplateResultItem> results;
+  EXPECT_THROW(m_ctx->GenerateByTemplateBatch(templ, paramsList, results), utils::ExceptionInvalidParams);
+
+  // parameters are checked before generation, so no sc-constructions are generated
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(classAddr), 0u);
+}
+
+TEST_F(ScTemplateGenApiTest, GenTemplateBatchFailedAfterPartOfGeneration)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & arcAddr =
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  // sc-arc as source of triple can't be generated, so generation fails only for parameters without it
+  ScTemplate templ;
+  templ.Triple(ScType::VarPermPosArc >> "_arc", ScType::VarPermPosArc, ScType::VarNode >> "_instance");
+
+  std::vector<ScTemplateParams> paramsList(4);
+  for (size_t i = 0; i < paramsList.size(); ++i)
+  {
+    if (i != 2)
+      paramsList[i].Add("_arc", arcAddr);
+    paramsList[i].Add("_instance", m_ctx->GenerateNode(ScType::ConstNode));
+  }
+
+  std::vector<ScTemplateResultItem> results;
+  EXPECT_THROW(m_ctx->GenerateByTemplateBatch(templ, paramsList, results), utils::ExceptionInvalidParams);
+  EXPECT_TRUE(results.empty());
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(arcAddr), 0u);
+
+  // the first worker generates its sc-constructions successfully, but they are erased because the second one fails
+  EXPECT_THROW(m_ctx->GenerateByTemplateBatch(templ, paramsList, results, 2), utils::ExceptionInvalidParams);
+  EXPECT_TRUE(results.empty());
+  EXPECT_EQ(m_ctx->GetElementEdgesAndOutgoingArcsCount(arcAddr), 0u);
+}
@@ -475,3 +475,207 @@ TEST_F(ScTemplateSearchTest, StructureElements)
   EXPECT_EQ(searchResult[0]["_target"], targetAddr);
   EXPECT_EQ(searchResult[0]["_relation"], relationAddr);
 }
+
+TEST_F(ScTemplateSearchTest, CyclicTriangles)
+{
+  /**
+   *   class -> n0; n1; n2; n3;;
+   *   ni => nj, for each i < j;;
+   *
+   *  Each triple of class members ni, nj, nk (i < j < k) is a triangle
+   */
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrVector members;
+  for (size_t i = 0; i < 4; ++i)
+  {
+    ScAddr const & memberAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, memberAddr);
+    members.push_back(memberAddr);
+  }
+  for (size_t i = 0; i < members.size(); ++i)
+  {
+    for (size_t j = i + 1; j < members.size(); ++j)
+      m_ctx->GenerateConnector(ScType::ConstCommonArc, members[i], members[j]);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_a");
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_b");
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_c");
+  templ.Triple("_a", ScType::VarCommonArc >> "_ab", "_b");
+  templ.Triple("_b", ScType::VarCommonArc, "_c");
+  templ.Triple("_a", ScType::VarCommonArc, "_c");
+
+  ScTemplateSearchResult searchResult;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  EXPECT_EQ(searchResult.Size(), 4u);
+
+  searchResult.ForEach(
+      [&](ScTemplateResultItem const & item)
+      {
+        EXPECT_TRUE(m_ctx->CheckConnector(item["_a"], item["_b"], ScType::ConstCommonArc));
+        EXPECT_TRUE(m_ctx->CheckConnector(item["_b"], item["_c"], ScType::ConstCommonArc));
+        EXPECT_TRUE(m_ctx->CheckConnector(item["_a"], item["_c"], ScType::ConstCommonArc));
+
+        auto const [sourceAddr, targetAddr] = m_ctx->GetConnectorIncidentElements(item["_ab"]);
+        EXPECT_EQ(sourceAddr, item["_a"]);
+        EXPECT_EQ(targetAddr, item["_b"]);
+      });
+
+  // parallel arc gives one more triangle for each triangle it belongs to
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[0], members[1]);
+
+  searchResult.Clear();
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult));
+  EXPECT_EQ(searchResult.Size(), 6u);
+
+  size_t count = 0;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&](ScTemplateResultItem const &)
+      {
+        ++count;
+      });
+  EXPECT_EQ(count, 6u);
+}
+
+TEST_F(ScTemplateSearchTest, Profile)
+{
+  /**
+   *   class -> a; b; c;;
+   *   a => d;;
+   */
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrVector members;
+  for (size_t i = 0; i < 3; ++i)
+  {
+    members.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, members.back());
+  }
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[0], m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_x");
+  templ.Triple("_x", ScType::VarCommonArc, ScType::VarNode >> "_y");
+
+  ScTemplateSearchResult searchResult;
+  ScTemplateSearchProfile profile;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult, profile));
+  EXPECT_EQ(searchResult.Size(), 1u);
+  EXPECT_EQ(searchResult[0]["_x"], members[0]);
+
+  EXPECT_FALSE(profile.m_isJoined);
+  EXPECT_EQ(profile.m_executionOrder, std::vector<size_t>({0, 1}));
+  ASSERT_EQ(profile.m_triples.size(), 2u);
+
+  EXPECT_EQ(profile.m_triples[0].m_tripleIdx, 0u);
+  EXPECT_EQ(profile.m_triples[0].m_iteratorsCount, 1u);
+  EXPECT_EQ(profile.m_triples[0].m_visitedCandidatesCount, 3u);
+  EXPECT_EQ(profile.m_triples[0].m_rejectedByBindingCount, 0u);
+  EXPECT_EQ(profile.m_triples[0].m_rejectedByUsedConnectorCount, 0u);
+  EXPECT_EQ(profile.m_triples[0].m_rejectedByStructureCount, 0u);
+
+  // the second triple is iterated for each class member
+  EXPECT_EQ(profile.m_triples[1].m_tripleIdx, 1u);
+  EXPECT_EQ(profile.m_triples[1].m_iteratorsCount, 3u);
+  EXPECT_EQ(profile.m_triples[1].m_visitedCandidatesCount, 1u);
+  EXPECT_EQ(profile.m_triples[1].m_rejectedByBindingCount, 0u);
+  EXPECT_EQ(profile.m_triples[1].m_rejectedByUsedConnectorCount, 0u);
+  EXPECT_EQ(profile.m_triples[1].m_rejectedByStructureCount, 0u);
+
+  EXPECT_GE(profile.m_duration, profile.m_triples[0].m_duration + profile.m_triples[1].m_duration);
+
+  std::string const & profileJSON = profile.ToJSON();
+  EXPECT_NE(profileJSON.find(R"("algorithm":"dependence")"), std::string::npos);
+  EXPECT_NE(profileJSON.find(R"("order":[0,1])"), std::string::npos);
+
+  // profile is cleared before the next search
+  searchResult.Clear();
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult, profile));
+  EXPECT_EQ(profile.m_executionOrder.size(), 2u);
+  EXPECT_EQ(profile.m_triples[0].m_iteratorsCount, 1u);
+}
+
+TEST_F(ScTemplateSearchTest, ProfileEqualTriples)
+{
+  /**
+   *   class -> a; b; c;;
+   *   a => d;;
+   */
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrVector members;
+  for (size_t i = 0; i < 3; ++i)
+  {
+    members.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, members.back());
+  }
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[0], m_ctx->GenerateNode(ScType::ConstNode));
+
+  // the first two triples are equal, so candidates of both of them are visited by one sc-iterator
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_x");
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_z");
+  templ.Triple("_x", ScType::VarCommonArc, ScType::VarNode >> "_y");
+
+  ScTemplateSearchResult searchResult;
+  ScTemplateSearchProfile profile;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult, profile));
+  for (size_t i = 0; i < searchResult.Size(); ++i)
+    EXPECT_EQ(searchResult[i]["_x"], members[0]);
+
+  EXPECT_FALSE(profile.m_isJoined);
+  ASSERT_EQ(profile.m_triples.size(), 3u);
+
+  // candidates are counted by triples which sc-iterators returned them
+  for (ScTemplateSearchProfile::TripleProfile const & tripleProfile : profile.m_triples)
+  {
+    if (tripleProfile.m_iteratorsCount > 0)
+      continue;
+
+    EXPECT_EQ(tripleProfile.m_visitedCandidatesCount, 0u);
+    EXPECT_EQ(tripleProfile.m_rejectedByBindingCount, 0u);
+    EXPECT_EQ(tripleProfile.m_rejectedByUsedConnectorCount, 0u);
+    EXPECT_EQ(tripleProfile.m_rejectedByStructureCount, 0u);
+  }
+}
+
+TEST_F(ScTemplateSearchTest, ProfileCyclicTemplate)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrVector members;
+  for (size_t i = 0; i < 3; ++i)
+  {
+    members.push_back(m_ctx->GenerateNode(ScType::ConstNode));
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, members.back());
+  }
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[0], members[1]);
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[1], members[2]);
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, members[0], members[2]);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_a");
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_b");
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_c");
+  templ.Triple("_a", ScType::VarCommonArc, "_b");
+  templ.Triple("_b", ScType::VarCommonArc, "_c");
+  templ.Triple("_a", ScType::VarCommonArc, "_c");
+
+  ScTemplateSearchResult searchResult;
+  ScTemplateSearchProfile profile;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, searchResult, profile));
+  EXPECT_EQ(searchResult.Size(), 1u);
+
+  EXPECT_TRUE(profile.m_isJoined);
+  ASSERT_EQ(profile.m_triples.size(), 6u);
+
+  std::vector<size_t> executionOrder = profile.m_executionOrder;
+  std::sort(executionOrder.begin(), executionOrder.end());
+  EXPECT_EQ(executionOrder, std::vector<size_t>({0, 1, 2, 3, 4, 5}));
+
+  size_t iteratorsCount = 0;
+  for (ScTemplateSearchProfile::TripleProfile const & tripleProfile : profile.m_triples)
+    iteratorsCount += tripleProfile.m_iteratorsCount;
+  EXPECT_GT(iteratorsCount, 0u);
+
+  EXPECT_NE(profile.ToJSON().find(R"("algorithm":"join")"), std::string::npos);
+}
@@ -456,3 +456,155 @@ TEST_F(ScTemplateSearchApiTest, SearchTemplateWithConstantTriple)
   for (ScAddr const & addr : result[0])
     EXPECT_TRUE(m_ctx->IsElement(addr));
 }
+
+TEST_F(ScTemplateSearchApiTest, SearchByTemplateInStructure)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & structureAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+
+  ScAddr const & nodeAddr1 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr1 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr1);
+  ScAddr const & nodeAddr2 = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr2 = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr2);
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, classAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, nodeAddr1);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, arcAddr1);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, nodeAddr2);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc >> "_arc", ScType::VarNode >> "_node");
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  EXPECT_EQ(result.Size(), 2u);
+
+  EXPECT_TRUE(m_ctx->SearchByTemplateInStructure(templ, structureAddr, result));
+  EXPECT_EQ(result.Size(), 1u);
+  EXPECT_EQ(result[0]["_arc"], arcAddr1);
+  EXPECT_EQ(result[0]["_node"], nodeAddr1);
+
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, arcAddr2);
+  EXPECT_TRUE(m_ctx->SearchByTemplateInStructure(templ, structureAddr, result));
+  EXPECT_EQ(result.Size(), 2u);
+
+  EXPECT_THROW(m_ctx->SearchByTemplateInStructure(templ, ScAddr::Empty, result), utils::ExceptionInvalidParams);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchByTemplateInStructureWithDifferentSizes)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddr const & structureAddr = m_ctx->GenerateNode(ScType::ConstNodeStructure);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, classAddr);
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc >> "_arc", ScType::VarNode >> "_node");
+
+  // few candidates in large sc-structure are checked one by one
+  for (size_t i = 0; i < 100; ++i)
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, m_ctx->GenerateNode(ScType::ConstNode));
+
+  ScAddr const & nodeAddr = m_ctx->GenerateNode(ScType::ConstNode);
+  ScAddr const & arcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, nodeAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, nodeAddr);
+  m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, arcAddr);
+
+  ScTemplateSearchResult result;
+  EXPECT_TRUE(m_ctx->SearchByTemplateInStructure(templ, structureAddr, result));
+  EXPECT_EQ(result.Size(), 1u);
+  EXPECT_EQ(result[0]["_node"], nodeAddr);
+
+  // many candidates make search collect sc-elements of sc-structure, it gives the same results
+  size_t const instancesCount = 200;
+  for (size_t i = 0; i < instancesCount; ++i)
+  {
+    ScAddr const & instanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    ScAddr const & instanceArcAddr = m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, instanceAddr);
+    if (i % 2 == 0)
+    {
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, instanceAddr);
+      m_ctx->GenerateConnector(ScType::ConstPermPosArc, structureAddr, instanceArcAddr);
+    }
+  }
+
+  EXPECT_TRUE(m_ctx->SearchByTemplateInStructure(templ, structureAddr, result));
+  EXPECT_EQ(result.Size(), 1u + instancesCount / 2);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchResultItemsOutliveSearchResult)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrUnorderedSet instances;
+  for (size_t i = 0; i < 1000; ++i)
+  {
+    ScAddr const & instanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, instanceAddr);
+    instances.insert(instanceAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc, ScType::VarNode >> "_instance");
+
+  std::vector<ScTemplateResultItem> items;
+  {
+    ScTemplateSearchResult result;
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+    EXPECT_EQ(result.Size(), instances.size());
+
+    ScAddrUnorderedSet foundInstances;
+    result.ForEach(
+        [&foundInstances](ScTemplateResultItem const & item)
+        {
+          EXPECT_EQ(item.Size(), 3u);
+          foundInstances.insert(item["_instance"]);
+        });
+    EXPECT_EQ(foundInstances, instances);
+
+    for (size_t i = 0; i < result.Size(); ++i)
+      items.push_back(result[i]);
+
+    // next search doesn't change items of previous one
+    EXPECT_TRUE(m_ctx->SearchByTemplate(templ, result));
+  }
+
+  ScAddrUnorderedSet foundInstances;
+  for (ScTemplateResultItem const & item : items)
+  {
+    EXPECT_EQ(item[0], classAddr);
+    foundInstances.insert(item["_instance"]);
+  }
+  EXPECT_EQ(foundInstances, instances);
+}
+
+TEST_F(ScTemplateSearchApiTest, SearchWithCallbackCopiesResultItems)
+{
+  ScAddr const & classAddr = m_ctx->GenerateNode(ScType::ConstNodeClass);
+  ScAddrUnorderedSet instances;
+  for (size_t i = 0; i < 100; ++i)
+  {
+    ScAddr const & instanceAddr = m_ctx->GenerateNode(ScType::ConstNode);
+    m_ctx->GenerateConnector(ScType::ConstPermPosArc, classAddr, instanceAddr);
+    instances.insert(instanceAddr);
+  }
+
+  ScTemplate templ;
+  templ.Triple(classAddr, ScType::VarPermPosArc >> "_arc", ScType::VarNode >> "_instance");
+
+  // items passed to callback are views of search buffer, but their copies own found sc-addresses
+  std::vector<ScTemplateResultItem> items;
+  m_ctx->SearchByTemplate(
+      templ,
+      [&items](ScTemplateResultItem const & item)
+      {
+        items.push_back(item);
+      });
+  EXPECT_EQ(items.size(), instances.size());
+
+  ScAddrUnorderedSet foundInstances;
+  for (ScTemplateResultItem const & item : items)
+  {
+    EXPECT_EQ(m_ctx->GetArcTargetElement(item["_arc"]), item["_instance"]);
+    foundInstances.insert(item["_instance"]);
+  }
+  EXPECT_EQ(foundInstances, instances);
+}
@@ -167,6 +167,13 @@ sc_memory_params ScMemoryConfig::GetParams()
       GetBoolByKey("limit_max_threads_by_max_physical_cores", DEFAULT_LIMIT_MAX_THREADS_BY_MAX_PHYSICAL_CORES);
   m_memoryParams.max_events_and_agents_threads =
       GetIntByKey("max_events_and_agents_threads", DEFAULT_MAX_EVENTS_AND_AGENTS_THREADS);
+  m_memoryParams.min_events_and_agents_threads =
+      GetIntByKey("min_events_and_agents_threads", DEFAULT_MIN_EVENTS_AND_AGENTS_THREADS);
+  m_memoryParams.adaptive_events_and_agents_threads =
+      GetBoolByKey("adaptive_events_and_agents_threads", DEFAULT_ADAPTIVE_EVENTS_AND_AGENTS_THREADS);
+  m_memoryParams.max_events_queue_size = GetIntByKey("max_events_queue_size", DEFAULT_MAX_EVENTS_QUEUE_SIZE);
+  m_memoryParams.events_queue_overflow_policy =
+      GetStringByKey("events_queue_overflow_policy", DEFAULT_EVENTS_QUEUE_OVERFLOW_POLICY);
 
   m_memoryParams.dump_memory = GetBoolByKey("dump_memory", DEFAULT_DUMP_MEMORY);
   if (HasKey("save_period"))
@@ -0,0 +1,46 @@
+/*
+ * This source file is part of an OSTIS project. For the latest info, see http://ostis.net
+ * Distributed under the MIT License
+ * (See accompanying file COPYING.MIT or copy at http://opensource.org/licenses/MIT)
+ */
+
+#pragma once
+
+#include "sc_memory_json_action.hpp"
+
+#include <sc-memory/sc_agent_context.hpp>
+
+class ScMemoryAgentsStatisticsJsonAction : public ScMemoryJsonAction
+{
+public:
+  ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload, ScMemoryJsonPayload &) override
+  {
+    ScMemoryJsonPayload responsePayload = ScMemoryJsonPayload::array();
+
+    for (ScAgentExecutionStatistics const & statistics : context->GetAgentsExecutionStatistics())
+    {
+      ScMemoryContext::ScLatencyStatistics const & programDuration = statistics.m_programDuration;
+      responsePayload.push_back({
+          {"agent_class", statistics.m_agentClassName},
+          {"agent_implementation", statistics.m_agentImplementationAddr.Hash()},
+          {"invocations", statistics.m_invocationsNum},
+          {"deactivations", statistics.m_deactivationsNum},
+          {"initiation_condition_rejections", statistics.m_initiationConditionRejectionsNum},
+          {"successful_results", statistics.m_successfulResultsNum},
+          {"unsuccessful_results", statistics.m_unsuccessfulResultsNum},
+          {"error_results", statistics.m_errorResultsNum},
+          {"suspended_results", statistics.m_suspendedResultsNum},
+          {"memoized_results", statistics.m_memoizedResultsNum},
+          {"program_duration",
+           {{"num", programDuration.m_num},
+            {"p50", programDuration.m_p50},
+            {"p90", programDuration.m_p90},
+            {"p99", programDuration.m_p99},
+            {"max", programDuration.m_max}}},
+          {"program_waiting_time", statistics.m_programWaitingTime},
+      });
+    }
+
+    return responsePayload;
+  }
+};
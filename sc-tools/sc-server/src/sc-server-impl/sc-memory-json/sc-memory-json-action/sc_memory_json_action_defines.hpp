@@ -8,6 +8,7 @@
 
 #include "sc-server-impl/sc-memory-json/sc_memory_json_payload.hpp"
 #include "sc_memory_connection_info_json_action.hpp"
+#include "sc_memory_agents_statistics_json_action.hpp"
 #include "sc_memory_check_elements_json_action.hpp"
 #include "sc_memory_generate_elements_json_action.hpp"
 #include "sc_memory_generate_elements_by_scs_json_action.hpp"
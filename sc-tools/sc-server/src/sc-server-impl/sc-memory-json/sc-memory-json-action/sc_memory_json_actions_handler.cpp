@@ -22,6 +22,7 @@ void ScMemoryJsonActionsHandler::InitializeActionClasses()
 {
   m_actions = {
       {"connection_info", new ScMemoryConnectionInfoJsonAction()},
+      {"agents_statistics", new ScMemoryAgentsStatisticsJsonAction()},
       {"keynodes", new ScMemoryHandleKeynodesJsonAction()},
       {"create_elements", new ScMemoryGenerateElementsJsonAction()},
       {"create_elements_by_scs", new ScMemoryGenerateElementsByScsJsonAction()},
@@ -14,9 +14,16 @@ public:
   ScMemoryJsonPayload Complete(ScAgentContext * context, ScMemoryJsonPayload requestPayload, ScMemoryJsonPayload &)
       override
   {
+    bool const isProfiled = requestPayload.is_object() && requestPayload.contains("profile")
+                            && requestPayload["profile"].is_boolean() && requestPayload["profile"].get<bool>();
+
     ScTemplateSearchResult result;
+    ScTemplateSearchProfile profile;
     auto const & pair = GetTemplate(context, requestPayload);
-    context->SearchByTemplate(*pair.first, result);
+    if (isProfiled)
+      context->SearchByTemplate(*pair.first, result, profile);
+    else
+      context->SearchByTemplate(*pair.first, result);
 
     std::vector<std::vector<size_t>> hashesVectors;
     for (size_t i = 0; i < result.Size(); ++i)
@@ -31,8 +38,11 @@ public:
     }
 
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_BEGIN
-    ScMemoryJsonPayload const & resultPayload = {{"aliases", result.GetReplacements()}, {"addrs", hashesVectors}};
+    ScMemoryJsonPayload resultPayload = {{"aliases", result.GetReplacements()}, {"addrs", hashesVectors}};
     SC_PRAGMA_DISABLE_DEPRECATION_WARNINGS_END
+    if (isProfiled)
+      resultPayload["profile"] = ScMemoryJsonPayload::parse(profile.ToJSON());
+
     delete pair.first;
     return resultPayload;
   }
@@ -406,6 +406,35 @@ TEST_F(ScServerTest, HandleEmptyKeynodes)
   client.Stop();
 }
 
+TEST_F(ScServerTest, GetAgentsStatistics)
+{
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  std::string const payloadString =
+      ScMemoryJsonConverter::From(0, "agents_statistics", ScMemoryJsonPayload::object({}));
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  EXPECT_TRUE(responsePayload.is_array());
+  for (auto const & agentStatistics : responsePayload)
+  {
+    EXPECT_TRUE(agentStatistics["agent_class"].is_string());
+    EXPECT_TRUE(agentStatistics["program_duration"].is_object());
+    EXPECT_GE(
+        agentStatistics["invocations"].get<sc_uint64>(),
+        agentStatistics["initiation_condition_rejections"].get<sc_uint64>());
+  }
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, HandleContent)
 {
   ScClient client;
@@ -1467,6 +1496,42 @@ TEST_F(ScServerTest, SearchStringTemplate)
   client.Stop();
 }
 
+TEST_F(ScServerTest, SearchStringTemplateWithProfile)
+{
+  ScAddr const & addr1 = m_ctx->ResolveElementSystemIdentifier("node1", ScType::ConstNode);
+  ScAddr const & addr2 = m_ctx->ResolveElementSystemIdentifier("node2", ScType::ConstNode);
+  m_ctx->GenerateConnector(ScType::ConstCommonArc, addr1, addr2);
+
+  ScClient client;
+  EXPECT_TRUE(client.Connect(m_server->GetUri()));
+  client.Run();
+
+  ScMemoryJsonPayload payload;
+  payload["templ"] = "node1 _=> _node2;;";
+  payload["profile"] = true;
+  std::string const payloadString = ScMemoryJsonConverter::From(0, "search_template", payload);
+  EXPECT_TRUE(client.Send(payloadString));
+
+  auto const response = client.GetResponseMessage();
+  EXPECT_FALSE(response.is_null());
+  auto const & responsePayload = response["payload"];
+  EXPECT_FALSE(responsePayload.is_null());
+  EXPECT_TRUE(response["status"].get<sc_bool>());
+  EXPECT_TRUE(response["errors"].empty());
+
+  auto const & addrs = responsePayload["addrs"][0].get<std::vector<size_t>>();
+  EXPECT_TRUE(ScAddr(addrs[2]) == addr2);
+
+  auto const & profile = responsePayload["profile"];
+  EXPECT_EQ(profile["algorithm"].get<std::string>(), "dependence");
+  EXPECT_EQ(profile["order"].get<std::vector<size_t>>(), std::vector<size_t>({0}));
+  EXPECT_EQ(profile["triples"].size(), 1u);
+  EXPECT_EQ(profile["triples"][0]["iterators"].get<size_t>(), 1u);
+  EXPECT_EQ(profile["triples"][0]["visited"].get<size_t>(), 1u);
+
+  client.Stop();
+}
+
 TEST_F(ScServerTest, SearchTemplateByIdtf)
 {
   LoadKB(m_ctx, {"templates.scs", "user.scs"});